@@ -30,20 +30,24 @@
 #include "hipblas_data.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
+#include "hipblas_trace.hpp"
 #include "test_cleanup.hpp"
 #include "type_dispatch.hpp"
 #include "utility.h"
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 typedef int hipblas_int;
@@ -54,9 +58,460 @@ int hipblas_bench_datafile()
     for(Arguments arg : HipBLAS_TestData())
         ret |= run_bench_test(arg, 0, 1);
     test_cleanup::cleanup();
+
+    // Tests from a HIPBLAS_LAYER profile carry a call_count; report the
+    // total time of the profiled workload with each shape weighted by it
+    if(ArgumentModel_get_weighted_call_count())
+        std::cout << "\nweighted total over " << ArgumentModel_get_weighted_call_count()
+                  << " calls, hipblas-us: " << ArgumentModel_get_weighted_time_us() << std::endl;
     return ret;
 }
 
+// Replay of a binary call trace recorded with HIPBLAS_LAYER=8. Handles, streams
+// and buffers are recreated from the identities in the trace, so calls that
+// shared memory or a stream in the application still do so in the replay.
+struct replay_buffer
+{
+    size_t bytes        = 0; // whole allocation, or one member of a pointer array
+    int    batch_count  = 0; // > 0 when the identity is a batched pointer array
+    char*  data         = nullptr;
+    void** device_array = nullptr;
+};
+
+static size_t replay_type_size(int32_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+static bool replay_is_complex(int32_t type)
+{
+    return type == HIPBLAS_C_16F || type == HIPBLAS_C_32F || type == HIPBLAS_C_64F
+           || type == HIPBLAS_C_16B || type == HIPBLAS_C_8I || type == HIPBLAS_C_32I;
+}
+
+// Value 1 in the scalar type, used for calls traced in device pointer mode
+static void replay_set_one(int32_t type, uint8_t* p)
+{
+    memset(p, 0, 16);
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+    case HIPBLAS_C_16F:
+        *(uint16_t*)p = 0x3c00;
+        break;
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_16B:
+        *(uint16_t*)p = 0x3f80;
+        break;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        *(float*)p = 1;
+        break;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        *(double*)p = 1;
+        break;
+    case HIPBLAS_R_32I:
+        *(int32_t*)p = 1;
+        break;
+    }
+}
+
+static bool replay_is_batched(const hipblas_trace_record& r)
+{
+    const char* f = r.function;
+    return strstr(f, "_batched") && !strstr(f, "_strided_batched");
+}
+
+// Record the size needed behind one traced pointer
+static void replay_require(std::map<uint64_t, replay_buffer>& buffers,
+                           uint64_t                           ptr,
+                           int32_t                            type,
+                           int64_t                            ld,
+                           int64_t                            cols,
+                           int64_t                            stride,
+                           int32_t                            batch_count,
+                           bool                               batched)
+{
+    if(!ptr)
+        return;
+    size_t         matrix = size_t(ld * cols) * replay_type_size(type);
+    replay_buffer& b      = buffers[ptr];
+    if(batched)
+    {
+        b.bytes       = std::max(b.bytes, matrix);
+        b.batch_count = std::max(b.batch_count, batch_count);
+    }
+    else
+    {
+        size_t stride_bytes = size_t(stride) * replay_type_size(type);
+        b.bytes = std::max(b.bytes, matrix + stride_bytes * std::max(batch_count - 1, 0));
+    }
+}
+
+template <typename T>
+static hipblasStatus_t replay_gemm(hipblasHandle_t             handle,
+                                   const hipblas_trace_record& r,
+                                   const void*                 alpha,
+                                   const void*                 beta,
+                                   void*                       A,
+                                   void*                       B,
+                                   void*                       C)
+{
+    auto transA = hipblasOperation_t(r.transA);
+    auto transB = hipblasOperation_t(r.transB);
+    if(replay_is_batched(r))
+        return hipblasGemmBatched<T>(handle,
+                                     transA,
+                                     transB,
+                                     r.m,
+                                     r.n,
+                                     r.k,
+                                     (const T*)alpha,
+                                     (const T* const*)A,
+                                     r.lda,
+                                     (const T* const*)B,
+                                     r.ldb,
+                                     (const T*)beta,
+                                     (T* const*)C,
+                                     r.ldc,
+                                     r.batch_count);
+    if(strstr(r.function, "_strided_batched"))
+        return hipblasGemmStridedBatched<T>(handle,
+                                            transA,
+                                            transB,
+                                            r.m,
+                                            r.n,
+                                            r.k,
+                                            (const T*)alpha,
+                                            (const T*)A,
+                                            r.lda,
+                                            r.stride_a,
+                                            (const T*)B,
+                                            r.ldb,
+                                            r.stride_b,
+                                            (const T*)beta,
+                                            (T*)C,
+                                            r.ldc,
+                                            r.stride_c,
+                                            r.batch_count);
+    return hipblasGemm<T>(handle,
+                          transA,
+                          transB,
+                          r.m,
+                          r.n,
+                          r.k,
+                          (const T*)alpha,
+                          (const T*)A,
+                          r.lda,
+                          (const T*)B,
+                          r.ldb,
+                          (const T*)beta,
+                          (T*)C,
+                          r.ldc);
+}
+
+static hipblasStatus_t replay_call(hipblasHandle_t             handle,
+                                   const hipblas_trace_record& r,
+                                   const void*                 alpha,
+                                   const void*                 beta,
+                                   void*                       A,
+                                   void*                       B,
+                                   void*                       C)
+{
+    auto transA       = hipblasOperation_t(r.transA);
+    auto transB       = hipblasOperation_t(r.transB);
+    auto a_type       = hipblasDatatype_t(r.a_type);
+    auto b_type       = hipblasDatatype_t(r.b_type);
+    auto c_type       = hipblasDatatype_t(r.c_type);
+    auto compute_type = hipblasDatatype_t(r.compute_type);
+
+    std::string f = r.function;
+
+    if(f == "hipblas_gemm_ex")
+        return hipblasGemmEx(handle,
+                             transA,
+                             transB,
+                             r.m,
+                             r.n,
+                             r.k,
+                             alpha,
+                             A,
+                             a_type,
+                             r.lda,
+                             B,
+                             b_type,
+                             r.ldb,
+                             beta,
+                             C,
+                             c_type,
+                             r.ldc,
+                             compute_type,
+                             HIPBLAS_GEMM_DEFAULT);
+    if(f == "hipblas_gemm_batched_ex")
+        return hipblasGemmBatchedEx(handle,
+                                    transA,
+                                    transB,
+                                    r.m,
+                                    r.n,
+                                    r.k,
+                                    alpha,
+                                    (const void**)A,
+                                    a_type,
+                                    r.lda,
+                                    (const void**)B,
+                                    b_type,
+                                    r.ldb,
+                                    beta,
+                                    (void**)C,
+                                    c_type,
+                                    r.ldc,
+                                    r.batch_count,
+                                    compute_type,
+                                    HIPBLAS_GEMM_DEFAULT);
+    if(f == "hipblas_gemm_strided_batched_ex")
+        return hipblasGemmStridedBatchedEx(handle,
+                                           transA,
+                                           transB,
+                                           r.m,
+                                           r.n,
+                                           r.k,
+                                           alpha,
+                                           A,
+                                           a_type,
+                                           r.lda,
+                                           r.stride_a,
+                                           B,
+                                           b_type,
+                                           r.ldb,
+                                           r.stride_b,
+                                           beta,
+                                           C,
+                                           c_type,
+                                           r.ldc,
+                                           r.stride_c,
+                                           r.batch_count,
+                                           compute_type,
+                                           HIPBLAS_GEMM_DEFAULT);
+
+    // typed functions are named hipblas_<precision>gemm...
+    switch(f.size() > 8 ? f[8] : 0)
+    {
+    case 'h':
+        return replay_gemm<hipblasHalf>(handle, r, alpha, beta, A, B, C);
+    case 's':
+        return replay_gemm<float>(handle, r, alpha, beta, A, B, C);
+    case 'd':
+        return replay_gemm<double>(handle, r, alpha, beta, A, B, C);
+    case 'c':
+        return replay_gemm<hipblasComplex>(handle, r, alpha, beta, A, B, C);
+    case 'z':
+        return replay_gemm<hipblasDoubleComplex>(handle, r, alpha, beta, A, B, C);
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+int hipblas_bench_replay(const std::string& path, bool recorded_rate, int cold_iters, int iters)
+{
+    std::ifstream        in(path, std::ios::binary);
+    hipblas_trace_header header{};
+    if(!in.read((char*)&header, sizeof(header))
+       || memcmp(header.magic, HIPBLAS_TRACE_MAGIC, sizeof(header.magic))
+       || header.version != HIPBLAS_TRACE_VERSION
+       || header.record_size != sizeof(hipblas_trace_record))
+    {
+        std::cerr << "Invalid or incompatible hipBLAS trace " << path << std::endl;
+        return 1;
+    }
+
+    std::vector<hipblas_trace_record> records;
+    hipblas_trace_record              r;
+    while(in.read((char*)&r, sizeof(r)))
+        records.push_back(r);
+    if(records.empty())
+        return 0;
+
+    int device_count;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+
+    // Sizes needed behind every traced pointer, then one allocation per identity
+    std::map<uint64_t, replay_buffer> buffers;
+    for(auto& t : records)
+    {
+        bool batched = replay_is_batched(t);
+        replay_require(buffers,
+                       t.A,
+                       t.a_type,
+                       t.lda,
+                       t.transA == HIPBLAS_OP_N ? t.k : t.m,
+                       t.stride_a,
+                       t.batch_count,
+                       batched);
+        replay_require(buffers,
+                       t.B,
+                       t.b_type,
+                       t.ldb,
+                       t.transB == HIPBLAS_OP_N ? t.n : t.k,
+                       t.stride_b,
+                       t.batch_count,
+                       batched);
+        replay_require(buffers,
+                       t.C,
+                       t.c_type,
+                       t.ldc,
+                       t.n,
+                       t.stride_c,
+                       t.batch_count,
+                       batched);
+    }
+
+    std::map<uint64_t, hipblasHandle_t> handles;
+    std::map<uint64_t, hipStream_t>     streams;
+    std::vector<int>                    devices;
+    for(auto& t : records)
+    {
+        int device = t.device % device_count;
+        if(std::find(devices.begin(), devices.end(), device) == devices.end())
+            devices.push_back(device);
+        CHECK_HIP_ERROR(hipSetDevice(device));
+        if(!handles.count(t.handle))
+            CHECK_HIPBLAS_ERROR(hipblasCreate(&handles[t.handle]));
+        if(t.stream && !streams.count(t.stream))
+            CHECK_HIP_ERROR(hipStreamCreate(&streams[t.stream]));
+        for(uint64_t ptr : {t.A, t.B, t.C})
+        {
+            replay_buffer& b = buffers[ptr];
+            if(!ptr || b.data)
+                continue;
+            size_t count = b.batch_count ? b.batch_count : 1;
+            CHECK_HIP_ERROR(hipMalloc(&b.data, b.bytes * count));
+            CHECK_HIP_ERROR(hipMemset(b.data, 0, b.bytes * count));
+            if(b.batch_count)
+            {
+                std::vector<void*> host_array(count);
+                for(size_t i = 0; i < count; i++)
+                    host_array[i] = b.data + i * b.bytes;
+                CHECK_HIP_ERROR(hipMalloc(&b.device_array, sizeof(void*) * count));
+                CHECK_HIP_ERROR(hipMemcpy(b.device_array,
+                                          host_array.data(),
+                                          sizeof(void*) * count,
+                                          hipMemcpyHostToDevice));
+            }
+        }
+    }
+
+    // Scalars traced in device pointer mode are replayed as device-resident ones
+    uint8_t* device_scalars;
+    CHECK_HIP_ERROR(hipMalloc(&device_scalars, 32 * records.size()));
+    for(size_t i = 0; i < records.size(); i++)
+    {
+        auto& t = records[i];
+        if(t.pointer_mode != HIPBLAS_POINTER_MODE_DEVICE)
+            continue;
+        replay_set_one(t.compute_type, t.alpha);
+        replay_set_one(t.compute_type, t.beta);
+        CHECK_HIP_ERROR(hipMemcpy(device_scalars + 32 * i, t.alpha, 16, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(device_scalars + 32 * i + 16, t.beta, 16, hipMemcpyHostToDevice));
+    }
+
+    auto operand = [&](uint64_t ptr) -> void* {
+        replay_buffer& b = buffers[ptr];
+        return b.batch_count ? (void*)b.device_array : (void*)b.data;
+    };
+
+    double gflop = 0;
+    for(auto& t : records)
+        gflop += (replay_is_complex(t.a_type) ? 8.0 : 2.0) * t.m * t.n * t.k
+                 * std::max(t.batch_count, 1) / 1e9;
+
+    auto replay_pass = [&]() -> hipblasStatus_t {
+        auto start = std::chrono::steady_clock::now();
+        for(size_t i = 0; i < records.size(); i++)
+        {
+            auto& t = records[i];
+            if(recorded_rate)
+                std::this_thread::sleep_until(
+                    start
+                    + std::chrono::microseconds(int64_t(t.time_us - records[0].time_us)));
+
+            hipblasHandle_t handle = handles[t.handle];
+            CHECK_HIP_ERROR(hipSetDevice(t.device % device_count));
+            CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, t.stream ? streams[t.stream] : 0));
+            CHECK_HIPBLAS_ERROR(
+                hipblasSetPointerMode(handle, hipblasPointerMode_t(t.pointer_mode)));
+
+            bool        device_mode = t.pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+            const void* alpha       = device_mode ? device_scalars + 32 * i : t.alpha;
+            const void* beta        = device_mode ? device_scalars + 32 * i + 16 : t.beta;
+
+            hipblasStatus_t status
+                = replay_call(handle, t, alpha, beta, operand(t.A), operand(t.B), operand(t.C));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                std::cerr << "replay of " << t.function << " returned "
+                          << hipblasStatusToString(status) << std::endl;
+        }
+        for(int device : devices)
+        {
+            CHECK_HIP_ERROR(hipSetDevice(device));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    for(int i = 0; i < cold_iters; i++)
+        CHECK_HIPBLAS_ERROR(replay_pass());
+
+    int    passes        = std::max(iters, 1);
+    double gpu_time_used = get_time_us();
+    for(int i = 0; i < passes; i++)
+        CHECK_HIPBLAS_ERROR(replay_pass());
+    gpu_time_used = get_time_us() - gpu_time_used;
+
+    std::cout << "calls,handles,streams,replay-us,calls/s,hipblas-Gflops" << std::endl;
+    std::cout << records.size() << "," << handles.size() << "," << streams.size() << ","
+              << gpu_time_used / passes << ","
+              << records.size() * passes / gpu_time_used * 1e6 << ","
+              << gflop * passes / gpu_time_used * 1e6 << std::endl;
+
+    for(auto& h : handles)
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(h.second));
+    for(auto& s : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(s.second));
+    for(auto& b : buffers)
+    {
+        CHECK_HIP_ERROR(hipFree(b.second.data));
+        CHECK_HIP_ERROR(hipFree(b.second.device_array));
+    }
+    CHECK_HIP_ERROR(hipFree(device_scalars));
+    return 0;
+}
+
 void thread_init_device(int id, const Arguments& arg)
 {
     int count;
@@ -141,6 +596,8 @@ try
     std::string d_type;
     std::string compute_type;
     std::string initialization;
+    std::string replay;
+    std::string replay_rate;
     hipblas_int device_id;
     hipblas_int parallel_devices;
 
@@ -330,6 +787,11 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("float32_mode",
+         value<hipblas_int>(&arg.float32_mode)->default_value(0),
+         "Precision of the products of f32 GEMMs: 0 = f32, 1 or 2 = TF32 where the device has it, "
+         "3 = bf16x3. Only applicable to gemm_ex routines")
+
         ("device",
          value<hipblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -338,6 +800,15 @@ try
          value<hipblas_int>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("replay",
+         value<std::string>(&replay)->default_value(""),
+         "Replay a binary call trace recorded with HIPBLAS_LAYER=8: cold_iters untimed and "
+         "iters timed passes over the whole trace")
+
+        ("replay_rate",
+         value<std::string>(&replay_rate)->default_value("max"),
+         "Issue replayed calls as fast as possible (max) or at the recorded times (recorded)")
+
         // ("c_noalias_d",
         //  bool_switch(&arg.c_noalias_d)->default_value(false),
         //  "C and D are stored in separate memory")
@@ -397,6 +868,13 @@ try
     if(datafile)
         return hipblas_bench_datafile();
 
+    if(!replay.empty())
+    {
+        if(replay_rate != "max" && replay_rate != "recorded")
+            throw std::invalid_argument("Invalid value for --replay_rate " + replay_rate);
+        return hipblas_bench_replay(replay, replay_rate == "recorded", arg.cold_iters, arg.iters);
+    }
+
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
     if(prec == HIPBLAS_DATATYPE_INVALID)
@@ -47,3 +47,22 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static double weighted_time_us    = 0;
+static size_t weighted_call_count = 0;
+
+void ArgumentModel_add_weighted_time(double us_per_call, int call_count)
+{
+    weighted_time_us += us_per_call * call_count;
+    weighted_call_count += call_count;
+}
+
+double ArgumentModel_get_weighted_time_us()
+{
+    return weighted_time_us;
+}
+
+size_t ArgumentModel_get_weighted_call_count()
+{
+    return weighted_call_count;
+}
@@ -45,8 +45,11 @@
 // aux
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_matrix_staged.hpp"
 #include "testing_set_get_vector.hpp"
 #include "testing_set_get_vector_async.hpp"
+#include "testing_set_get_vector_batched_async.hpp"
 // blas1
 #include "testing_asum.hpp"
 #include "testing_asum_batched.hpp"
@@ -75,6 +78,7 @@
 #include "testing_nrm2_ex.hpp"
 #include "testing_nrm2_strided_batched.hpp"
 #include "testing_nrm2_strided_batched_ex.hpp"
+#include "testing_reduction_async.hpp"
 #include "testing_rot.hpp"
 #include "testing_rot_batched.hpp"
 #include "testing_rot_batched_ex.hpp"
@@ -177,9 +181,38 @@
 #include "testing_gemm.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
+#include "testing_gemm_batched_ex_d.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_d.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
+#include "testing_gemm_strided_batched_ex_d.hpp"
+#include "testing_gemmt.hpp"
+#include "testing_gemmt_batched.hpp"
+#include "testing_gemmt_strided_batched.hpp"
+#include "testing_row_gemm.hpp"
+#include "testing_row_gemv.hpp"
+#include "testing_row_trsm.hpp"
+#include "testing_gepack_compact.hpp"
+#include "testing_geunpack_compact.hpp"
+#include "testing_gemm_strided_batched_vec.hpp"
+#include "testing_scal_strided_batched_vec.hpp"
+#include "testing_gemm_scaled_ex.hpp"
+#include "testing_gemm_ex_half_complex.hpp"
+#include "testing_dot_ex_half_complex.hpp"
+#include "testing_gemm_ex_float32_mode.hpp"
+#include "testing_gemm_deferred.hpp"
+#include "testing_graph.hpp"
+#include "testing_matmul_plan.hpp"
+#include "testing_gemm_managed.hpp"
+#include "testing_handle_pool.hpp"
+#include "testing_thread_stream.hpp"
+#include "testing_gemm_broadcast.hpp"
+#include "testing_symmetric_output.hpp"
+#include "testing_gemm_out_of_core.hpp"
+#include "testing_trsm_out_of_core.hpp"
+#include "testing_xt_gemm.hpp"
+#include "testing_xt_cpu_ratio.hpp"
 #include "testing_hemm.hpp"
 #include "testing_hemm_batched.hpp"
 #include "testing_hemm_strided_batched.hpp"
@@ -308,6 +341,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"nrm2_ex", testname_nrm2_ex},
         {"nrm2_batched_ex", testname_nrm2_batched_ex},
         {"nrm2_strided_batched_ex", testname_nrm2_strided_batched_ex},
+        {"reduction_async", testname_reduction_async},
         {"rot", testname_rot},
         {"rot_batched", testname_rot_batched},
         {"rot_strided_batched", testname_rot_strided_batched},
@@ -423,6 +457,9 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+        {"gemm_ex_d", testname_gemm_ex_d},
+        {"gemm_batched_ex_d", testname_gemm_batched_ex_d},
+        {"gemm_strided_batched_ex_d", testname_gemm_strided_batched_ex_d},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
@@ -447,6 +484,33 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"syrkx", testname_syrkx},
         {"syrkx_batched", testname_syrkx_batched},
         {"syrkx_strided_batched", testname_syrkx_strided_batched},
+        {"gemmt", testname_gemmt},
+        {"gemmt_batched", testname_gemmt_batched},
+        {"gemmt_strided_batched", testname_gemmt_strided_batched},
+        {"row_gemm", testname_row_gemm},
+        {"row_gemv", testname_row_gemv},
+        {"row_trsm", testname_row_trsm},
+        {"gepack_compact", testname_gepack_compact},
+        {"geunpack_compact", testname_geunpack_compact},
+        {"gemm_strided_batched_vec", testname_gemm_strided_batched_vec},
+        {"scal_strided_batched_vec", testname_scal_strided_batched_vec},
+        {"gemm_scaled_ex", testname_gemm_scaled_ex},
+        {"gemm_ex_half_complex", testname_gemm_ex_half_complex},
+        {"dot_ex_half_complex", testname_dot_ex_half_complex},
+        {"dotc_ex_half_complex", testname_dotc_ex_half_complex},
+        {"gemm_ex_float32_mode", testname_gemm_ex_float32_mode},
+        {"gemm_deferred", testname_gemm_deferred},
+        {"graph", testname_graph},
+        {"matmul_plan", testname_matmul_plan},
+        {"gemm_managed", testname_gemm_managed},
+        {"handle_pool", testname_handle_pool},
+        {"thread_stream", testname_thread_stream},
+        {"gemm_broadcast", testname_gemm_broadcast},
+        {"symmetric_output", testname_symmetric_output},
+        {"gemm_out_of_core", testname_gemm_out_of_core},
+        {"trsm_out_of_core", testname_trsm_out_of_core},
+        {"xt_gemm", testname_xt_gemm},
+        {"xt_cpu_ratio", testname_xt_cpu_ratio},
         {"trmm", testname_trmm},
         {"trmm_batched", testname_trmm_batched},
         {"trmm_strided_batched", testname_trmm_strided_batched},
@@ -483,8 +547,11 @@ void get_test_name(const Arguments& arg, std::string& name)
         // Aux
         {"set_get_vector", testname_set_get_vector},
         {"set_get_vector_async", testname_set_get_vector_async},
+        {"set_get_vector_batched_async", testname_set_get_vector_batched_async},
         {"set_get_matrix", testname_set_get_matrix},
         {"set_get_matrix_async", testname_set_get_matrix_async},
+        {"set_get_matrix_batched_async", testname_set_get_matrix_batched_async},
+        {"set_get_matrix_staged", testname_set_get_matrix_staged},
     };
 
     auto match = fmap.find(arg.function);
@@ -513,6 +580,8 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_template<Ti, Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_ex_d", testing_gemm_ex_d_template<Ti, Ti, To, Tc>},
+            {"gemm_batched_ex_d", testing_gemm_batched_ex_d_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -538,6 +607,8 @@ struct perf_gemm_strided_batched_ex<
     {
         static const func_map map = {
             {"gemm_strided_batched_ex", testing_gemm_strided_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_strided_batched_ex_d",
+             testing_gemm_strided_batched_ex_d_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -577,6 +648,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"nrm2", testing_nrm2<T>},
             {"nrm2_batched", testing_nrm2_batched<T>},
             {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+            {"reduction_async", testing_reduction_async<T>},
             {"rotg", testing_rotg<T>},
             {"rotg_batched", testing_rotg_batched<T>},
             {"rotg_strided_batched", testing_rotg_strided_batched<T>},
@@ -656,6 +728,18 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_deferred", testing_gemm_deferred<T>},
+            {"gemm_managed", testing_gemm_managed<T>},
+            {"handle_pool", testing_handle_pool<T>},
+            {"thread_stream", testing_thread_stream<T>},
+            {"gemm_broadcast", testing_gemm_broadcast<T>},
+            {"symmetric_output", testing_symmetric_output<T>},
+            {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+            {"trsm_out_of_core", testing_trsm_out_of_core<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
+            {"graph", testing_graph<T>},
+            {"matmul_plan", testing_matmul_plan<T>},
+            {"xt_cpu_ratio", testing_xt_cpu_ratio<T>},
             {"symm", testing_symm<T>},
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
@@ -671,6 +755,17 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"syrkx", testing_syrkx<T>},
             {"syrkx_batched", testing_syrkx_batched<T>},
             {"syrkx_strided_batched", testing_syrkx_strided_batched<T>},
+            {"gemmt", testing_gemmt<T>},
+            {"gemmt_batched", testing_gemmt_batched<T>},
+            {"gemmt_strided_batched", testing_gemmt_strided_batched<T>},
+            {"row_gemm", testing_row_gemm<T>},
+            {"row_gemv", testing_row_gemv<T>},
+            {"row_trsm", testing_row_trsm<T>},
+            {"gepack_compact", testing_gepack_compact<T>},
+            {"geunpack_compact", testing_geunpack_compact<T>},
+            {"gemm_strided_batched_vec", testing_gemm_strided_batched_vec<T>},
+            {"scal_strided_batched_vec", testing_scal_strided_batched_vec<T>},
+            {"gemm_scaled_ex", testing_gemm_scaled_ex_template<T>},
             {"trsm", testing_trsm<T>},
             {"trsm_ex", testing_trsm_ex<T>},
             {"trsm_batched", testing_trsm_batched<T>},
@@ -701,8 +796,11 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             // Aux
             {"set_get_vector", testing_set_get_vector<T>},
             {"set_get_vector_async", testing_set_get_vector_async<T>},
+            {"set_get_vector_batched_async", testing_set_get_vector_batched_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
             {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+            {"set_get_matrix_batched_async", testing_set_get_matrix_batched_async<T>},
+            {"set_get_matrix_staged", testing_set_get_matrix_staged<T>},
         };
         run_function(fmap, arg);
     }
@@ -778,6 +876,7 @@ struct perf_blas<
             {"nrm2", testing_nrm2<T>},
             {"nrm2_batched", testing_nrm2_batched<T>},
             {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+            {"reduction_async", testing_reduction_async<T>},
             {"rotg", testing_rotg<T>},
             {"rotg_batched", testing_rotg_batched<T>},
             {"rotg_strided_batched", testing_rotg_strided_batched<T>},
@@ -863,6 +962,15 @@ struct perf_blas<
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_deferred", testing_gemm_deferred<T>},
+            {"gemm_managed", testing_gemm_managed<T>},
+            {"handle_pool", testing_handle_pool<T>},
+            {"thread_stream", testing_thread_stream<T>},
+            {"gemm_broadcast", testing_gemm_broadcast<T>},
+            {"symmetric_output", testing_symmetric_output<T>},
+            {"gemm_out_of_core", testing_gemm_out_of_core<T>},
+            {"trsm_out_of_core", testing_trsm_out_of_core<T>},
+            {"xt_gemm", testing_xt_gemm<T>},
             {"hemm", testing_hemm<T>},
             {"hemm_batched", testing_hemm_batched<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched<T>},
@@ -890,6 +998,17 @@ struct perf_blas<
             {"syrkx", testing_syrkx<T>},
             {"syrkx_batched", testing_syrkx_batched<T>},
             {"syrkx_strided_batched", testing_syrkx_strided_batched<T>},
+            {"gemmt", testing_gemmt<T>},
+            {"gemmt_batched", testing_gemmt_batched<T>},
+            {"gemmt_strided_batched", testing_gemmt_strided_batched<T>},
+            {"row_gemm", testing_row_gemm<T>},
+            {"row_gemv", testing_row_gemv<T>},
+            {"row_trsm", testing_row_trsm<T>},
+            {"gepack_compact", testing_gepack_compact<T>},
+            {"geunpack_compact", testing_geunpack_compact<T>},
+            {"gemm_strided_batched_vec", testing_gemm_strided_batched_vec<T>},
+            {"scal_strided_batched_vec", testing_scal_strided_batched_vec<T>},
+            {"gemm_scaled_ex", testing_gemm_scaled_ex_template<T>},
             {"trsm", testing_trsm<T>},
             {"trsm_batched", testing_trsm_batched<T>},
             {"trsm_strided_batched", testing_trsm_strided_batched<T>},
@@ -1264,7 +1383,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_ex_d") || !strcmp(function, "gemm_batched_ex_d"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1294,7 +1414,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
         hipblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
-    else if(!strcmp(function, "gemm_strided_batched_ex"))
+    else if(!strcmp(function, "gemm_strided_batched_ex")
+            || !strcmp(function, "gemm_strided_batched_ex_d"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1358,6 +1479,15 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+        // complex half has no type in the dispatch tables, its testers pick the types themselves
+        else if(!strcmp(function, "gemm_ex_half_complex"))
+            testing_gemm_ex_half_complex(arg);
+        else if(!strcmp(function, "dot_ex_half_complex"))
+            testing_dot_ex_half_complex(arg);
+        else if(!strcmp(function, "dotc_ex_half_complex"))
+            testing_dotc_ex_half_complex(arg);
+        else if(!strcmp(function, "gemm_ex_float32_mode"))
+            testing_gemm_ex_float32_mode(arg);
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
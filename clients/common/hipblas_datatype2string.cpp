@@ -128,6 +128,10 @@ hipblasFillMode_t char2hipblas_fill(char value)
         return HIPBLAS_FILL_MODE_UPPER;
     case 'l':
         return HIPBLAS_FILL_MODE_LOWER;
+    case 'F':
+        return HIPBLAS_FILL_MODE_FULL;
+    case 'f':
+        return HIPBLAS_FILL_MODE_FULL;
     }
     return HIPBLAS_FILL_MODE_LOWER;
 }
@@ -184,6 +188,9 @@ hipblasDatatype_t string2hipblas_datatype(const std::string& value)
         value == "u32_r"                 ? HIPBLAS_R_32U  :
         value == "u8_c"                  ? HIPBLAS_C_8U   :
         value == "u32_c"                 ? HIPBLAS_C_32U  :
+        value == "f32_fast_r"            ? HIPBLAS_R_32F_FAST :
+        value == "f32_fast_tf32_r"       ? HIPBLAS_R_32F_FAST_TF32 :
+        value == "f32_fast_16bx3_r"      ? HIPBLAS_R_32F_FAST_16BX3 :
         HIPBLAS_DATATYPE_INVALID;
 }
 // clang-format on
@@ -7555,6 +7555,1341 @@ hipblasStatus_t hipblasSyrkxStridedBatched(hipblasHandle_t             handle,
                                        batchCount);
 }
 
+// gemmt
+template <>
+hipblasStatus_t hipblasGemmt(hipblasHandle_t    handle,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       B,
+                             int                ldb,
+                             const float*       beta,
+                             float*             C,
+                             int                ldc)
+{
+    return hipblasSgemmt(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmt(hipblasHandle_t    handle,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      B,
+                             int                ldb,
+                             const double*      beta,
+                             double*            C,
+                             int                ldc)
+{
+    return hipblasDgemmt(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmt(hipblasHandle_t       handle,
+                             hipblasFillMode_t     uplo,
+                             hipblasOperation_t    transA,
+                             hipblasOperation_t    transB,
+                             int                   n,
+                             int                   k,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const hipblasComplex* B,
+                             int                   ldb,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+{
+    return hipblasCgemmt(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmt(hipblasHandle_t             handle,
+                             hipblasFillMode_t           uplo,
+                             hipblasOperation_t          transA,
+                             hipblasOperation_t          transB,
+                             int                         n,
+                             int                         k,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const hipblasDoubleComplex* B,
+                             int                         ldb,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
+{
+    return hipblasZgemmt(handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// gemmt_batched
+template <>
+hipblasStatus_t hipblasGemmtBatched(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                n,
+                                    int                k,
+                                    const float*       alpha,
+                                    const float* const A[],
+                                    int                lda,
+                                    const float* const B[],
+                                    int                ldb,
+                                    const float*       beta,
+                                    float* const       C[],
+                                    int                ldc,
+                                    int                batchCount)
+{
+    return hipblasSgemmtBatched(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtBatched(hipblasHandle_t     handle,
+                                    hipblasFillMode_t   uplo,
+                                    hipblasOperation_t  transA,
+                                    hipblasOperation_t  transB,
+                                    int                 n,
+                                    int                 k,
+                                    const double*       alpha,
+                                    const double* const A[],
+                                    int                 lda,
+                                    const double* const B[],
+                                    int                 ldb,
+                                    const double*       beta,
+                                    double* const       C[],
+                                    int                 ldc,
+                                    int                 batchCount)
+{
+    return hipblasDgemmtBatched(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtBatched(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int                         n,
+                                    int                         k,
+                                    const hipblasComplex*       alpha,
+                                    const hipblasComplex* const A[],
+                                    int                         lda,
+                                    const hipblasComplex* const B[],
+                                    int                         ldb,
+                                    const hipblasComplex*       beta,
+                                    hipblasComplex* const       C[],
+                                    int                         ldc,
+                                    int                         batchCount)
+{
+    return hipblasCgemmtBatched(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtBatched(hipblasHandle_t                   handle,
+                                    hipblasFillMode_t                 uplo,
+                                    hipblasOperation_t                transA,
+                                    hipblasOperation_t                transB,
+                                    int                               n,
+                                    int                               k,
+                                    const hipblasDoubleComplex*       alpha,
+                                    const hipblasDoubleComplex* const A[],
+                                    int                               lda,
+                                    const hipblasDoubleComplex* const B[],
+                                    int                               ldb,
+                                    const hipblasDoubleComplex*       beta,
+                                    hipblasDoubleComplex* const       C[],
+                                    int                               ldc,
+                                    int                               batchCount)
+{
+    return hipblasZgemmtBatched(
+        handle, uplo, transA, transB, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+// gemmt_strided_batched
+template <>
+hipblasStatus_t hipblasGemmtStridedBatched(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                n,
+                                           int                k,
+                                           const float*       alpha,
+                                           const float*       A,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const float*       B,
+                                           int                ldb,
+                                           hipblasStride      strideB,
+                                           const float*       beta,
+                                           float*             C,
+                                           int                ldc,
+                                           hipblasStride      strideC,
+                                           int                batchCount)
+{
+    return hipblasSgemmtStridedBatched(handle,
+                                       uplo,
+                                       transA,
+                                       transB,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       strideC,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtStridedBatched(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                n,
+                                           int                k,
+                                           const double*      alpha,
+                                           const double*      A,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const double*      B,
+                                           int                ldb,
+                                           hipblasStride      strideB,
+                                           const double*      beta,
+                                           double*            C,
+                                           int                ldc,
+                                           hipblasStride      strideC,
+                                           int                batchCount)
+{
+    return hipblasDgemmtStridedBatched(handle,
+                                       uplo,
+                                       transA,
+                                       transB,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       strideC,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtStridedBatched(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           hipblasOperation_t    transA,
+                                           hipblasOperation_t    transB,
+                                           int                   n,
+                                           int                   k,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* A,
+                                           int                   lda,
+                                           hipblasStride         strideA,
+                                           const hipblasComplex* B,
+                                           int                   ldb,
+                                           hipblasStride         strideB,
+                                           const hipblasComplex* beta,
+                                           hipblasComplex*       C,
+                                           int                   ldc,
+                                           hipblasStride         strideC,
+                                           int                   batchCount)
+{
+    return hipblasCgemmtStridedBatched(handle,
+                                       uplo,
+                                       transA,
+                                       transB,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       strideC,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmtStridedBatched(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasOperation_t          transB,
+                                           int                         n,
+                                           int                         k,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* A,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           const hipblasDoubleComplex* B,
+                                           int                         ldb,
+                                           hipblasStride               strideB,
+                                           const hipblasDoubleComplex* beta,
+                                           hipblasDoubleComplex*       C,
+                                           int                         ldc,
+                                           hipblasStride               strideC,
+                                           int                         batchCount)
+{
+    return hipblasZgemmtStridedBatched(handle,
+                                       uplo,
+                                       transA,
+                                       transB,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       strideC,
+                                       batchCount);
+}
+
+// row-major
+template <>
+hipblasStatus_t hipblasRowGemm(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       B,
+                               int                ldb,
+                               const float*       beta,
+                               float*             C,
+                               int                ldc)
+{
+    return hipblasRowSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemm(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      B,
+                               int                ldb,
+                               const double*      beta,
+                               double*            C,
+                               int                ldc)
+{
+    return hipblasRowDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemm(hipblasHandle_t       handle,
+                               hipblasOperation_t    transA,
+                               hipblasOperation_t    transB,
+                               int                   m,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* B,
+                               int                   ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+{
+    return hipblasRowCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemm(hipblasHandle_t             handle,
+                               hipblasOperation_t          transA,
+                               hipblasOperation_t          transB,
+                               int                         m,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* B,
+                               int                         ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+{
+    return hipblasRowZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemv(hipblasHandle_t    handle,
+                               hipblasOperation_t trans,
+                               int                m,
+                               int                n,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       x,
+                               int                incx,
+                               const float*       beta,
+                               float*             y,
+                               int                incy)
+{
+    return hipblasRowSgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemv(hipblasHandle_t    handle,
+                               hipblasOperation_t trans,
+                               int                m,
+                               int                n,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      x,
+                               int                incx,
+                               const double*      beta,
+                               double*            y,
+                               int                incy)
+{
+    return hipblasRowDgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemv(hipblasHandle_t       handle,
+                               hipblasOperation_t    trans,
+                               int                   m,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* x,
+                               int                   incx,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       y,
+                               int                   incy)
+{
+    return hipblasRowCgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasRowGemv(hipblasHandle_t             handle,
+                               hipblasOperation_t          trans,
+                               int                         m,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* x,
+                               int                         incx,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       y,
+                               int                         incy)
+{
+    return hipblasRowZgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasRowTrsm(hipblasHandle_t    handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const float*       alpha,
+                               float*             A,
+                               int                lda,
+                               float*             B,
+                               int                ldb)
+{
+    return hipblasRowStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasRowTrsm(hipblasHandle_t    handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const double*      alpha,
+                               double*            A,
+                               int                lda,
+                               double*            B,
+                               int                ldb)
+{
+    return hipblasRowDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasRowTrsm(hipblasHandle_t       handle,
+                               hipblasSideMode_t     side,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               hipblasDiagType_t     diag,
+                               int                   m,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               hipblasComplex*       A,
+                               int                   lda,
+                               hipblasComplex*       B,
+                               int                   ldb)
+{
+    return hipblasRowCtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasRowTrsm(hipblasHandle_t             handle,
+                               hipblasSideMode_t           side,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               hipblasDiagType_t           diag,
+                               int                         m,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               hipblasDoubleComplex*       A,
+                               int                         lda,
+                               hipblasDoubleComplex*       B,
+                               int                         ldb)
+{
+    return hipblasRowZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// compact
+template <>
+hipblasStatus_t hipblasGepackCompact(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     const float*    A,
+                                     int             lda,
+                                     hipblasStride   strideA,
+                                     float*          Ac,
+                                     int             ldac,
+                                     int             batchCount)
+{
+    return hipblasSgepackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGepackCompact(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     const double*   A,
+                                     int             lda,
+                                     hipblasStride   strideA,
+                                     double*         Ac,
+                                     int             ldac,
+                                     int             batchCount)
+{
+    return hipblasDgepackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGepackCompact(hipblasHandle_t       handle,
+                                     int                   m,
+                                     int                   n,
+                                     const hipblasComplex* A,
+                                     int                   lda,
+                                     hipblasStride         strideA,
+                                     hipblasComplex*       Ac,
+                                     int                   ldac,
+                                     int                   batchCount)
+{
+    return hipblasCgepackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGepackCompact(hipblasHandle_t             handle,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasDoubleComplex* A,
+                                     int                         lda,
+                                     hipblasStride               strideA,
+                                     hipblasDoubleComplex*       Ac,
+                                     int                         ldac,
+                                     int                         batchCount)
+{
+    return hipblasZgepackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeunpackCompact(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       const float*    Ac,
+                                       int             ldac,
+                                       float*          A,
+                                       int             lda,
+                                       hipblasStride   strideA,
+                                       int             batchCount)
+{
+    return hipblasSgeunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeunpackCompact(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       const double*   Ac,
+                                       int             ldac,
+                                       double*         A,
+                                       int             lda,
+                                       hipblasStride   strideA,
+                                       int             batchCount)
+{
+    return hipblasDgeunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeunpackCompact(hipblasHandle_t       handle,
+                                       int                   m,
+                                       int                   n,
+                                       const hipblasComplex* Ac,
+                                       int                   ldac,
+                                       hipblasComplex*       A,
+                                       int                   lda,
+                                       hipblasStride         strideA,
+                                       int                   batchCount)
+{
+    return hipblasCgeunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeunpackCompact(hipblasHandle_t             handle,
+                                       int                         m,
+                                       int                         n,
+                                       const hipblasDoubleComplex* Ac,
+                                       int                         ldac,
+                                       hipblasDoubleComplex*       A,
+                                       int                         lda,
+                                       hipblasStride               strideA,
+                                       int                         batchCount)
+{
+    return hipblasZgeunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+// batch scalars
+template <>
+hipblasStatus_t hipblasGemmStridedBatchedVec(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const float*       alpha,
+                                             const float*       A,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const float*       B,
+                                             int                ldb,
+                                             hipblasStride      strideB,
+                                             const float*       beta,
+                                             float*             C,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount)
+{
+    return hipblasSgemmStridedBatchedVec(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchedVec(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const double*      alpha,
+                                             const double*      A,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const double*      B,
+                                             int                ldb,
+                                             hipblasStride      strideB,
+                                             const double*      beta,
+                                             double*            C,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount)
+{
+    return hipblasDgemmStridedBatchedVec(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchedVec(hipblasHandle_t       handle,
+                                             hipblasOperation_t    transA,
+                                             hipblasOperation_t    transB,
+                                             int                   m,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasStride         strideA,
+                                             const hipblasComplex* B,
+                                             int                   ldb,
+                                             hipblasStride         strideB,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       C,
+                                             int                   ldc,
+                                             hipblasStride         strideC,
+                                             int                   batchCount)
+{
+    return hipblasCgemmStridedBatchedVec(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchedVec(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             hipblasStride               strideA,
+                                             const hipblasDoubleComplex* B,
+                                             int                         ldb,
+                                             hipblasStride               strideB,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       C,
+                                             int                         ldc,
+                                             hipblasStride               strideC,
+                                             int                         batchCount)
+{
+    return hipblasZgemmStridedBatchedVec(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatchedVec(hipblasHandle_t handle,
+                                             int             n,
+                                             const float*    alpha,
+                                             float*          x,
+                                             int             incx,
+                                             hipblasStride   stridex,
+                                             int             batchCount)
+{
+    return hipblasSscalStridedBatchedVec(handle, n, alpha, x, incx, stridex, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatchedVec(hipblasHandle_t handle,
+                                             int             n,
+                                             const double*   alpha,
+                                             double*         x,
+                                             int             incx,
+                                             hipblasStride   stridex,
+                                             int             batchCount)
+{
+    return hipblasDscalStridedBatchedVec(handle, n, alpha, x, incx, stridex, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatchedVec(hipblasHandle_t       handle,
+                                             int                   n,
+                                             const hipblasComplex* alpha,
+                                             hipblasComplex*       x,
+                                             int                   incx,
+                                             hipblasStride         stridex,
+                                             int                   batchCount)
+{
+    return hipblasCscalStridedBatchedVec(handle, n, alpha, x, incx, stridex, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasScalStridedBatchedVec(hipblasHandle_t             handle,
+                                             int                         n,
+                                             const hipblasDoubleComplex* alpha,
+                                             hipblasDoubleComplex*       x,
+                                             int                         incx,
+                                             hipblasStride               stridex,
+                                             int                         batchCount)
+{
+    return hipblasZscalStridedBatchedVec(handle, n, alpha, x, incx, stridex, batchCount);
+}
+
+// gemm_out_of_core
+template <>
+hipblasStatus_t hipblasGemmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int                lda,
+                                     const float*       B,
+                                     int                ldb,
+                                     const float*       beta,
+                                     float*             C,
+                                     int                ldc)
+{
+    return hipblasSgemmOutOfCore(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const double*      alpha,
+                                     const double*      A,
+                                     int                lda,
+                                     const double*      B,
+                                     int                ldb,
+                                     const double*      beta,
+                                     double*            C,
+                                     int                ldc)
+{
+    return hipblasDgemmOutOfCore(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmOutOfCore(hipblasHandle_t       handle,
+                                     hipblasOperation_t    transA,
+                                     hipblasOperation_t    transB,
+                                     int                   m,
+                                     int                   n,
+                                     int                   k,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int                   lda,
+                                     const hipblasComplex* B,
+                                     int                   ldb,
+                                     const hipblasComplex* beta,
+                                     hipblasComplex*       C,
+                                     int                   ldc)
+{
+    return hipblasCgemmOutOfCore(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemmOutOfCore(hipblasHandle_t             handle,
+                                     hipblasOperation_t          transA,
+                                     hipblasOperation_t          transB,
+                                     int                         m,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int                         lda,
+                                     const hipblasDoubleComplex* B,
+                                     int                         ldb,
+                                     const hipblasDoubleComplex* beta,
+                                     hipblasDoubleComplex*       C,
+                                     int                         ldc)
+{
+    return hipblasZgemmOutOfCore(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// trsm_out_of_core
+template <>
+hipblasStatus_t hipblasTrsmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int                lda,
+                                     float*             B,
+                                     int                ldb)
+{
+    return hipblasStrsmOutOfCore(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const double*      alpha,
+                                     const double*      A,
+                                     int                lda,
+                                     double*            B,
+                                     int                ldb)
+{
+    return hipblasDtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmOutOfCore(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasFillMode_t     uplo,
+                                     hipblasOperation_t    transA,
+                                     hipblasDiagType_t     diag,
+                                     int                   m,
+                                     int                   n,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* A,
+                                     int                   lda,
+                                     hipblasComplex*       B,
+                                     int                   ldb)
+{
+    return hipblasCtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmOutOfCore(hipblasHandle_t             handle,
+                                     hipblasSideMode_t           side,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     hipblasDiagType_t           diag,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* A,
+                                     int                         lda,
+                                     hipblasDoubleComplex*       B,
+                                     int                         ldb)
+{
+    return hipblasZtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// xt_gemm
+template <>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const float*       alpha,
+                              const float*       A,
+                              int                lda,
+                              const float*       B,
+                              int                ldb,
+                              const float*       beta,
+                              float*             C,
+                              int                ldc)
+{
+    return hipblasXtSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc)
+{
+    return hipblasXtDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t     handle,
+                              hipblasOperation_t    transA,
+                              hipblasOperation_t    transB,
+                              int                   m,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              const hipblasComplex* B,
+                              int                   ldb,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       C,
+                              int                   ldc)
+{
+    return hipblasXtCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t           handle,
+                              hipblasOperation_t          transA,
+                              hipblasOperation_t          transB,
+                              int                         m,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              const hipblasDoubleComplex* B,
+                              int                         ldb,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       C,
+                              int                         ldc)
+{
+    return hipblasXtZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// xt_syrk
+template <>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              int                n,
+                              int                k,
+                              const float*       alpha,
+                              const float*       A,
+                              int                lda,
+                              const float*       beta,
+                              float*             C,
+                              int                ldc)
+{
+    return hipblasXtSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc)
+{
+    return hipblasXtDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t     handle,
+                              hipblasFillMode_t     uplo,
+                              hipblasOperation_t    transA,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       C,
+                              int                   ldc)
+{
+    return hipblasXtCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t           handle,
+                              hipblasFillMode_t           uplo,
+                              hipblasOperation_t          transA,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       C,
+                              int                         ldc)
+{
+    return hipblasXtZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// async reductions
+template <>
+hipblasStatus_t hipblasDotAsync(hipblasHandle_t handle,
+                                int             n,
+                                const float*    x,
+                                int             incx,
+                                const float*    y,
+                                int             incy,
+                                float*          result,
+                                hipEvent_t      event)
+{
+    return hipblasSdotAsync(handle, n, x, incx, y, incy, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasDotAsync(hipblasHandle_t handle,
+                                int             n,
+                                const double*   x,
+                                int             incx,
+                                const double*   y,
+                                int             incy,
+                                double*         result,
+                                hipEvent_t      event)
+{
+    return hipblasDdotAsync(handle, n, x, incx, y, incy, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasDotAsync(hipblasHandle_t       handle,
+                                int                   n,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                const hipblasComplex* y,
+                                int                   incy,
+                                hipblasComplex*       result,
+                                hipEvent_t            event)
+{
+    return hipblasCdotuAsync(handle, n, x, incx, y, incy, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasDotAsync(hipblasHandle_t             handle,
+                                int                         n,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                const hipblasDoubleComplex* y,
+                                int                         incy,
+                                hipblasDoubleComplex*       result,
+                                hipEvent_t                  event)
+{
+    return hipblasZdotuAsync(handle, n, x, incx, y, incy, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasAsumAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const float*    x,
+                                 int             incx,
+                                 float*          result,
+                                 hipEvent_t      event)
+{
+    return hipblasSasumAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasAsumAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const double*   x,
+                                 int             incx,
+                                 double*         result,
+                                 hipEvent_t      event)
+{
+    return hipblasDasumAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasAsumAsync(hipblasHandle_t       handle,
+                                 int                   n,
+                                 const hipblasComplex* x,
+                                 int                   incx,
+                                 float*                result,
+                                 hipEvent_t            event)
+{
+    return hipblasScasumAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasAsumAsync(hipblasHandle_t             handle,
+                                 int                         n,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 double*                     result,
+                                 hipEvent_t                  event)
+{
+    return hipblasDzasumAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Async(hipblasHandle_t handle,
+                                 int             n,
+                                 const float*    x,
+                                 int             incx,
+                                 float*          result,
+                                 hipEvent_t      event)
+{
+    return hipblasSnrm2Async(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Async(hipblasHandle_t handle,
+                                 int             n,
+                                 const double*   x,
+                                 int             incx,
+                                 double*         result,
+                                 hipEvent_t      event)
+{
+    return hipblasDnrm2Async(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Async(hipblasHandle_t       handle,
+                                 int                   n,
+                                 const hipblasComplex* x,
+                                 int                   incx,
+                                 float*                result,
+                                 hipEvent_t            event)
+{
+    return hipblasScnrm2Async(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Async(hipblasHandle_t             handle,
+                                 int                         n,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 double*                     result,
+                                 hipEvent_t                  event)
+{
+    return hipblasDznrm2Async(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasIamaxAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const float*    x,
+                                  int             incx,
+                                  int*            result,
+                                  hipEvent_t      event)
+{
+    return hipblasIsamaxAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasIamaxAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const double*   x,
+                                  int             incx,
+                                  int*            result,
+                                  hipEvent_t      event)
+{
+    return hipblasIdamaxAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasIamaxAsync(hipblasHandle_t       handle,
+                                  int                   n,
+                                  const hipblasComplex* x,
+                                  int                   incx,
+                                  int*                  result,
+                                  hipEvent_t            event)
+{
+    return hipblasIcamaxAsync(handle, n, x, incx, result, event);
+}
+
+template <>
+hipblasStatus_t hipblasIamaxAsync(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  int*                        result,
+                                  hipEvent_t                  event)
+{
+    return hipblasIzamaxAsync(handle, n, x, incx, result, event);
+}
+
 // hemm
 template <>
 hipblasStatus_t hipblasHemm(hipblasHandle_t       handle,
@@ -195,6 +195,8 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
 
     if(mode != hipblasAtomicsMode_t(arg.atomics_mode))
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.float32_mode != HIPBLAS_FLOAT32_MODE_DEFAULT)
+        status = hipblasSetFloat32Mode(m_handle, hipblasFloat32Mode_t(arg.float32_mode));
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
         /*
@@ -21,8 +21,10 @@
  *
  * ************************************************************************ */
 
+#include "hipblas_trace.hpp"
 #include "testing_exceptions.hpp"
 #include "utility.h"
+#include <fstream>
 #include <math.h>
 #include <stdexcept>
 #include <vector>
@@ -47,4 +49,109 @@ namespace
         EXPECT_EQ(testing_handle(), HIPBLAS_STATUS_SUCCESS);
     }
 
+    // One logged 37 x 19 x 23 Sgemm with transB = T, returning the exit code of the child
+    // process of layerLogging
+    int logged_gemm()
+    {
+        const int       m = 37, n = 19, k = 23;
+        const float     alpha = 2, beta = 0;
+        hipblasHandle_t handle;
+        float*          d;
+        if(hipblasCreate(&handle) != HIPBLAS_STATUS_SUCCESS)
+            return 1;
+        if(hipMalloc(&d, size_t(m * k + n * k + m * n) * sizeof(float)) != hipSuccess)
+            return 2;
+        hipblasStatus_t status = hipblasSgemm(handle,
+                                              HIPBLAS_OP_N,
+                                              HIPBLAS_OP_T,
+                                              m,
+                                              n,
+                                              k,
+                                              &alpha,
+                                              d,
+                                              m,
+                                              d + m * k,
+                                              n,
+                                              &beta,
+                                              d + m * k + n * k,
+                                              m);
+        bool done = status == HIPBLAS_STATUS_SUCCESS && hipDeviceSynchronize() == hipSuccess;
+        hipFree(d);
+        hipblasDestroy(handle);
+        return done ? 0 : 3;
+    }
+
+    // HIPBLAS_LAYER is read at the first call, so the calls run in a child process started
+    // afresh, which also writes the profile at exit
+    TEST(hipblas_auxiliary, layerLogging)
+    {
+        std::string profile_path = ::testing::TempDir() + "hipblas_layer_profile.yaml";
+        std::string trace_path   = ::testing::TempDir() + "hipblas_layer_trace.bin";
+        std::remove(profile_path.c_str());
+        std::remove(trace_path.c_str());
+        ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+
+        // Profile, trace, ranges and shape markers, which do nothing without roctx or NVTX
+        EXPECT_EXIT(
+            {
+                setenv("HIPBLAS_LAYER", "0x3c", 1);
+                setenv("HIPBLAS_LOG_PROFILE_PATH", profile_path.c_str(), 1);
+                setenv("HIPBLAS_LOG_TRACE_PATH", trace_path.c_str(), 1);
+                exit(logged_gemm());
+            },
+            ::testing::ExitedWithCode(0),
+            "");
+
+        std::ifstream profile(profile_path);
+        std::string   line, entry;
+        while(std::getline(profile, line))
+            if(line.rfind("- {", 0) == 0)
+                entry += line;
+        EXPECT_NE(entry.find("hipblas_function: hipblas_sgemm"), std::string::npos) << entry;
+        EXPECT_NE(entry.find("a_type: f32_r"), std::string::npos) << entry;
+        EXPECT_NE(entry.find("transA: N, transB: T, M: 37, N: 19, K: 23"), std::string::npos)
+            << entry;
+        EXPECT_NE(entry.find("lda: 37, ldb: 19, ldc: 37"), std::string::npos) << entry;
+        EXPECT_NE(entry.find("alpha: 2"), std::string::npos) << entry;
+        EXPECT_NE(entry.find("call_count: 1 }"), std::string::npos) << entry;
+
+        std::ifstream        trace(trace_path, std::ios::binary);
+        hipblas_trace_header header{};
+        hipblas_trace_record record{};
+        ASSERT_TRUE(trace.read((char*)&header, sizeof(header)));
+        EXPECT_EQ(memcmp(header.magic, HIPBLAS_TRACE_MAGIC, sizeof(header.magic)), 0);
+        EXPECT_EQ(header.version, uint32_t(HIPBLAS_TRACE_VERSION));
+        EXPECT_EQ(header.record_size, uint32_t(sizeof(record)));
+        ASSERT_TRUE(trace.read((char*)&record, sizeof(record)));
+        EXPECT_STREQ(record.function, "hipblas_sgemm");
+        EXPECT_EQ(record.transA, HIPBLAS_OP_N);
+        EXPECT_EQ(record.transB, HIPBLAS_OP_T);
+        EXPECT_EQ(record.m, 37);
+        EXPECT_EQ(record.n, 19);
+        EXPECT_EQ(record.k, 23);
+        EXPECT_EQ(record.lda, 37);
+        EXPECT_EQ(record.ldb, 19);
+        EXPECT_EQ(record.ldc, 37);
+        EXPECT_EQ(record.batch_count, 1);
+        EXPECT_EQ(record.pointer_mode, HIPBLAS_POINTER_MODE_HOST);
+        float alpha;
+        memcpy(&alpha, record.alpha, sizeof(alpha));
+        EXPECT_EQ(alpha, 2);
+        EXPECT_FALSE(trace.read((char*)&record, sizeof(record)));
+
+        // The range layers alone write no log
+        std::remove(profile_path.c_str());
+        std::remove(trace_path.c_str());
+        EXPECT_EXIT(
+            {
+                setenv("HIPBLAS_LAYER", "0x30", 1);
+                setenv("HIPBLAS_LOG_PROFILE_PATH", profile_path.c_str(), 1);
+                setenv("HIPBLAS_LOG_TRACE_PATH", trace_path.c_str(), 1);
+                exit(logged_gemm());
+            },
+            ::testing::ExitedWithCode(0),
+            "");
+        EXPECT_FALSE(std::ifstream(profile_path).good());
+        EXPECT_FALSE(std::ifstream(trace_path).good());
+    }
 } // namespace
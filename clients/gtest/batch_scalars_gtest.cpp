@@ -0,0 +1,260 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_gemm_strided_batched_vec.hpp"
+#include "testing_scal_strided_batched_vec.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, double, int> gemm_vec_tuple;
+typedef std::tuple<int, vector<double>, int, double, int>                 scal_vec_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// alpha and beta are arrays of batch_count scalars: the testers scale the given alpha by the
+// member's index plus one, and use the given beta on odd members and zero on even ones
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> gemm_vec_size_range = {{-1, -1, -1, -1, -1, -1},
+                                                 {0, 4, 3, 3, 4, 1},
+                                                 {4, 0, 3, 4, 3, 4},
+                                                 {10, 10, 10, 5, 10, 10},
+                                                 {3, 2, 4, 4, 4, 3},
+                                                 {4, 3, 0, 4, 4, 4},
+                                                 {13, 9, 7, 15, 15, 13},
+                                                 {33, 17, 20, 40, 40, 33}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+const vector<vector<double>> gemm_vec_alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 0.0, 0.0}, {1.0, 0.0, 1.0, 0.0}};
+
+const vector<vector<char>> gemm_vec_transA_transB_range
+    = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'C', 'C'}};
+
+// a stride_scale below one overlaps the C_i, which is invalid with more than one member
+const vector<double> gemm_vec_stride_scale_range = {0.5, 1.0, 2.5};
+
+const vector<int> scal_vec_N_range = {-1, 0, 5, 10, 500};
+
+// vector, each entry is  {alpha, alphai};
+const vector<vector<double>> scal_vec_alpha_range = {{-0.5, 1.5}, {2.0, 0.0}, {0.0, 0.0}};
+
+// unit increments scale the batch as one matrix, others go member by member
+const vector<int> scal_vec_incx_range = {-1, 0, 1, 2};
+
+const vector<double> scal_vec_stride_scale_range = {1.0, 2.5};
+
+const vector<int> batch_scalars_batch_count_range = {-1, 0, 1, 5};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     per-batch scalars:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_gemm_vec_arguments(gemm_vec_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+    double         stride_scale  = std::get<3>(tup);
+    int            batch_count   = std::get<4>(tup);
+
+    Arguments arg;
+
+    // see the comments about gemm_vec_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_scal_vec_arguments(scal_vec_tuple tup)
+{
+    Arguments arg;
+
+    arg.N            = std::get<0>(tup);
+    arg.alpha        = std::get<1>(tup)[0];
+    arg.alphai       = std::get<1>(tup)[1];
+    arg.incx         = std::get<2>(tup);
+    arg.stride_scale = std::get<3>(tup);
+    arg.batch_count  = std::get<4>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class gemm_vec_gtest : public ::TestWithParam<gemm_vec_tuple>
+{
+protected:
+    gemm_vec_gtest() {}
+    virtual ~gemm_vec_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class scal_vec_gtest : public ::TestWithParam<scal_vec_tuple>
+{
+protected:
+    scal_vec_gtest() {}
+    virtual ~scal_vec_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// gemm_strided_batched_vec
+TEST_P(gemm_vec_gtest, gemm_strided_batched_vec_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_vec_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_strided_batched_vec<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0
+           || arg.lda < std::max(1, A_row) || arg.ldb < std::max(1, B_row)
+           || arg.ldc < std::max(1, arg.M)
+           || (arg.batch_count > 1 && arg.N > 0 && arg.stride_scale < 1.0))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_vec_gtest, gemm_strided_batched_vec_gtest_double_complex)
+{
+    Arguments arg = setup_gemm_vec_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_strided_batched_vec<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0
+           || arg.lda < std::max(1, A_row) || arg.ldb < std::max(1, B_row)
+           || arg.ldc < std::max(1, arg.M)
+           || (arg.batch_count > 1 && arg.N > 0 && arg.stride_scale < 1.0))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// scal_strided_batched_vec, where every size quick returns successfully
+TEST_P(scal_vec_gtest, scal_strided_batched_vec_gtest_float)
+{
+    Arguments arg = setup_scal_vec_arguments(GetParam());
+
+    hipblasStatus_t status = testing_scal_strided_batched_vec<float>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(scal_vec_gtest, scal_strided_batched_vec_gtest_double_complex)
+{
+    Arguments arg = setup_scal_vec_arguments(GetParam());
+
+    hipblasStatus_t status = testing_scal_strided_batched_vec<hipblasDoubleComplex>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmStridedBatchedVec,
+                         gemm_vec_gtest,
+                         Combine(ValuesIn(gemm_vec_size_range),
+                                 ValuesIn(gemm_vec_alpha_beta_range),
+                                 ValuesIn(gemm_vec_transA_transB_range),
+                                 ValuesIn(gemm_vec_stride_scale_range),
+                                 ValuesIn(batch_scalars_batch_count_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasScalStridedBatchedVec,
+                         scal_vec_gtest,
+                         Combine(ValuesIn(scal_vec_N_range),
+                                 ValuesIn(scal_vec_alpha_range),
+                                 ValuesIn(scal_vec_incx_range),
+                                 ValuesIn(scal_vec_stride_scale_range),
+                                 ValuesIn(batch_scalars_batch_count_range)));
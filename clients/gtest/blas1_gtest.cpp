@@ -39,6 +39,7 @@
 #include "testing_nrm2.hpp"
 #include "testing_nrm2_batched.hpp"
 #include "testing_nrm2_strided_batched.hpp"
+#include "testing_reduction_async.hpp"
 #include "testing_rot.hpp"
 #include "testing_rot_batched.hpp"
 #include "testing_rot_strided_batched.hpp"
@@ -2325,6 +2326,39 @@ TEST_P(blas1_gtest, amax_strided_batched_float_complex)
 
 #endif
 
+// dot, nrm2, asum and amax written in stream order
+TEST_P(blas1_gtest, reduction_async_float)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_reduction_async<float>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(blas1_gtest, reduction_async_double)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_reduction_async<double>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(blas1_gtest, reduction_async_float_complex)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_reduction_async<hipblasComplex>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(blas1_gtest, reduction_async_double_complex)
+{
+    Arguments       arg    = setup_blas1_arguments(GetParam());
+    hipblasStatus_t status = testing_reduction_async<hipblasDoubleComplex>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
 // amin
 TEST_P(blas1_gtest, amin_float)
 {
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_gepack_compact.hpp"
+#include "testing_geunpack_compact.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, double, int> pack_compact_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// The matrices of a call form one group in the compact layout, so batch_count is the group size
+
+// vector of vector, each vector is a {M, N, lda, ldac};
+// add/delete as a group
+const vector<vector<int>> pack_compact_size_range = {{-1, -1, -1, -1},
+                                                     {0, 4, 1, 1},
+                                                     {10, 10, 5, 10},
+                                                     {10, 10, 10, 5},
+                                                     {4, 4, 4, 4},
+                                                     {13, 7, 15, 13},
+                                                     {33, 17, 33, 40}};
+
+const vector<double> pack_compact_stride_scale_range = {1.0, 2.5};
+
+const vector<int> compact_batch_count_range = {-1, 0, 1, 7};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     compact layout:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_pack_compact_arguments(pack_compact_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    double      stride_scale = std::get<1>(tup);
+    int         batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about pack_compact_size_range above, ldac being passed as ldc
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class pack_compact_gtest : public ::TestWithParam<pack_compact_tuple>
+{
+protected:
+    pack_compact_gtest() {}
+    virtual ~pack_compact_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// gepack_compact and geunpack_compact
+TEST_P(pack_compact_gtest, gepack_compact_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_pack_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gepack_compact<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0 || arg.lda < std::max(1, arg.M)
+           || arg.ldc < std::max(1, arg.M))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(pack_compact_gtest, gepack_compact_gtest_double_complex)
+{
+    Arguments arg = setup_pack_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gepack_compact<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0 || arg.lda < std::max(1, arg.M)
+           || arg.ldc < std::max(1, arg.M))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(pack_compact_gtest, geunpack_compact_gtest_float)
+{
+    Arguments arg = setup_pack_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geunpack_compact<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0 || arg.lda < std::max(1, arg.M)
+           || arg.ldc < std::max(1, arg.M))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(pack_compact_gtest, geunpack_compact_gtest_double_complex)
+{
+    Arguments arg = setup_pack_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geunpack_compact<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0 || arg.lda < std::max(1, arg.M)
+           || arg.ldc < std::max(1, arg.M))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasPackCompact,
+                         pack_compact_gtest,
+                         Combine(ValuesIn(pack_compact_size_range),
+                                 ValuesIn(pack_compact_stride_scale_range),
+                                 ValuesIn(compact_batch_count_range)));
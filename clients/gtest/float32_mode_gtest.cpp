@@ -0,0 +1,232 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_gemm_ex_float32_mode.hpp"
+#include "testing_set_get_float32_mode.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>, vector<hipblasDatatype_t>, int>
+    gemm_ex_float32_mode_tuple;
+
+// clang-format off
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    { -1,  1,   1,   1,   1,  1},
+    {  3,  3,   3,   2,   3,  3},
+    {  0,  3,   3,   3,   3,  1},
+    {  3,  0,   3,   3,   3,  3},
+    {  3,  2,   0,   3,   3,  3},
+    {  1,  1,   1,   1,   1,  1},
+    { 37, 29, 200, 200, 200, 37},
+    { 64, 64,  64,  64,  64, 64},
+};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+// add/delete this list in pairs, like {2.0, 3.0, 4.0, 5.0}
+const vector<vector<double>> alpha_beta_range = {
+    {1.5, 0.0, -0.5, 0.0}, {1.0, 0.0, 0.0, 0.0}, {-2.0, 0.0, 1.0, 0.0},
+};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+// a_type, b_type, c_type, compute_type
+const vector<vector<hipblasDatatype_t>> precision_range = {
+    {HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F},
+    {HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F_FAST},
+    {HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F_FAST_TF32},
+    {HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F_FAST_16BX3},
+};
+
+// the fast compute types with data other than f32
+const vector<vector<hipblasDatatype_t>> precision_not_single = {
+    {HIPBLAS_R_16F, HIPBLAS_R_16F, HIPBLAS_R_32F, HIPBLAS_R_32F_FAST},
+    {HIPBLAS_R_16F, HIPBLAS_R_16F, HIPBLAS_R_16F, HIPBLAS_R_32F_FAST_TF32},
+    {HIPBLAS_R_16B, HIPBLAS_R_16B, HIPBLAS_R_32F, HIPBLAS_R_32F_FAST_16BX3},
+    {HIPBLAS_R_64F, HIPBLAS_R_64F, HIPBLAS_R_64F, HIPBLAS_R_32F_FAST},
+};
+
+// the handle's hipblasFloat32Mode_t
+const vector<int> float32_mode_range = {
+    HIPBLAS_FLOAT32_MODE_DEFAULT,
+    HIPBLAS_FLOAT32_MODE_FAST,
+    HIPBLAS_FLOAT32_MODE_FAST_16BX3,
+};
+// clang-format on
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-EX GEMM with the fast f32 modes and compute types:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_gemm_ex_float32_mode_arguments(gemm_ex_float32_mode_tuple tup)
+{
+    vector<int>               matrix_size     = std::get<0>(tup);
+    vector<double>            alpha_beta      = std::get<1>(tup);
+    vector<char>              transA_transB   = std::get<2>(tup);
+    vector<hipblasDatatype_t> precision_types = std::get<3>(tup);
+    int                       float32_mode    = std::get<4>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.timing = 0;
+
+    arg.a_type       = precision_types[0];
+    arg.b_type       = precision_types[1];
+    arg.c_type       = precision_types[2];
+    arg.compute_type = precision_types[3];
+
+    arg.float32_mode = float32_mode;
+
+    // non-integer data, so that the reduced precision of the products shows in the result
+    arg.initialization = hipblas_initialization::trig_float;
+
+    return arg;
+}
+
+class gemm_ex_float32_mode_gtest : public ::TestWithParam<gemm_ex_float32_mode_tuple>
+{
+protected:
+    gemm_ex_float32_mode_gtest() {}
+    virtual ~gemm_ex_float32_mode_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class set_get_float32_mode_gtest : public ::TestWithParam<int>
+{
+protected:
+    set_get_float32_mode_gtest() {}
+    virtual ~set_get_float32_mode_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_ex_float32_mode_gtest, standard)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_ex_float32_mode_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_ex_float32_mode(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(arg.a_type != HIPBLAS_R_32F)
+        {
+            // the fast compute types only apply to f32 data
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row || arg.ldb < B_row
+                || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_get_float32_mode_gtest, default)
+{
+    Arguments arg;
+    arg.float32_mode = GetParam();
+
+    hipblasStatus_t status = testing_set_get_float32_mode(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmExFloat32Mode,
+                         gemm_ex_float32_mode_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(precision_range),
+                                 ValuesIn(float32_mode_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmExFloat32Mode_not_single,
+                         gemm_ex_float32_mode_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(precision_not_single),
+                                 Values(HIPBLAS_FLOAT32_MODE_DEFAULT)));
+
+INSTANTIATE_TEST_SUITE_P(hipblas_auxiliary_small,
+                         set_get_float32_mode_gtest,
+                         ValuesIn(float32_mode_range));
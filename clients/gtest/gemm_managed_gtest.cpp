@@ -0,0 +1,243 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_managed.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> gemm_managed_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range
+    = {{-1, 2, 2, 1, 2, 1}, {5, 0, 7, 5, 7, 5}, {5, 3, 7, 7, 8, 6}, {130, 65, 97, 150, 140, 130}};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+const vector<vector<double>> alpha_beta_range = {{2.0, 1.0, 1.0, -1.0}, {-1.0, 0.0, 0.0, 0.0}};
+
+// vector of vector, each pair is a {transA, transB};
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'T', 'N'}, {'N', 'C'}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 GEMM on managed matrices:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_gemm_managed_arguments(gemm_managed_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class gemm_managed_gtest : public ::TestWithParam<gemm_managed_tuple>
+{
+protected:
+    gemm_managed_gtest() {}
+    virtual ~gemm_managed_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_managed_gtest, gemm_managed_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_managed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_managed<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // managed memory hints are only given on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row || arg.ldb < B_row
+                || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_managed_gtest, gemm_managed_double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_managed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_managed<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // managed memory hints are only given on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row || arg.ldb < B_row
+                || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_managed_gtest, gemm_managed_float_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_managed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_managed<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // managed memory hints are only given on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row || arg.ldb < B_row
+                || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_managed_gtest, gemm_managed_double_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemm_managed_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_managed<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int A_row = arg.transA == 'N' ? arg.M : arg.K;
+        int B_row = arg.transB == 'N' ? arg.K : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // managed memory hints are only given on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.lda < A_row || arg.ldb < B_row
+                || arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmManaged,
+                         gemm_managed_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(transA_transB_range)));
@@ -0,0 +1,358 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemmt.hpp"
+#include "testing_gemmt_batched.hpp"
+#include "testing_gemmt_strided_batched.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, char, vector<char>, double, int> gemmt_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda, ldb, ldc};
+// add/delete as a group
+// 300 spans several diagonal blocks of the blocked form
+const vector<vector<int>> matrix_size_range = {{-1, -1, -1, -1, -1},
+                                               {0, 3, 3, 3, 1},
+                                               {11, 6, 11, 11, 11},
+                                               {16, 15, 16, 16, 16},
+                                               {20, 9, 25, 30, 27},
+                                               {65, 4, 65, 65, 65},
+                                               {300, 5, 300, 300, 300}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+// add/delete single values, like {2.0}
+const vector<vector<double>> alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 1.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
+
+// 'F' is not a valid fill mode for gemmt
+const vector<char> uplo_range = {'L', 'U', 'F'};
+
+// {N, T} and {T, N} are computed by syrkx, the others in block rows
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'C', 'C'}};
+
+const vector<double> stride_scale_range = {1.0, 2.5};
+const vector<int>    batch_count_range  = {-1, 0, 1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 gemmt:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_gemmt_arguments(gemmt_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    char           uplo          = std::get<2>(tup);
+    vector<char>   transA_transB = std::get<3>(tup);
+    double         stride_scale  = std::get<4>(tup);
+    int            batch_count   = std::get<5>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.timing = 0;
+
+    arg.uplo   = uplo;
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class blas3_gemmt_gtest : public ::TestWithParam<gemmt_tuple>
+{
+protected:
+    blas3_gemmt_gtest() {}
+    virtual ~blas3_gemmt_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// gemmt
+TEST_P(blas3_gemmt_gtest, gemmt_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_gemmt_gtest, gemmt_gtest_double_complex)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// gemmt_batched
+TEST_P(blas3_gemmt_gtest, gemmt_batched_gtest_float)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_gemmt_gtest, gemmt_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// gemmt_strided_batched
+TEST_P(blas3_gemmt_gtest, gemmt_strided_batched_gtest_float)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt_strided_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_gemmt_gtest, gemmt_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_gemmt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemmt_strided_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.uplo != 'L' && arg.uplo != 'U')
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM, status);
+        }
+        else if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.N : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasGemmt,
+                         blas3_gemmt_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(transA_transB_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
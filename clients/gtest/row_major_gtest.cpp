@@ -0,0 +1,402 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_row_gemm.hpp"
+#include "testing_row_gemv.hpp"
+#include "testing_row_trsm.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>>      row_gemm_tuple;
+typedef std::tuple<vector<int>, vector<int>, vector<double>, char> row_gemv_tuple;
+typedef std::tuple<vector<int>, vector<double>, vector<char>>      row_trsm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// The leading dimensions of a row-major matrix bound its number of columns
+
+// vector of vector, each vector is a {M, N, K, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> row_gemm_size_range = {{-1, -1, -1, -1, -1, -1},
+                                                 {0, 4, 3, 4, 4, 4},
+                                                 {10, 10, 10, 5, 10, 10},
+                                                 {5, 4, 3, 6, 6, 5},
+                                                 {33, 17, 9, 40, 40, 20},
+                                                 {64, 64, 64, 64, 64, 64}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+// add/delete single values, like {2.0}
+const vector<vector<double>> row_gemm_alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 1.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
+
+const vector<vector<char>> row_gemm_transA_transB_range
+    = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'C', 'C'}};
+
+// vector of vector, each vector is a {M, N, lda};
+const vector<vector<int>> row_gemv_size_range
+    = {{-1, -1, -1}, {0, 3, 3}, {10, 10, 5}, {5, 4, 4}, {33, 17, 20}, {100, 200, 200}};
+
+// vector of vector, each pair is a {incx, incy};
+const vector<vector<int>> row_gemv_incx_incy_range = {{1, 1}, {2, -1}, {-1, 3}, {0, 1}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+const vector<vector<double>> row_gemv_alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 0.0, 0.0}};
+
+// the conjugate of a complex row-major matrix is not supported by gemv
+const vector<char> row_gemv_transA_range = {'N', 'T', 'C'};
+
+// vector of vector, each vector is a {M, N, lda, ldb};
+const vector<vector<int>> row_trsm_size_range = {{-1, -1, -1, -1},
+                                                 {0, 4, 4, 4},
+                                                 {4, 5, 3, 5},
+                                                 {5, 4, 5, 4},
+                                                 {15, 20, 20, 25},
+                                                 {64, 33, 64, 40}};
+
+// vector, each entry is  {alpha, alphai};
+const vector<vector<double>> row_trsm_alpha_range = {{1.0, 0.0}, {-0.5, 1.5}};
+
+// each vector is a {side, uplo, transA, diag}
+const vector<vector<char>> row_trsm_side_uplo_transA_diag_range = {{'L', 'L', 'N', 'N'},
+                                                                   {'R', 'L', 'N', 'N'},
+                                                                   {'L', 'U', 'T', 'N'},
+                                                                   {'R', 'U', 'T', 'U'},
+                                                                   {'L', 'L', 'C', 'U'},
+                                                                   {'R', 'U', 'C', 'N'}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     row-major gemm, gemv and trsm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_row_gemm_arguments(row_gemm_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about row_gemm_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA_transB[0];
+    arg.transB = transA_transB[1];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_row_gemv_arguments(row_gemv_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<int>    incx_incy   = std::get<1>(tup);
+    vector<double> alpha_beta  = std::get<2>(tup);
+    char           transA      = std::get<3>(tup);
+
+    Arguments arg;
+
+    // see the comments about row_gemv_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.transA = transA;
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_row_trsm_arguments(row_trsm_tuple tup)
+{
+    vector<int>    matrix_size           = std::get<0>(tup);
+    vector<double> alpha                 = std::get<1>(tup);
+    vector<char>   side_uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about row_trsm_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha  = alpha[0];
+    arg.alphai = alpha[1];
+
+    arg.side   = side_uplo_transA_diag[0];
+    arg.uplo   = side_uplo_transA_diag[1];
+    arg.transA = side_uplo_transA_diag[2];
+    arg.diag   = side_uplo_transA_diag[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class row_gemm_gtest : public ::TestWithParam<row_gemm_tuple>
+{
+protected:
+    row_gemm_gtest() {}
+    virtual ~row_gemm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class row_gemv_gtest : public ::TestWithParam<row_gemv_tuple>
+{
+protected:
+    row_gemv_gtest() {}
+    virtual ~row_gemv_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class row_trsm_gtest : public ::TestWithParam<row_trsm_tuple>
+{
+protected:
+    row_trsm_gtest() {}
+    virtual ~row_trsm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// row_gemm
+TEST_P(row_gemm_gtest, row_gemm_gtest_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_row_gemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_gemm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.K : arg.lda < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.N : arg.ldb < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(row_gemm_gtest, row_gemm_gtest_double_complex)
+{
+    Arguments arg = setup_row_gemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_gemm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.ldc < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.K : arg.lda < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.N : arg.ldb < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// row_gemv
+TEST_P(row_gemv_gtest, row_gemv_gtest_float)
+{
+    Arguments arg = setup_row_gemv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_gemv<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < arg.N || arg.lda < 1 || !arg.incx || !arg.incy)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(row_gemv_gtest, row_gemv_gtest_double_complex)
+{
+    Arguments arg = setup_row_gemv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_gemv<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.transA == 'C')
+        {
+            // complex row-major gemv has no conjugate transpose
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.lda < arg.N || arg.lda < 1 || !arg.incx
+                || !arg.incy)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// row_trsm
+TEST_P(row_trsm_gtest, row_trsm_gtest_float)
+{
+    Arguments arg = setup_row_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_trsm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(row_trsm_gtest, row_trsm_gtest_double_complex)
+{
+    Arguments arg = setup_row_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_row_trsm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasRowGemm,
+                         row_gemm_gtest,
+                         Combine(ValuesIn(row_gemm_size_range),
+                                 ValuesIn(row_gemm_alpha_beta_range),
+                                 ValuesIn(row_gemm_transA_transB_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasRowGemv,
+                         row_gemv_gtest,
+                         Combine(ValuesIn(row_gemv_size_range),
+                                 ValuesIn(row_gemv_incx_incy_range),
+                                 ValuesIn(row_gemv_alpha_beta_range),
+                                 ValuesIn(row_gemv_transA_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasRowTrsm,
+                         row_trsm_gtest,
+                         Combine(ValuesIn(row_trsm_size_range),
+                                 ValuesIn(row_trsm_alpha_range),
+                                 ValuesIn(row_trsm_side_uplo_transA_diag_range)));
@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_set_get_matrix_batched_async.hpp"
+#include "testing_set_get_vector_batched_async.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<int>, double, int> set_get_matrix_batched_async_tuple;
+typedef std::tuple<int, vector<int>, double, int>         set_get_vector_batched_async_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each pair is a {rows, cols};
+const vector<vector<int>> rows_cols_range = {{-1, 3}, {0, 3}, {8, 8}, {3, 30}, {300, 4}};
+
+// vector of vector, each triple is a {lda, ldb, ldc};
+const vector<vector<int>> lda_ldb_ldc_range = {{9, 8, 8}, {307, 301, 303}};
+
+// vector of vector, each triple is a {incx, incy, incd};
+const vector<vector<int>> incx_incy_incd_range = {{1, 1, 1}, {1, 2, 1}, {3, 1, 2}, {0, 1, 1}};
+
+const vector<int> M_range = {-1, 100, 1000};
+
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+// 1000 small members are packed several to a staging buffer
+const vector<int> batch_count_range = {-1, 0, 3, 1000};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS auxiliary, batched transfers:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_set_get_matrix_batched_async_arguments(set_get_matrix_batched_async_tuple tup)
+{
+    vector<int> rows_cols   = std::get<0>(tup);
+    vector<int> lda_ldb_ldc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.rows = rows_cols[0];
+    arg.cols = rows_cols[1];
+
+    arg.lda = lda_ldb_ldc[0];
+    arg.ldb = lda_ldb_ldc[1];
+    arg.ldc = lda_ldb_ldc[2];
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+Arguments setup_set_get_vector_batched_async_arguments(set_get_vector_batched_async_tuple tup)
+{
+    vector<int> incx_incy_incd = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M = std::get<0>(tup);
+
+    arg.incx = incx_incy_incd[0];
+    arg.incy = incx_incy_incd[1];
+    arg.incd = incx_incy_incd[2];
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class set_get_matrix_batched_async_gtest
+    : public ::TestWithParam<set_get_matrix_batched_async_tuple>
+{
+protected:
+    set_get_matrix_batched_async_gtest() {}
+    virtual ~set_get_matrix_batched_async_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+class set_get_vector_batched_async_gtest
+    : public ::TestWithParam<set_get_vector_batched_async_tuple>
+{
+protected:
+    set_get_vector_batched_async_gtest() {}
+    virtual ~set_get_vector_batched_async_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(set_get_matrix_batched_async_gtest, float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_matrix_batched_async_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // batched transfers are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.rows < 0 || arg.cols < 0 || arg.lda < arg.rows || arg.ldb < arg.rows
+                || arg.ldc < arg.rows || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_get_matrix_batched_async_gtest, double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_matrix_batched_async_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched_async<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // batched transfers are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.rows < 0 || arg.cols < 0 || arg.lda < arg.rows || arg.ldb < arg.rows
+                || arg.ldc < arg.rows || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_get_vector_batched_async_gtest, float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_vector_batched_async_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_vector_batched_async<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // batched transfers are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.incx <= 0 || arg.incy <= 0 || arg.incd <= 0
+                || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_get_vector_batched_async_gtest, double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_vector_batched_async_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_vector_batched_async<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // batched transfers are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.incx <= 0 || arg.incy <= 0 || arg.incd <= 0
+                || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_batched,
+                         set_get_matrix_batched_async_gtest,
+                         Combine(ValuesIn(rows_cols_range),
+                                 ValuesIn(lda_ldb_ldc_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_batched,
+                         set_get_vector_batched_async_gtest,
+                         Combine(ValuesIn(M_range),
+                                 ValuesIn(incx_incy_incd_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
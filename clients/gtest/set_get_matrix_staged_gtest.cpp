@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_set_get_matrix_staged.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<int>> set_get_matrix_staged_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// Sizes above the 64 KiB staging threshold, the largest spanning several 4 MiB buffers
+
+// vector of vector, each pair is a {rows, cols};
+const vector<vector<int>> rows_cols_range = {{300, 200}, {500, 256}, {1024, 1100}};
+
+// vector of vector, each triple is a {lda, ldb, ldc};
+const vector<vector<int>> lda_ldb_ldc_range = {{1031, 1030, 1024}, {1040, 1024, 1033}};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS auxiliary, pageable memory staged through pinned buffers:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_set_get_matrix_staged_arguments(set_get_matrix_staged_tuple tup)
+{
+    vector<int> rows_cols   = std::get<0>(tup);
+    vector<int> lda_ldb_ldc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.rows = rows_cols[0];
+    arg.cols = rows_cols[1];
+
+    arg.lda = lda_ldb_ldc[0];
+    arg.ldb = lda_ldb_ldc[1];
+    arg.ldc = lda_ldb_ldc[2];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class set_get_matrix_staged_gtest : public ::TestWithParam<set_get_matrix_staged_tuple>
+{
+protected:
+    set_get_matrix_staged_gtest() {}
+    virtual ~set_get_matrix_staged_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(set_get_matrix_staged_gtest, float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_matrix_staged_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_staged<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols <= 0 || arg.lda <= 0 || arg.ldb <= 0 || arg.ldc <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(set_get_matrix_staged_gtest, double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_set_get_matrix_staged_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_staged<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.rows < 0 || arg.cols <= 0 || arg.lda <= 0 || arg.ldb <= 0 || arg.ldc <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// HIPBLAS_STAGING_SIZE is read once per process, so the run with 64 KiB buffers, which wraps
+// around the ring of buffers several times, runs in a child process started afresh.
+TEST_P(set_get_matrix_staged_gtest, small_buffers_double)
+{
+    Arguments arg = setup_set_get_matrix_staged_arguments(GetParam());
+
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+    EXPECT_EXIT(
+        {
+            setenv("HIPBLAS_STAGING_SIZE", "65536", 1);
+            hipblasStatus_t status = testing_set_get_matrix_staged<double>(arg);
+            exit(status == HIPBLAS_STATUS_SUCCESS && !::testing::Test::HasFailure() ? 0 : 1);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasAuxiliary_staged,
+                         set_get_matrix_staged_gtest,
+                         Combine(ValuesIn(rows_cols_range), ValuesIn(lda_ldb_ldc_range)));
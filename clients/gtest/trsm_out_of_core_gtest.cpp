@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_trsm_out_of_core.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> trsm_out_of_core_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, 1, 1}, {5, 3, 5, 5}, {10, 10, 20, 100}, {130, 70, 140, 130}};
+
+const vector<vector<double>> alpha_range = {{1.0, -5.0}};
+
+// vector of vector, each pair is a {side, uplo, transA, diag};
+// the blocks are solved forward for the first two and backward for the last two
+const vector<vector<char>> side_uplo_transA_diag_range = {
+    {'L', 'L', 'N', 'U'},
+    {'R', 'U', 'N', 'N'},
+    {'L', 'U', 'C', 'N'},
+    {'R', 'L', 'N', 'N'},
+};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 trsm on host matrices:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_trsm_out_of_core_arguments(trsm_out_of_core_tuple tup)
+{
+    vector<int>    matrix_size           = std::get<0>(tup);
+    vector<double> alpha_alphai          = std::get<1>(tup);
+    vector<char>   side_uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha  = alpha_alphai[0];
+    arg.alphai = alpha_alphai[1];
+
+    arg.side   = side_uplo_transA_diag[0];
+    arg.uplo   = side_uplo_transA_diag[1];
+    arg.transA = side_uplo_transA_diag[2];
+    arg.diag   = side_uplo_transA_diag[3];
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class trsm_out_of_core_gtest : public ::TestWithParam<trsm_out_of_core_tuple>
+{
+protected:
+    trsm_out_of_core_gtest() {}
+    virtual ~trsm_out_of_core_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_out_of_core_gtest, trsm_out_of_core_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_trsm_out_of_core_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_out_of_core<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // out-of-core routines are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(trsm_out_of_core_gtest, trsm_out_of_core_double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_trsm_out_of_core_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_out_of_core<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // out-of-core routines are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(trsm_out_of_core_gtest, trsm_out_of_core_float_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_trsm_out_of_core_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_out_of_core<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // out-of-core routines are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(trsm_out_of_core_gtest, trsm_out_of_core_double_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_trsm_out_of_core_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_out_of_core<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        int K = arg.side == 'L' ? arg.M : arg.N;
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // out-of-core routines are only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasTrsmOutOfCore,
+                         trsm_out_of_core_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_range),
+                                 ValuesIn(side_uplo_transA_diag_range)));
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_xt_cpu_ratio.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using std::vector;
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+
+typedef std::tuple<vector<int>, vector<double>, char> xt_cpu_ratio_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, K};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {{-1, 6, 3}, {6, 6, 3}, {100, 70, 40}};
+
+// vector of vector, each pair is a {alpha, alphai, beta, betai};
+const vector<vector<double>> alpha_beta_range = {{2.0, 0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0, 0.0}};
+
+const vector<char> uplo_range = {'L', 'U'};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     hipblasXt GEMM and SYRK shared between a device and the host BLAS:
+=================================================================== */
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "arg".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_xt_cpu_ratio_arguments(xt_cpu_ratio_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M = matrix_size[0];
+    arg.N = matrix_size[1];
+    arg.K = matrix_size[2];
+
+    // the first 2 elements of alpha_beta_range are always alpha, and the second 2 are always beta
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.uplo = std::get<2>(tup);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class xt_cpu_ratio_gtest : public ::TestWithParam<xt_cpu_ratio_tuple>
+{
+protected:
+    xt_cpu_ratio_gtest() {}
+    virtual ~xt_cpu_ratio_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(xt_cpu_ratio_gtest, xt_cpu_ratio_float)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_xt_cpu_ratio_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_cpu_ratio<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // hipblasXt is only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M <= 0 || arg.N <= 0 || arg.K <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(xt_cpu_ratio_gtest, xt_cpu_ratio_double)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_xt_cpu_ratio_arguments(GetParam());
+
+    hipblasStatus_t status = testing_xt_cpu_ratio<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        {
+            // hipblasXt is only implemented on the rocBLAS and cuBLAS backends
+        }
+        else if(arg.M <= 0 || arg.N <= 0 || arg.K <= 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// The default host routines are looked up once per process, so the run without any runs in a
+// child process started afresh. Only the GEMM routine set by the tester is then available, and
+// the SYRK falls back to the device.
+TEST_P(xt_cpu_ratio_gtest, xt_cpu_ratio_no_host_blas_float)
+{
+    Arguments arg = setup_xt_cpu_ratio_arguments(GetParam());
+    if(arg.M <= 0 || arg.N <= 0 || arg.K <= 0)
+        return;
+
+    ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+    EXPECT_EXIT(
+        {
+            setenv("HIPBLAS_XT_CPU_BLAS", "libhipblas_no_host_blas.so", 1);
+            hipblasStatus_t status = testing_xt_cpu_ratio<float>(arg);
+            exit(status == HIPBLAS_STATUS_NOT_SUPPORTED
+                         || (status == HIPBLAS_STATUS_SUCCESS && !::testing::Test::HasFailure())
+                     ? 0
+                     : 1);
+        },
+        ::testing::ExitedWithCode(0),
+        "");
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasXtCpuRatio,
+                         xt_cpu_ratio_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(uplo_range)));
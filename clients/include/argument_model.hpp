@@ -41,6 +41,11 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// per-call time weighted by the call_count of each test, used to total a profiled workload
+void   ArgumentModel_add_weighted_time(double us_per_call, int call_count);
+double ArgumentModel_get_weighted_time_us();
+size_t ArgumentModel_get_weighted_call_count();
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -85,6 +90,8 @@ public:
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
 
+        ArgumentModel_add_weighted_time(gpu_us / hot_calls, arg.apiCallCount);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(arg.norm_check)
@@ -0,0 +1,71 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "testing_common.hpp"
+
+// Host copies between a strided batch of column-major matrices and the compact
+// layout of hipblasXgepackCompact, in which element (i, j) of matrix b is at
+// Ac[(i + j * ldac) * batch_count + b]. Only the m rows of each column are
+// copied, so the padding of either side is left as it was.
+template <typename T>
+void compact_pack_reference(int           m,
+                            int           n,
+                            const T*      A,
+                            int           lda,
+                            hipblasStride stride_a,
+                            T*            Ac,
+                            int           ldac,
+                            int           batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                size_t a  = b * stride_a + i + j * size_t(lda);
+                size_t ac = (i + j * size_t(ldac)) * batch_count + b;
+                Ac[ac]    = A[a];
+            }
+}
+
+template <typename T>
+void compact_unpack_reference(int           m,
+                              int           n,
+                              const T*      Ac,
+                              int           ldac,
+                              T*            A,
+                              int           lda,
+                              hipblasStride stride_a,
+                              int           batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                size_t a  = b * stride_a + i + j * size_t(lda);
+                size_t ac = (i + j * size_t(ldac)) * batch_count + b;
+                A[a]      = Ac[ac];
+            }
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_common.hpp"
+
+// reference implementation of gemmt: the uplo triangle of a GEMM, leaving the
+// other triangle of c untouched. This function is not part of legacy BLAS.
+template <typename T>
+void gemmt_reference(hipblasFillMode_t  uplo,
+                     hipblasOperation_t transA,
+                     hipblasOperation_t transB,
+                     int                n,
+                     int                k,
+                     T                  alpha,
+                     T*                 a,
+                     int                lda,
+                     T*                 b,
+                     int                ldb,
+                     T                  beta,
+                     T*                 c,
+                     int                ldc)
+{
+    host_vector<T> full(size_t(ldc) * n);
+    for(size_t i = 0; i < full.size(); i++)
+        full[i] = c[i];
+
+    cblas_gemm<T>(transA, transB, n, n, k, alpha, a, lda, b, ldb, beta, full.data(), ldc);
+
+    for(int j = 0; j < n; j++)
+    {
+        int i_start = uplo == HIPBLAS_FILL_MODE_LOWER ? j : 0;
+        int i_end   = uplo == HIPBLAS_FILL_MODE_LOWER ? n : j + 1;
+        for(int i = i_start; i < i_end; i++)
+            c[i + j * size_t(ldc)] = full[i + j * size_t(ldc)];
+    }
+}
@@ -1680,6 +1680,254 @@ hipblasStatus_t hipblasSyrkxStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount);
 
+// gemmt
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGemmt(hipblasHandle_t    handle,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             hipblasOperation_t transB,
+                             int                n,
+                             int                k,
+                             const T*           alpha,
+                             const T*           A,
+                             int                lda,
+                             const T*           B,
+                             int                ldb,
+                             const T*           beta,
+                             T*                 C,
+                             int                ldc);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGemmtBatched(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T* const     A[],
+                                    int                lda,
+                                    const T* const     B[],
+                                    int                ldb,
+                                    const T*           beta,
+                                    T* const           C[],
+                                    int                ldc,
+                                    int                batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGemmtStridedBatched(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T*           A,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const T*           B,
+                                           int                ldb,
+                                           hipblasStride      strideB,
+                                           const T*           beta,
+                                           T*                 C,
+                                           int                ldc,
+                                           hipblasStride      strideC,
+                                           int                batchCount);
+
+// row-major
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasRowGemm(hipblasHandle_t    handle,
+                               hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const T*           alpha,
+                               const T*           A,
+                               int                lda,
+                               const T*           B,
+                               int                ldb,
+                               const T*           beta,
+                               T*                 C,
+                               int                ldc);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasRowGemv(hipblasHandle_t    handle,
+                               hipblasOperation_t trans,
+                               int                m,
+                               int                n,
+                               const T*           alpha,
+                               const T*           A,
+                               int                lda,
+                               const T*           x,
+                               int                incx,
+                               const T*           beta,
+                               T*                 y,
+                               int                incy);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasRowTrsm(hipblasHandle_t    handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const T*           alpha,
+                               T*                 A,
+                               int                lda,
+                               T*                 B,
+                               int                ldb);
+
+// compact
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGepackCompact(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     const T*        A,
+                                     int             lda,
+                                     hipblasStride   strideA,
+                                     T*              Ac,
+                                     int             ldac,
+                                     int             batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGeunpackCompact(hipblasHandle_t handle,
+                                       int             m,
+                                       int             n,
+                                       const T*        Ac,
+                                       int             ldac,
+                                       T*              A,
+                                       int             lda,
+                                       hipblasStride   strideA,
+                                       int             batchCount);
+
+// batch scalars
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGemmStridedBatchedVec(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const T*           alpha,
+                                             const T*           A,
+                                             int                lda,
+                                             hipblasStride      strideA,
+                                             const T*           B,
+                                             int                ldb,
+                                             hipblasStride      strideB,
+                                             const T*           beta,
+                                             T*                 C,
+                                             int                ldc,
+                                             hipblasStride      strideC,
+                                             int                batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasScalStridedBatchedVec(hipblasHandle_t handle,
+                                             int             n,
+                                             const T*        alpha,
+                                             T*              x,
+                                             int             incx,
+                                             hipblasStride   stridex,
+                                             int             batchCount);
+
+// out-of-core
+template <typename T>
+hipblasStatus_t hipblasGemmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     int                lda,
+                                     const T*           B,
+                                     int                ldb,
+                                     const T*           beta,
+                                     T*                 C,
+                                     int                ldc);
+
+template <typename T>
+hipblasStatus_t hipblasTrsmOutOfCore(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int                m,
+                                     int                n,
+                                     const T*           alpha,
+                                     const T*           A,
+                                     int                lda,
+                                     T*                 B,
+                                     int                ldb);
+
+// xt
+template <typename T>
+hipblasStatus_t hipblasXtGemm(hipblasXtHandle_t  handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T*           A,
+                              int                lda,
+                              const T*           B,
+                              int                ldb,
+                              const T*           beta,
+                              T*                 C,
+                              int                ldc);
+
+template <typename T>
+hipblasStatus_t hipblasXtSyrk(hipblasXtHandle_t  handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T*           A,
+                              int                lda,
+                              const T*           beta,
+                              T*                 C,
+                              int                ldc);
+
+// async reductions
+template <typename T>
+hipblasStatus_t hipblasDotAsync(hipblasHandle_t handle,
+                                int             n,
+                                const T*        x,
+                                int             incx,
+                                const T*        y,
+                                int             incy,
+                                T*              result,
+                                hipEvent_t      event);
+
+template <typename T1, typename T2>
+hipblasStatus_t hipblasAsumAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const T1*       x,
+                                 int             incx,
+                                 T2*             result,
+                                 hipEvent_t      event);
+
+template <typename T1, typename T2>
+hipblasStatus_t hipblasNrm2Async(hipblasHandle_t handle,
+                                 int             n,
+                                 const T1*       x,
+                                 int             incx,
+                                 T2*             result,
+                                 hipEvent_t      event);
+
+template <typename T>
+hipblasStatus_t hipblasIamaxAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const T*        x,
+                                  int             incx,
+                                  int*            result,
+                                  hipEvent_t      event);
+
 // geam
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeam(hipblasHandle_t    handle,
@@ -137,6 +137,7 @@ struct Arguments
     char     category[64];
 
     int atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+    int float32_mode = HIPBLAS_FLOAT32_MODE_DEFAULT;
 
     hipblas_initialization initialization = hipblas_initialization::rand_int;
 
@@ -198,6 +199,7 @@ struct Arguments
     OPER(name) SEP                   \
     OPER(category) SEP               \
     OPER(atomics_mode) SEP           \
+    OPER(float32_mode) SEP           \
     OPER(initialization)
 
     // clang-format on
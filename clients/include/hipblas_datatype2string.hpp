@@ -131,6 +131,12 @@ inline constexpr auto hipblas_datatype2string(hipblasDatatype_t type)
         return "bf16_r";
     case HIPBLAS_C_16B:
         return "bf16_c";
+    case HIPBLAS_R_32F_FAST:
+        return "f32_fast_r";
+    case HIPBLAS_R_32F_FAST_TF32:
+        return "f32_fast_tf32_r";
+    case HIPBLAS_R_32F_FAST_16BX3:
+        return "f32_fast_16bx3_r";
     case HIPBLAS_DATATYPE_INVALID:
         return "invalid";
     }
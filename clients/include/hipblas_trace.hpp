@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstdint>
+
+/*! \brief  Layout of the binary call trace written by hipBLAS with HIPBLAS_LAYER=8
+and read by hipblas-bench --replay. This mirrors library/src/include/logging.hpp
+as the clients may be built against an installed library. */
+
+#define HIPBLAS_TRACE_MAGIC "HIPBLTRC"
+#define HIPBLAS_TRACE_VERSION 1
+
+struct hipblas_trace_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+};
+
+struct hipblas_trace_record
+{
+    char     function[48];
+    double   time_us; // host time at entry, relative to the first traced call
+    uint64_t handle; // handle, stream and buffer addresses are only used as identities
+    uint64_t stream;
+    uint64_t A, B, C; // device pointer arrays for the batched forms
+    int64_t  stride_a, stride_b, stride_c;
+    int32_t  device;
+    int32_t  pointer_mode;
+    int32_t  a_type, b_type, c_type, compute_type;
+    int32_t  transA, transB;
+    int32_t  m, n, k;
+    int32_t  lda, ldb, ldc;
+    int32_t  batch_count;
+    int32_t  reserved;
+    uint8_t  alpha[16]; // raw host scalars, zero in device pointer mode
+    uint8_t  beta[16];
+};
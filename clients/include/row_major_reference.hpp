@@ -0,0 +1,121 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "testing_common.hpp"
+
+// The references below work on column-major copies of the row-major operands
+// and call the column-major cblas routines, so they do not depend on the
+// transposes the library uses to forward row-major calls.
+
+// copy the rows x cols row-major matrix src into the column-major matrix dst
+template <typename T>
+void row_to_col_major(int rows, int cols, const T* src, int ld_src, T* dst, int ld_dst)
+{
+    for(int i = 0; i < rows; i++)
+        for(int j = 0; j < cols; j++)
+            dst[i + j * size_t(ld_dst)] = src[i * size_t(ld_src) + j];
+}
+
+// copy the rows x cols column-major matrix src into the row-major matrix dst
+template <typename T>
+void col_to_row_major(int rows, int cols, const T* src, int ld_src, T* dst, int ld_dst)
+{
+    for(int i = 0; i < rows; i++)
+        for(int j = 0; j < cols; j++)
+            dst[i * size_t(ld_dst) + j] = src[i + j * size_t(ld_src)];
+}
+
+// reference implementation of a row-major gemm
+template <typename T>
+void row_gemm_reference(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int                m,
+                        int                n,
+                        int                k,
+                        T                  alpha,
+                        const T*           a,
+                        int                lda,
+                        const T*           b,
+                        int                ldb,
+                        T                  beta,
+                        T*                 c,
+                        int                ldc)
+{
+    int a_rows = transA == HIPBLAS_OP_N ? m : k;
+    int a_cols = transA == HIPBLAS_OP_N ? k : m;
+    int b_rows = transB == HIPBLAS_OP_N ? k : n;
+    int b_cols = transB == HIPBLAS_OP_N ? n : k;
+
+    int lda_col = std::max(1, a_rows);
+    int ldb_col = std::max(1, b_rows);
+    int ldc_col = std::max(1, m);
+
+    host_vector<T> a_col(size_t(lda_col) * a_cols);
+    host_vector<T> b_col(size_t(ldb_col) * b_cols);
+    host_vector<T> c_col(size_t(ldc_col) * n);
+
+    row_to_col_major(a_rows, a_cols, a, lda, a_col.data(), lda_col);
+    row_to_col_major(b_rows, b_cols, b, ldb, b_col.data(), ldb_col);
+    row_to_col_major(m, n, (const T*)c, ldc, c_col.data(), ldc_col);
+
+    cblas_gemm<T>(transA,
+                  transB,
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  a_col.data(),
+                  lda_col,
+                  b_col.data(),
+                  ldb_col,
+                  beta,
+                  c_col.data(),
+                  ldc_col);
+
+    col_to_row_major(m, n, (const T*)c_col.data(), ldc_col, c, ldc);
+}
+
+// reference implementation of a row-major gemv, x and y being plain vectors
+template <typename T>
+void row_gemv_reference(hipblasOperation_t transA,
+                        int                m,
+                        int                n,
+                        T                  alpha,
+                        const T*           a,
+                        int                lda,
+                        T*                 x,
+                        int                incx,
+                        T                  beta,
+                        T*                 y,
+                        int                incy)
+{
+    int            lda_col = std::max(1, m);
+    host_vector<T> a_col(size_t(lda_col) * n);
+
+    row_to_col_major(m, n, a, lda, a_col.data(), lda_col);
+
+    cblas_gemv<T>(transA, m, n, alpha, a_col.data(), lda_col, x, incx, beta, y, incy);
+}
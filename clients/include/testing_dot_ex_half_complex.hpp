@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasDotExHalfComplexModel = ArgumentModel<e_N, e_incx, e_incy>;
+
+inline void testname_dot_ex_half_complex(const Arguments& arg, std::string& name)
+{
+    hipblasDotExHalfComplexModel{}.test_name(arg, name);
+}
+
+inline void testname_dotc_ex_half_complex(const Arguments& arg, std::string& name)
+{
+    hipblasDotExHalfComplexModel{}.test_name(arg, name);
+}
+
+// Tr is the type of the result, hipblasHalfComplex or hipblasComplex; x and y are always complex
+// half with complex float execution, done by hipBLAS itself on either backend
+template <typename Tr, bool CONJ = false>
+inline hipblasStatus_t testing_dot_ex_half_complex_template(const Arguments& arg)
+{
+    using Th = hipblasHalfComplex;
+    using Tf = hipblasComplex;
+
+    auto hipblasDotExFn = CONJ ? hipblasDotcEx : hipblasDotEx;
+
+    int N    = arg.N;
+    int incx = arg.incx;
+    int incy = arg.incy;
+
+    hipblasDatatype_t xType         = arg.a_type;
+    hipblasDatatype_t yType         = arg.b_type;
+    hipblasDatatype_t resultType    = arg.c_type;
+    hipblasDatatype_t executionType = arg.compute_type;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool same_direction = (incx > 0 && incy > 0) || (incx < 0 && incy < 0);
+    if(N <= 0 || !same_direction)
+    {
+        device_vector<Tr> d_hipblas_result_0(1);
+        host_vector<Tr>   h_hipblas_result_0(1);
+        hipblas_init_nan(h_hipblas_result_0.data(), 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(Tr), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        hipblasStatus_t actual = hipblasDotExFn(handle,
+                                                N,
+                                                nullptr,
+                                                xType,
+                                                incx,
+                                                nullptr,
+                                                yType,
+                                                incy,
+                                                d_hipblas_result_0,
+                                                resultType,
+                                                executionType);
+        if(N > 0)
+        {
+            // increments of opposite signs, or zero, are not implemented for complex half
+            EXPECT_HIPBLAS_STATUS(actual, HIPBLAS_STATUS_NOT_SUPPORTED);
+            return actual;
+        }
+        CHECK_HIPBLAS_ERROR(actual);
+
+        host_vector<Tf> cpu_0(1);
+        host_vector<Tf> gpu_0(1);
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_hipblas_result_0, d_hipblas_result_0, sizeof(Tr), hipMemcpyDeviceToHost));
+        cpu_0[0] = Tf(0);
+        gpu_0[0] = half_complex_widen(h_hipblas_result_0[0]);
+        unit_check_general<Tf>(1, 1, 1, cpu_0, gpu_0);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int    abs_incx = incx >= 0 ? incx : -incx;
+    int    abs_incy = incy >= 0 ? incy : -incy;
+    size_t sizeX    = size_t(N) * abs_incx;
+    size_t sizeY    = size_t(N) * abs_incy;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Th> hx(sizeX);
+    host_vector<Th> hy(sizeY);
+    host_vector<Tf> hx_gold(sizeX);
+    host_vector<Tf> hy_gold(sizeY);
+
+    device_vector<Th> dx(sizeX);
+    device_vector<Th> dy(sizeY);
+    device_vector<Tr> d_hipblas_result(1);
+
+    Tr hipblas_result;
+    Tf cpu_result, hipblas_result_host, hipblas_result_device;
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU: small integer parts, whose sums of products stay exact in half precision
+    // for the lengths tested
+    hipblas_seedrand();
+    hipblas_init(reinterpret_cast<hipblasHalf*>(hx.data()), 2, N, 2 * abs_incx);
+    hipblas_init(reinterpret_cast<hipblasHalf*>(hy.data()), 2, N, 2 * abs_incy);
+    for(size_t i = 0; i < sizeX; i++)
+        hx_gold[i] = half_complex_widen(hx[i]);
+    for(size_t i = 0; i < sizeY; i++)
+        hy_gold[i] = half_complex_widen(hy[i]);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Th) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Th) * sizeY, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
+                                           N,
+                                           dx,
+                                           xType,
+                                           incx,
+                                           dy,
+                                           yType,
+                                           incy,
+                                           &hipblas_result,
+                                           resultType,
+                                           executionType));
+        hipblas_result_host = half_complex_widen(hipblas_result);
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
+                                           N,
+                                           dx,
+                                           xType,
+                                           incx,
+                                           dy,
+                                           yType,
+                                           incy,
+                                           d_hipblas_result,
+                                           resultType,
+                                           executionType));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hipblas_result, d_hipblas_result, sizeof(Tr), hipMemcpyDeviceToHost));
+        hipblas_result_device = half_complex_widen(hipblas_result);
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        (CONJ ? cblas_dotc<Tf> : cblas_dot<Tf>)(
+            N, hx_gold.data(), incx, hy_gold.data(), incy, &cpu_result);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<Tf>(1, 1, 1, &cpu_result, &hipblas_result_host);
+            unit_check_general<Tf>(1, 1, 1, &cpu_result, &hipblas_result_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<Tf>('F', 1, 1, 1, &cpu_result, &hipblas_result_host);
+            hipblas_error_device
+                = norm_check_general<Tf>('F', 1, 1, 1, &cpu_result, &hipblas_result_device);
+        }
+
+    } // end of if unit/norm check
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasDotExFn(handle,
+                                               N,
+                                               dx,
+                                               xType,
+                                               incx,
+                                               dy,
+                                               yType,
+                                               incy,
+                                               d_hipblas_result,
+                                               resultType,
+                                               executionType));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasDotExHalfComplexModel{}.log_args<Tf>(std::cout,
+                                                    arg,
+                                                    gpu_time_used,
+                                                    dot_gflop_count<CONJ, Tf>(N),
+                                                    dot_gbyte_count<Th>(N),
+                                                    hipblas_error_host,
+                                                    hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <bool CONJ>
+inline hipblasStatus_t testing_dot_ex_half_complex_dispatch(const Arguments& arg)
+{
+    hipblasDatatype_t xType         = arg.a_type;
+    hipblasDatatype_t yType         = arg.b_type;
+    hipblasDatatype_t resultType    = arg.c_type;
+    hipblasDatatype_t executionType = arg.compute_type;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(xType == HIPBLAS_C_16F && yType == HIPBLAS_C_16F && resultType == HIPBLAS_C_16F
+       && executionType == HIPBLAS_C_32F)
+    {
+        status = testing_dot_ex_half_complex_template<hipblasHalfComplex, CONJ>(arg);
+    }
+    else if(xType == HIPBLAS_C_16F && yType == HIPBLAS_C_16F && resultType == HIPBLAS_C_32F
+            && executionType == HIPBLAS_C_32F)
+    {
+        status = testing_dot_ex_half_complex_template<hipblasComplex, CONJ>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
+
+inline hipblasStatus_t testing_dot_ex_half_complex(const Arguments& arg)
+{
+    return testing_dot_ex_half_complex_dispatch<false>(arg);
+}
+
+inline hipblasStatus_t testing_dotc_ex_half_complex(const Arguments& arg)
+{
+    return testing_dot_ex_half_complex_dispatch<true>(arg);
+}
@@ -0,0 +1,250 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmBroadcastModel = ArgumentModel<e_transA,
+                                                e_transB,
+                                                e_M,
+                                                e_N,
+                                                e_K,
+                                                e_alpha,
+                                                e_lda,
+                                                e_ldb,
+                                                e_beta,
+                                                e_ldc,
+                                                e_batch_count>;
+
+inline void testname_gemm_broadcast(const Arguments& arg, std::string& name)
+{
+    hipblasGemmBroadcastModel{}.test_name(arg, name);
+}
+
+// Strided batched GEMMs broadcasting one operand with stride 0, laid out so that they collapse
+// into a single GEMM: with A shared, the op(B_i) and C_i are consecutive column blocks; with B
+// shared, the op(A_i) and C_i are consecutive row blocks. lda, ldb and ldc are those of one
+// member; the row blocks widen them by M or N per extra member.
+template <typename T>
+inline hipblasStatus_t testing_gemm_broadcast(const Arguments& arg)
+{
+    bool FORTRAN = arg.fortran;
+    auto hipblasGemmStridedBatchedFn
+        = FORTRAN ? hipblasGemmStridedBatched<T, true> : hipblasGemmStridedBatched<T, false>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemmStridedBatchedFn(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             nullptr,
+                                                             nullptr,
+                                                             lda,
+                                                             0,
+                                                             nullptr,
+                                                             ldb,
+                                                             0,
+                                                             nullptr,
+                                                             nullptr,
+                                                             ldc,
+                                                             0,
+                                                             batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    // Runs one layout and checks it against the GEMM of each member
+    auto run = [&](bool          timed,
+                   int           lda_x,
+                   hipblasStride stride_A,
+                   int           ldb_x,
+                   hipblasStride stride_B,
+                   int           ldc_x,
+                   hipblasStride stride_C) {
+        size_t A_size = stride_A * (batch_count - 1) + size_t(lda_x) * A_col;
+        size_t B_size = stride_B * (batch_count - 1) + size_t(ldb_x) * B_col;
+        size_t C_size = stride_C * (batch_count - 1) + size_t(ldc_x) * N;
+
+        // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<T> hA(A_size);
+        host_vector<T> hB(B_size);
+        host_vector<T> hC(C_size);
+        host_vector<T> hC_gold(C_size);
+
+        device_vector<T> dA(A_size);
+        device_vector<T> dB(B_size);
+        device_vector<T> dC(C_size);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(hA, arg, A_size, 1, 1, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_size, 1, 1, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+        hipblas_init_matrix(hC, arg, C_size, 1, 1, 0, 1, hipblas_client_beta_sets_nan);
+        hC_gold = hC;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        hipblasStatus_t status = hipblasGemmStridedBatchedFn(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             &h_alpha,
+                                                             dA,
+                                                             lda_x,
+                                                             stride_A,
+                                                             dB,
+                                                             ldb_x,
+                                                             stride_B,
+                                                             &h_beta,
+                                                             dC,
+                                                             ldc_x,
+                                                             stride_C,
+                                                             batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int i = 0; i < batch_count; i++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * i,
+                          lda_x,
+                          hB.data() + stride_B * i,
+                          ldb_x,
+                          h_beta,
+                          hC_gold.data() + stride_C * i,
+                          ldc_x);
+        }
+
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, batch_count, ldc_x, stride_C, hC_gold, hC);
+        if(arg.norm_check)
+            hipblas_error = std::max(
+                hipblas_error,
+                norm_check_general<T>('F', M, N, ldc_x, stride_C, hC_gold, hC, batch_count));
+
+        if(timed && arg.timing)
+        {
+            hipStream_t stream;
+            CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &h_alpha,
+                                                                dA,
+                                                                lda_x,
+                                                                stride_A,
+                                                                dB,
+                                                                ldb_x,
+                                                                stride_B,
+                                                                &h_beta,
+                                                                dC,
+                                                                ldc_x,
+                                                                stride_C,
+                                                                batch_count));
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+            hipblasGemmBroadcastModel{}.log_args<T>(std::cout,
+                                                    arg,
+                                                    gpu_time_used,
+                                                    gemm_gflop_count<T>(M, N, K) * batch_count,
+                                                    gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                                    hipblas_error);
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    };
+
+    int           extra_rows_a = transA == HIPBLAS_OP_N ? M * (batch_count - 1) : 0;
+    int           extra_rows_b = transB == HIPBLAS_OP_N ? 0 : N * (batch_count - 1);
+    hipblasStride stride_A     = transA == HIPBLAS_OP_N ? M : hipblasStride(lda) * M;
+    hipblasStride stride_B     = transB == HIPBLAS_OP_N ? hipblasStride(ldb) * N : N;
+
+    // A shared; op(B_i) and C_i side by side
+    hipblasStatus_t status
+        = run(true, lda, 0, ldb + extra_rows_b, stride_B, ldc, hipblasStride(ldc) * N);
+
+    // B shared; op(A_i) and C_i stacked
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = run(false, lda + extra_rows_a, stride_A, ldb, 0, ldc + M * (batch_count - 1), M);
+
+    return status;
+}
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmDeferredModel = ArgumentModel<e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemm_deferred(const Arguments& arg, std::string& name)
+{
+    hipblasGemmDeferredModel{}.test_name(arg, name);
+}
+
+// batch_count independent GEMMs on a handle in HIPBLAS_DEFERRED_MODE_ENABLED, which are queued
+// until a flush and then issued together
+template <typename T>
+inline hipblasStatus_t testing_gemm_deferred(const Arguments& arg)
+{
+    bool FORTRAN       = arg.fortran;
+    auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!M || !N || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // The second layout leaves a growing gap after each C, so that the queue cannot be issued
+    // as one strided batched call and goes through the pointer arrays instead
+    size_t C_gaps = size_t(batch_count) * (batch_count - 1) / 2;
+
+    double             gpu_time_used, hipblas_error_host;
+    hipblasLocalHandle handle(arg);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hA(A_size * batch_count);
+    host_vector<T> hB(B_size * batch_count);
+    host_vector<T> hC(C_size * batch_count + C_gaps);
+    host_vector<T> hC_host(C_size * batch_count + C_gaps);
+    host_vector<T> hC_gold(C_size * batch_count + C_gaps);
+
+    device_vector<T> dA(A_size * batch_count);
+    device_vector<T> dB(B_size * batch_count);
+    device_vector<T> dC(C_size * batch_count + C_gaps);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, A_size, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB,
+                        arg,
+                        B_row,
+                        B_col,
+                        ldb,
+                        B_size,
+                        batch_count,
+                        hipblas_client_alpha_sets_nan,
+                        false,
+                        true);
+    hipblas_init_vector(hC, arg, hC.size(), 1, 0, 1, hipblas_client_beta_sets_nan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size * batch_count, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_ENABLED));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        hipblas_error_host = 0;
+        for(int gaps = 0; gaps < 2; gaps++)
+        {
+            auto C_offset
+                = [&](int b) { return C_size * b + (gaps ? size_t(b) * (b - 1) / 2 : 0); };
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+            for(int b = 0; b < batch_count; b++)
+                CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA + A_size * b,
+                                                  lda,
+                                                  dB + B_size * b,
+                                                  ldb,
+                                                  &h_beta,
+                                                  dC + C_offset(b),
+                                                  ldc));
+
+            // Nothing runs until the queue is flushed. C may hold NaNs, so compare the bytes.
+            if(K > 0)
+            {
+                CHECK_HIP_ERROR(hipDeviceSynchronize());
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hC_host, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+                EXPECT_EQ(0, memcmp(hC.data(), hC_host.data(), sizeof(T) * hC.size()));
+            }
+
+            // The first layout is flushed by a transfer without a handle, the second explicitly
+            if(!gaps)
+            {
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGetMatrix(ldc, N * batch_count, sizeof(T), dC, ldc, hC_host, ldc));
+            }
+            else
+            {
+                CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hC_host, dC, sizeof(T) * hC.size(), hipMemcpyDeviceToHost));
+            }
+
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            hC_gold = hC;
+            for(int b = 0; b < batch_count; b++)
+                cblas_gemm<T>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              h_alpha,
+                              hA.data() + A_size * b,
+                              lda,
+                              hB.data() + B_size * b,
+                              ldb,
+                              h_beta,
+                              hC_gold.data() + C_offset(b),
+                              ldc);
+
+            if(arg.unit_check)
+            {
+                for(int b = 0; b < batch_count; b++)
+                    unit_check_general<T>(
+                        M, N, ldc, hC_gold.data() + C_offset(b), hC_host.data() + C_offset(b));
+            }
+            if(arg.norm_check)
+            {
+                for(int b = 0; b < batch_count; b++)
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        std::abs(norm_check_general<T>('F',
+                                                       M,
+                                                       N,
+                                                       ldc,
+                                                       hC_gold.data() + C_offset(b),
+                                                       hC_host.data() + C_offset(b))));
+            }
+        }
+    } // end of if unit/norm check
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            for(int b = 0; b < batch_count; b++)
+                CHECK_HIPBLAS_ERROR(hipblasGemmFn(handle,
+                                                  transA,
+                                                  transB,
+                                                  M,
+                                                  N,
+                                                  K,
+                                                  &h_alpha,
+                                                  dA + A_size * b,
+                                                  lda,
+                                                  dB + B_size * b,
+                                                  ldb,
+                                                  &h_beta,
+                                                  dC + C_size * b,
+                                                  ldc));
+            CHECK_HIPBLAS_ERROR(hipblasFlush(handle));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmDeferredModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               gemm_gflop_count<T>(M, N, K) * batch_count,
+                                               gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                               hipblas_error_host);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,380 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExFloat32ModeModel = ArgumentModel<e_transA,
+                                                    e_transB,
+                                                    e_M,
+                                                    e_N,
+                                                    e_K,
+                                                    e_alpha,
+                                                    e_lda,
+                                                    e_ldb,
+                                                    e_beta,
+                                                    e_ldc,
+                                                    e_float32_mode>;
+
+inline void testname_gemm_ex_float32_mode(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExFloat32ModeModel{}.test_name(arg, name);
+}
+
+// Largest error allowed relative to alpha*|op(A)|*|op(B)| + |beta*C|, for the precision of the
+// products: TF32 or f32, whichever the device runs, for FAST and FAST_TF32, and for bf16x3 the
+// lo*lo term dropped and both parts truncated, about 2^-14 per input
+inline double float32_mode_error_bound(hipblasDatatype_t compute_type, int float32_mode)
+{
+    switch(compute_type)
+    {
+    case HIPBLAS_R_32F_FAST:
+    case HIPBLAS_R_32F_FAST_TF32:
+        return 1.0 / 256;
+    case HIPBLAS_R_32F_FAST_16BX3:
+        return 1.0 / 4096;
+    default:
+        break;
+    }
+    switch(float32_mode)
+    {
+    case HIPBLAS_FLOAT32_MODE_FAST:
+    case HIPBLAS_FLOAT32_MODE_FAST_TF32:
+        return 1.0 / 256;
+    case HIPBLAS_FLOAT32_MODE_FAST_16BX3:
+        return 1.0 / 4096;
+    default:
+        return 1e-5;
+    }
+}
+
+// f32 GEMMs with the handle's float32_mode and a compute type of R_32F or one of the fast ones,
+// on non-integer data so that the reduced internal precision shows in the result
+inline hipblasStatus_t testing_gemm_ex_float32_mode_template(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasGemmEx(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               nullptr,
+                                               nullptr,
+                                               a_type,
+                                               lda,
+                                               nullptr,
+                                               b_type,
+                                               ldb,
+                                               nullptr,
+                                               nullptr,
+                                               c_type,
+                                               ldc,
+                                               compute_type,
+                                               algo);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<float>  hA(size_A);
+    host_vector<float>  hB(size_B);
+    host_vector<float>  hC_host(size_C);
+    host_vector<float>  hC_device(size_C);
+    host_vector<double> hA_gold(size_A);
+    host_vector<double> hB_gold(size_B);
+    host_vector<double> hC_gold(size_C);
+    host_vector<double> hA_abs(size_A);
+    host_vector<double> hB_abs(size_B);
+    host_vector<double> hC_scale(size_C);
+
+    device_vector<float> dA(size_A);
+    device_vector<float> dB(size_B);
+    device_vector<float> dC(size_C);
+    device_vector<float> d_alpha(1);
+    device_vector<float> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_device = hC_host;
+
+    for(size_t i = 0; i < size_A; i++)
+        hA_abs[i] = std::abs(hA_gold[i] = hA[i]);
+    for(size_t i = 0; i < size_B; i++)
+        hB_abs[i] = std::abs(hB_gold[i] = hB[i]);
+    for(size_t i = 0; i < size_C; i++)
+        hC_scale[i] = std::abs(hC_gold[i] = hC_host[i]);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(float) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(float), hipMemcpyHostToDevice));
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          &h_alpha,
+                                          dA,
+                                          a_type,
+                                          lda,
+                                          dB,
+                                          b_type,
+                                          ldb,
+                                          &h_beta,
+                                          dC,
+                                          c_type,
+                                          ldc,
+                                          compute_type,
+                                          algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(float) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          d_alpha,
+                                          dA,
+                                          a_type,
+                                          lda,
+                                          dB,
+                                          b_type,
+                                          ldb,
+                                          d_beta,
+                                          dC,
+                                          c_type,
+                                          ldc,
+                                          compute_type,
+                                          algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(float) * size_C, hipMemcpyDeviceToHost));
+
+        // reference BLAS in double, with the scale each element's error is relative to
+        cblas_gemm<double>(transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           h_alpha,
+                           hA_gold.data(),
+                           lda,
+                           hB_gold.data(),
+                           ldb,
+                           h_beta,
+                           hC_gold.data(),
+                           ldc);
+        cblas_gemm<double>(transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           std::abs(h_alpha),
+                           hA_abs.data(),
+                           lda,
+                           hB_abs.data(),
+                           ldb,
+                           std::abs(h_beta),
+                           hC_scale.data(),
+                           ldc);
+
+        hipblas_error_host = hipblas_error_device = 0;
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+            {
+                size_t idx   = i + j * size_t(ldc);
+                double scale = hC_scale[idx] ? hC_scale[idx] : 1.0;
+                hipblas_error_host
+                    = std::max(hipblas_error_host, std::abs(hC_host[idx] - hC_gold[idx]) / scale);
+                hipblas_error_device = std::max(hipblas_error_device,
+                                                std::abs(hC_device[idx] - hC_gold[idx]) / scale);
+            }
+
+        // the products are not exact in any mode, so unit_check also uses the bound
+        if(unit_check)
+        {
+            double bound = float32_mode_error_bound(compute_type, arg.float32_mode);
+            EXPECT_LE(hipblas_error_host, bound);
+            EXPECT_LE(hipblas_error_device, bound);
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dB,
+                                              b_type,
+                                              ldb,
+                                              &h_beta,
+                                              dC,
+                                              c_type,
+                                              ldc,
+                                              compute_type,
+                                              algo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExFloat32ModeModel{}.log_args<float>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gemm_gflop_count<float>(M, N, K),
+                                                        gemm_gbyte_count<float>(M, N, K),
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_ex_float32_mode(const Arguments& arg)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    bool single = a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F;
+    bool fast   = compute_type == HIPBLAS_R_32F_FAST || compute_type == HIPBLAS_R_32F_FAST_TF32
+                || compute_type == HIPBLAS_R_32F_FAST_16BX3;
+
+    if(single && (fast || compute_type == HIPBLAS_R_32F))
+    {
+        status = testing_gemm_ex_float32_mode_template(arg);
+    }
+    else if(fast)
+    {
+        // the fast compute types only apply to f32 data
+        hipblasLocalHandle handle(arg);
+
+        status = hipblasGemmEx(handle,
+                               char2hipblas_operation(arg.transA),
+                               char2hipblas_operation(arg.transB),
+                               arg.M,
+                               arg.N,
+                               arg.K,
+                               nullptr,
+                               nullptr,
+                               a_type,
+                               arg.lda,
+                               nullptr,
+                               b_type,
+                               arg.ldb,
+                               nullptr,
+                               nullptr,
+                               c_type,
+                               arg.ldc,
+                               compute_type,
+                               HIPBLAS_GEMM_DEFAULT);
+        EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_NOT_SUPPORTED);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
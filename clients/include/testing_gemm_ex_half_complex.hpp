@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExHalfComplexModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_ex_half_complex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExHalfComplexModel{}.test_name(arg, name);
+}
+
+// Tc is the type of C, hipblasHalfComplex or hipblasComplex; A and B are always complex half
+// with complex float compute, done by hipBLAS itself on either backend
+template <typename Tc>
+inline hipblasStatus_t testing_gemm_ex_half_complex_template(const Arguments& arg)
+{
+    using Th = hipblasHalfComplex;
+    using Tf = hipblasComplex;
+
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    Tf h_alpha = arg.get_alpha<Tf>();
+    Tf h_beta  = arg.get_beta<Tf>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < std::max(1, A_row)
+                        || ldb < std::max(1, B_row) || ldc < std::max(1, M);
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasGemmEx(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               nullptr,
+                                               nullptr,
+                                               a_type,
+                                               lda,
+                                               nullptr,
+                                               b_type,
+                                               ldb,
+                                               nullptr,
+                                               nullptr,
+                                               c_type,
+                                               ldc,
+                                               compute_type,
+                                               algo);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Th> hA(size_A);
+    host_vector<Th> hB(size_B);
+    host_vector<Th> hC_init(size_C);
+    host_vector<Tc> hC(size_C);
+    host_vector<Tc> hC_result(size_C);
+    host_vector<Tf> hA_gold(size_A);
+    host_vector<Tf> hB_gold(size_B);
+    host_vector<Tf> hC_gold(size_C);
+    host_vector<Tf> hC_host(size_C);
+    host_vector<Tf> hC_device(size_C);
+
+    device_vector<Th> dA(size_A);
+    device_vector<Th> dB(size_B);
+    device_vector<Tc> dC(size_C);
+    device_vector<Tf> d_alpha(1);
+    device_vector<Tf> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU: small integer parts, whose sums of products stay exact in half precision
+    // for the short inner dimensions tested
+    hipblas_seedrand();
+    hipblas_init(reinterpret_cast<hipblasHalf*>(hA.data()), 2 * A_row, A_col, 2 * lda);
+    hipblas_init(reinterpret_cast<hipblasHalf*>(hB.data()), 2 * B_row, B_col, 2 * ldb);
+    hipblas_init(reinterpret_cast<hipblasHalf*>(hC_init.data()), 2 * M, N, 2 * ldc);
+    for(size_t i = 0; i < size_A; i++)
+        hA_gold[i] = half_complex_widen(hA[i]);
+    for(size_t i = 0; i < size_B; i++)
+        hB_gold[i] = half_complex_widen(hB[i]);
+    for(size_t i = 0; i < size_C; i++)
+    {
+        hC_gold[i] = half_complex_widen(hC_init[i]);
+        half_complex_convert(hC_gold[i], hC[i]);
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Th) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Th) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Tf), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Tf), hipMemcpyHostToDevice));
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          &h_alpha,
+                                          dA,
+                                          a_type,
+                                          lda,
+                                          dB,
+                                          b_type,
+                                          ldb,
+                                          &h_beta,
+                                          dC,
+                                          c_type,
+                                          ldc,
+                                          compute_type,
+                                          algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_result, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size_C; i++)
+            hC_host[i] = half_complex_widen(hC_result[i]);
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          d_alpha,
+                                          dA,
+                                          a_type,
+                                          lda,
+                                          dB,
+                                          b_type,
+                                          ldb,
+                                          d_beta,
+                                          dC,
+                                          c_type,
+                                          ldc,
+                                          compute_type,
+                                          algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_result, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < size_C; i++)
+            hC_device[i] = half_complex_widen(hC_result[i]);
+
+        // a plan has no backend GEMM to prepare for complex half
+        hipblasMatmulPlan_t plan = nullptr;
+        EXPECT_HIPBLAS_STATUS(hipblasMatmulPlanCreate(handle,
+                                                      &plan,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      a_type,
+                                                      lda,
+                                                      b_type,
+                                                      ldb,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type,
+                                                      algo,
+                                                      HIPBLAS_MATMUL_EPILOGUE_DEFAULT),
+                              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+        // reference BLAS in complex float
+        cblas_gemm<Tf>(transA,
+                       transB,
+                       M,
+                       N,
+                       K,
+                       h_alpha,
+                       hA_gold.data(),
+                       lda,
+                       hB_gold.data(),
+                       ldb,
+                       h_beta,
+                       hC_gold.data(),
+                       ldc);
+
+        if(unit_check)
+        {
+            unit_check_general<Tf>(M, N, ldc, hC_gold, hC_host);
+            unit_check_general<Tf>(M, N, ldc, hC_gold, hC_device);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = std::abs(norm_check_general<Tf>('F', M, N, ldc, hC_gold, hC_host));
+            hipblas_error_device
+                = std::abs(norm_check_general<Tf>('F', M, N, ldc, hC_gold, hC_device));
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmEx(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha,
+                                              dA,
+                                              a_type,
+                                              lda,
+                                              dB,
+                                              b_type,
+                                              ldb,
+                                              &h_beta,
+                                              dC,
+                                              c_type,
+                                              ldc,
+                                              compute_type,
+                                              algo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExHalfComplexModel{}.log_args<Tf>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     gemm_gflop_count<Tf>(M, N, K),
+                                                     gemm_gbyte_count<Th>(M, N, K),
+                                                     hipblas_error_host,
+                                                     hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_ex_half_complex(const Arguments& arg)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    if(a_type == HIPBLAS_C_16F && b_type == HIPBLAS_C_16F && c_type == HIPBLAS_C_16F
+       && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_ex_half_complex_template<hipblasHalfComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_C_16F && b_type == HIPBLAS_C_16F && c_type == HIPBLAS_C_32F
+            && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_ex_half_complex_template<hipblasComplex>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
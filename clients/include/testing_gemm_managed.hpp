@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmManagedModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_gemm_managed(const Arguments& arg, std::string& name)
+{
+    hipblasGemmManagedModel{}.test_name(arg, name);
+}
+
+// A, B and C are managed memory. Each policy runs the GEMM twice, C being written on the host in
+// between, so that its pages are back on the host when the second call prefetches them.
+template <typename T>
+inline hipblasStatus_t testing_gemm_managed(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipblasManagedMemoryPolicy_t policy;
+    CHECK_HIPBLAS_ERROR(hipblasGetManagedMemoryPolicy(handle, &policy));
+    EXPECT_EQ(HIPBLAS_MANAGED_MEMORY_POLICY_NONE, policy);
+    EXPECT_HIPBLAS_STATUS(hipblasSetManagedMemoryPolicy(handle, hipblasManagedMemoryPolicy_t(3)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasGemm<T>(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                nullptr,
+                                                nullptr,
+                                                lda,
+                                                nullptr,
+                                                ldb,
+                                                nullptr,
+                                                nullptr,
+                                                ldc);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: mK is in managed memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    T *mA, *mB, *mC;
+    CHECK_HIP_ERROR(hipMallocManaged(&mA, A_size * sizeof(T)));
+    CHECK_HIP_ERROR(hipMallocManaged(&mB, B_size * sizeof(T)));
+    CHECK_HIP_ERROR(hipMallocManaged(&mC, C_size * sizeof(T)));
+    std::copy(hA.begin(), hA.end(), mA);
+    std::copy(hB.begin(), hB.end(), mB);
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    cblas_gemm<T>(transA,
+                  transB,
+                  M,
+                  N,
+                  K,
+                  h_alpha,
+                  hA.data(),
+                  lda,
+                  hB.data(),
+                  ldb,
+                  h_beta,
+                  hC_gold.data(),
+                  ldc);
+
+    /* =====================================================================
+        HIPBLAS
+    =================================================================== */
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(auto set_policy :
+        {HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH, HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE})
+    {
+        status = hipblasSetManagedMemoryPolicy(handle, set_policy);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+        CHECK_HIPBLAS_ERROR(hipblasGetManagedMemoryPolicy(handle, &policy));
+        EXPECT_EQ(set_policy, policy);
+
+        for(int call = 0; call < 2 && status == HIPBLAS_STATUS_SUCCESS; call++)
+        {
+            std::copy(hC.begin(), hC.end(), mC);
+            status = hipblasGemm<T>(
+                handle, transA, transB, M, N, K, &h_alpha, mA, lda, mB, ldb, &h_beta, mC, ldc);
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            if(status == HIPBLAS_STATUS_SUCCESS && arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold, mC);
+            if(status == HIPBLAS_STATUS_SUCCESS && arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error, std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, mC)));
+        }
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(
+            hipblasSetManagedMemoryPolicy(handle, HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemm<T>(
+                handle, transA, transB, M, N, K, &h_alpha, mA, lda, mB, ldb, &h_beta, mC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmManagedModel{}.log_args<T>(std::cout,
+                                              arg,
+                                              gpu_time_used,
+                                              gemm_gflop_count<T>(M, N, K),
+                                              gemm_gbyte_count<T>(M, N, K),
+                                              hipblas_error);
+    }
+
+    CHECK_HIP_ERROR(hipFree(mA));
+    CHECK_HIP_ERROR(hipFree(mB));
+    CHECK_HIP_ERROR(hipFree(mC));
+    return status;
+}
@@ -0,0 +1,370 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmScaledExModel = ArgumentModel<e_transA,
+                                               e_transB,
+                                               e_side,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc>;
+
+inline void testname_gemm_scaled_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmScaledExModel{}.test_name(arg, name);
+}
+
+// side picks the scale vectors passed: 'L' gives only rowScale, 'R' only colScale, and anything
+// else both
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_scaled_ex_template(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+    bool               by_row = arg.side != 'R';
+    bool               by_col = arg.side != 'L';
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    Tex h_alpha_Tc = arg.get_alpha<Tex>();
+    Tex h_beta_Tc  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasGemmScaledEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     nullptr,
+                                                     nullptr,
+                                                     a_type,
+                                                     lda,
+                                                     nullptr,
+                                                     b_type,
+                                                     ldb,
+                                                     nullptr,
+                                                     nullptr,
+                                                     c_type,
+                                                     ldc,
+                                                     nullptr,
+                                                     nullptr,
+                                                     compute_type,
+                                                     algo);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+    const size_t size_P = static_cast<size_t>(M) * static_cast<size_t>(N);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta> hA(size_A);
+    host_vector<Tb> hB(size_B);
+    host_vector<Tc> hC_host(size_C);
+    host_vector<Tc> hC_device(size_C);
+    host_vector<Tc> hC_gold(size_C);
+    host_vector<Tc> h_row(M);
+    host_vector<Tc> h_col(N);
+
+    device_vector<Ta>  dA(size_A);
+    device_vector<Tb>  dB(size_B);
+    device_vector<Tc>  dC(size_C);
+    device_vector<Tc>  d_row(M);
+    device_vector<Tc>  d_col(N);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    const Tc* row_scale = by_row ? (const Tc*)d_row : nullptr;
+    const Tc* col_scale = by_col ? (const Tc*)d_col : nullptr;
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU, with scales that keep the integer data exact whatever the order in
+    // which the library applies them
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_host, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC_device = hC_host;
+
+    for(int i = 0; i < M; i++)
+        h_row[i] = Tc(0.5 * (i % 4 + 1));
+    for(int j = 0; j < N; j++)
+        h_col[j] = Tc(0.25 * (j % 4 + 1));
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_row, h_row, sizeof(Tc) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_col, h_col, sizeof(Tc) * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        hipblasStatus_t status = hipblasGemmScaledEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha_Tc,
+                                                     dA,
+                                                     a_type,
+                                                     lda,
+                                                     dB,
+                                                     b_type,
+                                                     ldb,
+                                                     &h_beta_Tc,
+                                                     dC,
+                                                     c_type,
+                                                     ldc,
+                                                     row_scale,
+                                                     col_scale,
+                                                     compute_type,
+                                                     algo);
+
+#ifndef __HIP_PLATFORM_NVCC__
+        // rocBLAS has no int8 GEMM with a floating-point output
+        if(std::is_same<Ta, int8_t>{} && !std::is_same<Tc, int32_t>{})
+        {
+            EXPECT_HIPBLAS_STATUS(status, HIPBLAS_STATUS_NOT_SUPPORTED);
+            return status;
+        }
+#endif
+        CHECK_HIPBLAS_ERROR(status);
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmScaledEx(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                d_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                dB,
+                                                b_type,
+                                                ldb,
+                                                d_beta,
+                                                dC,
+                                                c_type,
+                                                ldc,
+                                                row_scale,
+                                                col_scale,
+                                                compute_type,
+                                                algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+
+        // reference BLAS: the unscaled product op( A )*op( B ) in the type of C, with the scales,
+        // alpha and beta*C applied to it on the host
+        host_vector<Tc> hA_c(size_A);
+        host_vector<Tc> hB_c(size_B);
+        host_vector<Tc> hP(size_P);
+        for(size_t i = 0; i < size_A; i++)
+            hA_c[i] = Tc(hA[i]);
+        for(size_t i = 0; i < size_B; i++)
+            hB_c[i] = Tc(hB[i]);
+
+        cblas_gemm<Tc>(transA,
+                       transB,
+                       M,
+                       N,
+                       K,
+                       Tc(1),
+                       hA_c.data(),
+                       lda,
+                       hB_c.data(),
+                       ldb,
+                       Tc(0),
+                       hP.data(),
+                       M);
+
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+            {
+                Tc  p = hP[i + j * size_t(M)];
+                Tc& c = hC_gold[i + j * size_t(ldc)];
+                if(by_row)
+                    p = h_row[i] * p;
+                if(by_col)
+                    p = p * h_col[j];
+                c = h_alpha_Tc * p + h_beta_Tc * c;
+            }
+
+        if(unit_check)
+        {
+            unit_check_general<Tc>(M, N, ldc, hC_gold, hC_host);
+            unit_check_general<Tc>(M, N, ldc, hC_gold, hC_device);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = std::abs(norm_check_general<Tc>('F', M, N, ldc, hC_gold, hC_host));
+            hipblas_error_device
+                = std::abs(norm_check_general<Tc>('F', M, N, ldc, hC_gold, hC_device));
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmScaledEx(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &h_alpha_Tc,
+                                                    dA,
+                                                    a_type,
+                                                    lda,
+                                                    dB,
+                                                    b_type,
+                                                    ldb,
+                                                    &h_beta_Tc,
+                                                    dC,
+                                                    c_type,
+                                                    ldc,
+                                                    row_scale,
+                                                    col_scale,
+                                                    compute_type,
+                                                    algo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmScaledExModel{}.log_args<Tc>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gemm_gflop_count<Tex>(M, N, K),
+                                                gemm_gbyte_count<Tex>(M, N, K),
+                                                hipblas_error_host,
+                                                hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_scaled_ex(const Arguments& arg)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+       && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_scaled_ex_template<float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_scaled_ex_template<double>(arg);
+    }
+    else if(a_type == HIPBLAS_C_32F && b_type == HIPBLAS_C_32F && c_type == HIPBLAS_C_32F
+            && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_scaled_ex_template<hipblasComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_C_64F && b_type == HIPBLAS_C_64F && c_type == HIPBLAS_C_64F
+            && compute_type == HIPBLAS_C_64F)
+    {
+        status = testing_gemm_scaled_ex_template<hipblasDoubleComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_R_8I && b_type == HIPBLAS_R_8I && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_scaled_ex_template<int8_t, int8_t, float, float>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
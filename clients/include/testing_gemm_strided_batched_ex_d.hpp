@@ -0,0 +1,446 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatchedExDModel = ArgumentModel<e_transA,
+                                                        e_transB,
+                                                        e_M,
+                                                        e_N,
+                                                        e_K,
+                                                        e_alpha,
+                                                        e_lda,
+                                                        e_ldb,
+                                                        e_beta,
+                                                        e_ldc,
+                                                        e_ldd,
+                                                        e_stride_scale,
+                                                        e_batch_count>;
+
+inline void testname_gemm_strided_batched_ex_d(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedExDModel{}.test_name(arg, name);
+}
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_strided_batched_ex_d_template(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+    int                ldd    = arg.ldd;
+
+    // D has the type of C
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    Tex h_alpha_Tc = arg.get_alpha<Tex>();
+    Tex h_beta_Tc  = arg.get_beta<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || ldd < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemmStridedBatchedExD(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              nullptr,
+                                                              nullptr,
+                                                              a_type,
+                                                              lda,
+                                                              0,
+                                                              nullptr,
+                                                              b_type,
+                                                              ldb,
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              c_type,
+                                                              ldc,
+                                                              0,
+                                                              nullptr,
+                                                              c_type,
+                                                              ldd,
+                                                              0,
+                                                              batch_count,
+                                                              compute_type,
+                                                              algo);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    // A stride_scale of 0 shares A and B between all the members of the batch
+    hipblasStride stride_A = size_t(lda) * A_col * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * B_col * stride_scale;
+    hipblasStride stride_C = size_t(ldc) * N;
+    hipblasStride stride_D = size_t(ldd) * N;
+    int           A_count  = stride_A ? batch_count : 1;
+    int           B_count  = stride_B ? batch_count : 1;
+
+    const size_t size_A = stride_A ? stride_A * batch_count : size_t(lda) * A_col;
+    const size_t size_B = stride_B ? stride_B * batch_count : size_t(ldb) * B_col;
+    const size_t size_C = stride_C * batch_count;
+    const size_t size_D = stride_D * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta> hA(size_A);
+    host_vector<Tb> hB(size_B);
+    host_vector<Tc> hC(size_C);
+    host_vector<Tc> hC_out(size_C);
+    host_vector<Tc> hD(size_D);
+    host_vector<Tc> hD_host(size_D);
+    host_vector<Tc> hD_device(size_D);
+    host_vector<Tc> hD_gold(size_D);
+
+    device_vector<Ta>  dA(size_A);
+    device_vector<Tb>  dB(size_B);
+    device_vector<Tc>  dC(size_C);
+    device_vector<Tc>  dD(size_D);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, A_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, B_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hipblas_init_matrix(hD, arg, M, N, ldd, stride_D, batch_count, hipblas_client_never_set_nan);
+
+    // D starts as C, in the layout of D
+    hD_gold = hD;
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hD_gold[b * stride_D + i + j * size_t(ldd)]
+                    = hC[b * stride_C + i + j * size_t(ldc)];
+
+    // copy data from CPU to device
+#ifdef __HIP_PLATFORM_NVCC__
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+#else
+    if(std::is_same<Ta, int8_t>{} && transA == HIPBLAS_OP_N && layout_pack_int8(handle))
+    {
+        host_vector<Ta> hA_packed(hA);
+        hipblas_packInt8(hA_packed, M, K, lda, A_count, stride_A);
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA_packed, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    }
+
+    if(std::is_same<Tb, int8_t>{} && transB != HIPBLAS_OP_N && layout_pack_int8(handle))
+    {
+        host_vector<Tb> hB_packed(hB);
+        hipblas_packInt8(hB_packed, N, K, ldb, B_count, stride_B);
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB_packed, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+    }
+#endif
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD, hD, sizeof(Tc) * size_D, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tc, sizeof(Tex), hipMemcpyHostToDevice));
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExD(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         &h_alpha_Tc,
+                                                         dA,
+                                                         a_type,
+                                                         lda,
+                                                         stride_A,
+                                                         dB,
+                                                         b_type,
+                                                         ldb,
+                                                         stride_B,
+                                                         &h_beta_Tc,
+                                                         dC,
+                                                         c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         dD,
+                                                         c_type,
+                                                         ldd,
+                                                         stride_D,
+                                                         batch_count,
+                                                         compute_type,
+                                                         algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hD_host, dD, sizeof(Tc) * size_D, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dD, hD, sizeof(Tc) * size_D, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExD(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         d_alpha,
+                                                         dA,
+                                                         a_type,
+                                                         lda,
+                                                         stride_A,
+                                                         dB,
+                                                         b_type,
+                                                         ldb,
+                                                         stride_B,
+                                                         d_beta,
+                                                         dC,
+                                                         c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         dD,
+                                                         c_type,
+                                                         ldd,
+                                                         stride_D,
+                                                         batch_count,
+                                                         compute_type,
+                                                         algo));
+
+        CHECK_HIP_ERROR(hipMemcpy(hD_device, dD, sizeof(Tc) * size_D, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<Ta, Tc, Tex>(transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    h_alpha_Tc,
+                                    hA.data() + b * stride_A,
+                                    lda,
+                                    hB.data() + b * stride_B,
+                                    ldb,
+                                    h_beta_Tc,
+                                    hD_gold.data() + b * stride_D,
+                                    ldd);
+        }
+
+        if(unit_check)
+        {
+            // check for float16/bfloat16 input
+            if((getArchMajor() == 11)
+               && ((std::is_same<Tex, float>{} && std::is_same<Ta, hipblasBfloat16>{})
+                   || (std::is_same<Tex, float>{} && std::is_same<Ta, hipblasHalf>{})
+                   || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ta, hipblasHalf>{})))
+            {
+                const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ta, Tc>;
+                near_check_general<Tc>(M, N, batch_count, ldd, stride_D, hD_gold, hD_host, tol);
+                near_check_general<Tc>(M, N, batch_count, ldd, stride_D, hD_gold, hD_device, tol);
+            }
+            else
+            {
+                unit_check_general<Tc>(M, N, batch_count, ldd, stride_D, hD_gold, hD_host);
+                unit_check_general<Tc>(M, N, batch_count, ldd, stride_D, hD_gold, hD_device);
+            }
+
+            // C is only read
+            unit_check_general<Tc>(M, N, batch_count, ldc, stride_C, hC, hC_out);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<Tc>('F', M, N, ldd, stride_D, hD_gold, hD_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<Tc>('F', M, N, ldd, stride_D, hD_gold, hD_device, batch_count);
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExD(handle,
+                                                             transA,
+                                                             transB,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             &h_alpha_Tc,
+                                                             dA,
+                                                             a_type,
+                                                             lda,
+                                                             stride_A,
+                                                             dB,
+                                                             b_type,
+                                                             ldb,
+                                                             stride_B,
+                                                             &h_beta_Tc,
+                                                             dC,
+                                                             c_type,
+                                                             ldc,
+                                                             stride_C,
+                                                             dD,
+                                                             c_type,
+                                                             ldd,
+                                                             stride_D,
+                                                             batch_count,
+                                                             compute_type,
+                                                             algo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmStridedBatchedExDModel{}.log_args<Tc>(std::cout,
+                                                         arg,
+                                                         gpu_time_used,
+                                                         gemm_gflop_count<Tex>(M, N, K),
+                                                         gemm_gbyte_count<Tex>(M, N, K),
+                                                         hipblas_error_host,
+                                                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_gemm_strided_batched_ex_d(const Arguments& arg)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t d_type       = arg.d_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    if(d_type != c_type)
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_16F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<hipblasHalf>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<hipblasHalf,
+                                                            hipblasHalf,
+                                                            hipblasHalf,
+                                                            float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<hipblasBfloat16,
+                                                            hipblasBfloat16,
+                                                            hipblasBfloat16,
+                                                            float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<double>(arg);
+    }
+    else if(a_type == HIPBLAS_C_32F && b_type == HIPBLAS_C_32F && c_type == HIPBLAS_C_32F
+            && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<hipblasComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_C_64F && b_type == HIPBLAS_C_64F && c_type == HIPBLAS_C_64F
+            && compute_type == HIPBLAS_C_64F)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<hipblasDoubleComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_R_8I && b_type == HIPBLAS_R_8I && c_type == HIPBLAS_R_32I
+            && compute_type == HIPBLAS_R_32I)
+    {
+        status = testing_gemm_strided_batched_ex_d_template<int8_t, int8_t, int32_t, int32_t>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
@@ -0,0 +1,281 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmStridedBatchedVecModel = ArgumentModel<e_transA,
+                                                        e_transB,
+                                                        e_M,
+                                                        e_N,
+                                                        e_K,
+                                                        e_alpha,
+                                                        e_lda,
+                                                        e_ldb,
+                                                        e_beta,
+                                                        e_ldc,
+                                                        e_stride_scale,
+                                                        e_batch_count>;
+
+inline void testname_gemm_strided_batched_vec(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedVecModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemm_strided_batched_vec(const Arguments& arg)
+{
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
+    int                M            = arg.M;
+    int                N            = arg.N;
+    int                K            = arg.K;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    int                ldc          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasStride stride_A = size_t(lda) * A_col * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * B_col * stride_scale;
+    hipblasStride stride_C = size_t(ldc) * N * stride_scale;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < std::max(1, A_row)
+                        || ldb < std::max(1, B_row) || ldc < std::max(1, M)
+                        || (batch_count > 1 && stride_C < hipblasStride(ldc) * N);
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemmStridedBatchedVec<T>(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 lda,
+                                                                 stride_A,
+                                                                 nullptr,
+                                                                 ldb,
+                                                                 stride_B,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 ldc,
+                                                                 stride_C,
+                                                                 batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size = stride_A * batch_count;
+    size_t B_size = stride_B * batch_count;
+    size_t C_size = stride_C * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> h_alpha(batch_count);
+    host_vector<T> h_beta(batch_count);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(batch_count);
+    device_vector<T> d_beta(batch_count);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU, with a different alpha for every member and beta alternating between
+    // zero and the given value. C_i is NaN where beta_i is zero, as it must not be read.
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(
+        hC_host, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        h_alpha[b] = arg.get_alpha<T>() * T(b + 1);
+        h_beta[b]  = b % 2 ? arg.get_beta<T>() : T(0);
+        for(int j = 0; j < N && b % 2 == 0; j++)
+            for(int i = 0; i < M; i++)
+                hC_host[i + j * size_t(ldc) + b * stride_C] = T(hipblas_nan_rng());
+    }
+    hC_device = hC_gold = hC_host;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, h_alpha, sizeof(T) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, h_beta, sizeof(T) * batch_count, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedVec<T>(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            h_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            ldb,
+                                                            stride_B,
+                                                            h_beta,
+                                                            dC,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedVec<T>(handle,
+                                                            transA,
+                                                            transB,
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            d_alpha,
+                                                            dA,
+                                                            lda,
+                                                            stride_A,
+                                                            dB,
+                                                            ldb,
+                                                            stride_B,
+                                                            d_beta,
+                                                            dC,
+                                                            ldc,
+                                                            stride_C,
+                                                            batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha[b],
+                          hA.data() + b * stride_A,
+                          lda,
+                          hB.data() + b * stride_B,
+                          ldb,
+                          h_beta[b],
+                          hC_gold.data() + b * stride_C,
+                          ldc);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_host, batch_count));
+            hipblas_error_device = std::abs(
+                norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC_device, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedVec<T>(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                d_alpha,
+                                                                dA,
+                                                                lda,
+                                                                stride_A,
+                                                                dB,
+                                                                ldb,
+                                                                stride_B,
+                                                                d_beta,
+                                                                dC,
+                                                                ldc,
+                                                                stride_C,
+                                                                batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmStridedBatchedVecModel{}.log_args<T>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gemm_gflop_count<T>(M, N, K) * batch_count,
+                                                        gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,265 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "gemmt_reference.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmtBatchedModel = ArgumentModel<e_uplo,
+                                               e_transA,
+                                               e_transB,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_gemmt_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmtBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemmt_batched(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? N : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : N;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_enum = uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER;
+    bool invalid_size = N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < N || batch_count < 0;
+    if(invalid_enum || invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemmtBatched<T>(handle,
+                                                        uplo,
+                                                        transA,
+                                                        transB,
+                                                        N,
+                                                        K,
+                                                        nullptr,
+                                                        nullptr,
+                                                        lda,
+                                                        nullptr,
+                                                        ldb,
+                                                        nullptr,
+                                                        nullptr,
+                                                        ldc,
+                                                        batch_count);
+
+        // the fill mode is checked before the sizes
+        hipblasStatus_t expected = HIPBLAS_STATUS_SUCCESS;
+        if(invalid_enum)
+            expected = HIPBLAS_STATUS_INVALID_ENUM;
+        else if(invalid_size)
+            expected = HIPBLAS_STATUS_INVALID_VALUE;
+        EXPECT_HIPBLAS_STATUS(actual, expected);
+        return actual;
+    }
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hC_host(C_size, 1, batch_count);
+    host_batch_vector<T> hC_device(C_size, 1, batch_count);
+    host_batch_vector<T> hC_gold(C_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+    device_batch_vector<T> dC(C_size, 1, batch_count);
+    device_vector<T>       d_alpha(1);
+    device_vector<T>       d_beta(1);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmtBatched<T>(handle,
+                                                   uplo,
+                                                   transA,
+                                                   transB,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   dB.ptr_on_device(),
+                                                   ldb,
+                                                   &h_beta,
+                                                   dC.ptr_on_device(),
+                                                   ldc,
+                                                   batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmtBatched<T>(handle,
+                                                   uplo,
+                                                   transA,
+                                                   transB,
+                                                   N,
+                                                   K,
+                                                   d_alpha,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   dB.ptr_on_device(),
+                                                   ldb,
+                                                   d_beta,
+                                                   dC.ptr_on_device(),
+                                                   ldc,
+                                                   batch_count));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            gemmt_reference<T>(uplo,
+                               transA,
+                               transB,
+                               N,
+                               K,
+                               h_alpha,
+                               hA[b],
+                               lda,
+                               hB[b],
+                               ldb,
+                               h_beta,
+                               hC_gold[b],
+                               ldc);
+        }
+
+        // the whole of each C_i is compared, so the other triangle must be left as it was
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_host);
+            unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_host, batch_count));
+            hipblas_error_device
+                = std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_device, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmtBatched<T>(handle,
+                                                       uplo,
+                                                       transA,
+                                                       transB,
+                                                       N,
+                                                       K,
+                                                       d_alpha,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dB.ptr_on_device(),
+                                                       ldb,
+                                                       d_beta,
+                                                       dC.ptr_on_device(),
+                                                       ldc,
+                                                       batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // a triangle of a GEMM counts like syrkx
+        hipblasGemmtBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               syrkx_gflop_count<T>(N, K),
+                                               syrkx_gbyte_count<T>(N, K),
+                                               hipblas_error_host,
+                                               hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
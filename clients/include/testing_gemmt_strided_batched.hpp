@@ -0,0 +1,279 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "gemmt_reference.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmtStridedBatchedModel = ArgumentModel<e_uplo,
+                                                      e_transA,
+                                                      e_transB,
+                                                      e_N,
+                                                      e_K,
+                                                      e_alpha,
+                                                      e_lda,
+                                                      e_ldb,
+                                                      e_beta,
+                                                      e_ldc,
+                                                      e_stride_scale,
+                                                      e_batch_count>;
+
+inline void testname_gemmt_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmtStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_gemmt_strided_batched(const Arguments& arg)
+{
+    hipblasFillMode_t  uplo         = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA       = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB       = char2hipblas_operation(arg.transB);
+    int                N            = arg.N;
+    int                K            = arg.K;
+    int                lda          = arg.lda;
+    int                ldb          = arg.ldb;
+    int                ldc          = arg.ldc;
+    double             stride_scale = arg.stride_scale;
+    int                batch_count  = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? N : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : N;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_enum = uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER;
+    bool invalid_size = N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < N || batch_count < 0;
+    if(invalid_enum || invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGemmtStridedBatched<T>(handle,
+                                                               uplo,
+                                                               transA,
+                                                               transB,
+                                                               N,
+                                                               K,
+                                                               nullptr,
+                                                               nullptr,
+                                                               lda,
+                                                               0,
+                                                               nullptr,
+                                                               ldb,
+                                                               0,
+                                                               nullptr,
+                                                               nullptr,
+                                                               ldc,
+                                                               0,
+                                                               batch_count);
+
+        // the fill mode is checked before the sizes
+        hipblasStatus_t expected = HIPBLAS_STATUS_SUCCESS;
+        if(invalid_enum)
+            expected = HIPBLAS_STATUS_INVALID_ENUM;
+        else if(invalid_size)
+            expected = HIPBLAS_STATUS_INVALID_VALUE;
+        EXPECT_HIPBLAS_STATUS(actual, expected);
+        return actual;
+    }
+
+    hipblasStride stride_A = size_t(lda) * A_col * stride_scale;
+    hipblasStride stride_B = size_t(ldb) * B_col * stride_scale;
+    hipblasStride stride_C = size_t(ldc) * N * stride_scale;
+    size_t        A_size   = stride_A * batch_count;
+    size_t        B_size   = stride_B * batch_count;
+    size_t        C_size   = stride_C * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(
+        hC_host, arg, N, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hC_device = hC_gold = hC_host;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmtStridedBatched<T>(handle,
+                                                          uplo,
+                                                          transA,
+                                                          transB,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          dA,
+                                                          lda,
+                                                          stride_A,
+                                                          dB,
+                                                          ldb,
+                                                          stride_B,
+                                                          &h_beta,
+                                                          dC,
+                                                          ldc,
+                                                          stride_C,
+                                                          batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmtStridedBatched<T>(handle,
+                                                          uplo,
+                                                          transA,
+                                                          transB,
+                                                          N,
+                                                          K,
+                                                          d_alpha,
+                                                          dA,
+                                                          lda,
+                                                          stride_A,
+                                                          dB,
+                                                          ldb,
+                                                          stride_B,
+                                                          d_beta,
+                                                          dC,
+                                                          ldc,
+                                                          stride_C,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            gemmt_reference<T>(uplo,
+                               transA,
+                               transB,
+                               N,
+                               K,
+                               h_alpha,
+                               hA.data() + b * stride_A,
+                               lda,
+                               hB.data() + b * stride_B,
+                               ldb,
+                               h_beta,
+                               hC_gold.data() + b * stride_C,
+                               ldc);
+        }
+
+        // the whole of each C_i is compared, so the other triangle must be left as it was
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(N, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            unit_check_general<T>(N, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = std::abs(
+                norm_check_general<T>('F', N, N, ldc, stride_C, hC_gold, hC_host, batch_count));
+            hipblas_error_device = std::abs(
+                norm_check_general<T>('F', N, N, ldc, stride_C, hC_gold, hC_device, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmtStridedBatched<T>(handle,
+                                                              uplo,
+                                                              transA,
+                                                              transB,
+                                                              N,
+                                                              K,
+                                                              d_alpha,
+                                                              dA,
+                                                              lda,
+                                                              stride_A,
+                                                              dB,
+                                                              ldb,
+                                                              stride_B,
+                                                              d_beta,
+                                                              dC,
+                                                              ldc,
+                                                              stride_C,
+                                                              batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // a triangle of a GEMM counts like syrkx
+        hipblasGemmtStridedBatchedModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      syrkx_gflop_count<T>(N, K),
+                                                      syrkx_gbyte_count<T>(N, K),
+                                                      hipblas_error_host,
+                                                      hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
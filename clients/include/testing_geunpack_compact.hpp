@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "compact_reference.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGeunpackCompactModel
+    = ArgumentModel<e_M, e_N, e_lda, e_ldc, e_stride_scale, e_batch_count>;
+
+inline void testname_geunpack_compact(const Arguments& arg, std::string& name)
+{
+    hipblasGeunpackCompactModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_geunpack_compact(const Arguments& arg)
+{
+    int    M            = arg.M;
+    int    N            = arg.N;
+    int    lda          = arg.lda;
+    int    ldac         = arg.ldc;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride stride_A = size_t(lda) * N * stride_scale;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || batch_count < 0 || lda < std::max(1, M)
+                        || ldac < std::max(1, M)
+                        || (batch_count > 1 && stride_A < hipblasStride(lda) * N);
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGeunpackCompact<T>(
+            handle, M, N, nullptr, ldac, nullptr, lda, stride_A, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = stride_A * batch_count;
+    size_t Ac_size = size_t(ldac) * N * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAc(Ac_size);
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dAc(Ac_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU, the compact matrices being M * batch_count rows of ldac * batch_count
+    hipblas_init_matrix(
+        hAc, arg, M * batch_count, N, ldac * batch_count, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hA, arg, M, N, lda, stride_A, batch_count, hipblas_client_never_set_nan);
+    hA_gold = hA;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dAc, hAc, sizeof(T) * Ac_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(
+            hipblasGeunpackCompact<T>(handle, M, N, dAc, ldac, dA, lda, stride_A, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA, dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        compact_unpack_reference<T>(M, N, hAc, ldac, hA_gold, lda, stride_A, batch_count);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, lda, stride_A, hA_gold, hA);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error
+                = norm_check_general<T>('F', M, N, lda, stride_A, hA_gold, hA, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGeunpackCompact<T>(
+                handle, M, N, dAc, ldac, dA, lda, stride_A, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGeunpackCompactModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                ArgumentLogging::NA_value,
+                                                copy_gbyte_count<T>(M * N * batch_count),
+                                                hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
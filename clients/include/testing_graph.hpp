@@ -0,0 +1,174 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGraphModel = ArgumentModel<e_N, e_alpha, e_beta, e_incy>;
+
+inline void testname_graph(const Arguments& arg, std::string& name)
+{
+    hipblasGraphModel{}.test_name(arg, name);
+}
+
+// One step of a conjugate gradient style iteration recorded into a graph:
+//     y = beta * y + alpha * x, r0 = y . x, r1 = y . z, r2 = ||y||
+// The scal and axpy are combined into one call, the two dots into one GEMV and the nrm2 is
+// captured unchanged.
+template <typename T>
+inline hipblasStatus_t testing_graph(const Arguments& arg)
+{
+    auto hipblasScalFn = hipblasScal<T, T, false>;
+    auto hipblasAxpyFn = hipblasAxpy<T, false>;
+    auto hipblasDotFn  = hipblasDot<T, false>;
+    auto hipblasNrm2Fn = hipblasNrm2<T, T, false>;
+
+    int N    = arg.N;
+    int incy = arg.incy;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // check to prevent undefined memory allocation error
+    if(N <= 0 || incy <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    size_t size_y = size_t(N) * incy;
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+    hipblasGraph_t     graph = nullptr;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    // x and z are adjacent in hxz, so that the dots against them can be combined
+    host_vector<T> hxz(2 * size_t(N));
+    host_vector<T> hy(size_y);
+    host_vector<T> hy_gold(size_y);
+    host_vector<T> hresult(3);
+    host_vector<T> hresult_gold(3);
+
+    device_vector<T> dxz(2 * size_t(N));
+    device_vector<T> dy(size_y);
+    device_vector<T> d_result(3);
+
+    // Initial Data on CPU
+    hipblas_init_vector(hxz, arg, 2 * size_t(N), 1, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hy, arg, N, incy, 0, 1, hipblas_client_beta_sets_nan);
+    hy_gold = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dxz, hxz, sizeof(T) * hxz.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+        HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasGraphBegin(handle));
+    EXPECT_HIPBLAS_STATUS(hipblasGraphBegin(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasScalFn(handle, N, &h_beta, dy, incy));
+    CHECK_HIPBLAS_ERROR(hipblasAxpyFn(handle, N, &h_alpha, dxz, 1, dy, incy));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasDotFn(handle, N, dy, incy, dxz, 1, d_result));
+    CHECK_HIPBLAS_ERROR(hipblasDotFn(handle, N, dy, incy, dxz + N, 1, d_result + 1));
+    CHECK_HIPBLAS_ERROR(hipblasNrm2Fn(handle, N, dy, incy, d_result + 2));
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphEnd(handle, &graph));
+    EXPECT_HIPBLAS_STATUS(hipblasGraphEnd(handle, &graph), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Nothing has run yet, and the default stream is restored after the capture
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+    EXPECT_EQ(nullptr, stream);
+
+    CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+    unit_check_general<T>(1, N, incy, hy_gold, hy);
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphLaunch(graph, stream));
+    CHECK_HIP_ERROR(hipMemcpy(hy, dy, sizeof(T) * size_y, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hresult, d_result, sizeof(T) * 3, hipMemcpyDeviceToHost));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_scal<T>(N, h_beta, hy_gold.data(), incy);
+        cblas_axpy<T>(N, h_alpha, hxz.data(), 1, hy_gold.data(), incy);
+        cblas_dot<T>(N, hy_gold.data(), incy, hxz.data(), 1, &hresult_gold[0]);
+        cblas_dot<T>(N, hy_gold.data(), incy, hxz.data() + N, 1, &hresult_gold[1]);
+        cblas_nrm2<T, T>(N, hy_gold.data(), incy, &hresult_gold[2]);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, incy, hy_gold, hy);
+            unit_check_general<T>(1, 2, 1, hresult_gold, hresult);
+            unit_check_nrm2<T>(hresult_gold[2], hresult[2], N);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, N, incy, hy_gold, hy);
+            hipblas_error = std::max(hipblas_error,
+                                     vector_norm_1(3, 1, hresult_gold.data(), hresult.data()));
+        }
+    }
+
+    if(arg.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGraphLaunch(graph, stream));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // counted as the calls recorded, not the fewer calls issued
+        hipblasGraphModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            scal_gflop_count<T, T>(N) + axpy_gflop_count<T>(N) + 2 * dot_gflop_count<false, T>(N)
+                + nrm2_gflop_count<T>(N),
+            scal_gbyte_count<T>(N) + axpy_gbyte_count<T>(N) + 2 * dot_gbyte_count<T>(N)
+                + nrm2_gbyte_count<T>(N),
+            hipblas_error);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasGraphDestroy(graph));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
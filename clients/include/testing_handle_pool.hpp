@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasHandlePoolModel = ArgumentModel<e_transA,
+                                             e_transB,
+                                             e_M,
+                                             e_N,
+                                             e_K,
+                                             e_alpha,
+                                             e_lda,
+                                             e_ldb,
+                                             e_beta,
+                                             e_ldc,
+                                             e_batch_count>;
+
+inline void testname_handle_pool(const Arguments& arg, std::string& name)
+{
+    hipblasHandlePoolModel{}.test_name(arg, name);
+}
+
+// Two handles are taken from a pool. The first is given a stream and the device pointer mode, is
+// warmed up for the strided batched GEMM of the arguments and then runs it. Released handles
+// must come back with the settings hipblasCreate gives them.
+template <typename T>
+inline hipblasStatus_t testing_handle_pool(const Arguments& arg)
+{
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasDatatype_t type = std::is_same<T, double>{}                 ? HIPBLAS_R_64F
+                             : std::is_same<T, hipblasComplex>{}       ? HIPBLAS_C_32F
+                             : std::is_same<T, hipblasDoubleComplex>{} ? HIPBLAS_C_64F
+                                                                       : HIPBLAS_R_32F;
+    hipblasGemmShape_t shape = {transA, transB, M, N, K, type, type, type, type, batch_count};
+
+    double gpu_time_used, hipblas_error = 0.0;
+
+    hipblasHandlePool_t pool;
+    hipblasStatus_t     status = hipblasHandlePoolCreate(&pool);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolReserve(pool, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolReserve(pool, 2));
+
+    hipblasHandle_t first, second, third;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, &first));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, &second));
+    EXPECT_NE(first, second);
+
+    hipStream_t stream, current;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(first, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(first, HIPBLAS_POINTER_MODE_DEVICE));
+
+    // The leading dimensions are left to the GEMM, the warm up choosing its own
+    bool invalid_size = M < 0 || N < 0 || K < 0 || batch_count < 0;
+    status            = hipblasWarmup(first, &shape, 1);
+    if(status == HIPBLAS_STATUS_SUCCESS && !invalid_size && M && N && batch_count)
+    {
+        // The warm up leaves the pointer mode alone
+        hipblasPointerMode_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(first, &mode));
+        EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+
+        hipblasStride stride_A = size_t(lda) * A_col;
+        hipblasStride stride_B = size_t(ldb) * B_col;
+        hipblasStride stride_C = size_t(ldc) * N;
+        size_t        A_size   = stride_A * batch_count;
+        size_t        B_size   = stride_B * batch_count;
+        size_t        C_size   = stride_C * batch_count;
+
+        // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<T> hA(A_size);
+        host_vector<T> hB(B_size);
+        host_vector<T> hC(C_size);
+        host_vector<T> hC_gold(C_size);
+
+        device_vector<T> dA(A_size);
+        device_vector<T> dB(B_size);
+        device_vector<T> dC(C_size);
+        device_vector<T> d_alpha(1);
+        device_vector<T> d_beta(1);
+
+        // Initial Data on CPU
+        hipblas_init_matrix(
+            hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_matrix(
+            hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+        hipblas_init_matrix(
+            hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+        hC_gold = hC;
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        status = hipblasGemmStridedBatched<T>(first,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              d_alpha,
+                                              dA,
+                                              lda,
+                                              stride_A,
+                                              dB,
+                                              ldb,
+                                              stride_B,
+                                              d_beta,
+                                              dC,
+                                              ldc,
+                                              stride_C,
+                                              batch_count);
+        CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int i = 0; i < batch_count; i++)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data() + stride_A * i,
+                          lda,
+                          hB.data() + stride_B * i,
+                          ldb,
+                          h_beta,
+                          hC_gold.data() + stride_C * i,
+                          ldc);
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS && arg.unit_check)
+            unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC_gold, hC);
+        if(status == HIPBLAS_STATUS_SUCCESS && arg.norm_check)
+            hipblas_error
+                = norm_check_general<T>('F', M, N, ldc, stride_C, hC_gold, hC, batch_count);
+    }
+    else if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        EXPECT_HIPBLAS_STATUS(
+            status, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.timing)
+    {
+        // Cost of preparing a handle for the shape
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasWarmup(first, &shape, 1));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasHandlePoolModel{}.log_args<T>(std::cout,
+                                             arg,
+                                             gpu_time_used,
+                                             batch_count * gemm_gflop_count<T>(M, N, K),
+                                             batch_count * gemm_gbyte_count<T>(M, N, K),
+                                             hipblas_error);
+    }
+
+    // Released handles are reset, and can only be released once
+    hipblasPointerMode_t mode;
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, first));
+    EXPECT_HIPBLAS_STATUS(hipblasHandlePoolRelease(pool, first), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolAcquire(pool, &third));
+    EXPECT_EQ(first, third);
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(third, &current));
+    EXPECT_EQ(nullptr, current);
+    CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(third, &mode));
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, mode);
+
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, second));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolRelease(pool, third));
+    CHECK_HIPBLAS_ERROR(hipblasHandlePoolDestroy(pool));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return status;
+}
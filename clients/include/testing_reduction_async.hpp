@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasReductionAsyncModel = ArgumentModel<e_N, e_incx, e_incy>;
+
+inline void testname_reduction_async(const Arguments& arg, std::string& name)
+{
+    hipblasReductionAsyncModel{}.test_name(arg, name);
+}
+
+// dot, nrm2, asum and iamax write pinned host results in stream order, the last one recording an
+// event. The handle's pointer mode is left as it was, pageable results are rejected and managed
+// results are accepted.
+template <typename T>
+inline hipblasStatus_t testing_reduction_async(const Arguments& arg)
+{
+    using Tr                = real_t<T>;
+    auto hipblasNrm2AsyncFn = hipblasNrm2Async<T, Tr>;
+    auto hipblasAsumAsyncFn = hipblasAsumAsync<T, Tr>;
+
+    int N    = arg.N;
+    int incx = arg.incx;
+    int incy = arg.incy;
+
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // Naming: pK is in pinned host memory, mK in managed memory
+    T*   p_dot;
+    Tr*  p_nrm2;
+    Tr*  p_asum;
+    Tr*  m_asum;
+    int* p_amax;
+    CHECK_HIP_ERROR(hipHostMalloc(&p_dot, sizeof(T)));
+    CHECK_HIP_ERROR(hipHostMalloc(&p_nrm2, sizeof(Tr)));
+    CHECK_HIP_ERROR(hipHostMalloc(&p_asum, sizeof(Tr)));
+    CHECK_HIP_ERROR(hipHostMalloc(&p_amax, sizeof(int)));
+    CHECK_HIP_ERROR(hipMallocManaged(&m_asum, sizeof(Tr)));
+    hipblas_init_nan(p_dot, 1);
+    hipblas_init_nan(p_asum, 1);
+
+    hipEvent_t event;
+    CHECK_HIP_ERROR(hipEventCreate(&event));
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(
+            hipblasDotAsync<T>(handle, N, nullptr, incx, nullptr, incy, p_dot, nullptr));
+        CHECK_HIPBLAS_ERROR(hipblasAsumAsyncFn(handle, N, nullptr, incx, p_asum, event));
+        CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+        T  cpu_dot  = T(0);
+        Tr cpu_asum = Tr(0);
+        unit_check_general<T>(1, 1, 1, &cpu_dot, p_dot);
+        unit_check_general<Tr>(1, 1, 1, &cpu_asum, p_asum);
+    }
+    else
+    {
+        int    abs_incx = incx >= 0 ? incx : -incx;
+        int    abs_incy = incy >= 0 ? incy : -incy;
+        size_t sizeX    = size_t(N) * abs_incx;
+        size_t sizeY    = size_t(N) * abs_incy;
+
+        // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+        host_vector<T>   hx(sizeX);
+        host_vector<T>   hy(sizeY);
+        device_vector<T> dx(sizeX);
+        device_vector<T> dy(sizeY);
+
+        T   cpu_dot;
+        Tr  cpu_nrm2, cpu_asum;
+        int cpu_amax;
+
+        double gpu_time_used, hipblas_error = 0.0;
+
+        // Initial Data on CPU
+        hipblas_init_vector(hx, arg, N, abs_incx, 0, 1, hipblas_client_alpha_sets_nan, true);
+        hipblas_init_vector(hy, arg, N, abs_incy, 0, 1, hipblas_client_alpha_sets_nan, false);
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDotAsync<T>(handle, N, dx, incx, dy, incy, p_dot, nullptr));
+        CHECK_HIPBLAS_ERROR(hipblasNrm2AsyncFn(handle, N, dx, incx, p_nrm2, nullptr));
+        CHECK_HIPBLAS_ERROR(hipblasAsumAsyncFn(handle, N, dx, incx, p_asum, nullptr));
+        CHECK_HIPBLAS_ERROR(hipblasIamaxAsync<T>(handle, N, dx, incx, p_amax, event));
+        CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+        hipblasPointerMode_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetPointerMode(handle, &mode));
+        EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, mode);
+
+        // Pageable memory, on the stack or the heap, cannot be written in stream order
+        Tr              pageable;
+        host_vector<Tr> heap(1);
+        EXPECT_HIPBLAS_STATUS(hipblasNrm2AsyncFn(handle, N, dx, incx, &pageable, event),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_HIPBLAS_STATUS(hipblasNrm2AsyncFn(handle, N, dx, incx, heap.data(), event),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+
+        CHECK_HIPBLAS_ERROR(hipblasAsumAsyncFn(handle, N, dx, incx, m_asum, event));
+        CHECK_HIP_ERROR(hipEventSynchronize(event));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_dot<T>(N, hx.data(), incx, hy.data(), incy, &cpu_dot);
+        cblas_nrm2<T, Tr>(N, hx.data(), incx, &cpu_nrm2);
+        cblas_asum<T, Tr>(N, hx.data(), incx, &cpu_asum);
+        cblas_iamax<T>(N, hx.data(), incx, &cpu_amax);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, 1, 1, &cpu_dot, p_dot);
+            unit_check_nrm2<Tr>(cpu_nrm2, *p_nrm2, N);
+            unit_check_general<Tr>(1, 1, 1, &cpu_asum, p_asum);
+            unit_check_general<Tr>(1, 1, 1, &cpu_asum, m_asum);
+            unit_check_general<int>(1, 1, 1, &cpu_amax, p_amax);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = std::max(
+                {double(norm_check_general<T>('F', 1, 1, 1, &cpu_dot, p_dot)),
+                 double(vector_norm_1(1, 1, &cpu_nrm2, p_nrm2)),
+                 double(norm_check_general<Tr>('F', 1, 1, 1, &cpu_asum, p_asum))});
+        }
+
+        if(arg.timing)
+        {
+            int runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                if(iter == arg.cold_iters)
+                    gpu_time_used = get_time_us_sync(stream);
+
+                CHECK_HIPBLAS_ERROR(
+                    hipblasDotAsync<T>(handle, N, dx, incx, dy, incy, p_dot, nullptr));
+            }
+            gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+            hipblasReductionAsyncModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     dot_gflop_count<false, T>(N),
+                                                     dot_gbyte_count<T>(N),
+                                                     hipblas_error);
+        }
+    }
+
+    CHECK_HIP_ERROR(hipEventDestroy(event));
+    CHECK_HIP_ERROR(hipHostFree(p_dot));
+    CHECK_HIP_ERROR(hipHostFree(p_nrm2));
+    CHECK_HIP_ERROR(hipHostFree(p_asum));
+    CHECK_HIP_ERROR(hipHostFree(p_amax));
+    CHECK_HIP_ERROR(hipFree(m_asum));
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasScalStridedBatchedVecModel
+    = ArgumentModel<e_N, e_alpha, e_incx, e_stride_scale, e_batch_count>;
+
+inline void testname_scal_strided_batched_vec(const Arguments& arg, std::string& name)
+{
+    hipblasScalStridedBatchedVecModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_scal_strided_batched_vec(const Arguments& arg)
+{
+    int    N            = arg.N;
+    int    incx         = arg.incx;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride stridex = size_t(N) * incx * stride_scale;
+    size_t        sizeX   = stridex * batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        hipblasStatus_t actual = hipblasScalStridedBatchedVec<T>(
+            handle, N, nullptr, nullptr, incx, stridex, batch_count);
+        EXPECT_HIPBLAS_STATUS(actual, HIPBLAS_STATUS_SUCCESS);
+        return actual;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx_host(sizeX);
+    host_vector<T> hx_device(sizeX);
+    host_vector<T> hx_gold(sizeX);
+    host_vector<T> h_alpha(batch_count);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> d_alpha(batch_count);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU, with a different alpha for every member
+    hipblas_init_vector(
+        hx_host, arg, N, incx, stridex, batch_count, hipblas_client_alpha_sets_nan, true);
+    hx_device = hx_gold = hx_host;
+
+    for(int b = 0; b < batch_count; b++)
+        h_alpha[b] = arg.get_alpha<T>() * T(b + 1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx_host, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, h_alpha, sizeof(T) * batch_count, hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasScalStridedBatchedVec<T>(handle, N, h_alpha, dx, incx, stridex, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hx_host, dx, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dx, hx_device, sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasScalStridedBatchedVec<T>(handle, N, d_alpha, dx, incx, stridex, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hx_device, dx, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_scal<T>(N, h_alpha[b], hx_gold.data() + b * stridex, incx);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, N, batch_count, incx, stridex, hx_gold, hx_host);
+            unit_check_general<T>(1, N, batch_count, incx, stridex, hx_gold, hx_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, N, incx, stridex, hx_gold.data(), hx_host.data(), batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, N, incx, stridex, hx_gold.data(), hx_device.data(), batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasScalStridedBatchedVec<T>(
+                handle, N, d_alpha, dx, incx, stridex, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasScalStridedBatchedVecModel{}.log_args<T>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        scal_gflop_count<T, T>(N) * batch_count,
+                                                        scal_gbyte_count<T>(N) * batch_count,
+                                                        hipblas_error_host,
+                                                        hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_float32_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_float32_mode(const Arguments& arg)
+{
+    hipblasFloat32Mode_t mode;
+    hipblasLocalHandle   handle(arg);
+
+    // The handle starts in the mode of the arguments, which hipblasLocalHandle sets unless it is
+    // the default of a new handle
+    CHECK_HIPBLAS_ERROR(hipblasGetFloat32Mode(handle, &mode));
+
+    EXPECT_EQ(hipblasFloat32Mode_t(arg.float32_mode), mode);
+
+    // Make sure set()/get() functions work
+    const hipblasFloat32Mode_t modes[] = {HIPBLAS_FLOAT32_MODE_FAST,
+                                          HIPBLAS_FLOAT32_MODE_FAST_TF32,
+                                          HIPBLAS_FLOAT32_MODE_FAST_16BX3,
+                                          HIPBLAS_FLOAT32_MODE_DEFAULT};
+    for(auto m : modes)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetFloat32Mode(handle, m));
+        CHECK_HIPBLAS_ERROR(hipblasGetFloat32Mode(handle, &mode));
+
+        EXPECT_EQ(m, mode);
+    }
+
+    // An unknown mode is rejected and leaves the handle's mode as it was
+    EXPECT_HIPBLAS_STATUS(hipblasSetFloat32Mode(handle, hipblasFloat32Mode_t(7)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+    CHECK_HIPBLAS_ERROR(hipblasGetFloat32Mode(handle, &mode));
+
+    EXPECT_EQ(HIPBLAS_FLOAT32_MODE_DEFAULT, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
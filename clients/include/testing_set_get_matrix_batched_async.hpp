@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSetGetMatrixBatchedAsyncModel
+    = ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc, e_stride_scale, e_batch_count>;
+
+inline void testname_set_get_matrix_batched_async(const Arguments& arg, std::string& name)
+{
+    hipblasSetGetMatrixBatchedAsyncModel{}.test_name(arg, name);
+}
+
+// A strided batch is set and got back, then set from an array of pointers the same distance
+// apart, which is coalesced, and got back through pointers in reverse order, which is not.
+template <typename T>
+inline hipblasStatus_t testing_set_get_matrix_batched_async(const Arguments& arg)
+{
+    int    rows         = arg.rows;
+    int    cols         = arg.cols;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    ldc          = arg.ldc;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    bool invalid_size = rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0 || lda < rows
+                        || ldb < rows || ldc < rows || batch_count < 0;
+    if(invalid_size || !rows || !cols || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasSetMatrixStridedBatchedAsync(
+            rows, cols, sizeof(T), nullptr, lda, 0, nullptr, ldc, 0, batch_count, stream);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    hipblasStride stride_a = size_t(lda) * cols * stride_scale;
+    hipblasStride stride_b = size_t(ldb) * cols * stride_scale;
+    hipblasStride stride_c = size_t(ldc) * cols * stride_scale;
+    size_t        a_size   = stride_a * batch_count;
+    size_t        b_size   = stride_b * batch_count;
+    size_t        c_size   = stride_c * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, pageable here
+    host_vector<T>   ha(a_size);
+    host_vector<T>   hb(b_size);
+    host_vector<T>   hb_batched(b_size);
+    host_vector<T>   hb_ref(b_size);
+    device_vector<T> dc(c_size);
+
+    std::vector<const void*> ha_array(batch_count), dc_array(batch_count);
+    std::vector<void*>       dc_set_array(batch_count), hb_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        int r           = batch_count - 1 - b;
+        ha_array[b]     = ha.data() + b * stride_a;
+        dc_set_array[b] = (T*)dc + b * stride_c;
+        dc_array[b]     = (T*)dc + r * stride_c;
+        hb_array[b]     = hb_batched.data() + r * stride_b;
+    }
+
+    // Initial Data on CPU, the gaps between the matrices of hb included
+    srand(1);
+    hipblas_init<T>(ha, rows, cols, lda, stride_a, batch_count);
+    hipblas_init<T>(hb, 1, b_size, 1);
+    hb_batched = hb;
+    hb_ref     = hb;
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixStridedBatchedAsync(
+        rows, cols, sizeof(T), ha, lda, stride_a, dc, ldc, stride_c, batch_count, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrixStridedBatchedAsync(
+        rows, cols, sizeof(T), dc, ldc, stride_c, hb, ldb, stride_b, batch_count, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipMemset(dc, 0, c_size * sizeof(T)));
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrixBatchedAsync(rows,
+                                                     cols,
+                                                     sizeof(T),
+                                                     ha_array.data(),
+                                                     lda,
+                                                     dc_set_array.data(),
+                                                     ldc,
+                                                     batch_count,
+                                                     stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrixBatchedAsync(rows,
+                                                     cols,
+                                                     sizeof(T),
+                                                     dc_array.data(),
+                                                     ldc,
+                                                     hb_array.data(),
+                                                     ldb,
+                                                     batch_count,
+                                                     stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+            for(int i2 = 0; i2 < cols; i2++)
+                for(int i1 = 0; i1 < rows; i1++)
+                    hb_ref[i1 + i2 * ldb + b * stride_b] = ha[i1 + i2 * lda + b * stride_a];
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, b_size, 1, hb_ref, hb);
+            unit_check_general<T>(1, b_size, 1, hb_ref, hb_batched);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = std::max(norm_check_general<T>('F', 1, b_size, 1, hb_ref, hb),
+                                     norm_check_general<T>('F', 1, b_size, 1, hb_ref, hb_batched));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSetMatrixStridedBatchedAsync(
+                rows, cols, sizeof(T), ha, lda, stride_a, dc, ldc, stride_c, batch_count, stream));
+            CHECK_HIPBLAS_ERROR(hipblasGetMatrixStridedBatchedAsync(
+                rows, cols, sizeof(T), dc, ldc, stride_c, hb, ldb, stride_b, batch_count, stream));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSetGetMatrixBatchedAsyncModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(rows, cols) * batch_count,
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSetGetMatrixStagedModel = ArgumentModel<e_M, e_N, e_lda, e_ldb, e_ldc>;
+
+inline void testname_set_get_matrix_staged(const Arguments& arg, std::string& name)
+{
+    hipblasSetGetMatrixStagedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_set_get_matrix_staged(const Arguments& arg)
+{
+    int rows = arg.rows;
+    int cols = arg.cols;
+    int lda  = arg.lda;
+    int ldb  = arg.ldb;
+    int ldc  = arg.ldc;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory. ha and hb are pageable,
+    // so transfers above the staging threshold go through the handle's pinned buffers, while
+    // hc_pinned is page-locked and copied directly
+    size_t           c_size = size_t(ldc) * cols;
+    host_vector<T>   ha(size_t(lda) * cols);
+    host_vector<T>   ha_copy(size_t(lda) * cols);
+    host_vector<T>   hb(size_t(ldb) * cols);
+    host_vector<T>   hb_ref(size_t(ldb) * cols);
+    host_vector<T>   hc_ref(c_size);
+    device_vector<T> dc(c_size);
+    T*               hc_pinned;
+    CHECK_HIP_ERROR(hipHostMalloc(&hc_pinned, c_size * sizeof(T)));
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // Initial Data on CPU; the padding of dc stays zero and the padding of hb stays as initialized
+    srand(1);
+    hipblas_init<T>(ha, rows, cols, lda);
+    hipblas_init<T>(hb, rows, cols, ldb);
+    ha_copy = ha;
+    hb_ref  = hb;
+    for(size_t i = 0; i < c_size; i++)
+        hc_ref[i] = T(0);
+    CHECK_HIP_ERROR(hipMemset(dc, 0, c_size * sizeof(T)));
+
+    for(int i2 = 0; i2 < cols; i2++)
+    {
+        for(int i1 = 0; i1 < rows; i1++)
+        {
+            hb_ref[i1 + size_t(i2) * ldb] = ha[i1 + size_t(i2) * lda];
+            hc_ref[i1 + size_t(i2) * ldc] = ha[i1 + size_t(i2) * lda];
+        }
+    }
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    // Pageable to device, checked through pinned memory
+    CHECK_HIPBLAS_ERROR(hipblasSetMatrix(rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc));
+    CHECK_HIP_ERROR(hipMemcpy(hc_pinned, dc, c_size * sizeof(T), hipMemcpyDeviceToHost));
+    if(arg.unit_check)
+        unit_check_general<T>(ldc, cols, ldc, hc_ref, hc_pinned);
+    if(arg.norm_check)
+        hipblas_error = norm_check_general<T>('F', ldc, cols, ldc, hc_ref, hc_pinned);
+
+    // Device to pageable, leaving the padding of hb alone
+    CHECK_HIPBLAS_ERROR(hipblasGetMatrix(rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb));
+    if(arg.unit_check)
+        unit_check_general<T>(ldb, cols, ldb, hb_ref, hb);
+    if(arg.norm_check)
+        hipblas_error = std::max(hipblas_error,
+                                 norm_check_general<T>('F', ldb, cols, ldb, hb_ref, hb));
+
+    // The async forms on the handle's stream; ha may be reused as soon as the set returns
+    CHECK_HIP_ERROR(hipMemset(dc, 0, c_size * sizeof(T)));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSetMatrixAsync(rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
+    for(size_t i = 0; i < ha.size(); i++)
+        ha[i] = T(0);
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetMatrixAsync(rows, cols, sizeof(T), (void*)dc, ldc, (void*)ha, lda, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    if(arg.unit_check)
+        unit_check_general<T>(rows, cols, lda, ha_copy, ha);
+    if(arg.norm_check)
+        hipblas_error = std::max(hipblas_error,
+                                 norm_check_general<T>('F', rows, cols, lda, ha_copy, ha));
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSetMatrixAsync(
+                rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
+            CHECK_HIPBLAS_ERROR(hipblasGetMatrixAsync(
+                rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb, stream));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSetGetMatrixStagedModel{}.log_args<T>(std::cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     set_get_matrix_gbyte_count<T>(rows, cols),
+                                                     hipblas_error);
+    }
+
+    CHECK_HIP_ERROR(hipHostFree(hc_pinned));
+    return HIPBLAS_STATUS_SUCCESS;
+}
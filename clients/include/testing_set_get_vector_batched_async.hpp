@@ -0,0 +1,165 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSetGetVectorBatchedAsyncModel
+    = ArgumentModel<e_M, e_incx, e_incy, e_incd, e_stride_scale, e_batch_count>;
+
+inline void testname_set_get_vector_batched_async(const Arguments& arg, std::string& name)
+{
+    hipblasSetGetVectorBatchedAsyncModel{}.test_name(arg, name);
+}
+
+// A strided batch is set and got back, then set from an array of pointers the same distance
+// apart, which is coalesced, and got back through pointers in reverse order, which is not.
+template <typename T>
+inline hipblasStatus_t testing_set_get_vector_batched_async(const Arguments& arg)
+{
+    int    M            = arg.M;
+    int    incx         = arg.incx;
+    int    incy         = arg.incy;
+    int    incd         = arg.incd;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    double             hipblas_error = 0.0, gpu_time_used = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    bool invalid_size = M < 0 || incx <= 0 || incy <= 0 || incd <= 0 || batch_count < 0;
+    if(invalid_size || !M || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasSetVectorStridedBatchedAsync(
+            M, sizeof(T), nullptr, incx, 0, nullptr, incd, 0, batch_count, stream);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    hipblasStride stride_x = size_t(M) * incx * stride_scale;
+    hipblasStride stride_y = size_t(M) * incy * stride_scale;
+    hipblasStride stride_d = size_t(M) * incd * stride_scale;
+    size_t        x_size   = stride_x * batch_count;
+    size_t        y_size   = stride_y * batch_count;
+    size_t        d_size   = stride_d * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory, pageable here
+    host_vector<T>   hx(x_size);
+    host_vector<T>   hy(y_size);
+    host_vector<T>   hy_batched(y_size);
+    host_vector<T>   hy_ref(y_size);
+    device_vector<T> dd(d_size);
+
+    std::vector<const void*> hx_array(batch_count), dd_array(batch_count);
+    std::vector<void*>       dd_set_array(batch_count), hy_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        int r           = batch_count - 1 - b;
+        hx_array[b]     = hx.data() + b * stride_x;
+        dd_set_array[b] = (T*)dd + b * stride_d;
+        dd_array[b]     = (T*)dd + r * stride_d;
+        hy_array[b]     = hy_batched.data() + r * stride_y;
+    }
+
+    // Initial Data on CPU, the elements between those of hy included
+    srand(1);
+    hipblas_init<T>(hx, 1, M, incx, stride_x, batch_count);
+    hipblas_init<T>(hy, 1, y_size, 1);
+    hy_batched = hy;
+    hy_ref     = hy;
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasSetVectorStridedBatchedAsync(
+        M, sizeof(T), hx, incx, stride_x, dd, incd, stride_d, batch_count, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetVectorStridedBatchedAsync(
+        M, sizeof(T), dd, incd, stride_d, hy, incy, stride_y, batch_count, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    CHECK_HIP_ERROR(hipMemset(dd, 0, d_size * sizeof(T)));
+    CHECK_HIPBLAS_ERROR(hipblasSetVectorBatchedAsync(
+        M, sizeof(T), hx_array.data(), incx, dd_set_array.data(), incd, batch_count, stream));
+    CHECK_HIPBLAS_ERROR(hipblasGetVectorBatchedAsync(
+        M, sizeof(T), dd_array.data(), incd, hy_array.data(), incy, batch_count, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+            for(int i = 0; i < M; i++)
+                hy_ref[i * incy + b * stride_y] = hx[i * incx + b * stride_x];
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(1, y_size, 1, hy_ref, hy);
+            unit_check_general<T>(1, y_size, 1, hy_ref, hy_batched);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = std::max(norm_check_general<T>('F', 1, y_size, 1, hy_ref, hy),
+                                     norm_check_general<T>('F', 1, y_size, 1, hy_ref, hy_batched));
+        }
+    }
+
+    if(arg.timing)
+    {
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSetVectorStridedBatchedAsync(
+                M, sizeof(T), hx, incx, stride_x, dd, incd, stride_d, batch_count, stream));
+            CHECK_HIPBLAS_ERROR(hipblasGetVectorStridedBatchedAsync(
+                M, sizeof(T), dd, incd, stride_d, hy, incy, stride_y, batch_count, stream));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSetGetVectorBatchedAsyncModel{}.log_args<T>(std::cout,
+                                                           arg,
+                                                           gpu_time_used,
+                                                           ArgumentLogging::NA_value,
+                                                           set_get_vector_gbyte_count<T>(M)
+                                                               * batch_count,
+                                                           hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
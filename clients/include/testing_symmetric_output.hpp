@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasSymmetricOutputModel
+    = ArgumentModel<e_transA, e_transB, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>;
+
+inline void testname_symmetric_output(const Arguments& arg, std::string& name)
+{
+    hipblasSymmetricOutputModel{}.test_name(arg, name);
+}
+
+// op(A)*op(A)^T (op(A)^H for a conjugate transpose) by hipblasXgemm with B = A and each
+// hipblasSymmetricOutput_t. The triangular outputs must leave the other triangle of C as it was;
+// the full output must match the general GEMM. Hermitian products need real scalars.
+template <typename T>
+inline hipblasStatus_t testing_symmetric_output(const Arguments& arg)
+{
+    bool FORTRAN       = arg.fortran;
+    auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? N : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : N;
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipblasSymmetricOutput_t output;
+    CHECK_HIPBLAS_ERROR(hipblasGetSymmetricOutput(handle, &output));
+    EXPECT_EQ(output, HIPBLAS_SYMMETRIC_OUTPUT_NONE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetSymmetricOutput(handle, hipblasSymmetricOutput_t(7)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    hipblasStatus_t status = hipblasSetSymmetricOutput(handle, HIPBLAS_SYMMETRIC_OUTPUT_FULL);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Invalid arguments are reported by the GEMM
+    bool invalid_size = N < 0 || K < 0 || lda < A_row || ldc < N;
+    if(invalid_size || !N)
+    {
+        hipblasStatus_t actual = hipblasGemmFn(handle,
+                                               transA,
+                                               transB,
+                                               N,
+                                               N,
+                                               K,
+                                               nullptr,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               lda,
+                                               nullptr,
+                                               nullptr,
+                                               ldc);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_full(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_out(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dC(C_size);
+
+    // Initial Data on CPU. C is never NaN so that the triangle left alone compares equal.
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hC, arg, N, N, ldc, 0, 1, hipblas_client_never_set_nan);
+
+    // A Hermitian C has a real diagonal, which herk keeps real
+    if constexpr(is_complex<T>)
+        if(transA == HIPBLAS_OP_C || transB == HIPBLAS_OP_C)
+            for(int i = 0; i < N; i++)
+                hC[i + size_t(i) * ldc] = T(hC[i + size_t(i) * ldc].real());
+    hC_full = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    cblas_gemm<T>(transA,
+                  transB,
+                  N,
+                  N,
+                  K,
+                  h_alpha,
+                  hA.data(),
+                  lda,
+                  hA.data(),
+                  lda,
+                  h_beta,
+                  hC_full.data(),
+                  ldc);
+
+    for(hipblasSymmetricOutput_t mode : {HIPBLAS_SYMMETRIC_OUTPUT_UPPER,
+                                         HIPBLAS_SYMMETRIC_OUTPUT_LOWER,
+                                         HIPBLAS_SYMMETRIC_OUTPUT_FULL})
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetSymmetricOutput(handle, mode));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+            handle, transA, transB, N, N, K, &h_alpha, dA, lda, dA, lda, &h_beta, dC, ldc));
+        CHECK_HIP_ERROR(hipMemcpy(hC_out, dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        // The triangular outputs leave the other triangle as it was
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                bool written = mode == HIPBLAS_SYMMETRIC_OUTPUT_FULL
+                               || (mode == HIPBLAS_SYMMETRIC_OUTPUT_LOWER ? i >= j : i <= j);
+                size_t idx   = i + size_t(j) * ldc;
+                hC_gold[idx] = written ? hC_full[idx] : hC[idx];
+            }
+
+        if(arg.unit_check)
+            unit_check_general<T>(N, N, ldc, hC_gold, hC_out);
+        if(arg.norm_check)
+            hipblas_error = std::max(
+                hipblas_error, std::abs(norm_check_general<T>('F', N, N, ldc, hC_gold, hC_out)));
+    }
+
+    // Timed with the full output, the last one set
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmFn(
+                handle, transA, transB, N, N, K, &h_alpha, dA, lda, dA, lda, &h_beta, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasSymmetricOutputModel{}.log_args<T>(std::cout,
+                                                  arg,
+                                                  gpu_time_used,
+                                                  gemm_gflop_count<T>(N, N, K),
+                                                  gemm_gbyte_count<T>(N, N, K),
+                                                  hipblas_error);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasSetSymmetricOutput(handle, HIPBLAS_SYMMETRIC_OUTPUT_NONE));
+    CHECK_HIPBLAS_ERROR(hipblasGetSymmetricOutput(handle, &output));
+    EXPECT_EQ(output, HIPBLAS_SYMMETRIC_OUTPUT_NONE);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,307 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasThreadStreamModel = ArgumentModel<e_transA,
+                                               e_transB,
+                                               e_M,
+                                               e_N,
+                                               e_K,
+                                               e_alpha,
+                                               e_lda,
+                                               e_ldb,
+                                               e_beta,
+                                               e_ldc,
+                                               e_batch_count>;
+
+inline void testname_thread_stream(const Arguments& arg, std::string& name)
+{
+    hipblasThreadStreamModel{}.test_name(arg, name);
+}
+
+// batch_count threads share one handle in deferred mode, each bound to a stream of its own, and
+// run a GEMM into their own C. The odd threads turn deferred mode off on their binding, which
+// must leave the handle's own mode alone.
+template <typename T>
+inline hipblasStatus_t testing_thread_stream(const Arguments& arg)
+{
+    hipblasOperation_t transA  = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB  = char2hipblas_operation(arg.transB);
+    int                M       = arg.M;
+    int                N       = arg.N;
+    int                K       = arg.K;
+    int                lda     = arg.lda;
+    int                ldb     = arg.ldb;
+    int                ldc     = arg.ldc;
+    int                threads = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    hipStream_t handle_stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &handle_stream));
+
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(threads <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasSetThreadStream(handle, handle_stream);
+        if(actual == HIPBLAS_STATUS_NOT_SUPPORTED)
+            return actual;
+        CHECK_HIPBLAS_ERROR(actual);
+
+        actual = hipblasGemm<T>(handle,
+                                transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                nullptr,
+                                nullptr,
+                                lda,
+                                nullptr,
+                                ldb,
+                                nullptr,
+                                nullptr,
+                                ldc);
+        CHECK_HIPBLAS_ERROR(hipblasClearThreadStream(handle));
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_threads(C_size * threads);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size * threads);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+    std::vector<hipStream_t> streams(threads);
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    cblas_gemm<T>(transA,
+                  transB,
+                  M,
+                  N,
+                  K,
+                  h_alpha,
+                  hA.data(),
+                  lda,
+                  hB.data(),
+                  ldb,
+                  h_beta,
+                  hC_gold.data(),
+                  ldc);
+
+    /* =====================================================================
+        HIPBLAS
+    =================================================================== */
+    hipblasStatus_t status = hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_ENABLED);
+    std::vector<hipblasStatus_t> results(threads, status);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        for(int t = 0; t < threads; t++)
+            CHECK_HIP_ERROR(
+                hipMemcpy(dC + t * C_size, hC, sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        // Each thread checks its binding's stream and the mode copied from the handle. The
+        // GEMMs queued on the deferred bindings are issued when the binding is cleared.
+        auto run = [&](int t) {
+            hipblasHandle_t       shared = handle;
+            hipStream_t           bound  = nullptr;
+            hipblasDeferredMode_t mode   = HIPBLAS_DEFERRED_MODE_DISABLED;
+            hipblasStatus_t&      result = results[t];
+
+            result = hipblasSetThreadStream(shared, streams[t]);
+            if(result == HIPBLAS_STATUS_SUCCESS)
+                result = hipblasGetStream(shared, &bound);
+            if(result == HIPBLAS_STATUS_SUCCESS && bound != streams[t])
+                result = HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(result == HIPBLAS_STATUS_SUCCESS)
+                result = hipblasGetDeferredMode(shared, &mode);
+            if(result == HIPBLAS_STATUS_SUCCESS && mode != HIPBLAS_DEFERRED_MODE_ENABLED)
+                result = HIPBLAS_STATUS_INTERNAL_ERROR;
+            if(result == HIPBLAS_STATUS_SUCCESS && t % 2)
+                result = hipblasSetDeferredMode(shared, HIPBLAS_DEFERRED_MODE_DISABLED);
+            if(result == HIPBLAS_STATUS_SUCCESS)
+                result = hipblasGemm<T>(shared,
+                                        transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        &h_alpha,
+                                        dA,
+                                        lda,
+                                        dB,
+                                        ldb,
+                                        &h_beta,
+                                        dC + t * C_size,
+                                        ldc);
+            hipblasStatus_t cleared = hipblasClearThreadStream(shared);
+            if(result == HIPBLAS_STATUS_SUCCESS)
+                result = cleared;
+            if(hipStreamSynchronize(streams[t]) != hipSuccess
+               && result == HIPBLAS_STATUS_SUCCESS)
+                result = HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back(run, t);
+        for(auto& worker : workers)
+            worker.join();
+
+        for(int t = 0; t < threads && status == HIPBLAS_STATUS_SUCCESS; t++)
+            status = results[t];
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        // The handle kept its own stream and mode
+        hipStream_t           stream;
+        hipblasDeferredMode_t mode;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        EXPECT_EQ(handle_stream, stream);
+        CHECK_HIPBLAS_ERROR(hipblasGetDeferredMode(handle, &mode));
+        EXPECT_EQ(HIPBLAS_DEFERRED_MODE_ENABLED, mode);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hC_threads, dC, sizeof(T) * C_size * threads, hipMemcpyDeviceToHost));
+        for(int t = 0; t < threads; t++)
+        {
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, ldc, hC_gold, hC_threads.data() + t * C_size);
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    std::abs(norm_check_general<T>(
+                        'F', M, N, ldc, hC_gold.data(), hC_threads.data() + t * C_size)));
+        }
+    }
+    CHECK_HIPBLAS_ERROR(hipblasSetDeferredMode(handle, HIPBLAS_DEFERRED_MODE_DISABLED));
+
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.timing)
+    {
+        // Host time of the threads running their calls concurrently
+        auto run = [&](int t) {
+            hipblasHandle_t shared = handle;
+            CHECK_HIPBLAS_ERROR(hipblasSetThreadStream(shared, streams[t]));
+            for(int iter = 0; iter < arg.iters; iter++)
+                CHECK_HIPBLAS_ERROR(hipblasGemm<T>(shared,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   &h_beta,
+                                                   dC + t * C_size,
+                                                   ldc));
+            CHECK_HIPBLAS_ERROR(hipblasClearThreadStream(shared));
+            CHECK_HIP_ERROR(hipStreamSynchronize(streams[t]));
+        };
+
+        for(int t = 0; t < threads; t++)
+            for(int iter = 0; iter < arg.cold_iters; iter++)
+                CHECK_HIPBLAS_ERROR(hipblasGemm<T>(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   dA,
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   &h_beta,
+                                                   dC + t * C_size,
+                                                   ldc));
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        gpu_time_used = get_time_us();
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back(run, t);
+        for(auto& worker : workers)
+            worker.join();
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasThreadStreamModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               threads * gemm_gflop_count<T>(M, N, K),
+                                               threads * gemm_gbyte_count<T>(M, N, K),
+                                               hipblas_error);
+    }
+
+    for(auto& stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return status;
+}
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsmOutOfCoreModel
+    = ArgumentModel<e_side, e_uplo, e_transA, e_diag, e_M, e_N, e_alpha, e_lda, e_ldb>;
+
+inline void testname_trsm_out_of_core(const Arguments& arg, std::string& name)
+{
+    hipblasTrsmOutOfCoreModel{}.test_name(arg, name);
+}
+
+// A and B stay in host memory. Tiles of a third of the larger dimension give every panel of B
+// several blocks to solve in turn.
+template <typename T>
+inline hipblasStatus_t testing_trsm_out_of_core(const Arguments& arg)
+{
+    hipblasSideMode_t  side   = char2hipblas_side(arg.side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(arg.uplo);
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(arg.diag);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    bool invalid_size = M < 0 || N < 0 || lda < K || ldb < M;
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual = hipblasTrsmOutOfCore<T>(
+            handle, side, uplo, transA, diag, M, N, nullptr, nullptr, lda, nullptr, ldb);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size = size_t(lda) * K;
+    size_t B_size = size_t(ldb) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB_host(B_size);
+    host_vector<T> hB_device(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    device_vector<T> d_alpha(1);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, K, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB_host, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+
+    // pad untouched area into zero
+    for(int i = K; i < lda; i++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = 0.0;
+        }
+    }
+    // proprocess the matrix to avoid ill-conditioned matrix
+    std::vector<int> ipiv(K);
+    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = i; j < K; j++)
+        {
+            hA[i + j * lda] = hA[j + i * lda];
+            if(diag == HIPBLAS_DIAG_UNIT)
+            {
+                if(i == j)
+                    hA[i + j * lda] = 1.0;
+            }
+        }
+    }
+
+    // pad untouched area into zero
+    for(int i = M; i < ldb; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            hB_host[i + j * ldb] = 0.0;
+        }
+    }
+    hB_gold = hB_host; // original solution hX
+
+    // Calculate hB = hA*hX;
+    cblas_trmm<T>(
+        side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+
+    hB_device = hB_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    std::string tile = std::to_string(std::max(1, std::max(M, N) / 3));
+    setenv("HIPBLAS_OOC_TILE_SIZE", tile.c_str(), 1);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        status = hipblasTrsmOutOfCore<T>(
+            handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB_host, ldb);
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            status = hipblasTrsmOutOfCore<T>(
+                handle, side, uplo, transA, diag, M, N, d_alpha, hA, lda, hB_device, ldb);
+        }
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 40 * M;
+
+            hipblas_error_host   = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_host);
+            hipblas_error_device = norm_check_general<T>('F', M, N, ldb, hB_gold, hB_device);
+            if(arg.unit_check)
+            {
+                unit_check_error(hipblas_error_host, tolerance);
+                unit_check_error(hipblas_error_device, tolerance);
+            }
+        }
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTrsmOutOfCore<T>(
+                handle, side, uplo, transA, diag, M, N, &h_alpha, hA, lda, hB_host, ldb));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasTrsmOutOfCoreModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                trsm_gflop_count<T>(M, N, K),
+                                                trsm_gbyte_count<T>(M, N, K),
+                                                hipblas_error_host,
+                                                hipblas_error_device);
+    }
+
+    unsetenv("HIPBLAS_OOC_TILE_SIZE");
+
+    return status;
+}
@@ -0,0 +1,209 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtCpuRatioModel = ArgumentModel<e_uplo, e_M, e_N, e_K, e_alpha, e_beta>;
+
+inline void testname_xt_cpu_ratio(const Arguments& arg, std::string& name)
+{
+    hipblasXtCpuRatioModel{}.test_name(arg, name);
+}
+
+// Host GEMM with the cblas_<x>gemm signature of a real precision, counting its calls. hipblasXt
+// calls it on the calling thread and always with CblasColMajor.
+template <typename T>
+inline int xt_host_gemm_calls = 0;
+
+template <typename T>
+void xt_host_gemm(int      order,
+                  int      transA,
+                  int      transB,
+                  int      m,
+                  int      n,
+                  int      k,
+                  T        alpha,
+                  const T* A,
+                  int      lda,
+                  const T* B,
+                  int      ldb,
+                  T        beta,
+                  T*       C,
+                  int      ldc)
+{
+    xt_host_gemm_calls<T>++;
+    cblas_gemm<T>(hipblasOperation_t(transA),
+                  hipblasOperation_t(transB),
+                  m,
+                  n,
+                  k,
+                  alpha,
+                  const_cast<T*>(A),
+                  lda,
+                  const_cast<T*>(B),
+                  ldb,
+                  beta,
+                  C,
+                  ldc);
+}
+
+// The M x N result of a GEMM and the N x N result of a SYRK, both with inner dimension K, split
+// between one device and the host. The GEMM uses xt_host_gemm at a fixed share and then balanced
+// automatically; the SYRK gives the host every block it can take with the host routines found
+// by default, and falls back to the device for all of them when one is missing.
+template <typename T>
+inline hipblasStatus_t testing_xt_cpu_ratio(const Arguments& arg)
+{
+    hipblasFillMode_t uplo = char2hipblas_fill(arg.uplo);
+    int               M    = arg.M;
+    int               N    = arg.N;
+    int               K    = arg.K;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasXtOpType_t type = std::is_same<T, double>{} ? HIPBLAS_XT_DOUBLE : HIPBLAS_XT_FLOAT;
+
+    // check to prevent undefined memory allocation error
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    double            gpu_time_used, hipblas_error;
+    hipblasXtHandle_t xt;
+
+    hipblasStatus_t status = hipblasXtCreate(&xt);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int device, block_dim = std::max(1, std::max({M, N, K}) / 3);
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    CHECK_HIPBLAS_ERROR(hipblasXtDeviceSelect(xt, 1, &device));
+    CHECK_HIPBLAS_ERROR(hipblasXtSetBlockDim(xt, block_dim));
+    EXPECT_HIPBLAS_STATUS(hipblasXtSetCpuRatio(xt, HIPBLAS_XT_GEMM, type, 2),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasXtSetCpuRoutine(xt, HIPBLAS_XT_GEMM, type, (void*)xt_host_gemm<T>));
+
+    int blocks = ((M + block_dim - 1) / block_dim) * ((N + block_dim - 1) / block_dim);
+
+    // Naming: hK is in CPU (host) memory; hipblasXt copies the blocks to the devices itself
+    host_vector<T> hA(size_t(M) * K);
+    host_vector<T> hB(size_t(K) * N);
+    host_vector<T> hC_init(size_t(M) * N);
+    host_vector<T> hC(size_t(M) * N);
+    host_vector<T> hC_gold(size_t(M) * N);
+    host_vector<T> hS_A(size_t(N) * K);
+    host_vector<T> hS(size_t(N) * N);
+    host_vector<T> hS_gold(size_t(N) * N);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, M, K, M, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, K, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC_init, arg, M, N, M, 0, 1, hipblas_client_beta_sets_nan);
+    hipblas_init_matrix(hS_A, arg, N, K, N, 0, 1, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hS, arg, N, N, N, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC_init;
+    hS_gold = hS;
+
+    /* =====================================================================
+                CPU BLAS
+    =================================================================== */
+    cblas_gemm<T>(HIPBLAS_OP_N,
+                  HIPBLAS_OP_N,
+                  M,
+                  N,
+                  K,
+                  h_alpha,
+                  hA.data(),
+                  M,
+                  hB.data(),
+                  K,
+                  h_beta,
+                  hC_gold.data(),
+                  M);
+    cblas_syrk<T>(uplo, HIPBLAS_OP_N, N, K, h_alpha, hS_A.data(), N, h_beta, hS_gold.data(), N);
+
+    /* =====================================================================
+        HIPBLAS
+    =================================================================== */
+    // at most half of the blocks on the host, then balanced automatically
+    for(float ratio : {0.5f, -1.0f, -1.0f})
+    {
+        hC                    = hC_init;
+        xt_host_gemm_calls<T> = 0;
+        CHECK_HIPBLAS_ERROR(hipblasXtSetCpuRatio(xt, HIPBLAS_XT_GEMM, type, ratio));
+        CHECK_HIPBLAS_ERROR(hipblasXtGemm<T>(
+            xt, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &h_alpha, hA, M, hB, K, &h_beta, hC, M));
+
+        if(ratio > 0)
+            EXPECT_LE(xt_host_gemm_calls<T>, int(ratio * blocks + 0.5f));
+        if(arg.unit_check)
+            unit_check_general<T>(M, N, M, hC_gold, hC);
+        if(arg.norm_check)
+            hipblas_error = std::abs(norm_check_general<T>('F', M, N, M, hC_gold, hC));
+    }
+
+    // every block that the host cannot compute is left to the device
+    CHECK_HIPBLAS_ERROR(hipblasXtSetCpuRatio(xt, HIPBLAS_XT_SYRK, type, 1));
+    CHECK_HIPBLAS_ERROR(
+        hipblasXtSyrk<T>(xt, uplo, HIPBLAS_OP_N, N, K, &h_alpha, hS_A, N, &h_beta, hS, N));
+    if(arg.unit_check)
+        unit_check_general<T>(N, N, N, hS_gold, hS);
+    if(arg.norm_check)
+        hipblas_error
+            = std::max(hipblas_error, std::abs(norm_check_general<T>('F', N, N, N, hS_gold, hS)));
+
+    if(arg.timing)
+    {
+        // the call is synchronous with respect to the host
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblasXtGemm<T>(
+                xt, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &h_alpha, hA, M, hB, K, &h_beta, hC, M));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtCpuRatioModel{}.log_args<T>(std::cout,
+                                             arg,
+                                             gpu_time_used,
+                                             gemm_gflop_count<T>(M, N, K),
+                                             gemm_gbyte_count<T>(M, N, K),
+                                             hipblas_error);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasXtDestroy(xt));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
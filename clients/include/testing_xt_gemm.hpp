@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasXtGemmModel
+    = ArgumentModel<e_transA, e_transB, e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_beta, e_ldc>;
+
+inline void testname_xt_gemm(const Arguments& arg, std::string& name)
+{
+    hipblasXtGemmModel{}.test_name(arg, name);
+}
+
+// GEMM on host matrices shared between every device. Blocks of a third of the largest
+// dimension give each device several jobs to take.
+template <typename T>
+inline hipblasStatus_t testing_xt_gemm(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    double            gpu_time_used, hipblas_error;
+    hipblasXtHandle_t xt;
+
+    hipblasStatus_t status = hipblasXtCreate(&xt);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // no device is selected yet, and each may only be selected once
+    T c = T(0);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXtGemm<T>(
+            xt, HIPBLAS_OP_N, HIPBLAS_OP_N, 1, 1, 1, &h_alpha, &c, 1, &c, 1, &h_beta, &c, 1),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasXtDeviceSelect(xt, 2, std::vector<int>(2, 0).data()),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    int device_count, block_dim = std::max(1, std::max({M, N, K}) / 3);
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    std::vector<int> devices(device_count);
+    for(int i = 0; i < device_count; i++)
+        devices[i] = i;
+    CHECK_HIPBLAS_ERROR(hipblasXtDeviceSelect(xt, device_count, devices.data()));
+    CHECK_HIPBLAS_ERROR(hipblasXtSetBlockDim(xt, block_dim));
+    CHECK_HIPBLAS_ERROR(hipblasXtGetBlockDim(xt, &block_dim));
+    EXPECT_EQ(block_dim, std::max(1, std::max({M, N, K}) / 3));
+
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        status = hipblasXtGemm<T>(xt,
+                                  transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  nullptr,
+                                  nullptr,
+                                  lda,
+                                  nullptr,
+                                  ldb,
+                                  nullptr,
+                                  nullptr,
+                                  ldc);
+        EXPECT_HIPBLAS_STATUS(
+            status, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        CHECK_HIPBLAS_ERROR(hipblasXtDestroy(xt));
+        return status;
+    }
+
+    size_t A_size = size_t(lda) * A_col;
+    size_t B_size = size_t(ldb) * B_col;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: hK is in CPU (host) memory; hipblasXt copies the blocks to the devices itself
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, A_row, A_col, lda, 0, 1, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, 0, 1, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_beta_sets_nan);
+    hC_gold = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasXtGemm<T>(
+            xt, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      h_alpha,
+                      hA.data(),
+                      lda,
+                      hB.data(),
+                      ldb,
+                      h_beta,
+                      hC_gold.data(),
+                      ldc);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold, hC);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error = std::abs(norm_check_general<T>('F', M, N, ldc, hC_gold, hC));
+        }
+    }
+
+    if(arg.timing)
+    {
+        // the call is synchronous with respect to the host
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == arg.cold_iters)
+                gpu_time_used = get_time_us();
+
+            CHECK_HIPBLAS_ERROR(hipblasXtGemm<T>(
+                xt, transA, transB, M, N, K, &h_alpha, hA, lda, hB, ldb, &h_beta, hC, ldc));
+        }
+        gpu_time_used = get_time_us() - gpu_time_used;
+
+        hipblasXtGemmModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gemm_gflop_count<T>(M, N, K),
+                                         gemm_gbyte_count<T>(M, N, K),
+                                         hipblas_error);
+    }
+
+    CHECK_HIPBLAS_ERROR(hipblasXtDestroy(xt));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
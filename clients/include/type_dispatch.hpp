@@ -253,6 +253,12 @@ auto hipblas_gemm_dispatch(const Arguments& arg)
             {
                 return TEST<hipblasBfloat16, hipblasBfloat16, float>{}(arg);
             }
+            else if(To == HIPBLAS_R_32F
+                    && (Tc == HIPBLAS_R_32F_FAST || Tc == HIPBLAS_R_32F_FAST_TF32
+                        || Tc == HIPBLAS_R_32F_FAST_16BX3))
+            {
+                return TEST<float>{}(arg);
+            }
         }
         else
         {
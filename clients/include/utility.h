@@ -159,6 +159,37 @@ inline float half_to_float(hipblasHalf val)
 #endif
 }
 
+inline hipblasHalfComplex float_to_half_complex(hipblasComplex val)
+{
+    return hipblasHalfComplex(float_to_half(val.real()), float_to_half(val.imag()));
+}
+
+inline hipblasComplex half_complex_to_float(hipblasHalfComplex val)
+{
+    return hipblasComplex(half_to_float(val.real()), half_to_float(val.imag()));
+}
+
+// Complex half results are checked as complex float, for either type of output
+inline void half_complex_convert(hipblasComplex x, hipblasHalfComplex& y)
+{
+    y = float_to_half_complex(x);
+}
+
+inline void half_complex_convert(hipblasComplex x, hipblasComplex& y)
+{
+    y = x;
+}
+
+inline hipblasComplex half_complex_widen(hipblasHalfComplex x)
+{
+    return half_complex_to_float(x);
+}
+
+inline hipblasComplex half_complex_widen(hipblasComplex x)
+{
+    return x;
+}
+
 inline std::ostream& operator<<(std::ostream& os, const hipblasBfloat16& bf)
 {
     return os << float(bf);
@@ -276,6 +307,12 @@ public:
         return {float(*this), float(*this)};
     }
 
+    // Random NaN Half Complex
+    explicit operator hipblasHalfComplex()
+    {
+        return {hipblasHalf(*this), hipblasHalf(*this)};
+    }
+
     // Random NaN Double Complex
     explicit operator hipblasDoubleComplex()
     {
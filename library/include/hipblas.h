@@ -87,6 +87,18 @@
 /*! \brief hipblasHanlde_t is a void pointer, to store the library context (either rocBLAS or cuBLAS)*/
 typedef void* hipblasHandle_t;
 
+/*! \brief hipblasGraph_t is an opaque pointer to a sequence of calls recorded with hipblasGraphBegin*/
+typedef struct hipblasGraph* hipblasGraph_t;
+
+/*! \brief hipblasMatmulPlan_t is an opaque pointer to a GEMM prepared once with hipblasMatmulPlanCreate*/
+typedef struct hipblasMatmulPlan* hipblasMatmulPlan_t;
+
+/*! \brief hipblasXtHandle_t is an opaque pointer to a set of devices sharing hipblasXt calls, created with hipblasXtCreate*/
+typedef struct hipblasXtContext* hipblasXtHandle_t;
+
+/*! \brief hipblasHandlePool_t is an opaque pointer to a set of reusable handles, created with hipblasHandlePoolCreate*/
+typedef struct hipblasHandlePool* hipblasHandlePool_t;
+
 /*! \brief To specify the datatype to be unsigned short */
 
 #if __cplusplus < 201103L || !defined(HIPBLAS_USE_HIP_HALF)
@@ -357,6 +369,52 @@ static_assert(std::is_trivial<hipblasDoubleComplex>{},
 
 #endif // using internal complex class for API
 
+/*! \brief Struct to represent a complex number with half precision real and imaginary parts,
+    the element type of HIPBLAS_C_16F.*/
+typedef struct hipblasHalfComplex
+{
+#ifndef __cplusplus
+
+    hipblasHalf x, y;
+
+#else
+
+private:
+    hipblasHalf x, y;
+
+public:
+#if __cplusplus >= 201103L
+    hipblasHalfComplex() = default;
+#else
+    hipblasHalfComplex() {}
+#endif
+
+    hipblasHalfComplex(hipblasHalf r, hipblasHalf i = hipblasHalf())
+        : x(r)
+        , y(i)
+    {
+    }
+
+    hipblasHalf real() const
+    {
+        return x;
+    }
+    hipblasHalf imag() const
+    {
+        return y;
+    }
+    void real(hipblasHalf r)
+    {
+        x = r;
+    }
+    void imag(hipblasHalf i)
+    {
+        y = i;
+    }
+
+#endif
+} hipblasHalfComplex;
+
 #if __cplusplus >= 201103L
 #include <type_traits>
 static_assert(std::is_standard_layout<hipblasComplex>{},
@@ -368,6 +426,9 @@ static_assert(sizeof(hipblasComplex) == sizeof(float) * 2
                   && sizeof(hipblasDoubleComplex) == sizeof(double) * 2
                   && sizeof(hipblasDoubleComplex) == sizeof(hipblasComplex) * 2,
               "Sizes of hipblasComplex or hipblasDoubleComplex are inconsistent");
+static_assert(std::is_trivial<hipblasHalfComplex>{} && std::is_standard_layout<hipblasHalfComplex>{}
+                  && sizeof(hipblasHalfComplex) == sizeof(hipblasHalf) * 2,
+              "hipblasHalfComplex is incompatible with C or HIPBLAS_C_16F data");
 #endif
 
 /*! \brief hipblas status codes definition */
@@ -447,6 +508,9 @@ typedef enum
     HIPBLAS_C_32U            = 167, /**< 32 bit unsigned integer, complex */
     HIPBLAS_R_16B            = 168, /**< 16 bit bfloat, real */
     HIPBLAS_C_16B            = 169, /**< 16 bit bfloat, complex */
+    HIPBLAS_R_32F_FAST       = 170, /**< f32 computation with reduced-precision products, see hipblasFloat32Mode_t; compute type only */
+    HIPBLAS_R_32F_FAST_TF32  = 171, /**< f32 computation with TF32 (xf32) products where supported; compute type only */
+    HIPBLAS_R_32F_FAST_16BX3 = 172, /**< f32 computation with bf16x3 emulated products; compute type only */
     HIPBLAS_DATATYPE_INVALID = 255, /**< Invalid datatype value, do not use */
 } hipblasDatatype_t;
 
@@ -463,6 +527,79 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED = 1 /**< Algorithms will take advantage of atomics where applicable. */
 } hipblasAtomicsMode_t;
 
+/*! \brief Indicates if GEMM calls on a handle may be queued and coalesced into batched calls. */
+typedef enum
+{
+    HIPBLAS_DEFERRED_MODE_DISABLED = 0, /**<  Every call is issued when it is made. */
+    HIPBLAS_DEFERRED_MODE_ENABLED = 1 /**< Independent same-shape GEMM calls are queued and issued together. */
+} hipblasDeferredMode_t;
+
+/*! \brief Hints hipBLAS gives the runtime for managed memory passed to GEMM calls on a handle. */
+typedef enum
+{
+    HIPBLAS_MANAGED_MEMORY_POLICY_NONE = 0, /**<  Managed memory migrates on first touch. */
+    HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH = 1, /**< Regions are prefetched to the device on the handle's stream. */
+    HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE = 2 /**< Regions are also advised read-mostly for inputs and device-preferred for outputs. */
+} hipblasManagedMemoryPolicy_t;
+
+/*! \brief Declares that square GEMM outputs on a handle are symmetric, or Hermitian for the complex types with a conjugate transpose. */
+typedef enum
+{
+    HIPBLAS_SYMMETRIC_OUTPUT_NONE = 0, /**< GEMM outputs are general matrices. */
+    HIPBLAS_SYMMETRIC_OUTPUT_UPPER = 1, /**< Only the upper triangle of C is computed and written. */
+    HIPBLAS_SYMMETRIC_OUTPUT_LOWER = 2, /**< Only the lower triangle of C is computed and written. */
+    HIPBLAS_SYMMETRIC_OUTPUT_FULL = 3 /**< C is computed in block rows above the diagonal and mirrored below it. */
+} hipblasSymmetricOutput_t;
+
+/*! \brief Reduced-precision arithmetic the f32 GemmEx calls on a handle may use. */
+typedef enum
+{
+    HIPBLAS_FLOAT32_MODE_DEFAULT = 0, /**< Products are computed in f32. */
+    HIPBLAS_FLOAT32_MODE_FAST = 1, /**< TF32 (xf32) matrix cores where the device has them, f32 otherwise. */
+    HIPBLAS_FLOAT32_MODE_FAST_TF32 = 2, /**< The same as HIPBLAS_FLOAT32_MODE_FAST. */
+    HIPBLAS_FLOAT32_MODE_FAST_16BX3 = 3 /**< Each operand is split into two bf16 parts and three of their products are accumulated in f32. */
+} hipblasFloat32Mode_t;
+
+/*! \brief Operation applied to the result of a GEMM executed from a hipblasMatmulPlan_t. */
+typedef enum
+{
+    HIPBLAS_MATMUL_EPILOGUE_DEFAULT = 0, /**<  No operation after the GEMM. */
+    HIPBLAS_MATMUL_EPILOGUE_BIAS = 1 /**< A bias vector of m elements is added to every column of C. */
+} hipblasMatmulEpilogue_t;
+
+/*! \brief Level-3 routine a hipblasXt host BLAS setting applies to. */
+typedef enum
+{
+    HIPBLAS_XT_GEMM = 0, /**<  hipblasXtXgemm. */
+    HIPBLAS_XT_SYRK = 1, /**<  hipblasXtXsyrk, which also uses the host gemm routine. */
+    HIPBLAS_XT_TRSM = 2 /**<  hipblasXtXtrsm. */
+} hipblasXtBlasOp_t;
+
+/*! \brief Precision a hipblasXt host BLAS setting applies to. */
+typedef enum
+{
+    HIPBLAS_XT_FLOAT         = 0, /**<  s precision. */
+    HIPBLAS_XT_DOUBLE        = 1, /**<  d precision. */
+    HIPBLAS_XT_COMPLEX       = 2, /**<  c precision. */
+    HIPBLAS_XT_DOUBLECOMPLEX = 3 /**<  z precision. */
+} hipblasXtOpType_t;
+
+/*! \brief Problem shape prepared by hipblasWarmup, with the arguments of hipblasGemmEx that
+    select the kernel. */
+typedef struct
+{
+    hipblasOperation_t transA; /**<  form of op( A ). */
+    hipblasOperation_t transB; /**<  form of op( B ). */
+    int                m; /**<  rows of op( A ) and C. */
+    int                n; /**<  columns of op( B ) and C. */
+    int                k; /**<  columns of op( A ) and rows of op( B ). */
+    hipblasDatatype_t  aType; /**<  datatype of A. */
+    hipblasDatatype_t  bType; /**<  datatype of B. */
+    hipblasDatatype_t  cType; /**<  datatype of C. */
+    hipblasDatatype_t  computeType; /**<  datatype of computation. */
+    int                batchCount; /**<  number of strided matrices, 0 or 1 for hipblasGemmEx. */
+} hipblasGemmShape_t;
+
 typedef enum
 {
     HIPBLAS_INT8_DATATYPE_DEFAULT     = 0x0,
@@ -480,12 +617,107 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCreate(hipblasHandle_t* handle);
 /*! \brief Destroys the library context created using hipblasCreate() */
 HIPBLAS_EXPORT hipblasStatus_t hipblasDestroy(hipblasHandle_t handle);
 
+/*! \brief Create an empty pool of hipblas handles
+    \details
+    A pool keeps handles created once, typically at startup, so that request threads can obtain
+    an initialized handle for the current device with hipblasHandlePoolAcquire without paying
+    for hipblasCreate. Handles are created on demand when none is idle for the current device,
+    and all handles of the pool are destroyed with it. The pool functions may be called
+    concurrently from several threads.
+    Only supported with the rocBLAS and cuBLAS backends.
+    @param[out]
+    pool      [hipblasHandlePool_t*]
+              the new pool, released with hipblasHandlePoolDestroy.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool);
+
+/*! \brief Destroy a pool and every handle it created. No handle may still be acquired. */
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool);
+
+/*! \brief Create handles for the current device until count of them are idle in the pool */
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolReserve(hipblasHandlePool_t pool, int count);
+
+/*! \brief Take an idle handle for the current device from the pool, creating one if none is idle
+    @param[in]
+    pool      [hipblasHandlePool_t]
+              pool created with hipblasHandlePoolCreate.
+    @param[out]
+    handle    [hipblasHandle_t*]
+              handle reserved for the caller until hipblasHandlePoolRelease.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t*    handle);
+
+/*! \brief Return an acquired handle to the pool
+    \details
+    Calls queued in deferred mode are issued, the calling thread's stream binding is removed and
+    the stream, pointer mode, atomics mode and managed memory policy are reset to the values the
+    handle had when it was created. Workspace already allocated by the handle is kept.
+    @param[in]
+    pool      [hipblasHandlePool_t]
+              pool the handle was acquired from.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle returned by hipblasHandlePoolAcquire.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t     handle);
+
+/*! \brief Prepare a handle for the given GEMM shapes
+    \details
+    Runs one hipblasGemmEx, or hipblasGemmStridedBatchedEx when batchCount > 1, of each shape on
+    zero-filled scratch operands with the smallest leading dimensions, and waits for them on the
+    handle's stream. The backend loads the kernels those shapes select and grows the handle's
+    workspace to what they need, so that the first application call of each shape does not pay
+    for it. Shapes are run with HIPBLAS_GEMM_DEFAULT and host scalars whatever the pointer mode.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    shapes    [const hipblasGemmShape_t*]
+              host array of shapeCount shapes.
+    @param[in]
+    shapeCount
+              [int]
+              number of shapes.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasWarmup(hipblasHandle_t           handle,
+                                             const hipblasGemmShape_t* shapes,
+                                             int                       shapeCount);
+
 /*! \brief Set stream for handle */
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId);
 
 /*! \brief Get stream[0] for handle */
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId);
 
+/*! \brief Bind a stream to the handle for the calling thread
+    \details
+    Calls made on handle from the calling thread run on stream, without changing the stream seen
+    by other threads, so that several threads can share one handle without calling
+    hipblasSetStream around each call. Each bound thread runs its calls on a backend handle of its
+    own, with its own workspace and deferred queue, so the calls take no locks and run concurrently.
+    The thread's handle starts with the pointer mode, atomics mode, deferred mode, managed memory
+    policy, symmetric output and float32 mode of handle at the time of the binding. Settings
+    changed from a bound thread apply to its own handle only, as do hipblasSetStream,
+    hipblasGetStream, hipblasFlush and graph capture. Binding a bound thread again changes its
+    stream.
+
+    Bindings are released by hipblasClearThreadStream, which destroys the thread's handle after
+    issuing its deferred calls, or with the handle by hipblasDestroy.
+    Only supported with the rocBLAS and cuBLAS backends.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    stream    [hipStream_t]
+              stream the calling thread's calls on handle run on.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetThreadStream(hipblasHandle_t handle, hipStream_t stream);
+
+/*! \brief Remove the binding of the calling thread to the handle, see hipblasSetThreadStream */
+HIPBLAS_EXPORT hipblasStatus_t hipblasClearThreadStream(hipblasHandle_t handle);
+
 /*! \brief Set hipblas pointer mode */
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t      handle,
                                                      hipblasPointerMode_t mode);
@@ -604,7 +836,9 @@ HIPBLAS_EXPORT hipblasStatus_t
 /*! \brief asynchronously copy vector from host to device
     \details
     hipblasSetVectorAsync copies a vector from pinned host memory to device memory asynchronously.
-    Memory on the host must be allocated with hipHostMalloc or the transfer will be synchronous.
+    Pageable host memory larger than 64 KiB is packed into pinned staging buffers while the
+    previous buffer is copied; the call returns once the last buffer is packed, and the host
+    memory may then be reused. HIPBLAS_STAGING_SIZE sets the buffer size in bytes, 0 disables it.
     @param[in]
     n           [int]
                 number of elements in the vector
@@ -630,7 +864,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetVectorAsync(
 /*! \brief asynchronously copy vector from device to host
     \details
     hipblasGetVectorAsync copies a vector from pinned host memory to device memory asynchronously.
-    Memory on the host must be allocated with hipHostMalloc or the transfer will be synchronous.
+    Pageable host memory larger than 64 KiB is filled from pinned staging buffers by host
+    functions queued on stream, so it is written when stream reaches them.
+    HIPBLAS_STAGING_SIZE sets the buffer size in bytes, 0 disables it.
     @param[in]
     n           [int]
                 number of elements in the vector
@@ -656,7 +892,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetVectorAsync(
 /*! \brief asynchronously copy matrix from host to device
     \details
     hipblasSetMatrixAsync copies a matrix from pinned host memory to device memory asynchronously.
-    Memory on the host must be allocated with hipHostMalloc or the transfer will be synchronous.
+    Pageable host memory larger than 64 KiB is packed into pinned staging buffers while the
+    previous buffer is copied; the call returns once the last buffer is packed, and the host
+    memory may then be reused. HIPBLAS_STAGING_SIZE sets the buffer size in bytes, 0 disables it.
     @param[in]
     rows        [int]
                 number of rows in matrices
@@ -690,7 +928,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixAsync(int         rows,
 /*! \brief asynchronously copy matrix from device to host
     \details
     hipblasGetMatrixAsync copies a matrix from device memory to pinned host memory asynchronously.
-    Memory on the host must be allocated with hipHostMalloc or the transfer will be synchronous.
+    Pageable host memory larger than 64 KiB is filled from pinned staging buffers by host
+    functions queued on stream, so it is written when stream reaches them.
+    HIPBLAS_STAGING_SIZE sets the buffer size in bytes, 0 disables it.
     @param[in]
     rows        [int]
                 number of rows in matrices
@@ -722,6 +962,235 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixAsync(int         rows,
                                                      int         ldb,
                                                      hipStream_t stream);
 
+/*! @{
+    \brief asynchronously copy a batch of vectors between host and device
+    \details
+    hipblasSetVectorBatchedAsync copies batchCount vectors x_i on the host to y_i on the device,
+    and hipblasGetVectorBatchedAsync copies x_i on the device to y_i on the host, as one transfer
+    when the vectors of each side are the same distance apart in memory.
+    The arrays of pointers themselves are in host memory. Host memory is handled as in
+    hipblasSetVectorAsync and hipblasGetVectorAsync.
+    @param[in]
+    n           [int]
+                number of elements in each vector
+    @param[in]
+    elemSize    [int]
+                number of bytes per element
+    @param[in]
+    x           host array of pointers to the source vectors
+    @param[in]
+    incx        [int]
+                specifies the increment for the elements of each x_i, incx > 0
+    @param[out]
+    y           host array of pointers to the destination vectors
+    @param[in]
+    incy        [int]
+                specifies the increment for the elements of each y_i, incy > 0
+    @param[in]
+    batchCount  [int]
+                number of vectors in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetVectorBatchedAsync(int               n,
+                                                            int               elemSize,
+                                                            const void* const x[],
+                                                            int               incx,
+                                                            void* const       y[],
+                                                            int               incy,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetVectorBatchedAsync(int               n,
+                                                            int               elemSize,
+                                                            const void* const x[],
+                                                            int               incx,
+                                                            void* const       y[],
+                                                            int               incy,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+//! @}
+
+/*! @{
+    \brief asynchronously copy a strided batch of vectors between host and device
+    \details
+    hipblasSetVectorStridedBatchedAsync copies batchCount vectors from the host to the device,
+    and hipblasGetVectorStridedBatchedAsync copies them from the device to the host, with the
+    vectors of each side stridex and stridey elements apart.
+    Transfers are coalesced: vectors with unit increments are copied as the columns of one matrix,
+    other vectors with one 3D copy when the strides are multiples of the increments, and pageable
+    host memory is packed several vectors at a time into the pinned staging buffers used by
+    hipblasSetVectorAsync.
+    @param[in]
+    n           [int]
+                number of elements in each vector
+    @param[in]
+    elemSize    [int]
+                number of bytes per element
+    @param[in]
+    x           pointer to the first source vector
+    @param[in]
+    incx        [int]
+                specifies the increment for the elements of each x_i, incx > 0
+    @param[in]
+    stridex     [hipblasStride]
+                stride from the start of one x_i to the next, in elements
+    @param[out]
+    y           pointer to the first destination vector
+    @param[in]
+    incy        [int]
+                specifies the increment for the elements of each y_i, incy > 0
+    @param[in]
+    stridey     [hipblasStride]
+                stride from the start of one y_i to the next, in elements
+    @param[in]
+    batchCount  [int]
+                number of vectors in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetVectorStridedBatchedAsync(int           n,
+                                                                   int           elemSize,
+                                                                   const void*   x,
+                                                                   int           incx,
+                                                                   hipblasStride stridex,
+                                                                   void*         y,
+                                                                   int           incy,
+                                                                   hipblasStride stridey,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetVectorStridedBatchedAsync(int           n,
+                                                                   int           elemSize,
+                                                                   const void*   x,
+                                                                   int           incx,
+                                                                   hipblasStride stridex,
+                                                                   void*         y,
+                                                                   int           incy,
+                                                                   hipblasStride stridey,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+//! @}
+
+/*! @{
+    \brief asynchronously copy a batch of matrices between host and device
+    \details
+    hipblasSetMatrixBatchedAsync copies batchCount matrices A_i on the host to B_i on the device,
+    and hipblasGetMatrixBatchedAsync copies A_i on the device to B_i on the host, as one transfer
+    when the matrices of each side are the same distance apart in memory.
+    The arrays of pointers themselves are in host memory. Host memory is handled as in
+    hipblasSetMatrixAsync and hipblasGetMatrixAsync.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize    [int]
+                number of bytes per element
+    @param[in]
+    AP          host array of pointers to the source matrices
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[out]
+    BP          host array of pointers to the destination matrices
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                                            int               cols,
+                                                            int               elemSize,
+                                                            const void* const AP[],
+                                                            int               lda,
+                                                            void* const       BP[],
+                                                            int               ldb,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                                            int               cols,
+                                                            int               elemSize,
+                                                            const void* const AP[],
+                                                            int               lda,
+                                                            void* const       BP[],
+                                                            int               ldb,
+                                                            int               batchCount,
+                                                            hipStream_t       stream);
+//! @}
+
+/*! @{
+    \brief asynchronously copy a strided batch of matrices between host and device
+    \details
+    hipblasSetMatrixStridedBatchedAsync copies batchCount matrices from the host to the device,
+    and hipblasGetMatrixStridedBatchedAsync copies them from the device to the host, with the
+    matrices of each side strideA and strideB elements apart.
+    Transfers are coalesced: when the strides are whole numbers of columns the batch is copied
+    with one 3D copy, and pageable host memory is packed several matrices at a time into the
+    pinned staging buffers used by hipblasSetMatrixAsync.
+    @param[in]
+    rows        [int]
+                number of rows in matrices
+    @param[in]
+    cols        [int]
+                number of columns in matrices
+    @param[in]
+    elemSize    [int]
+                number of bytes per element
+    @param[in]
+    AP          pointer to the first source matrix
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= rows
+    @param[in]
+    strideA     [hipblasStride]
+                stride from the start of one A_i to the next, in elements
+    @param[out]
+    BP          pointer to the first destination matrix
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= rows
+    @param[in]
+    strideB     [hipblasStride]
+                stride from the start of one B_i to the next, in elements
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch
+    @param[in]
+    stream      specifies the stream into which this transfer request is queued
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                                   int           cols,
+                                                                   int           elemSize,
+                                                                   const void*   AP,
+                                                                   int           lda,
+                                                                   hipblasStride strideA,
+                                                                   void*         BP,
+                                                                   int           ldb,
+                                                                   hipblasStride strideB,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                                   int           cols,
+                                                                   int           elemSize,
+                                                                   const void*   AP,
+                                                                   int           lda,
+                                                                   hipblasStride strideA,
+                                                                   void*         BP,
+                                                                   int           ldb,
+                                                                   hipblasStride strideB,
+                                                                   int           batchCount,
+                                                                   hipStream_t   stream);
+//! @}
+
 /*! \brief Set hipblasSetAtomicsMode*/
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
                                                      hipblasAtomicsMode_t atomics_mode);
@@ -730,6 +1199,195 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Set hipblasDeferredMode
+    \details
+    With HIPBLAS_DEFERRED_MODE_ENABLED, calls to hipblas(H,S,D,C,Z)gemm on the handle
+    with host pointer mode are queued as long as they have the same transposes, sizes,
+    leading dimensions, alpha and beta, and do not read or write the output of a queued call.
+    The queue is issued as one hipblasXgemmStridedBatched call when the matrices are at regular
+    offsets, or as one hipblasXgemmBatched call otherwise, at the first of:
+    - a GEMM call that cannot join the queue,
+    - any other hipBLAS call on the handle, or a hipBLAS call that takes no handle,
+    - hipblasFlush.
+
+    Calls remain ordered on the handle's stream. The application must call hipblasFlush before it
+    synchronizes the stream or accesses the results other than through hipBLAS. Errors from a queued
+    call are returned by the call that issues the queue. Disabling deferred mode flushes the queue.
+    Only supported with the rocBLAS and cuBLAS backends.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasDeferredMode_t]
+              HIPBLAS_DEFERRED_MODE_DISABLED (default) or HIPBLAS_DEFERRED_MODE_ENABLED.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetDeferredMode(hipblasHandle_t       handle,
+                                                      hipblasDeferredMode_t mode);
+
+/*! \brief Get hipblasDeferredMode*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetDeferredMode(hipblasHandle_t        handle,
+                                                      hipblasDeferredMode_t* mode);
+
+/*! \brief Issue the GEMM calls queued on a handle in deferred mode, see hipblasSetDeferredMode */
+HIPBLAS_EXPORT hipblasStatus_t hipblasFlush(hipblasHandle_t handle);
+
+/*! \brief Set hipblasManagedMemoryPolicy
+    \details
+    With a policy other than HIPBLAS_MANAGED_MEMORY_POLICY_NONE, calls to hipblas(H,S,D,C,Z)gemm,
+    hipblasGemmEx, their StridedBatched forms and hipblasMatmulPlanExecute on the handle check
+    whether A, B and C are managed memory. The regions the call touches are prefetched to the
+    current device on the handle's stream before the call, so the computation does not stall on
+    page faults. Pages already on the device are not migrated again.
+
+    When the regions together exceed the device's memory they are not prefetched; they are advised
+    as accessed by the device instead, so an oversubscribed call reads them in place rather than
+    migrating pages back and forth. With HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE, inputs
+    that fit are also advised read-mostly and outputs preferred on the device. Advice applies to
+    the whole allocation and is given once per allocation, as hipMemAdvise synchronizes; a handle
+    remembers the last 256 allocations advised.
+    The batched forms, which take device arrays of pointers, are not prefetched.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    policy    [hipblasManagedMemoryPolicy_t]
+              HIPBLAS_MANAGED_MEMORY_POLICY_NONE (default), HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH
+              or HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetManagedMemoryPolicy(hipblasHandle_t              handle,
+                                                             hipblasManagedMemoryPolicy_t policy);
+
+/*! \brief Get hipblasManagedMemoryPolicy*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetManagedMemoryPolicy(hipblasHandle_t               handle,
+                                                             hipblasManagedMemoryPolicy_t* policy);
+
+/*! \brief Set hipblasSymmetricOutput
+    \details
+    Declares that C in the following hipblas(S,D,C,Z)gemm calls on the handle, and in their
+    Batched and StridedBatched forms, is symmetric, so that about half of the products can be
+    skipped. The setting only applies to calls with m == n and complementary transposes, one of
+    transA and transB being HIPBLAS_OP_N, where op( A )*op( B ) is symmetric, or Hermitian
+    with HIPBLAS_OP_C for the complex types. Other calls are unaffected.
+
+    With HIPBLAS_SYMMETRIC_OUTPUT_UPPER or HIPBLAS_SYMMETRIC_OUTPUT_LOWER, only that triangle of
+    C is written, with syrk or herk when B is A, and with syrkx or herkx otherwise. The Hermitian
+    forms are only used in host pointer mode with real beta, and real alpha when B is A. When
+    the backend has no batched form of these routines the call runs as a GEMM.
+
+    With HIPBLAS_SYMMETRIC_OUTPUT_FULL, the block rows of C are computed from the diagonal
+    rightwards, each with one GEMM, and the part right of the diagonal block is transposed
+    below it with geam. This applies to the non-batched and StridedBatched forms with n greater
+    than 128.
+
+    The result is only that of the GEMM if C and op( A )*op( B ) are indeed symmetric. Calls
+    queued in deferred mode run as GEMMs.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    output    [hipblasSymmetricOutput_t]
+              HIPBLAS_SYMMETRIC_OUTPUT_NONE (default), HIPBLAS_SYMMETRIC_OUTPUT_UPPER,
+              HIPBLAS_SYMMETRIC_OUTPUT_LOWER or HIPBLAS_SYMMETRIC_OUTPUT_FULL.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetSymmetricOutput(hipblasHandle_t          handle,
+                                                         hipblasSymmetricOutput_t output);
+
+/*! \brief Get hipblasSymmetricOutput*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetSymmetricOutput(hipblasHandle_t           handle,
+                                                         hipblasSymmetricOutput_t* output);
+
+/*! \brief Set hipblasFloat32Mode
+    \details
+    Lets the hipblasGemmEx, hipblasGemmBatchedEx and hipblasGemmStridedBatchedEx calls on the
+    handle with HIPBLAS_R_32F A, B, C and computeType compute their products with less than f32
+    precision, for the throughput of the device's matrix cores. Accumulation remains in f32.
+    A call can instead select a mode with computeType HIPBLAS_R_32F_FAST, HIPBLAS_R_32F_FAST_TF32
+    or HIPBLAS_R_32F_FAST_16BX3, which take precedence over the handle's mode.
+
+    TF32 uses the backend's reduced-precision math mode: TF32 tensor cores on NVIDIA devices
+    of compute capability 8.0 and above, and xf32 matrix cores on gfx940, gfx941 and gfx942.
+    Inputs keep 10 bits of their mantissa, for a relative error of about 2^-11 per product.
+    Devices without them compute in f32, as with HIPBLAS_FLOAT32_MODE_DEFAULT. The math mode
+    is switched on the handle for the duration of the call, so a handle running TF32 GEMMs
+    must not be used from another thread at the same time, other than by threads bound with
+    hipblasSetThreadStream, whose calls wait for each other.
+
+    bf16x3, which is only used when asked for, splits A into the bf16 value Ah of its upper 16
+    bits and the bf16 remainder Al, and B likewise, and computes
+    alpha*(Al*Bh + Ah*Bl + Ah*Bh) + beta*C as three bf16 GEMMs with f32 accumulation, for a
+    relative error of about 2^-15 per product. The split takes about twice the size of A and
+    B from the handle's workspace and does not wait for the stream. hipblasGemmBatchedEx
+    reads the pointer arrays with a wait on backends without hipblasSgeamBatched. It pays off
+    for large GEMMs on devices with bf16 but no TF32 matrix cores. Infinite or NaN inputs give
+    NaN results.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasFloat32Mode_t]
+              HIPBLAS_FLOAT32_MODE_DEFAULT (default), HIPBLAS_FLOAT32_MODE_FAST,
+              HIPBLAS_FLOAT32_MODE_FAST_TF32 or HIPBLAS_FLOAT32_MODE_FAST_16BX3.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetFloat32Mode(hipblasHandle_t      handle,
+                                                     hipblasFloat32Mode_t mode);
+
+/*! \brief Get hipblasFloat32Mode*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetFloat32Mode(hipblasHandle_t       handle,
+                                                     hipblasFloat32Mode_t* mode);
+
+/*! \brief Start recording the calls made on a handle into a graph
+    \details
+    Until hipblasGraphEnd, calls on the handle are captured into a HIP graph instead of running.
+    Consecutive calls to hipblas(S,D,C,Z)scal, hipblas(S,D,C,Z)axpy and hipblas(S,D,C,Z)gemv with
+    host scalars, and hipblas(S,D)dot with device scalars, are first gathered, and runs of calls
+    of one precision are combined where they compute the same values, though the combined call
+    may round differently from the separate ones:
+    - scal and axpy calls updating the same vector y from at most one other vector x, in any
+      order, become one scal or axpy, or one in-place hipblasXgeam computing
+      y = alpha * x + beta * y, a single pass over both vectors,
+    - gemv calls sharing A, alpha and beta on independent vectors at regular offsets become one
+      hipblasXgemm or hipblasXgemvStridedBatched call,
+    - dot calls sharing one vector, with the other vectors and the results at regular offsets,
+      become one hipblasXgemv call.
+
+    A call that does not join the current run starts a new one; in a sequence such as
+    scal, axpy, dot, nrm2 the scal and axpy become one call and the dot its own.
+    nrm2 and any other call are captured unchanged, as there is no single BLAS call computing
+    them together with their neighbours, so a graph can record any sequence of hipBLAS calls,
+    including calls not listed above. Calls made while recording must not synchronize the stream
+    or allocate device memory; in particular reductions must use HIPBLAS_POINTER_MODE_DEVICE.
+    If the handle has the default stream, an internal stream is used for the capture and the
+    default stream is restored by hipblasGraphEnd.
+    Only supported with the rocBLAS and cuBLAS backends.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphBegin(hipblasHandle_t handle);
+
+/*! \brief Stop recording calls on a handle and compile them into a graph, see hipblasGraphBegin
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    graph     [hipblasGraph_t*]
+              the compiled graph, released with hipblasGraphDestroy.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphEnd(hipblasHandle_t handle, hipblasGraph_t* graph);
+
+/*! \brief Run all calls recorded in a graph with a single launch on a stream
+    @param[in]
+    graph     [hipblasGraph_t]
+              graph compiled by hipblasGraphEnd.
+    @param[in]
+    stream    [hipStream_t]
+              stream the graph is launched into.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphLaunch(hipblasGraph_t graph, hipStream_t stream);
+
+/*! \brief Release a graph compiled by hipblasGraphEnd*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -893,7 +1551,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
     \brief BLAS Level 1 API
 
     \details
-    amin finds the first index of the element of minimum magnitude of a vector x.
+    amaxAsync finds the first index of the element of maximum magnitude of a vector x, as hipblasIXamax does,
+    without waiting for the result in host pointer mode.
+
+    The result is written by the device: it must be pinned or registered host memory, or device
+    memory, and is valid once the handle's stream reaches the end of the call. If event is not
+    null it is recorded on the stream after the call, so that the host can check the result with
+    hipEventQuery or hipEventSynchronize, for instance one iteration later. The pointer mode of
+    the handle is not used.
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : s,d,c,z
@@ -908,18 +1573,74 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
     x         device pointer storing vector x.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of y.
-    @param[inout]
+              specifies the increment for the elements of x.
+    @param[out]
     result
-              device pointer or host pointer to store the amin index.
-              return is 0.0 if n, incx<=0.
+              pinned host pointer or device pointer to store the amax index.
+    @param[in]
+    event     [hipEvent_t]
+              event recorded after the call, or nullptr.
     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxAsync(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const float*    x,
+                                                  int             incx,
+                                                  int*            result,
+                                                  hipEvent_t      event);
 
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxAsync(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const double*   x,
+                                                  int             incx,
+                                                  int*            result,
+                                                  hipEvent_t      event);
 
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxAsync(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  int*                  result,
+                                                  hipEvent_t            event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxAsync(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  int*                        result,
+                                                  hipEvent_t                  event);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    amin finds the first index of the element of minimum magnitude of a vector x.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    result
+              device pointer or host pointer to store the amin index.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
 
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
@@ -1210,6 +1931,69 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t
                                                            double*                     result);
 //! @}
 
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    asumAsync computes the sum of the magnitudes of the elements of a vector x, as hipblasXasum does,
+    without waiting for the result in host pointer mode.
+
+    The result is written by the device: it must be pinned or registered host memory, or device
+    memory, and is valid once the handle's stream reaches the end of the call. If event is not
+    null it is recorded on the stream after the call, so that the host can check the result with
+    hipEventQuery or hipEventSynchronize, for instance one iteration later. The pointer mode of
+    the handle is not used.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[out]
+    result
+              pinned host pointer or device pointer to store the sum.
+    @param[in]
+    event     [hipEvent_t]
+              event recorded after the call, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumAsync(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const float*    x,
+                                                 int             incx,
+                                                 float*          result,
+                                                 hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumAsync(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const double*   x,
+                                                 int             incx,
+                                                 double*         result,
+                                                 hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumAsync(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  float*                result,
+                                                  hipEvent_t            event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumAsync(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  double*                     result,
+                                                  hipEvent_t                  event);
+//! @}
+
 /*! @{
     \brief BLAS Level 1 API
 
@@ -2021,6 +2805,100 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t
                                                           hipblasDoubleComplex*       result);
 //! @}
 
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    dotAsync computes the dot product of vectors x and y, as hipblasXdot does,
+    without waiting for the result in host pointer mode.
+
+    The result is written by the device: it must be pinned or registered host memory, or device
+    memory, and is valid once the handle's stream reaches the end of the call. If event is not
+    null it is recorded on the stream after the call, so that the host can check the result with
+    hipEventQuery or hipEventSynchronize, for instance one iteration later. The pointer mode of
+    the handle is not used.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[out]
+    result
+              pinned host pointer or device pointer to store the dot product.
+    @param[in]
+    event     [hipEvent_t]
+              event recorded after the call, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotAsync(hipblasHandle_t handle,
+                                                int             n,
+                                                const float*    x,
+                                                int             incx,
+                                                const float*    y,
+                                                int             incy,
+                                                float*          result,
+                                                hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotAsync(hipblasHandle_t handle,
+                                                int             n,
+                                                const double*   x,
+                                                int             incx,
+                                                const double*   y,
+                                                int             incy,
+                                                double*         result,
+                                                hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuAsync(hipblasHandle_t       handle,
+                                                 int                   n,
+                                                 const hipblasComplex* x,
+                                                 int                   incx,
+                                                 const hipblasComplex* y,
+                                                 int                   incy,
+                                                 hipblasComplex*       result,
+                                                 hipEvent_t            event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcAsync(hipblasHandle_t       handle,
+                                                 int                   n,
+                                                 const hipblasComplex* x,
+                                                 int                   incx,
+                                                 const hipblasComplex* y,
+                                                 int                   incy,
+                                                 hipblasComplex*       result,
+                                                 hipEvent_t            event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuAsync(hipblasHandle_t             handle,
+                                                 int                         n,
+                                                 const hipblasDoubleComplex* x,
+                                                 int                         incx,
+                                                 const hipblasDoubleComplex* y,
+                                                 int                         incy,
+                                                 hipblasDoubleComplex*       result,
+                                                 hipEvent_t                  event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcAsync(hipblasHandle_t             handle,
+                                                 int                         n,
+                                                 const hipblasDoubleComplex* x,
+                                                 int                         incx,
+                                                 const hipblasDoubleComplex* y,
+                                                 int                         incy,
+                                                 hipblasDoubleComplex*       result,
+                                                 hipEvent_t                  event);
+//! @}
+
 /*! @{
     \brief BLAS Level 1 API
 
@@ -2192,6 +3070,69 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t
                                                            double*                     result);
 //! @}
 
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    nrm2Async computes the euclidean norm of a vector x, as hipblasXnrm2 does,
+    without waiting for the result in host pointer mode.
+
+    The result is written by the device: it must be pinned or registered host memory, or device
+    memory, and is valid once the handle's stream reaches the end of the call. If event is not
+    null it is recorded on the stream after the call, so that the host can check the result with
+    hipEventQuery or hipEventSynchronize, for instance one iteration later. The pointer mode of
+    the handle is not used.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[out]
+    result
+              pinned host pointer or device pointer to store the norm.
+    @param[in]
+    event     [hipEvent_t]
+              event recorded after the call, or nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Async(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const float*    x,
+                                                 int             incx,
+                                                 float*          result,
+                                                 hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Async(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const double*   x,
+                                                 int             incx,
+                                                 double*         result,
+                                                 hipEvent_t      event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Async(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  float*                result,
+                                                  hipEvent_t            event);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Async(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  double*                     result,
+                                                  hipEvent_t                  event);
+//! @}
+
 /*! @{
     \brief BLAS Level 1 API
 
@@ -10878,6 +11819,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t
     op( B ) an k by n by batchCount strided_batched matrix and
     C an m by n by batchCount strided_batched matrix.
 
+    When strideA is 0 and the op( B_i ) and C_i follow each other column block after column
+    block, or strideB is 0 and the op( A_i ) and C_i follow each other row block after row
+    block, the batch is computed as one GEMM with n*batchCount columns or m*batchCount rows.
+    The larger GEMM may use a different kernel, so results can differ in the last bits from
+    separate GEMMs; set HIPBLAS_GEMM_BROADCAST=0 to compute the batch as given.
+
     - Supported precisions in rocBLAS : h,s,d,c,z
     - Supported precisions in cuBLAS  : h,s,d,c,z
 
@@ -13812,18 +14759,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t
     \brief BLAS Level 3 API
 
     \details
-    geam performs one of the matrix-matrix operations
+    gemmt performs the matrix-matrix operation
 
-        C = alpha*op( A ) + beta*op( B ),
+        C := alpha*op( A )*op( B ) + beta*C
 
-    where op( X ) is one of
+    on the upper or lower triangle of C only, where alpha and beta are scalars, op( A ) is an
+    n by k matrix, op( B ) a k by n matrix and C an n by n matrix, with
 
         op( X ) = X      or
         op( X ) = X**T   or
-        op( X ) = X**H,
+        op( X ) = X**H.
 
-    alpha and beta are scalars, and A, B and C are matrices, with
-    op( A ) an m by n matrix, op( B ) an m by n matrix, and C an m by n matrix.
+    The other triangle of C is not referenced. Unlike syrkx, A and B need not be shaped alike
+    and the product need not be symmetric.
+
+    When transA == HIPBLAS_OP_N and transB == HIPBLAS_OP_T, or the reverse, the backend syrkx
+    computes the triangle directly. Otherwise C is computed in block rows: one GEMM covers the
+    part of the row off the diagonal, and one GEMM into a device workspace computes the
+    diagonal tile, which is then added to the triangle of C. The workspace belongs to the
+    handle and is reused by later calls, so the function does not synchronize unless it needs
+    more workspace than any call on the handle before it. Either way, about half the floating
+    point work of gemm is done.
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : s,d,c,z
@@ -13832,489 +14788,493 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  only the upper triangle of C is computed
+              HIPBLAS_FILL_MODE_LOWER:  only the lower triangle of C is computed
+    @param[in]
     transA    [hipblasOperation_t]
-              specifies the form of op( A )
+              specifies the form of op( A ).
     @param[in]
     transB    [hipblasOperation_t]
-              specifies the form of op( B )
-    @param[in]
-    m         [int]
-              matrix dimension m.
+              specifies the form of op( B ).
     @param[in]
     n         [int]
-              matrix dimension n.
+              number of rows and columns of C, and of rows of op( A ) and columns of
+              op( B ). n >= 0.
+    @param[in]
+    k         [int]
+              number of columns of op( A ) and rows of op( B ). k >= 0.
     @param[in]
     alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    AP         device pointer storing matrix A.
+    A         device pointer storing matrix A.
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
+              if transA == HIPBLAS_OP_N, lda >= max( 1, n ), otherwise lda >= max( 1, k ).
     @param[in]
-    beta      device pointer or host pointer specifying the scalar beta.
-    @param[in]
-    BP         device pointer storing matrix B.
+    B         device pointer storing matrix B.
     @param[in]
     ldb       [int]
               specifies the leading dimension of B.
-    @param[in, out]
-    CP         device pointer storing matrix C.
+              if transB == HIPBLAS_OP_N, ldb >= max( 1, k ), otherwise ldb >= max( 1, n ).
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    C         device pointer storing matrix C.
+              Only the uplo triangle is referenced and updated.
     @param[in]
     ldc       [int]
-              specifies the leading dimension of C.
+              specifies the leading dimension of C. ldc >= max( 1, n ).
 
     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmt(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                n,
+                                             int                k,
+                                             const float*       alpha,
+                                             const float*       A,
+                                             int                lda,
+                                             const float*       B,
+                                             int                ldb,
+                                             const float*       beta,
+                                             float*             C,
+                                             int                ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
-                                            hipblasOperation_t transA,
-                                            hipblasOperation_t transB,
-                                            int                m,
-                                            int                n,
-                                            const float*       alpha,
-                                            const float*       AP,
-                                            int                lda,
-                                            const float*       beta,
-                                            const float*       BP,
-                                            int                ldb,
-                                            float*             CP,
-                                            int                ldc);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
-                                            hipblasOperation_t transA,
-                                            hipblasOperation_t transB,
-                                            int                m,
-                                            int                n,
-                                            const double*      alpha,
-                                            const double*      AP,
-                                            int                lda,
-                                            const double*      beta,
-                                            const double*      BP,
-                                            int                ldb,
-                                            double*            CP,
-                                            int                ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmt(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                n,
+                                             int                k,
+                                             const double*      alpha,
+                                             const double*      A,
+                                             int                lda,
+                                             const double*      B,
+                                             int                ldb,
+                                             const double*      beta,
+                                             double*            C,
+                                             int                ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
-                                            hipblasOperation_t    transA,
-                                            hipblasOperation_t    transB,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* AP,
-                                            int                   lda,
-                                            const hipblasComplex* beta,
-                                            const hipblasComplex* BP,
-                                            int                   ldb,
-                                            hipblasComplex*       CP,
-                                            int                   ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmt(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             hipblasOperation_t    transA,
+                                             hipblasOperation_t    transB,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             const hipblasComplex* B,
+                                             int                   ldb,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       C,
+                                             int                   ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
-                                            hipblasOperation_t          transA,
-                                            hipblasOperation_t          transB,
-                                            int                         m,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* AP,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* beta,
-                                            const hipblasDoubleComplex* BP,
-                                            int                         ldb,
-                                            hipblasDoubleComplex*       CP,
-                                            int                         ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmt(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             const hipblasDoubleComplex* B,
+                                             int                         ldb,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       C,
+                                             int                         ldc);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
-    geamBatched performs one of the batched matrix-matrix operations
+    gemmtBatched performs a batch of the matrix-matrix operations
 
-        C_i = alpha*op( A_i ) + beta*op( B_i )  for i = 0, 1, ... batchCount - 1
+        C_i := alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount
 
-    where alpha and beta are scalars, and op(A_i), op(B_i) and C_i are m by n matrices
-    and op( X ) is one of
-
-        op( X ) = X      or
-        op( X ) = X**T
+    on the upper or lower triangle of each C_i only, see hipblasXgemmt. Except where the backend
+    has a batched syrkx for the transA and transB given, the pointer arrays are read back and
+    the matrices are computed one at a time.
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  only the upper triangle of C_i is computed
+              HIPBLAS_FILL_MODE_LOWER:  only the lower triangle of C_i is computed
+    @param[in]
     transA    [hipblasOperation_t]
-              specifies the form of op( A )
+              specifies the form of op( A_i ).
     @param[in]
     transB    [hipblasOperation_t]
-              specifies the form of op( B )
-    @param[in]
-    m         [int]
-              matrix dimension m.
+              specifies the form of op( B_i ).
     @param[in]
     n         [int]
-              matrix dimension n.
+              number of rows and columns of C_i, and of rows of op( A_i ) and columns of
+              op( B_i ). n >= 0.
+    @param[in]
+    k         [int]
+              number of columns of op( A_i ) and rows of op( B_i ). k >= 0.
     @param[in]
     alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    AP         device array of device pointers storing each matrix A_i on the GPU.
-              Each A_i is of dimension ( lda, k ), where k is m
-              when  transA == HIPBLAS_OP_N and
-              is  n  when  transA == HIPBLAS_OP_T.
+    A         device array of device pointers storing each matrix A_i.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A.
-    @param[in]
-    beta      device pointer or host pointer specifying the scalar beta.
+              specifies the leading dimension of A_i.
+              if transA == HIPBLAS_OP_N, lda >= max( 1, n ), otherwise lda >= max( 1, k ).
     @param[in]
-    BP         device array of device pointers storing each matrix B_i on the GPU.
-              Each B_i is of dimension ( ldb, k ), where k is m
-              when  transB == HIPBLAS_OP_N and
-              is  n  when  transB == HIPBLAS_OP_T.
+    B         device array of device pointers storing each matrix B_i.
     @param[in]
     ldb       [int]
-              specifies the leading dimension of B.
-    @param[in, out]
-    CP         device array of device pointers storing each matrix C_i on the GPU.
-              Each C_i is of dimension ( ldc, n ).
+              specifies the leading dimension of B_i.
+              if transB == HIPBLAS_OP_N, ldb >= max( 1, k ), otherwise ldb >= max( 1, n ).
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    C         device array of device pointers storing each matrix C_i.
+              Only the uplo triangle is referenced and updated.
     @param[in]
     ldc       [int]
-              specifies the leading dimension of C.
-
+              specifies the leading dimension of C_i. ldc >= max( 1, n ).
     @param[in]
-    batchCount [int]
-                number of instances i in the batch.
+    batchCount
+              [int]
+              number of instances in the batch.
 
     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmtBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                n,
+                                                    int                k,
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    const float* const B[],
+                                                    int                ldb,
+                                                    const float*       beta,
+                                                    float* const       C[],
+                                                    int                ldc,
+                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t transA,
-                                                   hipblasOperation_t transB,
-                                                   int                m,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const AP[],
-                                                   int                lda,
-                                                   const float*       beta,
-                                                   const float* const BP[],
-                                                   int                ldb,
-                                                   float* const       CP[],
-                                                   int                ldc,
-                                                   int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasOperation_t  transB,
-                                                   int                 m,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const AP[],
-                                                   int                 lda,
-                                                   const double*       beta,
-                                                   const double* const BP[],
-                                                   int                 ldb,
-                                                   double* const       CP[],
-                                                   int                 ldc,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmtBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    hipblasOperation_t  transA,
+                                                    hipblasOperation_t  transB,
+                                                    int                 n,
+                                                    int                 k,
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    const double* const B[],
+                                                    int                 ldb,
+                                                    const double*       beta,
+                                                    double* const       C[],
+                                                    int                 ldc,
+                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasOperation_t          transB,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const AP[],
-                                                   int                         lda,
-                                                   const hipblasComplex*       beta,
-                                                   const hipblasComplex* const BP[],
-                                                   int                         ldb,
-                                                   hipblasComplex* const       CP[],
-                                                   int                         ldc,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmtBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    const hipblasComplex* const B[],
+                                                    int                         ldb,
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       C[],
+                                                    int                         ldc,
+                                                    int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasOperation_t                transB,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const AP[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   const hipblasDoubleComplex* const BP[],
-                                                   int                               ldb,
-                                                   hipblasDoubleComplex* const       CP[],
-                                                   int                               ldc,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmtBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    hipblasOperation_t                transA,
+                                                    hipblasOperation_t                transB,
+                                                    int                               n,
+                                                    int                               k,
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    const hipblasDoubleComplex* const B[],
+                                                    int                               ldb,
+                                                    const hipblasDoubleComplex*       beta,
+                                                    hipblasDoubleComplex* const       C[],
+                                                    int                               ldc,
+                                                    int                               batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
-    geamStridedBatched performs one of the batched matrix-matrix operations
-
-        C_i = alpha*op( A_i ) + beta*op( B_i )  for i = 0, 1, ... batchCount - 1
+    gemmtStridedBatched performs a batch of the matrix-matrix operations
 
-    where alpha and beta are scalars, and op(A_i), op(B_i) and C_i are m by n matrices
-    and op( X ) is one of
+        C_i := alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount
 
-        op( X ) = X      or
-        op( X ) = X**T
+    on the upper or lower triangle of each C_i only, see hipblasXgemmt. Backends without a
+    strided batched syrkx compute the matrices one at a time.
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
-
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  only the upper triangle of C_i is computed
+              HIPBLAS_FILL_MODE_LOWER:  only the lower triangle of C_i is computed
     @param[in]
     transA    [hipblasOperation_t]
-              specifies the form of op( A )
-
+              specifies the form of op( A_i ).
     @param[in]
     transB    [hipblasOperation_t]
-              specifies the form of op( B )
-
-    @param[in]
-    m         [int]
-              matrix dimension m.
-
+              specifies the form of op( B_i ).
     @param[in]
     n         [int]
-              matrix dimension n.
-
+              number of rows and columns of C_i, and of rows of op( A_i ) and columns of
+              op( B_i ). n >= 0.
+    @param[in]
+    k         [int]
+              number of columns of op( A_i ) and rows of op( B_i ). k >= 0.
     @param[in]
     alpha     device pointer or host pointer specifying the scalar alpha.
-
     @param[in]
-    AP         device pointer to the first matrix A_0 on the GPU.
-              Each A_i is of dimension ( lda, k ), where k is m
-              when  transA == HIPBLAS_OP_N and
-              is  n  when  transA == HIPBLAS_OP_T.
-
+    A         device pointer to the first matrix A_1.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A.
-
-    @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
-
+              specifies the leading dimension of A_i.
+              if transA == HIPBLAS_OP_N, lda >= max( 1, n ), otherwise lda >= max( 1, k ).
     @param[in]
-    beta      device pointer or host pointer specifying the scalar beta.
-
+    strideA   [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
     @param[in]
-    BP         pointer to the first matrix B_0 on the GPU.
-              Each B_i is of dimension ( ldb, k ), where k is m
-              when  transB == HIPBLAS_OP_N and
-              is  n  when  transB == HIPBLAS_OP_T.
-
+    B         device pointer to the first matrix B_1.
     @param[in]
     ldb       [int]
-              specifies the leading dimension of B.
-
+              specifies the leading dimension of B_i.
+              if transB == HIPBLAS_OP_N, ldb >= max( 1, k ), otherwise ldb >= max( 1, n ).
     @param[in]
-    strideB  [hipblasStride]
-              stride from the start of one matrix (B_i) and the next one (B_i+1)
-
-    @param[in, out]
-    CP         pointer to the first matrix C_0 on the GPU.
-              Each C_i is of dimension ( ldc, n ).
-
+    strideB   [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[inout]
+    C         device pointer to the first matrix C_1.
+              Only the uplo triangle is referenced and updated.
     @param[in]
     ldc       [int]
-              specifies the leading dimension of C.
-
+              specifies the leading dimension of C_i. ldc >= max( 1, n ).
     @param[in]
-    strideC  [hipblasStride]
-              stride from the start of one matrix (C_i) and the next one (C_i+1)
-
+    strideC   [hipblasStride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
     @param[in]
-    batchCount [int]
-                number of instances i in the batch.
+    batchCount
+              [int]
+              number of instances in the batch.
 
     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmtStridedBatched(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                n,
+                                                           int                k,
+                                                           const float*       alpha,
+                                                           const float*       A,
+                                                           int                lda,
+                                                           hipblasStride      strideA,
+                                                           const float*       B,
+                                                           int                ldb,
+                                                           hipblasStride      strideB,
+                                                           const float*       beta,
+                                                           float*             C,
+                                                           int                ldc,
+                                                           hipblasStride      strideC,
+                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transA,
-                                                          hipblasOperation_t transB,
-                                                          int                m,
-                                                          int                n,
-                                                          const float*       alpha,
-                                                          const float*       AP,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const float*       beta,
-                                                          const float*       BP,
-                                                          int                ldb,
-                                                          hipblasStride      strideB,
-                                                          float*             CP,
-                                                          int                ldc,
-                                                          hipblasStride      strideC,
-                                                          int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmtStridedBatched(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                n,
+                                                           int                k,
+                                                           const double*      alpha,
+                                                           const double*      A,
+                                                           int                lda,
+                                                           hipblasStride      strideA,
+                                                           const double*      B,
+                                                           int                ldb,
+                                                           hipblasStride      strideB,
+                                                           const double*      beta,
+                                                           double*            C,
+                                                           int                ldc,
+                                                           hipblasStride      strideC,
+                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transA,
-                                                          hipblasOperation_t transB,
-                                                          int                m,
-                                                          int                n,
-                                                          const double*      alpha,
-                                                          const double*      AP,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const double*      beta,
-                                                          const double*      BP,
-                                                          int                ldb,
-                                                          hipblasStride      strideB,
-                                                          double*            CP,
-                                                          int                ldc,
-                                                          hipblasStride      strideC,
-                                                          int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasOperation_t    transB,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* AP,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* beta,
-                                                          const hipblasComplex* BP,
-                                                          int                   ldb,
-                                                          hipblasStride         strideB,
-                                                          hipblasComplex*       CP,
-                                                          int                   ldc,
-                                                          hipblasStride         strideC,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmtStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasOperation_t    transA,
+                                                           hipblasOperation_t    transB,
+                                                           int                   n,
+                                                           int                   k,
+                                                           const hipblasComplex* alpha,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           const hipblasComplex* B,
+                                                           int                   ldb,
+                                                           hipblasStride         strideB,
+                                                           const hipblasComplex* beta,
+                                                           hipblasComplex*       C,
+                                                           int                   ldc,
+                                                           hipblasStride         strideC,
+                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasOperation_t          transB,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* AP,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* beta,
-                                                          const hipblasDoubleComplex* BP,
-                                                          int                         ldb,
-                                                          hipblasStride               strideB,
-                                                          hipblasDoubleComplex*       CP,
-                                                          int                         ldc,
-                                                          hipblasStride               strideC,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmtStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasOperation_t          transB,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           const hipblasDoubleComplex* B,
+                                                           int                         ldb,
+                                                           hipblasStride               strideB,
+                                                           const hipblasDoubleComplex* beta,
+                                                           hipblasDoubleComplex*       C,
+                                                           int                         ldc,
+                                                           hipblasStride               strideC,
+                                                           int                         batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
+    geam performs one of the matrix-matrix operations
 
-    hemm performs one of the matrix-matrix operations:
+        C = alpha*op( A ) + beta*op( B ),
 
-    C := alpha*A*B + beta*C if side == HIPBLAS_SIDE_LEFT,
-    C := alpha*B*A + beta*C if side == HIPBLAS_SIDE_RIGHT,
+    where op( X ) is one of
 
-    where alpha and beta are scalars, B and C are m by n matrices, and
-    A is a Hermitian matrix stored as either upper or lower.
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
 
-    - Supported precisions in rocBLAS : c,z
-    - Supported precisions in cuBLAS  : c,z
+    alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by n matrix, op( B ) an m by n matrix, and C an m by n matrix.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    side  [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:      C := alpha*A*B + beta*C
-            HIPBLAS_SIDE_RIGHT:     C := alpha*B*A + beta*C
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix
-
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
     @param[in]
-    n       [int]
-            n specifies the number of rows of B and C. n >= 0.
-
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
     @param[in]
-    k       [int]
-            n specifies the number of columns of B and C. k >= 0.
-
+    m         [int]
+              matrix dimension m.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            zero then A and B are not referenced.
-
+    n         [int]
+              matrix dimension n.
     @param[in]
-    AP       pointer storing matrix A on the GPU.
-            A is m by m if side == HIPBLAS_SIDE_LEFT
-            A is n by n if side == HIPBLAS_SIDE_RIGHT
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
-
+    alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    lda     [int]
-            lda specifies the first dimension of A.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
+    AP         device pointer storing matrix A.
     @param[in]
-    BP       pointer storing matrix B on the GPU.
-            Matrix dimension is m by n
-
+    lda       [int]
+              specifies the leading dimension of A.
     @param[in]
-    ldb     [int]
-            ldb specifies the first dimension of B. ldb >= max( 1, m )
-
+    beta      device pointer or host pointer specifying the scalar beta.
     @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
-
+    BP         device pointer storing matrix B.
     @param[in]
-    CP       pointer storing matrix C on the GPU.
-            Matrix dimension is m by n
-
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in, out]
+    CP         device pointer storing matrix C.
     @param[in]
-    ldc    [int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m )
+    ldc       [int]
+              specifies the leading dimension of C.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
-                                            hipblasSideMode_t     side,
-                                            hipblasFillMode_t     uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float*       AP,
+                                            int                lda,
+                                            const float*       beta,
+                                            const float*       BP,
+                                            int                ldb,
+                                            float*             CP,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            const double*      AP,
+                                            int                lda,
+                                            const double*      beta,
+                                            const double*      BP,
+                                            int                ldb,
+                                            double*            CP,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transA,
+                                            hipblasOperation_t    transB,
+                                            int                   m,
                                             int                   n,
-                                            int                   k,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* AP,
                                             int                   lda,
+                                            const hipblasComplex* beta,
                                             const hipblasComplex* BP,
                                             int                   ldb,
-                                            const hipblasComplex* beta,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
-                                            hipblasSideMode_t           side,
-                                            hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transA,
+                                            hipblasOperation_t          transB,
+                                            int                         m,
                                             int                         n,
-                                            int                         k,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* AP,
                                             int                         lda,
+                                            const hipblasDoubleComplex* beta,
                                             const hipblasDoubleComplex* BP,
                                             int                         ldb,
-                                            const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
 //! @}
@@ -14323,111 +15283,123 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
     \brief BLAS Level 3 API
 
     \details
+    geamBatched performs one of the batched matrix-matrix operations
 
-    hemmBatched performs a batch of the matrix-matrix operations:
+        C_i = alpha*op( A_i ) + beta*op( B_i )  for i = 0, 1, ... batchCount - 1
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
-    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
+    where alpha and beta are scalars, and op(A_i), op(B_i) and C_i are m by n matrices
+    and op( X ) is one of
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a Hermitian matrix stored as either upper or lower.
+        op( X ) = X      or
+        op( X ) = X**T
 
-    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : No support
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    side  [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:      C_i := alpha*A_i*B_i + beta*C_i
-            HIPBLAS_SIDE_RIGHT:     C_i := alpha*B_i*A_i + beta*C_i
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix
-
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
     @param[in]
-    n       [int]
-            n specifies the number of rows of B_i and C_i. n >= 0.
-
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
     @param[in]
-    k       [int]
-            k specifies the number of columns of B_i and C_i. k >= 0.
-
+    m         [int]
+              matrix dimension m.
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
-
+    n         [int]
+              matrix dimension n.
     @param[in]
-    AP       device array of device pointers storing each matrix A_i on the GPU.
-            A_i is m by m if side == HIPBLAS_SIDE_LEFT
-            A_i is n by n if side == HIPBLAS_SIDE_RIGHT
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
-
+    alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    lda     [int]
-            lda specifies the first dimension of A_i.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
-
+    AP         device array of device pointers storing each matrix A_i on the GPU.
+              Each A_i is of dimension ( lda, k ), where k is m
+              when  transA == HIPBLAS_OP_N and
+              is  n  when  transA == HIPBLAS_OP_T.
     @param[in]
-    BP       device array of device pointers storing each matrix B_i on the GPU.
-            Matrix dimension is m by n
-
+    lda       [int]
+              specifies the leading dimension of A.
     @param[in]
-    ldb     [int]
-            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
-
+    beta      device pointer or host pointer specifying the scalar beta.
     @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C_i need not be set before entry.
-
+    BP         device array of device pointers storing each matrix B_i on the GPU.
+              Each B_i is of dimension ( ldb, k ), where k is m
+              when  transB == HIPBLAS_OP_N and
+              is  n  when  transB == HIPBLAS_OP_T.
     @param[in]
-    CP       device array of device pointers storing each matrix C_i on the GPU.
-            Matrix dimension is m by n
-
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in, out]
+    CP         device array of device pointers storing each matrix C_i on the GPU.
+              Each C_i is of dimension ( ldc, n ).
     @param[in]
-    ldc    [int]
-           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
+    ldc       [int]
+              specifies the leading dimension of C.
 
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances i in the batch.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
-                                                   hipblasSideMode_t           side,
-                                                   hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const AP[],
+                                                   int                lda,
+                                                   const float*       beta,
+                                                   const float* const BP[],
+                                                   int                ldb,
+                                                   float* const       CP[],
+                                                   int                ldc,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasOperation_t  transB,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const AP[],
+                                                   int                 lda,
+                                                   const double*       beta,
+                                                   const double* const BP[],
+                                                   int                 ldb,
+                                                   double* const       CP[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasOperation_t          transB,
+                                                   int                         m,
                                                    int                         n,
-                                                   int                         k,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const AP[],
                                                    int                         lda,
+                                                   const hipblasComplex*       beta,
                                                    const hipblasComplex* const BP[],
                                                    int                         ldb,
-                                                   const hipblasComplex*       beta,
                                                    hipblasComplex* const       CP[],
                                                    int                         ldc,
                                                    int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
-                                                   hipblasSideMode_t                 side,
-                                                   hipblasFillMode_t                 uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasOperation_t                transB,
+                                                   int                               m,
                                                    int                               n,
-                                                   int                               k,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const AP[],
                                                    int                               lda,
+                                                   const hipblasDoubleComplex*       beta,
                                                    const hipblasDoubleComplex* const BP[],
                                                    int                               ldb,
-                                                   const hipblasDoubleComplex*       beta,
                                                    hipblasDoubleComplex* const       CP[],
                                                    int                               ldc,
                                                    int                               batchCount);
@@ -14437,289 +15409,271 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t
     \brief BLAS Level 3 API
 
     \details
+    geamStridedBatched performs one of the batched matrix-matrix operations
 
-    hemmStridedBatched performs a batch of the matrix-matrix operations:
+        C_i = alpha*op( A_i ) + beta*op( B_i )  for i = 0, 1, ... batchCount - 1
 
-    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
-    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
+    where alpha and beta are scalars, and op(A_i), op(B_i) and C_i are m by n matrices
+    and op( X ) is one of
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a Hermitian matrix stored as either upper or lower.
+        op( X ) = X      or
+        op( X ) = X**T
 
-    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : No support
 
+
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
 
     @param[in]
-    side  [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:      C_i := alpha*A_i*B_i + beta*C_i
-            HIPBLAS_SIDE_RIGHT:     C_i := alpha*B_i*A_i + beta*C_i
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
 
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
 
     @param[in]
-    n       [int]
-            n specifies the number of rows of B_i and C_i. n >= 0.
+    m         [int]
+              matrix dimension m.
 
     @param[in]
-    k       [int]
-            k specifies the number of columns of B_i and C_i. k >= 0.
+    n         [int]
+              matrix dimension n.
 
     @param[in]
-    alpha
-            alpha specifies the scalar alpha. When alpha is
-            zero then A_i and B_i are not referenced.
+    alpha     device pointer or host pointer specifying the scalar alpha.
 
     @param[in]
-    AP       device pointer to first matrix A_1
-            A_i is m by m if side == HIPBLAS_SIDE_LEFT
-            A_i is n by n if side == HIPBLAS_SIDE_RIGHT
-            Only the upper/lower triangular part is accessed.
-            The imaginary component of the diagonal elements is not used.
+    AP         device pointer to the first matrix A_0 on the GPU.
+              Each A_i is of dimension ( lda, k ), where k is m
+              when  transA == HIPBLAS_OP_N and
+              is  n  when  transA == HIPBLAS_OP_T.
 
     @param[in]
-    lda     [int]
-            lda specifies the first dimension of A_i.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            otherwise lda >= max( 1, n ).
+    lda       [int]
+              specifies the leading dimension of A.
 
     @param[in]
     strideA  [hipblasStride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
     @param[in]
-    BP       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU
+    beta      device pointer or host pointer specifying the scalar beta.
 
     @param[in]
-    ldb     [int]
-            ldb specifies the first dimension of B_i.
-            if side = HIPBLAS_OP_N,  ldb >= max( 1, m ),
-            otherwise ldb >= max( 1, n ).
+    BP         pointer to the first matrix B_0 on the GPU.
+              Each B_i is of dimension ( ldb, k ), where k is m
+              when  transB == HIPBLAS_OP_N and
+              is  n  when  transB == HIPBLAS_OP_T.
+
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
 
     @param[in]
     strideB  [hipblasStride]
               stride from the start of one matrix (B_i) and the next one (B_i+1)
 
-    @param[in]
-    beta
-            beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
+    @param[in, out]
+    CP         pointer to the first matrix C_0 on the GPU.
+              Each C_i is of dimension ( ldc, n ).
 
     @param[in]
-    CP        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+    ldc       [int]
+              specifies the leading dimension of C.
 
     @param[in]
-    ldc    [int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m )
-
-    @param[inout]
     strideC  [hipblasStride]
               stride from the start of one matrix (C_i) and the next one (C_i+1)
 
     @param[in]
     batchCount [int]
-                number of instances in the batch
+                number of instances i in the batch.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasSideMode_t     side,
-                                                          hipblasFillMode_t     uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transA,
+                                                          hipblasOperation_t transB,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          const float*       AP,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const float*       beta,
+                                                          const float*       BP,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          float*             CP,
+                                                          int                ldc,
+                                                          hipblasStride      strideC,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transA,
+                                                          hipblasOperation_t transB,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          const double*      AP,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const double*      beta,
+                                                          const double*      BP,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          double*            CP,
+                                                          int                ldc,
+                                                          hipblasStride      strideC,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasOperation_t    transB,
+                                                          int                   m,
                                                           int                   n,
-                                                          int                   k,
                                                           const hipblasComplex* alpha,
                                                           const hipblasComplex* AP,
                                                           int                   lda,
                                                           hipblasStride         strideA,
+                                                          const hipblasComplex* beta,
                                                           const hipblasComplex* BP,
                                                           int                   ldb,
                                                           hipblasStride         strideB,
-                                                          const hipblasComplex* beta,
                                                           hipblasComplex*       CP,
                                                           int                   ldc,
                                                           hipblasStride         strideC,
                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasSideMode_t           side,
-                                                          hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasOperation_t          transB,
+                                                          int                         m,
                                                           int                         n,
-                                                          int                         k,
                                                           const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* AP,
                                                           int                         lda,
                                                           hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* beta,
                                                           const hipblasDoubleComplex* BP,
                                                           int                         ldb,
                                                           hipblasStride               strideB,
-                                                          const hipblasDoubleComplex* beta,
                                                           hipblasDoubleComplex*       CP,
                                                           int                         ldc,
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
 //! @}
 
-// clang-format off
-HIPBLAS_DEPRECATED_MSG("The hipblasXtrmm API, along with batched versions, will \
-be changing in a future release to allow in-place and out-of-place behavior. This change \
-will introduce an output matrix 'C', matching the rocblas_xtrmm_outofplace API and the \
-cublasXtrmm API.")
-// clang-format on
 /*! @{
     \brief BLAS Level 3 API
 
     \details
 
-    trmm performs one of the matrix-matrix operations
-
-    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
-
-    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
-    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
+    hemm performs one of the matrix-matrix operations:
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    C := alpha*A*B + beta*C if side == HIPBLAS_SIDE_LEFT,
+    C := alpha*B*A + beta*C if side == HIPBLAS_SIDE_RIGHT,
 
+    where alpha and beta are scalars, B and C are m by n matrices, and
+    A is a Hermitian matrix stored as either upper or lower.
 
-    - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : s,d,c,z
+    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in cuBLAS  : c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
 
     @param[in]
-    side    [hipblasSideMode_t]
-            Specifies whether op(A) multiplies B from the left or right as follows:
-            HIPBLAS_SIDE_LEFT:       B := alpha*op( A )*B.
-            HIPBLAS_SIDE_RIGHT:      B := alpha*B*op( A ).
+    side  [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:      C := alpha*A*B + beta*C
+            HIPBLAS_SIDE_RIGHT:     C := alpha*B*A + beta*C
 
     @param[in]
     uplo    [hipblasFillMode_t]
-            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
-    @param[in]
-    transA  [hipblasOperation_t]
-            Specifies the form of op(A) to be used in the matrix multiplication as follows:
-            HIPBLAS_OP_N: op(A) = A.
-            HIPBLAS_OP_T: op(A) = A^T.
-            HIPBLAS_OP_C:  op(A) = A^H.
-
-    @param[in]
-    diag    [hipblasDiagType_t]
-            Specifies whether or not A is unit triangular as follows:
-            HIPBLAS_DIAG_UNIT:      A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix
 
     @param[in]
-    m       [int]
-            m specifies the number of rows of B. m >= 0.
+    n       [int]
+            n specifies the number of rows of B and C. n >= 0.
 
     @param[in]
-    n       [int]
-            n specifies the number of columns of B. n >= 0.
+    k       [int]
+            n specifies the number of columns of B and C. k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A is not referenced and B need not be set before
-            entry.
+            zero then A and B are not referenced.
 
     @param[in]
-    AP       Device pointer to matrix A on the GPU.
-            A has dimension ( lda, k ), where k is m
-            when  side == HIPBLAS_SIDE_LEFT  and
-            is  n  when  side == HIPBLAS_SIDE_RIGHT.
-
-        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
-        upper triangular part of the array  A must contain the upper
-        triangular matrix  and the strictly lower triangular part of
-        A is not referenced.
-
-        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
-        lower triangular part of the array  A must contain the lower
-        triangular matrix  and the strictly upper triangular part of
-        A is not referenced.
-
-        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
-        A  are not referenced either,  but are assumed to be  unity.
+    AP       pointer storing matrix A on the GPU.
+            A is m by m if side == HIPBLAS_SIDE_LEFT
+            A is n by n if side == HIPBLAS_SIDE_RIGHT
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
 
     @param[in]
     lda     [int]
             lda specifies the first dimension of A.
-            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
 
-    @param[inout]
-    BP       Device pointer to the first matrix B_0 on the GPU.
-            On entry,  the leading  m by n part of the array  B must
-           contain the matrix  B,  and  on exit  is overwritten  by the
-           transformed matrix.
+    @param[in]
+    BP       pointer storing matrix B on the GPU.
+            Matrix dimension is m by n
 
     @param[in]
-    ldb    [int]
-           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+    ldb     [int]
+            ldb specifies the first dimension of B. ldb >= max( 1, m )
 
-    ********************************************************************/
+    @param[in]
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
-                                            hipblasSideMode_t  side,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            int                n,
-                                            const float*       alpha,
-                                            const float*       AP,
-                                            int                lda,
-                                            float*             BP,
-                                            int                ldb);
+    @param[in]
+    CP       pointer storing matrix C on the GPU.
+            Matrix dimension is m by n
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
-                                            hipblasSideMode_t  side,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            int                n,
-                                            const double*      alpha,
-                                            const double*      AP,
-                                            int                lda,
-                                            double*            BP,
-                                            int                ldb);
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, m )
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
-                                            int                   m,
                                             int                   n,
+                                            int                   k,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* AP,
                                             int                   lda,
-                                            hipblasComplex*       BP,
-                                            int                   ldb);
+                                            const hipblasComplex* BP,
+                                            int                   ldb,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       CP,
+                                            int                   ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
-                                            hipblasDiagType_t           diag,
-                                            int                         m,
                                             int                         n,
+                                            int                         k,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* AP,
                                             int                         lda,
-                                            hipblasDoubleComplex*       BP,
-                                            int                         ldb);
+                                            const hipblasDoubleComplex* BP,
+                                            int                         ldb,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       CP,
+                                            int                         ldc);
 //! @}
 
 /*! @{
@@ -14727,16 +15681,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
 
     \details
 
-    trmmBatched performs one of the batched matrix-matrix operations
-
-    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batchCount -1
+    hemmBatched performs a batch of the matrix-matrix operations:
 
-    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
-    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
+    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
+    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
 
-        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a Hermitian matrix stored as either upper or lower.
 
-    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in rocBLAS : c,z
     - Supported precisions in cuBLAS  : No support
 
     @param[in]
@@ -14744,138 +15697,96 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
               handle to the hipblas library context queue.
 
     @param[in]
-    side    [hipblasSideMode_t]
-            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
-            HIPBLAS_SIDE_LEFT:       B_i := alpha*op( A_i )*B_i.
-            HIPBLAS_SIDE_RIGHT:      B_i := alpha*B_i*op( A_i ).
+    side  [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:      C_i := alpha*A_i*B_i + beta*C_i
+            HIPBLAS_SIDE_RIGHT:     C_i := alpha*B_i*A_i + beta*C_i
 
     @param[in]
     uplo    [hipblasFillMode_t]
-            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
-    @param[in]
-    transA  [hipblasOperation_t]
-            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
-            HIPBLAS_OP_N:    op(A_i) = A_i.
-            HIPBLAS_OP_T:      op(A_i) = A_i^T.
-            HIPBLAS_OP_C:  op(A_i) = A_i^H.
-
-    @param[in]
-    diag    [hipblasDiagType_t]
-            Specifies whether or not A_i is unit triangular as follows:
-            HIPBLAS_DIAG_UNIT:      A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix
 
     @param[in]
-    m       [int]
-            m specifies the number of rows of B_i. m >= 0.
+    n       [int]
+            n specifies the number of rows of B_i and C_i. n >= 0.
 
     @param[in]
-    n       [int]
-            n specifies the number of columns of B_i. n >= 0.
+    k       [int]
+            k specifies the number of columns of B_i and C_i. k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i is not referenced and B_i need not be set before
-            entry.
+            zero then A_i and B_i are not referenced.
 
     @param[in]
-    AP       Device array of device pointers storing each matrix A_i on the GPU.
-            Each A_i is of dimension ( lda, k ), where k is m
-            when  side == HIPBLAS_SIDE_LEFT  and
-            is  n  when  side == HIPBLAS_SIDE_RIGHT.
+    AP       device array of device pointers storing each matrix A_i on the GPU.
+            A_i is m by m if side == HIPBLAS_SIDE_LEFT
+            A_i is n by n if side == HIPBLAS_SIDE_RIGHT
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
 
-        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
-        upper triangular part of the array  A must contain the upper
-        triangular matrix  and the strictly lower triangular part of
-        A is not referenced.
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
 
-        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
-        lower triangular part of the array  A must contain the lower
-        triangular matrix  and the strictly upper triangular part of
-        A is not referenced.
+    @param[in]
+    BP       device array of device pointers storing each matrix B_i on the GPU.
+            Matrix dimension is m by n
 
-        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
-        A_i  are not referenced either,  but are assumed to be  unity.
+    @param[in]
+    ldb     [int]
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
 
     @param[in]
-    lda     [int]
-            lda specifies the first dimension of A.
-            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C_i need not be set before entry.
 
-    @param[inout]
-    BP       device array of device pointers storing each matrix B_i on the GPU.
-            On entry,  the leading  m by n part of the array  B_i must
-           contain the matrix  B_i,  and  on exit  is overwritten  by the
-           transformed matrix.
+    @param[in]
+    CP       device array of device pointers storing each matrix C_i on the GPU.
+            Matrix dimension is m by n
 
     @param[in]
-    ldb    [int]
-           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+    ldc    [int]
+           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
 
     @param[in]
     batchCount [int]
-                number of instances i in the batch.
-    ********************************************************************/
+                number of instances in the batch.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
-                                                   hipblasSideMode_t  side,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const AP[],
-                                                   int                lda,
-                                                   float* const       BP[],
-                                                   int                ldb,
-                                                   int                batchCount);
+    ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
-                                                   hipblasSideMode_t   side,
-                                                   hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasDiagType_t   diag,
-                                                   int                 m,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const AP[],
-                                                   int                 lda,
-                                                   double* const       BP[],
-                                                   int                 ldb,
-                                                   int                 batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
-                                                   int                         m,
                                                    int                         n,
+                                                   int                         k,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const AP[],
                                                    int                         lda,
-                                                   hipblasComplex* const       BP[],
+                                                   const hipblasComplex* const BP[],
                                                    int                         ldb,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       CP[],
+                                                   int                         ldc,
                                                    int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                                    hipblasSideMode_t                 side,
                                                    hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasDiagType_t                 diag,
-                                                   int                               m,
                                                    int                               n,
+                                                   int                               k,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const AP[],
                                                    int                               lda,
-                                                   hipblasDoubleComplex* const       BP[],
+                                                   const hipblasDoubleComplex* const BP[],
                                                    int                               ldb,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       CP[],
+                                                   int                               ldc,
                                                    int                               batchCount);
 //! @}
 
@@ -14884,16 +15795,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t
 
     \details
 
-    trmmStridedBatched performs one of the strided_batched matrix-matrix operations
-
-    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batchCount -1
+    hemmStridedBatched performs a batch of the matrix-matrix operations:
 
-    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
-    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
+    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
+    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
 
-        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a Hermitian matrix stored as either upper or lower.
 
-    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in rocBLAS : c,z
     - Supported precisions in cuBLAS  : No support
 
     @param[in]
@@ -14901,182 +15811,137 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t
               handle to the hipblas library context queue.
 
     @param[in]
-    side    [hipblasSideMode_t]
-            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
-            HIPBLAS_SIDE_LEFT:       B_i := alpha*op( A_i )*B_i.
-            HIPBLAS_SIDE_RIGHT:      B_i := alpha*B_i*op( A_i ).
+    side  [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:      C_i := alpha*A_i*B_i + beta*C_i
+            HIPBLAS_SIDE_RIGHT:     C_i := alpha*B_i*A_i + beta*C_i
 
     @param[in]
     uplo    [hipblasFillMode_t]
-            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
-    @param[in]
-    transA  [hipblasOperation_t]
-            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
-            HIPBLAS_OP_N:    op(A_i) = A_i.
-            HIPBLAS_OP_T:      op(A_i) = A_i^T.
-            HIPBLAS_OP_C:  op(A_i) = A_i^H.
-
-    @param[in]
-    diag    [hipblasDiagType_t]
-            Specifies whether or not A_i is unit triangular as follows:
-            HIPBLAS_DIAG_UNIT:      A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix
 
     @param[in]
-    m       [int]
-            m specifies the number of rows of B_i. m >= 0.
+    n       [int]
+            n specifies the number of rows of B_i and C_i. n >= 0.
 
     @param[in]
-    n       [int]
-            n specifies the number of columns of B_i. n >= 0.
+    k       [int]
+            k specifies the number of columns of B_i and C_i. k >= 0.
 
     @param[in]
     alpha
             alpha specifies the scalar alpha. When alpha is
-            zero then A_i is not referenced and B_i need not be set before
-            entry.
+            zero then A_i and B_i are not referenced.
 
     @param[in]
-    AP       Device pointer to the first matrix A_0 on the GPU.
-            Each A_i is of dimension ( lda, k ), where k is m
-            when  side == HIPBLAS_SIDE_LEFT  and
-            is  n  when  side == HIPBLAS_SIDE_RIGHT.
-
-        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
-        upper triangular part of the array  A must contain the upper
-        triangular matrix  and the strictly lower triangular part of
-        A is not referenced.
-
-        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
-        lower triangular part of the array  A must contain the lower
-        triangular matrix  and the strictly upper triangular part of
-        A is not referenced.
-
-        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
-        A_i  are not referenced either,  but are assumed to be  unity.
+    AP       device pointer to first matrix A_1
+            A_i is m by m if side == HIPBLAS_SIDE_LEFT
+            A_i is n by n if side == HIPBLAS_SIDE_RIGHT
+            Only the upper/lower triangular part is accessed.
+            The imaginary component of the diagonal elements is not used.
 
     @param[in]
     lda     [int]
-            lda specifies the first dimension of A.
-            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+            lda specifies the first dimension of A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
 
     @param[in]
     strideA  [hipblasStride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
 
-    @param[inout]
-    BP       Device pointer to the first matrix B_0 on the GPU.
-            On entry,  the leading  m by n part of the array  B_i must
-           contain the matrix  B_i,  and  on exit  is overwritten  by the
-           transformed matrix.
+    @param[in]
+    BP       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU
 
     @param[in]
-    ldb    [int]
-           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+    ldb     [int]
+            ldb specifies the first dimension of B_i.
+            if side = HIPBLAS_OP_N,  ldb >= max( 1, m ),
+            otherwise ldb >= max( 1, n ).
 
-           @param[in]
+    @param[in]
     strideB  [hipblasStride]
               stride from the start of one matrix (B_i) and the next one (B_i+1)
+
     @param[in]
-    batchCount [int]
-                number of instances i in the batch.
-    ********************************************************************/
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasSideMode_t  side,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          int                n,
-                                                          const float*       alpha,
-                                                          const float*       AP,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          float*             BP,
-                                                          int                ldb,
-                                                          hipblasStride      strideB,
-                                                          int                batchCount);
+    @param[in]
+    CP        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasSideMode_t  side,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          int                n,
-                                                          const double*      alpha,
-                                                          const double*      AP,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          double*            BP,
-                                                          int                ldb,
-                                                          hipblasStride      strideB,
-                                                          int                batchCount);
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, m )
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
+    @param[inout]
+    strideC  [hipblasStride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
-                                                          int                   m,
                                                           int                   n,
+                                                          int                   k,
                                                           const hipblasComplex* alpha,
                                                           const hipblasComplex* AP,
                                                           int                   lda,
                                                           hipblasStride         strideA,
-                                                          hipblasComplex*       BP,
+                                                          const hipblasComplex* BP,
                                                           int                   ldb,
                                                           hipblasStride         strideB,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       CP,
+                                                          int                   ldc,
+                                                          hipblasStride         strideC,
                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         m,
                                                           int                         n,
+                                                          int                         k,
                                                           const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* AP,
                                                           int                         lda,
                                                           hipblasStride               strideA,
-                                                          hipblasDoubleComplex*       BP,
+                                                          const hipblasDoubleComplex* BP,
                                                           int                         ldb,
                                                           hipblasStride               strideB,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       CP,
+                                                          int                         ldc,
+                                                          hipblasStride               strideC,
                                                           int                         batchCount);
 //! @}
 
+// clang-format off
+HIPBLAS_DEPRECATED_MSG("The hipblasXtrmm API, along with batched versions, will \
+be changing in a future release to allow in-place and out-of-place behavior. This change \
+will introduce an output matrix 'C', matching the rocblas_xtrmm_outofplace API and the \
+cublasXtrmm API.")
+// clang-format on
 /*! @{
     \brief BLAS Level 3 API
 
     \details
 
-    trsm solves
+    trmm performs one of the matrix-matrix operations
 
-        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+    B := alpha*op( A )*B,   or   B := alpha*B*op( A )
 
-    where alpha is a scalar, X and B are m by n matrices,
-    A is triangular matrix and op(A) is one of
+    where  alpha  is a scalar,  B  is an m by n matrix,  A  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A )  is one  of
 
         op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
 
-    The matrix X is overwritten on B.
-
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
-
-    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : s,d,c,z
@@ -15087,23 +15952,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
 
     @param[in]
     side    [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
-            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+            Specifies whether op(A) multiplies B from the left or right as follows:
+            HIPBLAS_SIDE_LEFT:       B := alpha*op( A )*B.
+            HIPBLAS_SIDE_RIGHT:      B := alpha*B*op( A ).
 
     @param[in]
     uplo    [hipblasFillMode_t]
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
             HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
             HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
 
     @param[in]
     transA  [hipblasOperation_t]
+            Specifies the form of op(A) to be used in the matrix multiplication as follows:
             HIPBLAS_OP_N: op(A) = A.
             HIPBLAS_OP_T: op(A) = A^T.
-            HIPBLAS_OP_C: op(A) = A^H.
+            HIPBLAS_OP_C:  op(A) = A^H.
 
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            Specifies whether or not A is unit triangular as follows:
+            HIPBLAS_DIAG_UNIT:      A is assumed to be unit triangular.
             HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
 
     @param[in]
@@ -15116,25 +15985,40 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
 
     @param[in]
     alpha
-            device pointer or host pointer specifying the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
+            alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced and B need not be set before
             entry.
 
     @param[in]
-    AP       device pointer storing matrix A.
-            of dimension ( lda, k ), where k is m
-            when  HIPBLAS_SIDE_LEFT  and
-            is  n  when  HIPBLAS_SIDE_RIGHT
-            only the upper/lower triangular part is accessed.
+    AP       Device pointer to matrix A on the GPU.
+            A has dimension ( lda, k ), where k is m
+            when  side == HIPBLAS_SIDE_LEFT  and
+            is  n  when  side == HIPBLAS_SIDE_RIGHT.
+
+        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
+
+        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
+
+        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
+        A  are not referenced either,  but are assumed to be  unity.
 
     @param[in]
     lda     [int]
             lda specifies the first dimension of A.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
 
-    @param[in,out]
-    BP       device pointer storing matrix B.
+    @param[inout]
+    BP       Device pointer to the first matrix B_0 on the GPU.
+            On entry,  the leading  m by n part of the array  B must
+           contain the matrix  B,  and  on exit  is overwritten  by the
+           transformed matrix.
 
     @param[in]
     ldb    [int]
@@ -15142,7 +16026,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -15150,12 +16034,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                                             int                m,
                                             int                n,
                                             const float*       alpha,
-                                            float*             AP,
+                                            const float*       AP,
                                             int                lda,
                                             float*             BP,
                                             int                ldb);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
@@ -15163,12 +16047,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                                             int                m,
                                             int                n,
                                             const double*      alpha,
-                                            double*            AP,
+                                            const double*      AP,
                                             int                lda,
                                             double*            BP,
                                             int                ldb);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
@@ -15176,12 +16060,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                                             int                   m,
                                             int                   n,
                                             const hipblasComplex* alpha,
-                                            hipblasComplex*       AP,
+                                            const hipblasComplex* AP,
                                             int                   lda,
                                             hipblasComplex*       BP,
                                             int                   ldb);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                                             hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
@@ -15189,7 +16073,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                                             int                         m,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
-                                            hipblasDoubleComplex*       AP,
+                                            const hipblasDoubleComplex* AP,
                                             int                         lda,
                                             hipblasDoubleComplex*       BP,
                                             int                         ldb);
@@ -15197,83 +16081,105 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
 
 /*! @{
     \brief BLAS Level 3 API
-    \details
-    trsmBatched performs the following batched operation:
 
-        op(A_i)*X_i = alpha*B_i or  X_i*op(A_i) = alpha*B_i, for i = 1, ..., batchCount.
+    \details
 
-    where alpha is a scalar, X and B are batched m by n matrices,
-    A is triangular batched matrix and op(A) is one of
+    trmmBatched performs one of the batched matrix-matrix operations
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batchCount -1
 
-    Each matrix X_i is overwritten on B_i for i = 1, ..., batchCount.
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
-    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
     side    [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
-            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
+            HIPBLAS_SIDE_LEFT:       B_i := alpha*op( A_i )*B_i.
+            HIPBLAS_SIDE_RIGHT:      B_i := alpha*B_i*op( A_i ).
+
     @param[in]
     uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
     @param[in]
     transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: op(A) = A.
-            HIPBLAS_OP_T: op(A) = A^T.
-            HIPBLAS_OP_C: op(A) = A^H.
+            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
+            HIPBLAS_OP_N:    op(A_i) = A_i.
+            HIPBLAS_OP_T:      op(A_i) = A_i^T.
+            HIPBLAS_OP_C:  op(A_i) = A_i^H.
+
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
+            Specifies whether or not A_i is unit triangular as follows:
+            HIPBLAS_DIAG_UNIT:      A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
     @param[in]
     m       [int]
-            m specifies the number of rows of each B_i. m >= 0.
+            m specifies the number of rows of B_i. m >= 0.
+
     @param[in]
     n       [int]
-            n specifies the number of columns of each B_i. n >= 0.
+            n specifies the number of columns of B_i. n >= 0.
+
     @param[in]
     alpha
-            device pointer or host pointer specifying the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i is not referenced and B_i need not be set before
             entry.
+
     @param[in]
-    AP       device array of device pointers storing each matrix A_i on the GPU.
-            Matricies are of dimension ( lda, k ), where k is m
-            when  HIPBLAS_SIDE_LEFT  and is  n  when  HIPBLAS_SIDE_RIGHT
-            only the upper/lower triangular part is accessed.
+    AP       Device array of device pointers storing each matrix A_i on the GPU.
+            Each A_i is of dimension ( lda, k ), where k is m
+            when  side == HIPBLAS_SIDE_LEFT  and
+            is  n  when  side == HIPBLAS_SIDE_RIGHT.
+
+        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
+
+        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
+
+        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
+        A_i  are not referenced either,  but are assumed to be  unity.
+
     @param[in]
     lda     [int]
-            lda specifies the first dimension of each A_i.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
-    @param[in,out]
+            lda specifies the first dimension of A.
+            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+
+    @param[inout]
     BP       device array of device pointers storing each matrix B_i on the GPU.
+            On entry,  the leading  m by n part of the array  B_i must
+           contain the matrix  B_i,  and  on exit  is overwritten  by the
+           transformed matrix.
+
     @param[in]
     ldb    [int]
-           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+
     @param[in]
     batchCount [int]
-                number of trsm operatons in the batch.
+                number of instances i in the batch.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                                    hipblasSideMode_t  side,
                                                    hipblasFillMode_t  uplo,
                                                    hipblasOperation_t transA,
@@ -15281,78 +16187,68 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                                    int                m,
                                                    int                n,
                                                    const float*       alpha,
-                                                   float* const       AP[],
-                                                   int                lda,
-                                                   float*             BP[],
-                                                   int                ldb,
-                                                   int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
-                                                   hipblasSideMode_t  side,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   int                n,
-                                                   const double*      alpha,
-                                                   double* const      AP[],
+                                                   const float* const AP[],
                                                    int                lda,
-                                                   double*            BP[],
+                                                   float* const       BP[],
                                                    int                ldb,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
-                                                   hipblasSideMode_t     side,
-                                                   hipblasFillMode_t     uplo,
-                                                   hipblasOperation_t    transA,
-                                                   hipblasDiagType_t     diag,
-                                                   int                   m,
-                                                   int                   n,
-                                                   const hipblasComplex* alpha,
-                                                   hipblasComplex* const AP[],
-                                                   int                   lda,
-                                                   hipblasComplex*       BP[],
-                                                   int                   ldb,
-                                                   int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const AP[],
+                                                   int                 lda,
+                                                   double* const       BP[],
+                                                   int                 ldb,
+                                                   int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                                    hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
                                                    hipblasDiagType_t           diag,
                                                    int                         m,
                                                    int                         n,
-                                                   const hipblasDoubleComplex* alpha,
-                                                   hipblasDoubleComplex* const AP[],
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const AP[],
                                                    int                         lda,
-                                                   hipblasDoubleComplex*       BP[],
+                                                   hipblasComplex* const       BP[],
                                                    int                         ldb,
                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
+                                                   hipblasSideMode_t                 side,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   int                               lda,
+                                                   hipblasDoubleComplex* const       BP[],
+                                                   int                               ldb,
+                                                   int                               batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
-    \details
-    trsmSridedBatched performs the following strided batched operation:
 
-        op(A_i)*X_i = alpha*B_i or  X_i*op(A_i) = alpha*B_i, for i = 1, ..., batchCount.
+    \details
 
-    where alpha is a scalar, X and B are strided batched m by n matrices,
-    A is triangular strided batched matrix and op(A) is one of
+    trmmStridedBatched performs one of the strided_batched matrix-matrix operations
 
-        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+    B_i := alpha*op( A_i )*B_i,   or   B_i := alpha*B_i*op( A_i )  for i = 0, 1, ... batchCount -1
 
-    Each matrix X_i is overwritten on B_i for i = 1, ..., batchCount.
+    where  alpha  is a scalar,  B_i  is an m by n matrix,  A_i  is a unit, or
+    non-unit,  upper or lower triangular matrix  and  op( A_i )  is one  of
 
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
-    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
+        op( A_i ) = A_i   or   op( A_i ) = A_i^T   or   op( A_i ) = A_i^H.
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : No support
@@ -15360,62 +16256,94 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             h
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
     side    [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
-            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
+            HIPBLAS_SIDE_LEFT:       B_i := alpha*op( A_i )*B_i.
+            HIPBLAS_SIDE_RIGHT:      B_i := alpha*B_i*op( A_i ).
+
     @param[in]
     uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
     @param[in]
     transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: op(A) = A.
-            HIPBLAS_OP_T: op(A) = A^T.
-            HIPBLAS_OP_C: op(A) = A^H.
+            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
+            HIPBLAS_OP_N:    op(A_i) = A_i.
+            HIPBLAS_OP_T:      op(A_i) = A_i^T.
+            HIPBLAS_OP_C:  op(A_i) = A_i^H.
+
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
+            Specifies whether or not A_i is unit triangular as follows:
+            HIPBLAS_DIAG_UNIT:      A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
     @param[in]
     m       [int]
-            m specifies the number of rows of each B_i. m >= 0.
+            m specifies the number of rows of B_i. m >= 0.
+
     @param[in]
     n       [int]
-            n specifies the number of columns of each B_i. n >= 0.
+            n specifies the number of columns of B_i. n >= 0.
+
     @param[in]
     alpha
-            device pointer or host pointer specifying the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i is not referenced and B_i need not be set before
             entry.
+
     @param[in]
-    AP       device pointer pointing to the first matrix A_1.
-            of dimension ( lda, k ), where k is m
-            when  HIPBLAS_SIDE_LEFT  and
-            is  n  when  HIPBLAS_SIDE_RIGHT
-            only the upper/lower triangular part is accessed.
+    AP       Device pointer to the first matrix A_0 on the GPU.
+            Each A_i is of dimension ( lda, k ), where k is m
+            when  side == HIPBLAS_SIDE_LEFT  and
+            is  n  when  side == HIPBLAS_SIDE_RIGHT.
+
+        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
+
+        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
+
+        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
+        A_i  are not referenced either,  but are assumed to be  unity.
+
     @param[in]
     lda     [int]
-            lda specifies the first dimension of each A_i.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+            lda specifies the first dimension of A.
+            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+
     @param[in]
-    strideA [hipblasStride]
-             stride from the start of one A_i matrix to the next A_(i + 1).
-    @param[in,out]
-    BP       device pointer pointing to the first matrix B_1.
+    strideA  [hipblasStride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+
+    @param[inout]
+    BP       Device pointer to the first matrix B_0 on the GPU.
+            On entry,  the leading  m by n part of the array  B_i must
+           contain the matrix  B_i,  and  on exit  is overwritten  by the
+           transformed matrix.
+
     @param[in]
     ldb    [int]
-           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
-    @param[in]
-    strideB [hipblasStride]
-             stride from the start of one B_i matrix to the next B_(i + 1).
+           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+
+           @param[in]
+    strideB  [hipblasStride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
     @param[in]
     batchCount [int]
-                number of trsm operatons in the batch.
+                number of instances i in the batch.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasSideMode_t  side,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -15423,7 +16351,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    han
                                                           int                m,
                                                           int                n,
                                                           const float*       alpha,
-                                                          float*             AP,
+                                                          const float*       AP,
                                                           int                lda,
                                                           hipblasStride      strideA,
                                                           float*             BP,
@@ -15431,7 +16359,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasSideMode_t  side,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
@@ -15439,7 +16367,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    han
                                                           int                m,
                                                           int                n,
                                                           const double*      alpha,
-                                                          double*            AP,
+                                                          const double*      AP,
                                                           int                lda,
                                                           hipblasStride      strideA,
                                                           double*            BP,
@@ -15447,7 +16375,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      strideB,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasSideMode_t     side,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
@@ -15455,7 +16383,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t
                                                           int                   m,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
-                                                          hipblasComplex*       AP,
+                                                          const hipblasComplex* AP,
                                                           int                   lda,
                                                           hipblasStride         strideA,
                                                           hipblasComplex*       BP,
@@ -15463,7 +16391,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t
                                                           hipblasStride         strideB,
                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasSideMode_t           side,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
@@ -15471,7 +16399,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t
                                                           int                         m,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
-                                                          hipblasDoubleComplex*       AP,
+                                                          const hipblasDoubleComplex* AP,
                                                           int                         lda,
                                                           hipblasStride               strideA,
                                                           hipblasDoubleComplex*       BP,
@@ -15484,171 +16412,304 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t
     \brief BLAS Level 3 API
 
     \details
-    trtri  compute the inverse of a matrix A, namely, invA
 
-        and write the result into invA;
+    trsm solves
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    where alpha is a scalar, X and B are m by n matrices,
+    A is triangular matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    The matrix X is overwritten on B.
+
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+
+    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+
     @param[in]
-    diag      [hipblasDiagType_t]
-              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
-              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
     @param[in]
-    n         [int]
-              size of matrix A and invA
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
+
     @param[in]
-    AP         device pointer storing matrix A.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
-    @param[out]
-    invA      device pointer storing matrix invA.
+    m       [int]
+            m specifies the number of rows of B. m >= 0.
+
     @param[in]
-    ldinvA    [int]
-              specifies the leading dimension of invA.
+    n       [int]
+            n specifies the number of columns of B. n >= 0.
 
-********************************************************************/
+    @param[in]
+    alpha
+            device pointer or host pointer specifying the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
-                                             hipblasFillMode_t uplo,
-                                             hipblasDiagType_t diag,
-                                             int               n,
-                                             const float*      AP,
-                                             int               lda,
-                                             float*            invA,
-                                             int               ldinvA);
+    @param[in]
+    AP       device pointer storing matrix A.
+            of dimension ( lda, k ), where k is m
+            when  HIPBLAS_SIDE_LEFT  and
+            is  n  when  HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
-                                             hipblasFillMode_t uplo,
-                                             hipblasDiagType_t diag,
-                                             int               n,
-                                             const double*     AP,
-                                             int               lda,
-                                             double*           invA,
-                                             int               ldinvA);
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
-                                             hipblasFillMode_t     uplo,
-                                             hipblasDiagType_t     diag,
-                                             int                   n,
-                                             const hipblasComplex* AP,
-                                             int                   lda,
-                                             hipblasComplex*       invA,
-                                             int                   ldinvA);
+    @param[in,out]
+    BP       device pointer storing matrix B.
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
-                                             hipblasFillMode_t           uplo,
-                                             hipblasDiagType_t           diag,
-                                             int                         n,
-                                             const hipblasDoubleComplex* AP,
-                                             int                         lda,
-                                             hipblasDoubleComplex*       invA,
-                                             int                         ldinvA);
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            float*             AP,
+                                            int                lda,
+                                            float*             BP,
+                                            int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            double*            AP,
+                                            int                lda,
+                                            double*            BP,
+                                            int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            hipblasComplex*       AP,
+                                            int                   lda,
+                                            hipblasComplex*       BP,
+                                            int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            hipblasDoubleComplex*       AP,
+                                            int                         lda,
+                                            hipblasDoubleComplex*       BP,
+                                            int                         ldb);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
-
     \details
-    trtriBatched  compute the inverse of A_i and write into invA_i where
-                   A_i and invA_i are the i-th matrices in the batch,
-                   for i = 1, ..., batchCount.
+    trsmBatched performs the following batched operation:
 
-    - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
+        op(A_i)*X_i = alpha*B_i or  X_i*op(A_i) = alpha*B_i, for i = 1, ..., batchCount.
+
+    where alpha is a scalar, X and B are batched m by n matrices,
+    A is triangular batched matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    Each matrix X_i is overwritten on B_i for i = 1, ..., batchCount.
+
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-    @param[in]
-    diag      [hipblasDiagType_t]
-              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
-              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    n         [int]
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
     @param[in]
-    AP         device array of device pointers storing each matrix A_i.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
-    @param[out]
-    invA      device array of device pointers storing the inverse of each matrix A_i.
-              Partial inplace operation is supported, see below.
-              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
-              the inverse of the upper triangular matrix, and the strictly lower
-              triangular part of invA is cleared.
-              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
-              the inverse of the lower triangular matrix, and the strictly upper
-              triangular part of invA is cleared.
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
     @param[in]
-    ldinvA    [int]
-              specifies the leading dimension of each invA_i.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
+    @param[in]
+    m       [int]
+            m specifies the number of rows of each B_i. m >= 0.
+    @param[in]
+    n       [int]
+            n specifies the number of columns of each B_i. n >= 0.
+    @param[in]
+    alpha
+            device pointer or host pointer specifying the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+    @param[in]
+    AP       device array of device pointers storing each matrix A_i on the GPU.
+            Matricies are of dimension ( lda, k ), where k is m
+            when  HIPBLAS_SIDE_LEFT  and is  n  when  HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of each A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+    @param[in,out]
+    BP       device array of device pointers storing each matrix B_i on the GPU.
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
     @param[in]
     batchCount [int]
-              numbers of matrices in the batch
+                number of trsm operatons in the batch.
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
-                                                    hipblasFillMode_t  uplo,
-                                                    hipblasDiagType_t  diag,
-                                                    int                n,
-                                                    const float* const AP[],
-                                                    int                lda,
-                                                    float*             invA[],
-                                                    int                ldinvA,
-                                                    int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   float* const       AP[],
+                                                   int                lda,
+                                                   float*             BP[],
+                                                   int                ldb,
+                                                   int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
-                                                    hipblasFillMode_t   uplo,
-                                                    hipblasDiagType_t   diag,
-                                                    int                 n,
-                                                    const double* const AP[],
-                                                    int                 lda,
-                                                    double*             invA[],
-                                                    int                 ldinvA,
-                                                    int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   int                n,
+                                                   const double*      alpha,
+                                                   double* const      AP[],
+                                                   int                lda,
+                                                   double*            BP[],
+                                                   int                ldb,
+                                                   int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
-                                                    hipblasFillMode_t           uplo,
-                                                    hipblasDiagType_t           diag,
-                                                    int                         n,
-                                                    const hipblasComplex* const AP[],
-                                                    int                         lda,
-                                                    hipblasComplex*             invA[],
-                                                    int                         ldinvA,
-                                                    int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   hipblasDiagType_t     diag,
+                                                   int                   m,
+                                                   int                   n,
+                                                   const hipblasComplex* alpha,
+                                                   hipblasComplex* const AP[],
+                                                   int                   lda,
+                                                   hipblasComplex*       BP[],
+                                                   int                   ldb,
+                                                   int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
-                                                    hipblasFillMode_t                 uplo,
-                                                    hipblasDiagType_t                 diag,
-                                                    int                               n,
-                                                    const hipblasDoubleComplex* const AP[],
-                                                    int                               lda,
-                                                    hipblasDoubleComplex*             invA[],
-                                                    int                               ldinvA,
-                                                    int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   hipblasDoubleComplex* const AP[],
+                                                   int                         lda,
+                                                   hipblasDoubleComplex*       BP[],
+                                                   int                         ldb,
+                                                   int                         batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
-
     \details
-    trtriStridedBatched compute the inverse of A_i and write into invA_i where
-                   A_i and invA_i are the i-th matrices in the batch,
-                   for i = 1, ..., batchCount
+    trsmSridedBatched performs the following strided batched operation:
+
+        op(A_i)*X_i = alpha*B_i or  X_i*op(A_i) = alpha*B_i, for i = 1, ..., batchCount.
+
+    where alpha is a scalar, X and B are strided batched m by n matrices,
+    A is triangular strided batched matrix and op(A) is one of
+
+        op( A ) = A   or   op( A ) = A^T   or   op( A ) = A^H.
+
+    Each matrix X_i is overwritten on B_i for i = 1, ..., batchCount.
+
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : No support
@@ -15657,194 +16718,208 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
     @param[in]
-    diag      [hipblasDiagType_t]
-              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
-              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
     @param[in]
-    n         [int]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
     @param[in]
-    AP         device pointer pointing to address of first matrix A_1.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A.
+    m       [int]
+            m specifies the number of rows of each B_i. m >= 0.
     @param[in]
-    strideA  [hipblasStride]
-             "batch stride a": stride from the start of one A_i matrix to the next A_(i + 1).
-    @param[out]
-    invA      device pointer storing the inverses of each matrix A_i.
-              Partial inplace operation is supported, see below.
-              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
-              the inverse of the upper triangular matrix, and the strictly lower
-              triangular part of invA is cleared.
-              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
-              the inverse of the lower triangular matrix, and the strictly upper
-              triangular part of invA is cleared.
+    n       [int]
+            n specifies the number of columns of each B_i. n >= 0.
     @param[in]
-    ldinvA    [int]
-              specifies the leading dimension of each invA_i.
+    alpha
+            device pointer or host pointer specifying the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
     @param[in]
-    stride_invA  [hipblasStride]
-                 "batch stride invA": stride from the start of one invA_i matrix to the next invA_(i + 1).
+    AP       device pointer pointing to the first matrix A_1.
+            of dimension ( lda, k ), where k is m
+            when  HIPBLAS_SIDE_LEFT  and
+            is  n  when  HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
     @param[in]
-    batchCount  [int]
-                 numbers of matrices in the batch
-    ********************************************************************/
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
-                                                           hipblasFillMode_t uplo,
-                                                           hipblasDiagType_t diag,
-                                                           int               n,
-                                                           const float*      AP,
-                                                           int               lda,
-                                                           hipblasStride     strideA,
-                                                           float*            invA,
-                                                           int               ldinvA,
-                                                           hipblasStride     stride_invA,
-                                                           int               batchCount);
+    lda     [int]
+            lda specifies the first dimension of each A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+    @param[in]
+    strideA [hipblasStride]
+             stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[in,out]
+    BP       device pointer pointing to the first matrix B_1.
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+    @param[in]
+    strideB [hipblasStride]
+             stride from the start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    batchCount [int]
+                number of trsm operatons in the batch.
+    ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
-                                                           hipblasFillMode_t uplo,
-                                                           hipblasDiagType_t diag,
-                                                           int               n,
-                                                           const double*     AP,
-                                                           int               lda,
-                                                           hipblasStride     strideA,
-                                                           double*           invA,
-                                                           int               ldinvA,
-                                                           hipblasStride     stride_invA,
-                                                           int               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasSideMode_t  side,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          float*             AP,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          float*             BP,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
-                                                           hipblasFillMode_t     uplo,
-                                                           hipblasDiagType_t     diag,
-                                                           int                   n,
-                                                           const hipblasComplex* AP,
-                                                           int                   lda,
-                                                           hipblasStride         strideA,
-                                                           hipblasComplex*       invA,
-                                                           int                   ldinvA,
-                                                           hipblasStride         stride_invA,
-                                                           int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasSideMode_t  side,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          double*            AP,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          double*            BP,
+                                                          int                ldb,
+                                                          hipblasStride      strideB,
+                                                          int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
-                                                           hipblasFillMode_t           uplo,
-                                                           hipblasDiagType_t           diag,
-                                                           int                         n,
-                                                           const hipblasDoubleComplex* AP,
-                                                           int                         lda,
-                                                           hipblasStride               strideA,
-                                                           hipblasDoubleComplex*       invA,
-                                                           int                         ldinvA,
-                                                           hipblasStride               stride_invA,
-                                                           int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          hipblasComplex*       AP,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          hipblasComplex*       BP,
+                                                          int                   ldb,
+                                                          hipblasStride         strideB,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          hipblasDoubleComplex*       AP,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       BP,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          int                         batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
-    dgmm performs one of the matrix-matrix operations
-
-        C = A * diag(x) if side == HIPBLAS_SIDE_RIGHT
-        C = diag(x) * A if side == HIPBLAS_SIDE_LEFT
+    trtri  compute the inverse of a matrix A, namely, invA
 
-    where C and A are m by n dimensional matrices. diag( x ) is a diagonal matrix
-    and x is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
-    if side == HIPBLAS_SIDE_LEFT.
+        and write the result into invA;
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    side      [hipblasSideMode_t]
-              specifies the side of diag(x)
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
     @param[in]
-    m         [int]
-              matrix dimension m.
+    diag      [hipblasDiagType_t]
+              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
+              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
     @param[in]
     n         [int]
-              matrix dimension n.
+              size of matrix A and invA
     @param[in]
     AP         device pointer storing matrix A.
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
+    @param[out]
+    invA      device pointer storing matrix invA.
     @param[in]
-    x         device pointer storing vector x.
-    @param[in]
-    incx      [int]
-              specifies the increment between values of x
-    @param[in, out]
-    CP         device pointer storing matrix C.
-    @param[in]
-    ldc       [int]
-              specifies the leading dimension of C.
+    ldinvA    [int]
+              specifies the leading dimension of invA.
 
-    ********************************************************************/
+********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
-                                            hipblasSideMode_t side,
-                                            int               m,
-                                            int               n,
-                                            const float*      AP,
-                                            int               lda,
-                                            const float*      x,
-                                            int               incx,
-                                            float*            CP,
-                                            int               ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             hipblasDiagType_t diag,
+                                             int               n,
+                                             const float*      AP,
+                                             int               lda,
+                                             float*            invA,
+                                             int               ldinvA);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
-                                            hipblasSideMode_t side,
-                                            int               m,
-                                            int               n,
-                                            const double*     AP,
-                                            int               lda,
-                                            const double*     x,
-                                            int               incx,
-                                            double*           CP,
-                                            int               ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             hipblasDiagType_t diag,
+                                             int               n,
+                                             const double*     AP,
+                                             int               lda,
+                                             double*           invA,
+                                             int               ldinvA);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
-                                            hipblasSideMode_t     side,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* AP,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            hipblasComplex*       CP,
-                                            int                   ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             hipblasDiagType_t     diag,
+                                             int                   n,
+                                             const hipblasComplex* AP,
+                                             int                   lda,
+                                             hipblasComplex*       invA,
+                                             int                   ldinvA);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
-                                            hipblasSideMode_t           side,
-                                            int                         m,
-                                            int                         n,
-                                            const hipblasDoubleComplex* AP,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            hipblasDoubleComplex*       CP,
-                                            int                         ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             hipblasDiagType_t           diag,
+                                             int                         n,
+                                             const hipblasDoubleComplex* AP,
+                                             int                         lda,
+                                             hipblasDoubleComplex*       invA,
+                                             int                         ldinvA);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
-    dgmmBatched performs one of the batched matrix-matrix operations
-
-        C_i = A_i * diag(x_i) for i = 0, 1, ... batchCount-1 if side == HIPBLAS_SIDE_RIGHT
-        C_i = diag(x_i) * A_i for i = 0, 1, ... batchCount-1 if side == HIPBLAS_SIDE_LEFT
-
-    where C_i and A_i are m by n dimensional matrices. diag(x_i) is a diagonal matrix
-    and x_i is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
-    if side == HIPBLAS_SIDE_LEFT.
+    trtriBatched  compute the inverse of A_i and write into invA_i where
+                   A_i and invA_i are the i-th matrices in the batch,
+                   for i = 1, ..., batchCount.
 
     - Supported precisions in rocBLAS : s,d,c,z
     - Supported precisions in cuBLAS  : No support
@@ -15853,103 +16928,192 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    side      [hipblasSideMode_t]
-              specifies the side of diag(x)
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
     @param[in]
-    m         [int]
-              matrix dimension m.
+    diag      [hipblasDiagType_t]
+              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
+              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
     @param[in]
     n         [int]
-              matrix dimension n.
     @param[in]
-    AP         device array of device pointers storing each matrix A_i on the GPU.
-              Each A_i is of dimension ( lda, n )
+    AP         device array of device pointers storing each matrix A_i.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A_i.
-    @param[in]
-    x         device array of device pointers storing each vector x_i on the GPU.
-              Each x_i is of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension
-              m if side == HIPBLAS_SIDE_LEFT
-    @param[in]
-    incx      [int]
-              specifies the increment between values of x_i
-    @param[in, out]
-    CP         device array of device pointers storing each matrix C_i on the GPU.
-              Each C_i is of dimension ( ldc, n ).
+              specifies the leading dimension of each A_i.
+    @param[out]
+    invA      device array of device pointers storing the inverse of each matrix A_i.
+              Partial inplace operation is supported, see below.
+              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
+              the inverse of the upper triangular matrix, and the strictly lower
+              triangular part of invA is cleared.
+              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
+              the inverse of the lower triangular matrix, and the strictly upper
+              triangular part of invA is cleared.
     @param[in]
-    ldc       [int]
-              specifies the leading dimension of C_i.
+    ldinvA    [int]
+              specifies the leading dimension of each invA_i.
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+              numbers of matrices in the batch
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasDiagType_t  diag,
+                                                    int                n,
+                                                    const float* const AP[],
+                                                    int                lda,
+                                                    float*             invA[],
+                                                    int                ldinvA,
+                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    hipblasDiagType_t   diag,
+                                                    int                 n,
+                                                    const double* const AP[],
+                                                    int                 lda,
+                                                    double*             invA[],
+                                                    int                 ldinvA,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasDiagType_t           diag,
+                                                    int                         n,
+                                                    const hipblasComplex* const AP[],
+                                                    int                         lda,
+                                                    hipblasComplex*             invA[],
+                                                    int                         ldinvA,
+                                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    hipblasDiagType_t                 diag,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const AP[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex*             invA[],
+                                                    int                               ldinvA,
+                                                    int                               batchCount);
+//! @}
 
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    trtriStridedBatched compute the inverse of A_i and write into invA_i where
+                   A_i and invA_i are the i-th matrices in the batch,
+                   for i = 1, ..., batchCount
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+    @param[in]
+    diag      [hipblasDiagType_t]
+              = 'HIPBLAS_DIAG_NON_UNIT', A is non-unit triangular;
+              = 'HIPBLAS_DIAG_UNIT', A is unit triangular;
+    @param[in]
+    n         [int]
+    @param[in]
+    AP         device pointer pointing to address of first matrix A_1.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A.
+    @param[in]
+    strideA  [hipblasStride]
+             "batch stride a": stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[out]
+    invA      device pointer storing the inverses of each matrix A_i.
+              Partial inplace operation is supported, see below.
+              If UPLO = 'U', the leading N-by-N upper triangular part of the invA will store
+              the inverse of the upper triangular matrix, and the strictly lower
+              triangular part of invA is cleared.
+              If UPLO = 'L', the leading N-by-N lower triangular part of the invA will store
+              the inverse of the lower triangular matrix, and the strictly upper
+              triangular part of invA is cleared.
+    @param[in]
+    ldinvA    [int]
+              specifies the leading dimension of each invA_i.
+    @param[in]
+    stride_invA  [hipblasStride]
+                 "batch stride invA": stride from the start of one invA_i matrix to the next invA_(i + 1).
+    @param[in]
+    batchCount  [int]
+                 numbers of matrices in the batch
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
-                                                   hipblasSideMode_t  side,
-                                                   int                m,
-                                                   int                n,
-                                                   const float* const AP[],
-                                                   int                lda,
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   float* const       CP[],
-                                                   int                ldc,
-                                                   int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           hipblasDiagType_t diag,
+                                                           int               n,
+                                                           const float*      AP,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           float*            invA,
+                                                           int               ldinvA,
+                                                           hipblasStride     stride_invA,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
-                                                   hipblasSideMode_t   side,
-                                                   int                 m,
-                                                   int                 n,
-                                                   const double* const AP[],
-                                                   int                 lda,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   double* const       CP[],
-                                                   int                 ldc,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           hipblasDiagType_t diag,
+                                                           int               n,
+                                                           const double*     AP,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           double*           invA,
+                                                           int               ldinvA,
+                                                           hipblasStride     stride_invA,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
-                                                   hipblasSideMode_t           side,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex* const AP[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   hipblasComplex* const       CP[],
-                                                   int                         ldc,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasDiagType_t     diag,
+                                                           int                   n,
+                                                           const hipblasComplex* AP,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       invA,
+                                                           int                   ldinvA,
+                                                           hipblasStride         stride_invA,
+                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
-                                                   hipblasSideMode_t                 side,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex* const AP[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   hipblasDoubleComplex* const       CP[],
-                                                   int                               ldc,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasDiagType_t           diag,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* AP,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           hipblasDoubleComplex*       invA,
+                                                           int                         ldinvA,
+                                                           hipblasStride               stride_invA,
+                                                           int                         batchCount);
 //! @}
 
 /*! @{
     \brief BLAS Level 3 API
 
     \details
-    dgmmStridedBatched performs one of the batched matrix-matrix operations
+    dgmm performs one of the matrix-matrix operations
 
-        C_i = A_i * diag(x_i)   if side == HIPBLAS_SIDE_RIGHT   for i = 0, 1, ... batchCount-1
-        C_i = diag(x_i) * A_i   if side == HIPBLAS_SIDE_LEFT    for i = 0, 1, ... batchCount-1
+        C = A * diag(x) if side == HIPBLAS_SIDE_RIGHT
+        C = diag(x) * A if side == HIPBLAS_SIDE_LEFT
 
-    where C_i and A_i are m by n dimensional matrices. diag(x_i) is a diagonal matrix
-    and x_i is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
+    where C and A are m by n dimensional matrices. diag( x ) is a diagonal matrix
+    and x is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
     if side == HIPBLAS_SIDE_LEFT.
 
     - Supported precisions in rocBLAS : s,d,c,z
-    - Supported precisions in cuBLAS  : No support
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -15964,60 +17128,253 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t
     n         [int]
               matrix dimension n.
     @param[in]
-    AP         device pointer to the first matrix A_0 on the GPU.
-              Each A_i is of dimension ( lda, n )
+    AP         device pointer storing matrix A.
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
     @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
-    @param[in]
-    x         pointer to the first vector x_0 on the GPU.
-              Each x_i is of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension
-              m if side == HIPBLAS_SIDE_LEFT
+    x         device pointer storing vector x.
     @param[in]
     incx      [int]
               specifies the increment between values of x
-    @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one vector(x_i) and the next one (x_i+1)
     @param[in, out]
-    CP         device pointer to the first matrix C_0 on the GPU.
-              Each C_i is of dimension ( ldc, n ).
+    CP         device pointer storing matrix C.
     @param[in]
     ldc       [int]
               specifies the leading dimension of C.
-    @param[in]
-    strideC  [hipblasStride]
-              stride from the start of one matrix (C_i) and the next one (C_i+1)
-    @param[in]
-    batchCount [int]
-                number of instances i in the batch.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasSideMode_t side,
-                                                          int               m,
-                                                          int               n,
-                                                          const float*      AP,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          const float*      x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          float*            CP,
-                                                          int               ldc,
-                                                          hipblasStride     strideC,
-                                                          int               batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasSideMode_t side,
-                                                          int               m,
-                                                          int               n,
-                                                          const double*     AP,
-                                                          int               lda,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            int               m,
+                                            int               n,
+                                            const float*      AP,
+                                            int               lda,
+                                            const float*      x,
+                                            int               incx,
+                                            float*            CP,
+                                            int               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            int               m,
+                                            int               n,
+                                            const double*     AP,
+                                            int               lda,
+                                            const double*     x,
+                                            int               incx,
+                                            double*           CP,
+                                            int               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* AP,
+                                            int                   lda,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasComplex*       CP,
+                                            int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* AP,
+                                            int                         lda,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasDoubleComplex*       CP,
+                                            int                         ldc);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    dgmmBatched performs one of the batched matrix-matrix operations
+
+        C_i = A_i * diag(x_i) for i = 0, 1, ... batchCount-1 if side == HIPBLAS_SIDE_RIGHT
+        C_i = diag(x_i) * A_i for i = 0, 1, ... batchCount-1 if side == HIPBLAS_SIDE_LEFT
+
+    where C_i and A_i are m by n dimensional matrices. diag(x_i) is a diagonal matrix
+    and x_i is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
+    if side == HIPBLAS_SIDE_LEFT.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    side      [hipblasSideMode_t]
+              specifies the side of diag(x)
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    AP         device array of device pointers storing each matrix A_i on the GPU.
+              Each A_i is of dimension ( lda, n )
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A_i.
+    @param[in]
+    x         device array of device pointers storing each vector x_i on the GPU.
+              Each x_i is of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension
+              m if side == HIPBLAS_SIDE_LEFT
+    @param[in]
+    incx      [int]
+              specifies the increment between values of x_i
+    @param[in, out]
+    CP         device array of device pointers storing each matrix C_i on the GPU.
+              Each C_i is of dimension ( ldc, n ).
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C_i.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   int                m,
+                                                   int                n,
+                                                   const float* const AP[],
+                                                   int                lda,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   float* const       CP[],
+                                                   int                ldc,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double* const AP[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   double* const       CP[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasComplex* const AP[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   hipblasComplex* const       CP[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
+                                                   hipblasSideMode_t                 side,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   hipblasDoubleComplex* const       CP[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    dgmmStridedBatched performs one of the batched matrix-matrix operations
+
+        C_i = A_i * diag(x_i)   if side == HIPBLAS_SIDE_RIGHT   for i = 0, 1, ... batchCount-1
+        C_i = diag(x_i) * A_i   if side == HIPBLAS_SIDE_LEFT    for i = 0, 1, ... batchCount-1
+
+    where C_i and A_i are m by n dimensional matrices. diag(x_i) is a diagonal matrix
+    and x_i is vector of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension m
+    if side == HIPBLAS_SIDE_LEFT.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    side      [hipblasSideMode_t]
+              specifies the side of diag(x)
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    AP         device pointer to the first matrix A_0 on the GPU.
+              Each A_i is of dimension ( lda, n )
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    x         pointer to the first vector x_0 on the GPU.
+              Each x_i is of dimension n if side == HIPBLAS_SIDE_RIGHT and dimension
+              m if side == HIPBLAS_SIDE_LEFT
+    @param[in]
+    incx      [int]
+              specifies the increment between values of x
+    @param[in]
+    stridex  [hipblasStride]
+              stride from the start of one vector(x_i) and the next one (x_i+1)
+    @param[in, out]
+    CP         device pointer to the first matrix C_0 on the GPU.
+              Each C_i is of dimension ( ldc, n ).
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    strideC  [hipblasStride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+    @param[in]
+    batchCount [int]
+                number of instances i in the batch.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          int               m,
+                                                          int               n,
+                                                          const float*      AP,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          float*            CP,
+                                                          int               ldc,
+                                                          hipblasStride     strideC,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          int               m,
+                                                          int               n,
+                                                          const double*     AP,
+                                                          int               lda,
                                                           hipblasStride     strideA,
                                                           const double*     x,
                                                           int               incx,
@@ -17482,11 +18839,351 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
     alpha and beta are scalars, and A, B, and C are matrices, with
     op( A ) an m by k matrix, op( B ) a k by n matrix and C is a m by n matrix.
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    - Complex half A and B (HIPBLAS_C_16F, see hipblasHalfComplex), with an HIPBLAS_C_16F or
+      HIPBLAS_C_32F C and HIPBLAS_C_32F computeType, are implemented by hipBLAS on either
+      backend as real f16 GEMMs on the interleaved parts accumulating in f32. op( A ) is
+      expanded to a 2m by 2k real matrix in the handle's workspace, and the call does not wait
+      for the stream. With device alpha and beta, C is scaled by beta ahead of the GEMMs and
+      read even when beta is zero. hipblasMatmulPlanCreate does not take such types.
+    - With HIPBLAS_R_32F A, B and C, computeType HIPBLAS_R_32F_FAST, HIPBLAS_R_32F_FAST_TF32 or
+      HIPBLAS_R_32F_FAST_16BX3 computes the products with reduced precision, see
+      hipblasSetFloat32Mode, which also sets such a mode for HIPBLAS_R_32F on a handle.
+
+    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_ex documentation on int8
+    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
+    format for a given device as documented in rocBLAS.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType    [hipblasDatatype_t]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType    [hipblasDatatype_t]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType    [hipblasDatatype_t]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  aType,
+                                             int                lda,
+                                             const void*        B,
+                                             hipblasDatatype_t  bType,
+                                             int                ldb,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  cType,
+                                             int                ldc,
+                                             hipblasDatatype_t  computeType,
+                                             hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+    \details
+    gemmBatchedEx performs one of the batched matrix-matrix operations
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
+    where op( X ) is one of
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
+    op( A ) an m by k by batchCount batched matrix,
+    op( B ) a k by n by batchCount batched matrix and
+    C a m by n by batchCount batched matrix.
+    The batched matrices are an array of pointers to matrices.
+    The number of pointers to matrices is batchCount.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_batched_ex documentation on int8
+    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
+    format for a given device as documented in rocBLAS.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing array of pointers to each matrix A_i.
+    @param[in]
+    aType    [hipblasDatatype_t]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         [void *]
+              device pointer storing array of pointers to each matrix B_i.
+    @param[in]
+    bType    [hipblasDatatype_t]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i.
+    @param[in]
+    cType    [hipblasDatatype_t]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  aType,
+                                                    int                lda,
+                                                    const void*        B[],
+                                                    hipblasDatatype_t  bType,
+                                                    int                ldb,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  cType,
+                                                    int                ldc,
+                                                    int                batchCount,
+                                                    hipblasDatatype_t  computeType,
+                                                    hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix,
+    op( B ) a k by n by batchCount strided_batched matrix and
+    C a m by n by batchCount strided_batched matrix.
+
+    The strided_batched matrices are multiple matrices separated by a constant stride.
+    The number of matrices is batchCount.
+
+    When strideA is 0 and the op( B_i ) and C_i follow each other column block after column
+    block, or strideB is 0 and the op( A_i ) and C_i follow each other row block after row
+    block, the batch is computed as one GEMM with n*batchCount columns or m*batchCount rows.
+    The larger GEMM may use a different kernel, so results can differ in the last bits from
+    separate GEMMs; set HIPBLAS_GEMM_BROADCAST=0 to compute the batch as given.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_strided_batched_ex documentation on int8
+    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
+    format for a given device as documented in rocBLAS.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer pointing to first matrix A_1.
+    @param[in]
+    aType    [hipblasDatatype_t]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA  [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         [void *]
+              device pointer pointing to first matrix B_1.
+    @param[in]
+    bType    [hipblasDatatype_t]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB  [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device pointer pointing to first matrix C_1.
+    @param[in]
+    cType    [hipblasDatatype_t]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    strideC  [hipblasStride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  aType,
+                                                           int                lda,
+                                                           hipblasStride      strideA,
+                                                           const void*        B,
+                                                           hipblasDatatype_t  bType,
+                                                           int                ldb,
+                                                           hipblasStride      strideB,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  cType,
+                                                           int                ldc,
+                                                           hipblasStride      strideC,
+                                                           int                batchCount,
+                                                           hipblasDatatype_t  computeType,
+                                                           hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmExD performs the matrix-matrix operation
+
+        D = alpha*op( A )*op( B ) + beta*C,
 
-    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_ex documentation on int8
-    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
-    format for a given device as documented in rocBLAS.
+    like hipblasGemmEx, but writes the result to D, leaving C unchanged. D may be the same matrix
+    as C with ldd == ldc, which is equivalent to hipblasGemmEx.
+
+    The rocBLAS backend passes D to rocblas_gemm_ex directly; see the rocBLAS documentation for
+    the supported combinations of cType and dType. Other backends copy C to D on the handle's
+    stream and compute in place on D, skipping the copy when beta is a host zero, and require
+    dType == cType.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -17510,19 +19207,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
     alpha     [const void *]
               device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
     @param[in]
-    A         [void *]
+    A         [const void *]
               device pointer storing matrix A.
     @param[in]
-    aType    [hipblasDatatype_t]
+    aType     [hipblasDatatype_t]
               specifies the datatype of matrix A.
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
     @param[in]
-    B         [void *]
+    B         [const void *]
               device pointer storing matrix B.
     @param[in]
-    bType    [hipblasDatatype_t]
+    bType     [hipblasDatatype_t]
               specifies the datatype of matrix B.
     @param[in]
     ldb       [int]
@@ -17531,14 +19228,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
     beta      [const void *]
               device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
     @param[in]
-    C         [void *]
+    C         [const void *]
               device pointer storing matrix C.
     @param[in]
-    cType    [hipblasDatatype_t]
+    cType     [hipblasDatatype_t]
               specifies the datatype of matrix C.
     @param[in]
     ldc       [int]
               specifies the leading dimension of C.
+    @param[out]
+    D         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    dType     [hipblasDatatype_t]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [int]
+              specifies the leading dimension of D.
     @param[in]
     computeType
               [hipblasDatatype_t]
@@ -17548,46 +19254,40 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
               enumerant specifying the algorithm type.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                             hipblasOperation_t transA,
-                                             hipblasOperation_t transB,
-                                             int                m,
-                                             int                n,
-                                             int                k,
-                                             const void*        alpha,
-                                             const void*        A,
-                                             hipblasDatatype_t  aType,
-                                             int                lda,
-                                             const void*        B,
-                                             hipblasDatatype_t  bType,
-                                             int                ldb,
-                                             const void*        beta,
-                                             void*              C,
-                                             hipblasDatatype_t  cType,
-                                             int                ldc,
-                                             hipblasDatatype_t  computeType,
-                                             hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExD(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const void*        alpha,
+                                              const void*        A,
+                                              hipblasDatatype_t  aType,
+                                              int                lda,
+                                              const void*        B,
+                                              hipblasDatatype_t  bType,
+                                              int                ldb,
+                                              const void*        beta,
+                                              const void*        C,
+                                              hipblasDatatype_t  cType,
+                                              int                ldc,
+                                              void*              D,
+                                              hipblasDatatype_t  dType,
+                                              int                ldd,
+                                              hipblasDatatype_t  computeType,
+                                              hipblasGemmAlgo_t  algo);
 
 /*! \brief BLAS EX API
+
     \details
-    gemmBatchedEx performs one of the batched matrix-matrix operations
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
-    where op( X ) is one of
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
-    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
-    op( A ) an m by k by batchCount batched matrix,
-    op( B ) a k by n by batchCount batched matrix and
-    C a m by n by batchCount batched matrix.
-    The batched matrices are an array of pointers to matrices.
-    The number of pointers to matrices is batchCount.
+    gemmBatchedExD performs the batched matrix-matrix operation
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+        D_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
 
-    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_batched_ex documentation on int8
-    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
-    format for a given device as documented in rocBLAS.
+    like hipblasGemmBatchedEx, but writes the results to D, leaving C unchanged, see
+    hipblasGemmExD. On backends other than rocBLAS each C_i is copied to D_i on the device by a
+    geamBatched; for half, bfloat16 and integer C the pointer arrays are read back instead, which
+    synchronizes with the handle's stream.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -17611,192 +19311,971 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
     alpha     [const void *]
               device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
     @param[in]
-    A         [void *]
-              device pointer storing array of pointers to each matrix A_i.
+    A         [const void*[]]
+              array of device pointers storing each matrix A_i.
     @param[in]
-    aType    [hipblasDatatype_t]
+    aType     [hipblasDatatype_t]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         [const void*[]]
+              array of device pointers storing each matrix B_i.
+    @param[in]
+    bType     [hipblasDatatype_t]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [const void*[]]
+              array of device pointers storing each matrix C_i.
+    @param[in]
+    cType     [hipblasDatatype_t]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[out]
+    D         [void*[]]
+              array of device pointers storing each matrix D_i.
+    @param[in]
+    dType     [hipblasDatatype_t]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [int]
+              specifies the leading dimension of each D_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExD(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const void*        alpha,
+                                                     const void*        A[],
+                                                     hipblasDatatype_t  aType,
+                                                     int                lda,
+                                                     const void*        B[],
+                                                     hipblasDatatype_t  bType,
+                                                     int                ldb,
+                                                     const void*        beta,
+                                                     const void*        C[],
+                                                     hipblasDatatype_t  cType,
+                                                     int                ldc,
+                                                     void*              D[],
+                                                     hipblasDatatype_t  dType,
+                                                     int                ldd,
+                                                     int                batchCount,
+                                                     hipblasDatatype_t  computeType,
+                                                     hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmStridedBatchedExD performs the strided batched matrix-matrix operation
+
+        D_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
+
+    like hipblasGemmStridedBatchedEx, but writes the results to D, leaving C unchanged, see
+    hipblasGemmExD. On backends other than rocBLAS the copy of C to D is a single strided copy
+    when the strides are whole numbers of columns.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [const void *]
+              device pointer pointing to the first matrix A_1.
+    @param[in]
+    aType     [hipblasDatatype_t]
               specifies the datatype of each matrix A_i.
     @param[in]
     lda       [int]
               specifies the leading dimension of each A_i.
     @param[in]
-    B         [void *]
-              device pointer storing array of pointers to each matrix B_i.
+    strideA   [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         [const void *]
+              device pointer pointing to the first matrix B_1.
+    @param[in]
+    bType     [hipblasDatatype_t]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB   [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [const void *]
+              device pointer pointing to the first matrix C_1.
+    @param[in]
+    cType     [hipblasDatatype_t]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    strideC   [hipblasStride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[out]
+    D         [void *]
+              device pointer pointing to the first matrix D_1.
+    @param[in]
+    dType     [hipblasDatatype_t]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [int]
+              specifies the leading dimension of each D_i.
+    @param[in]
+    strideD   [hipblasStride]
+              specifies stride from start of one D_i matrix to the next D_(i + 1).
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExD(hipblasHandle_t    handle,
+                                                            hipblasOperation_t transA,
+                                                            hipblasOperation_t transB,
+                                                            int                m,
+                                                            int                n,
+                                                            int                k,
+                                                            const void*        alpha,
+                                                            const void*        A,
+                                                            hipblasDatatype_t  aType,
+                                                            int                lda,
+                                                            hipblasStride      strideA,
+                                                            const void*        B,
+                                                            hipblasDatatype_t  bType,
+                                                            int                ldb,
+                                                            hipblasStride      strideB,
+                                                            const void*        beta,
+                                                            const void*        C,
+                                                            hipblasDatatype_t  cType,
+                                                            int                ldc,
+                                                            hipblasStride      strideC,
+                                                            void*              D,
+                                                            hipblasDatatype_t  dType,
+                                                            int                ldd,
+                                                            hipblasStride      strideD,
+                                                            int                batchCount,
+                                                            hipblasDatatype_t  computeType,
+                                                            hipblasGemmAlgo_t  algo);
+
+/*! \brief BLAS EX API
+
+    \details
+    matmulPlanCreate prepares a gemmEx of a fixed shape so that it can be executed repeatedly
+    with hipblasMatmulPlanExecute at a lower host cost than hipblasGemmEx. Arguments are
+    validated, datatypes and operations are translated, and backend queries such as the rocBLAS
+    int8 layout flag are made once, when the plan is created. The plan also records the device
+    workspace the GEMM needs, see hipblasMatmulPlanGetWorkspaceSize.
+
+    The plan is tied to the device current when it is created and can be executed on any handle
+    for that device; hipblasMatmulPlanExecute returns HIPBLAS_STATUS_INVALID_VALUE on another
+    device. The plan does not select a kernel: algo is passed through, and the backend picks the
+    kernel for the shape on each execution as it does for hipblasGemmEx. With
+    HIPBLAS_MATMUL_EPILOGUE_BIAS, cType must be a floating point type.
+    HIPBLAS_C_16F types, which hipBLAS itself implements for hipblasGemmEx, return
+    HIPBLAS_STATUS_NOT_SUPPORTED. Only supported with the rocBLAS and cuBLAS backends.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    plan      [hipblasMatmulPlan_t*]
+              the new plan, released with hipblasMatmulPlanDestroy.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    aType     [hipblasDatatype_t]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    bType     [hipblasDatatype_t]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    cType     [hipblasDatatype_t]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType
+              [hipblasDatatype_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+    @param[in]
+    epilogue  [hipblasMatmulEpilogue_t]
+              operation applied to C after the GEMM.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatmulPlanCreate(hipblasHandle_t         handle,
+                                                       hipblasMatmulPlan_t*    plan,
+                                                       hipblasOperation_t      transA,
+                                                       hipblasOperation_t      transB,
+                                                       int                     m,
+                                                       int                     n,
+                                                       int                     k,
+                                                       hipblasDatatype_t       aType,
+                                                       int                     lda,
+                                                       hipblasDatatype_t       bType,
+                                                       int                     ldb,
+                                                       hipblasDatatype_t       cType,
+                                                       int                     ldc,
+                                                       hipblasDatatype_t       computeType,
+                                                       hipblasGemmAlgo_t       algo,
+                                                       hipblasMatmulEpilogue_t epilogue);
+
+/*! \brief BLAS EX API
+
+    \details
+    matmulPlanExecute performs the GEMM prepared in plan
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    followed by the plan's epilogue.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    plan      [hipblasMatmulPlan_t]
+              plan created by hipblasMatmulPlanCreate.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[inout]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    bias      [const void *]
+              device pointer storing m elements of cType for HIPBLAS_MATMUL_EPILOGUE_BIAS,
+              ignored otherwise.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatmulPlanExecute(hipblasHandle_t     handle,
+                                                        hipblasMatmulPlan_t plan,
+                                                        const void*         alpha,
+                                                        const void*         A,
+                                                        const void*         B,
+                                                        const void*         beta,
+                                                        void*               C,
+                                                        const void*         bias);
+
+/*! \brief Get the device workspace in bytes that executing a hipblasMatmulPlan_t uses*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatmulPlanGetWorkspaceSize(hipblasMatmulPlan_t plan,
+                                                                 size_t*             size);
+
+/*! \brief Release a plan created by hipblasMatmulPlanCreate*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasMatmulPlanDestroy(hipblasMatmulPlan_t plan);
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gemmOutOfCore performs the same operation as gemm
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    with A, B and C in host memory, for problems larger than device memory. C is computed
+    in square tiles; the tiles of A, B and C are copied to the device, multiplied and copied
+    back, alternating between two streams so the copies of one tile overlap the GEMM of
+    another. The tile size is chosen from the free device memory, or taken from the
+    HIPBLAS_OOC_TILE_SIZE environment variable.
+
+    Tiles of pageable host matrices are packed on the host through the pinned staging buffers
+    used by hipblasSetMatrixAsync, so their copies overlap the GEMM of the other stream but
+    take host time; matrices that are pinned, allocated with hipHostMalloc or registered with
+    hipHostRegister, are copied directly. Each stream has its own handle with the atomics mode
+    of handle. The call waits for work already queued on the handle's stream and returns once
+    C has been written back, so it is synchronous with respect to the host.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
     @param[in]
-    bType    [hipblasDatatype_t]
-              specifies the datatype of each matrix B_i.
+    m         [int]
+              number or rows of matrices op( A ) and C.
     @param[in]
-    ldb       [int]
-              specifies the leading dimension of each B_i.
+    n         [int]
+              number of columns of matrices op( B ) and C.
     @param[in]
-    beta      [const void *]
-              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
     @param[in]
-    C         [void *]
-              device array of device pointers to each matrix C_i.
+    alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    cType    [hipblasDatatype_t]
-              specifies the datatype of each matrix C_i.
+    A         host pointer storing matrix A.
     @param[in]
-    ldc       [int]
-              specifies the leading dimension of each C_i.
+    lda       [int]
+              specifies the leading dimension of A.
     @param[in]
-    batchCount
-              [int]
-              number of gemm operations in the batch.
+    B         host pointer storing matrix B.
     @param[in]
-    computeType
-              [hipblasDatatype_t]
-              specifies the datatype of computation.
+    ldb       [int]
+              specifies the leading dimension of B.
     @param[in]
-    algo      [hipblasGemmAlgo_t]
-              enumerant specifying the algorithm type.
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                                    hipblasOperation_t transA,
-                                                    hipblasOperation_t transB,
-                                                    int                m,
-                                                    int                n,
-                                                    int                k,
-                                                    const void*        alpha,
-                                                    const void*        A[],
-                                                    hipblasDatatype_t  aType,
-                                                    int                lda,
-                                                    const void*        B[],
-                                                    hipblasDatatype_t  bType,
-                                                    int                ldb,
-                                                    const void*        beta,
-                                                    void*              C[],
-                                                    hipblasDatatype_t  cType,
-                                                    int                ldc,
-                                                    int                batchCount,
-                                                    hipblasDatatype_t  computeType,
-                                                    hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const float*       B,
+                                                     int                ldb,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transA,
+                                                     hipblasOperation_t transB,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const double*      B,
+                                                     int                ldb,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmOutOfCore(hipblasHandle_t       handle,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasOperation_t    transB,
+                                                     int                   m,
+                                                     int                   n,
+                                                     int                   k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const hipblasComplex* B,
+                                                     int                   ldb,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       C,
+                                                     int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmOutOfCore(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const hipblasDoubleComplex* B,
+                                                     int                         ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int                         ldc);
+//! @}
 
-/*! \brief BLAS EX API
+/*! @{
+    \brief BLAS EX API
 
     \details
-    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+    syrkOutOfCore performs the same operation as syrk
 
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+        C := alpha*op( A )*op( A )**T + beta*C,
 
-    where op( X ) is one of
+    with A and C in host memory, tiled and pipelined as in gemmOutOfCore. Only the tiles
+    of C in the uplo triangle are computed and written back.
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
-    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
-    op( A ) an m by k by batchCount strided_batched matrix,
-    op( B ) a k by n by batchCount strided_batched matrix and
-    C a m by n by batchCount strided_batched matrix.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  C is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  C is a  lower triangular matrix
+    @param[in]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_T: op(A) = A**T
+            HIPBLAS_OP_N: op(A) = A
+    @param[in]
+    n       [int]
+            n specifies the number of rows and columns of C. n >= 0.
+    @param[in]
+    k       [int]
+            k specifies the number of columns of op(A). k >= 0.
+    @param[in]
+    alpha   device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A       host pointer storing matrix A.
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A.
+    @param[in]
+    beta    device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C       host pointer storing matrix C.
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
 
-    The strided_batched matrices are multiple matrices separated by a constant stride.
-    The number of matrices is batchCount.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     int                n,
+                                                     int                k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkOutOfCore(hipblasHandle_t       handle,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     int                   n,
+                                                     int                   k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       C,
+                                                     int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkOutOfCore(hipblasHandle_t             handle,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int                         ldc);
+//! @}
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+/*! @{
+    \brief BLAS EX API
 
-    Note for int8 users - For rocBLAS backend, please read rocblas_gemm_strided_batched_ex documentation on int8
-    data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
-    format for a given device as documented in rocBLAS.
+    \details
+    trsmOutOfCore solves the same system as trsm
+
+        op(A)*X = alpha*B or  X*op(A) = alpha*B,
+
+    with A and B in host memory, overwriting B with X. Panels of B are solved
+    independently and pipelined over two streams as in gemmOutOfCore; within a panel the
+    blocks of X are solved in dependency order, each updated by a GEMM with the blocks
+    solved before it and then by a trsm with the diagonal block of A.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    transA    [hipblasOperation_t]
-              specifies the form of op( A ).
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
     @param[in]
-    transB    [hipblasOperation_t]
-              specifies the form of op( B ).
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
     @param[in]
-    m         [int]
-              matrix dimension m.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
     @param[in]
-    n         [int]
-              matrix dimension n.
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
     @param[in]
-    k         [int]
-              matrix dimension k.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT: A is not assumed to be unit triangular.
     @param[in]
-    alpha     [const void *]
-              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    m       [int]
+            m specifies the number of rows of B. m >= 0.
     @param[in]
-    A         [void *]
-              device pointer pointing to first matrix A_1.
+    n       [int]
+            n specifies the number of columns of B. n >= 0.
     @param[in]
-    aType    [hipblasDatatype_t]
-              specifies the datatype of each matrix A_i.
+    alpha   device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    A       host pointer storing matrix A.
     @param[in]
-    strideA  [hipblasStride]
-              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    lda     [int]
+            lda specifies the first dimension of A.
+    @param[in, out]
+    B       host pointer storing matrix B, overwritten by X.
     @param[in]
-    B         [void *]
-              device pointer pointing to first matrix B_1.
+    ldb    [int]
+           ldb specifies the first dimension of B. ldb >= max( 1, m ).
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     int                n,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     float*             B,
+                                                     int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmOutOfCore(hipblasHandle_t    handle,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     int                n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     double*            B,
+                                                     int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmOutOfCore(hipblasHandle_t       handle,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     hipblasComplex*       B,
+                                                     int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmOutOfCore(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     hipblasDoubleComplex*       B,
+                                                     int                         ldb);
+//! @}
+
+/*! \brief Create a hipblasXt context, distributing Level-3 calls over the devices chosen with
+    hipblasXtDeviceSelect.
+
+    \details
+    The hipblasXt routines take the same arguments as the corresponding hipblasX routines, with
+    the matrices in host memory or in the memory of any device. The result is split into square
+    blocks of hipblasXtSetBlockDim elements, and the blocks are shared between the selected
+    devices: each device runs one host thread which, as soon as it has issued one block on one of
+    its two streams, takes the next block not yet taken by another device. Faster devices
+    therefore compute more blocks. Each block copies its tiles of the matrices to the device,
+    computes and copies its result back, as in hipblasXgemmOutOfCore.
+
+    alpha and beta are always host pointers. The routines are synchronous with respect to the
+    host. Pageable host matrices are staged as in hipblasXgemmOutOfCore; pinned ones, allocated
+    with hipHostMalloc or registered with hipHostRegister, are copied without host work. Peer access is enabled between the
+    selected devices where supported, so matrices resident on one of them are copied directly.
+    Only supported with the rocBLAS and cuBLAS backends.
+    @param[out]
+    handle    [hipblasXtHandle_t*]
+              the new context, released with hipblasXtDestroy.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle);
+
+/*! \brief Release a hipblasXt context and the hipBLAS handles of its devices*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle);
+
+/*! \brief Select the devices sharing the calls made on a hipblasXt context
     @param[in]
-    bType    [hipblasDatatype_t]
-              specifies the datatype of each matrix B_i.
+    handle    [hipblasXtHandle_t]
+              the hipblasXt context.
     @param[in]
-    ldb       [int]
-              specifies the leading dimension of each B_i.
+    nbDevices [int]
+              number of devices, nbDevices > 0.
     @param[in]
-    strideB  [hipblasStride]
-              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    deviceId  [const int*]
+              host array of nbDevices distinct device ids.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle,
+                                                     int               nbDevices,
+                                                     const int*        deviceId);
+
+/*! \brief Set the size of the square blocks the result is split into. 0, the default, uses
+    HIPBLAS_OOC_TILE_SIZE if set, otherwise the largest size fitting in every selected device*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim);
+
+/*! \brief Get the block size set with hipblasXtSetBlockDim*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim);
+
+/*! \brief Share the blocks of a hipblasXt routine between the devices and the host BLAS
+
+    \details
+    With a non-zero ratio, a host thread computes blocks of the result with the host BLAS while
+    the devices compute the others. The devices take blocks from the start of the result and the
+    host from the end, until they meet, so the host never holds up the devices for long:
+    - 0 < ratio <= 1: the host computes at most this fraction of the blocks,
+    - ratio < 0: the fraction is balanced automatically. The first call lets the host take
+      blocks until it meets the devices; later calls give the host the fraction of the blocks
+      matching its measured rate relative to the devices in the previous calls,
+    - ratio == 0, the default: the host computes no blocks.
+
+    The host only takes part when every matrix of the call is in host memory, and when a host
+    routine is found for blasOp and type, see hipblasXtSetCpuRoutine.
     @param[in]
-    beta      [const void *]
-              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    handle    [hipblasXtHandle_t]
+              the hipblasXt context.
     @param[in]
-    C         [void *]
-              device pointer pointing to first matrix C_1.
+    blasOp    [hipblasXtBlasOp_t]
+              the routine the ratio applies to.
     @param[in]
-    cType    [hipblasDatatype_t]
-              specifies the datatype of each matrix C_i.
+    type      [hipblasXtOpType_t]
+              the precision the ratio applies to.
     @param[in]
-    ldc       [int]
-              specifies the leading dimension of each C_i.
+    ratio     [float]
+              fraction of the blocks computed on the host, ratio <= 1.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetCpuRatio(hipblasXtHandle_t handle,
+                                                    hipblasXtBlasOp_t blasOp,
+                                                    hipblasXtOpType_t type,
+                                                    float             ratio);
+
+/*! \brief Set the host BLAS routine computing the host share of a hipblasXt routine
+
+    \details
+    blasFunctor has the CBLAS signature of the routine, for example cblas_sgemm for
+    HIPBLAS_XT_GEMM and HIPBLAS_XT_FLOAT, and is always called with CblasColMajor. When no
+    routine is set, cblas_<x><routine> is looked up in the library named by HIPBLAS_XT_CPU_BLAS
+    if it is set, otherwise in the process and then in libcblas, libblis or libopenblas. A call
+    lacking any host routine it needs, the syrk routines also needing gemm, is computed entirely
+    on the devices.
     @param[in]
-    strideC  [hipblasStride]
-              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    handle      [hipblasXtHandle_t]
+                the hipblasXt context.
     @param[in]
-    batchCount
-              [int]
-              number of gemm operations in the batch.
+    blasOp      [hipblasXtBlasOp_t]
+                the routine blasFunctor computes.
     @param[in]
-    computeType
-              [hipblasDatatype_t]
-              specifies the datatype of computation.
+    type        [hipblasXtOpType_t]
+                the precision blasFunctor computes.
     @param[in]
-    algo      [hipblasGemmAlgo_t]
-              enumerant specifying the algorithm type.
+    blasFunctor [void*]
+                host function, or nullptr to use the routine found by default.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetCpuRoutine(hipblasXtHandle_t handle,
+                                                      hipblasXtBlasOp_t blasOp,
+                                                      hipblasXtOpType_t type,
+                                                      void*             blasFunctor);
+
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    hipblasXtXgemm performs hipblasXgemm on the devices of a hipblasXt context, see
+    hipblasXtCreate.
 
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                                           hipblasOperation_t transA,
-                                                           hipblasOperation_t transB,
-                                                           int                m,
-                                                           int                n,
-                                                           int                k,
-                                                           const void*        alpha,
-                                                           const void*        A,
-                                                           hipblasDatatype_t  aType,
-                                                           int                lda,
-                                                           hipblasStride      strideA,
-                                                           const void*        B,
-                                                           hipblasDatatype_t  bType,
-                                                           int                ldb,
-                                                           hipblasStride      strideB,
-                                                           const void*        beta,
-                                                           void*              C,
-                                                           hipblasDatatype_t  cType,
-                                                           int                ldc,
-                                                           hipblasStride      strideC,
-                                                           int                batchCount,
-                                                           hipblasDatatype_t  computeType,
-                                                           hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              const float*       B,
+                                              int                ldb,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              const double*      B,
+                                              int                ldb,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    hipblasXtXsyrk performs hipblasXsyrk on the devices of a hipblasXt context, see
+    hipblasXtCreate. transA must be HIPBLAS_OP_N or HIPBLAS_OP_T.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    hipblasXtXtrsm performs hipblasXtrsm on the devices of a hipblasXt context, see
+    hipblasXtCreate. Panels of B are solved independently on the devices.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              float*             B,
+                                              int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              double*            B,
+                                              int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int                   m,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasComplex*       B,
+                                              int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int                         m,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasDoubleComplex*       B,
+                                              int                         ldb);
+//! @}
 
 /*! BLAS EX API
 
@@ -18245,6 +20724,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    ha
         y := alpha * x + y
 
         - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+        - HIPBLAS_C_16F x and y with an HIPBLAS_R_32F or HIPBLAS_C_32F alpha and HIPBLAS_C_32F
+          executionType are implemented by hipBLAS on either backend with f32 arithmetic.
+          Increments must both be positive or both negative.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -18433,6 +20915,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   han
         result = conjugate (x) * y;
 
         - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+        - HIPBLAS_C_16F x and y with an HIPBLAS_C_16F or HIPBLAS_C_32F result and HIPBLAS_C_32F
+          executionType are implemented by hipBLAS on either backend, accumulating in f32.
+          Increments must both be positive or both negative.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -18677,6 +21162,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   han
               result := sqrt( x**H*x ) for complex vectors
 
     - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    - An HIPBLAS_C_16F x is the norm of its real and imaginary parts as an HIPBLAS_R_16F vector of
+      2n elements, with the resultType and executionType the backend supports for that.
 
 
     @param[in]
@@ -19031,6 +21518,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   hand
         x := alpha * x
 
     - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    - An HIPBLAS_C_16F x with an HIPBLAS_R_32F or HIPBLAS_C_32F alpha and HIPBLAS_C_32F
+      executionType is implemented by hipBLAS on either backend with f32 arithmetic.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -19165,6 +21654,1690 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   han
                                                            int               batchCount,
                                                            hipblasDatatype_t executionType);
 
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    rowGemm performs the same operation as gemm,
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    on matrices stored in row-major order: element (i, j) of A is A[i*lda + j], and lda, ldb
+    and ldc are the distances between consecutive rows. The call is forwarded to the
+    column-major gemm on the transposes of the operands, C**T = op( B**T )*op( A**T ), which
+    reads the same memory, so no data is copied or transposed.
+
+    The arguments are those of hipblasXgemm, hipblasXgemmBatched and
+    hipblasXgemmStridedBatched, with every matrix in row-major order.
+
+    - Supported precisions in rocBLAS : h,s,d,c,z
+    - Supported precisions in cuBLAS  : h,s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowHgemm(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* A,
+                                               int                lda,
+                                               const hipblasHalf* B,
+                                               int                ldb,
+                                               const hipblasHalf* beta,
+                                               hipblasHalf*       C,
+                                               int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemm(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               const float*       B,
+                                               int                ldb,
+                                               const float*       beta,
+                                               float*             C,
+                                               int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemm(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               const double*      B,
+                                               int                ldb,
+                                               const double*      beta,
+                                               double*            C,
+                                               int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemm(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int                   m,
+                                               int                   n,
+                                               int                   k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int                   lda,
+                                               const hipblasComplex* B,
+                                               int                   ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemm(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int                         m,
+                                               int                         n,
+                                               int                         k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int                         lda,
+                                               const hipblasDoubleComplex* B,
+                                               int                         ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       C,
+                                               int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowHgemmBatched(hipblasHandle_t          handle,
+                                                      hipblasOperation_t       transA,
+                                                      hipblasOperation_t       transB,
+                                                      int                      m,
+                                                      int                      n,
+                                                      int                      k,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const A[],
+                                                      int                      lda,
+                                                      const hipblasHalf* const B[],
+                                                      int                      ldb,
+                                                      const hipblasHalf*       beta,
+                                                      hipblasHalf* const       C[],
+                                                      int                      ldc,
+                                                      int                      batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemmBatched(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int                lda,
+                                                      const float* const B[],
+                                                      int                ldb,
+                                                      const float*       beta,
+                                                      float* const       C[],
+                                                      int                ldc,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemmBatched(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int                 lda,
+                                                      const double* const B[],
+                                                      int                 ldb,
+                                                      const double*       beta,
+                                                      double* const       C[],
+                                                      int                 ldc,
+                                                      int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemmBatched(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int                         lda,
+                                                      const hipblasComplex* const B[],
+                                                      int                         ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       C[],
+                                                      int                         ldc,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemmBatched(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int                               m,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int                               lda,
+                                                      const hipblasDoubleComplex* const B[],
+                                                      int                               ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       C[],
+                                                      int                               ldc,
+                                                      int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowHgemmStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* A,
+                                                             int                lda,
+                                                             long long          strideA,
+                                                             const hipblasHalf* B,
+                                                             int                ldb,
+                                                             long long          strideB,
+                                                             const hipblasHalf* beta,
+                                                             hipblasHalf*       C,
+                                                             int                ldc,
+                                                             long long          strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemmStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int                lda,
+                                                             long long          strideA,
+                                                             const float*       B,
+                                                             int                ldb,
+                                                             long long          strideB,
+                                                             const float*       beta,
+                                                             float*             C,
+                                                             int                ldc,
+                                                             long long          strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemmStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int                lda,
+                                                             long long          strideA,
+                                                             const double*      B,
+                                                             int                ldb,
+                                                             long long          strideB,
+                                                             const double*      beta,
+                                                             double*            C,
+                                                             int                ldc,
+                                                             long long          strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemmStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int                   m,
+                                                             int                   n,
+                                                             int                   k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int                   lda,
+                                                             long long             strideA,
+                                                             const hipblasComplex* B,
+                                                             int                   ldb,
+                                                             long long             strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       C,
+                                                             int                   ldc,
+                                                             long long             strideC,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemmStridedBatched(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          transA,
+                                                             hipblasOperation_t          transB,
+                                                             int                         m,
+                                                             int                         n,
+                                                             int                         k,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* A,
+                                                             int                         lda,
+                                                             long long                   strideA,
+                                                             const hipblasDoubleComplex* B,
+                                                             int                         ldb,
+                                                             long long                   strideB,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       C,
+                                                             int                         ldc,
+                                                             long long                   strideC,
+                                                             int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    RowGemmEx performs the same operation as GemmEx,
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    on matrices stored in row-major order, with lda, ldb and ldc the distances between
+    consecutive rows. As for hipblasRowXgemm, A and B swap places on the column-major call,
+    together with their datatypes, and no data is copied.
+
+    The arguments are those of hipblasGemmEx, hipblasGemmBatchedEx and
+    hipblasGemmStridedBatchedEx, with every matrix in row-major order.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowGemmEx(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  aType,
+                                                int                lda,
+                                                const void*        B,
+                                                hipblasDatatype_t  bType,
+                                                int                ldb,
+                                                const void*        beta,
+                                                void*              C,
+                                                hipblasDatatype_t  cType,
+                                                int                ldc,
+                                                hipblasDatatype_t  computeType,
+                                                hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowGemmBatchedEx(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int                m,
+                                                       int                n,
+                                                       int                k,
+                                                       const void*        alpha,
+                                                       const void*        A[],
+                                                       hipblasDatatype_t  aType,
+                                                       int                lda,
+                                                       const void*        B[],
+                                                       hipblasDatatype_t  bType,
+                                                       int                ldb,
+                                                       const void*        beta,
+                                                       void*              C[],
+                                                       hipblasDatatype_t  cType,
+                                                       int                ldc,
+                                                       int                batchCount,
+                                                       hipblasDatatype_t  computeType,
+                                                       hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int                m,
+                                                              int                n,
+                                                              int                k,
+                                                              const void*        alpha,
+                                                              const void*        A,
+                                                              hipblasDatatype_t  aType,
+                                                              int                lda,
+                                                              hipblasStride      strideA,
+                                                              const void*        B,
+                                                              hipblasDatatype_t  bType,
+                                                              int                ldb,
+                                                              hipblasStride      strideB,
+                                                              const void*        beta,
+                                                              void*              C,
+                                                              hipblasDatatype_t  cType,
+                                                              int                ldc,
+                                                              hipblasStride      strideC,
+                                                              int                batchCount,
+                                                              hipblasDatatype_t  computeType,
+                                                              hipblasGemmAlgo_t  algo);
+//! @}
+
+/*! @{
+    \brief BLAS Level 2 API
+
+    \details
+    rowGemv performs the same operation as gemv,
+
+        y = alpha*op( A )*x + beta*y,
+
+    with the m by n matrix A stored in row-major order and lda the distance between
+    consecutive rows. The column-major gemv is called on the n by m matrix A**T with
+    HIPBLAS_OP_N and HIPBLAS_OP_T exchanged, so no data is copied.
+
+    For the complex types, trans == HIPBLAS_OP_C would need the conjugate of A without
+    the transpose, which gemv does not provide; it returns HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    The arguments are those of hipblasXgemv, hipblasXgemvBatched and
+    hipblasXgemvStridedBatched, with A in row-major order.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemv(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               const float*       x,
+                                               int                incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemv(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                m,
+                                               int                n,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               const double*      x,
+                                               int                incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemv(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int                   m,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int                   lda,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemv(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int                         m,
+                                               int                         n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int                         lda,
+                                               const hipblasDoubleComplex* x,
+                                               int                         incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int                         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemvBatched(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int                m,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int                lda,
+                                                      const float* const x[],
+                                                      int                incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int                incy,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemvBatched(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int                 m,
+                                                      int                 n,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int                 lda,
+                                                      const double* const x[],
+                                                      int                 incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int                 incy,
+                                                      int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemvBatched(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int                         m,
+                                                      int                         n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int                         lda,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int                         incy,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemvBatched(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int                               m,
+                                                      int                               n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int                               lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int                               incy,
+                                                      int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSgemvStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int                m,
+                                                             int                n,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int                incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int                incy,
+                                                             hipblasStride      stridey,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDgemvStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int                m,
+                                                             int                n,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int                incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int                incy,
+                                                             hipblasStride      stridey,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCgemvStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             int                   m,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int                   lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int                   incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int                   incy,
+                                                             hipblasStride         stridey,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZgemvStridedBatched(hipblasHandle_t             handle,
+                                                             hipblasOperation_t          transA,
+                                                             int                         m,
+                                                             int                         n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* A,
+                                                             int                         lda,
+                                                             hipblasStride               strideA,
+                                                             const hipblasDoubleComplex* x,
+                                                             int                         incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       y,
+                                                             int                         incy,
+                                                             hipblasStride               stridey,
+                                                             int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    rowTrsm solves the same system as trsm,
+
+        op( A )*X = alpha*B  or  X*op( A ) = alpha*B,
+
+    with A and B stored in row-major order and lda and ldb the distances between
+    consecutive rows. X overwrites B. The column-major trsm is called on A**T and B**T,
+    solving from the other side against the other triangle, so no data is copied.
+
+    The arguments are those of hipblasXtrsm, hipblasXtrsmBatched and
+    hipblasXtrsmStridedBatched, with A and B in row-major order.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowStrsm(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const float*       alpha,
+                                               float*             A,
+                                               int                lda,
+                                               float*             B,
+                                               int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDtrsm(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const double*      alpha,
+                                               double*            A,
+                                               int                lda,
+                                               double*            B,
+                                               int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCtrsm(hipblasHandle_t       handle,
+                                               hipblasSideMode_t     side,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               hipblasDiagType_t     diag,
+                                               int                   m,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       A,
+                                               int                   lda,
+                                               hipblasComplex*       B,
+                                               int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZtrsm(hipblasHandle_t             handle,
+                                               hipblasSideMode_t           side,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               hipblasDiagType_t           diag,
+                                               int                         m,
+                                               int                         n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       A,
+                                               int                         lda,
+                                               hipblasDoubleComplex*       B,
+                                               int                         ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowStrsmBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      float* const       A[],
+                                                      int                lda,
+                                                      float*             B[],
+                                                      int                ldb,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDtrsmBatched(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const double*      alpha,
+                                                      double* const      A[],
+                                                      int                lda,
+                                                      double*            B[],
+                                                      int                ldb,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCtrsmBatched(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int                   m,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const A[],
+                                                      int                   lda,
+                                                      hipblasComplex*       B[],
+                                                      int                   ldb,
+                                                      int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZtrsmBatched(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int                         m,
+                                                      int                         n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const A[],
+                                                      int                         lda,
+                                                      hipblasDoubleComplex*       B[],
+                                                      int                         ldb,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowStrsmStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int                m,
+                                                             int                n,
+                                                             const float*       alpha,
+                                                             float*             A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             float*             B,
+                                                             int                ldb,
+                                                             hipblasStride      strideB,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDtrsmStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int                m,
+                                                             int                n,
+                                                             const double*      alpha,
+                                                             double*            A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             double*            B,
+                                                             int                ldb,
+                                                             hipblasStride      strideB,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCtrsmStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasSideMode_t     side,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasDiagType_t     diag,
+                                                             int                   m,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       A,
+                                                             int                   lda,
+                                                             hipblasStride         strideA,
+                                                             hipblasComplex*       B,
+                                                             int                   ldb,
+                                                             hipblasStride         strideB,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZtrsmStridedBatched(hipblasHandle_t             handle,
+                                                             hipblasSideMode_t           side,
+                                                             hipblasFillMode_t           uplo,
+                                                             hipblasOperation_t          transA,
+                                                             hipblasDiagType_t           diag,
+                                                             int                         m,
+                                                             int                         n,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             hipblasDoubleComplex*       A,
+                                                             int                         lda,
+                                                             hipblasStride               strideA,
+                                                             hipblasDoubleComplex*       B,
+                                                             int                         ldb,
+                                                             hipblasStride               strideB,
+                                                             int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    RowTrsmEx solves the same system as TrsmEx with A and B stored in row-major order, in
+    the same way as hipblasRowXtrsm. The inverted diagonal blocks in invA, when given, are
+    also read in row-major order.
+
+    The arguments are those of hipblasTrsmEx, hipblasTrsmBatchedEx and
+    hipblasTrsmStridedBatchedEx.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowTrsmEx(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t transA,
+                                                hipblasDiagType_t  diag,
+                                                int                m,
+                                                int                n,
+                                                const void*        alpha,
+                                                void*              A,
+                                                int                lda,
+                                                void*              B,
+                                                int                ldb,
+                                                const void*        invA,
+                                                int                invAsize,
+                                                hipblasDatatype_t  computeType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowTrsmBatchedEx(hipblasHandle_t    handle,
+                                                       hipblasSideMode_t  side,
+                                                       hipblasFillMode_t  uplo,
+                                                       hipblasOperation_t transA,
+                                                       hipblasDiagType_t  diag,
+                                                       int                m,
+                                                       int                n,
+                                                       const void*        alpha,
+                                                       void*              A,
+                                                       int                lda,
+                                                       void*              B,
+                                                       int                ldb,
+                                                       int                batchCount,
+                                                       const void*        invA,
+                                                       int                invAsize,
+                                                       hipblasDatatype_t  computeType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                                              hipblasSideMode_t  side,
+                                                              hipblasFillMode_t  uplo,
+                                                              hipblasOperation_t transA,
+                                                              hipblasDiagType_t  diag,
+                                                              int                m,
+                                                              int                n,
+                                                              const void*        alpha,
+                                                              void*              A,
+                                                              int                lda,
+                                                              hipblasStride      strideA,
+                                                              void*              B,
+                                                              int                ldb,
+                                                              hipblasStride      strideB,
+                                                              int                batchCount,
+                                                              const void*        invA,
+                                                              int                invAsize,
+                                                              hipblasStride      strideInvA,
+                                                              hipblasDatatype_t  computeType);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    rowSyrk performs the same operation as syrk,
+
+        C = alpha*op( A )*op( A )**T + beta*C,
+
+    with A and C stored in row-major order and lda and ldc the distances between
+    consecutive rows. The column-major syrk is called on A**T with HIPBLAS_OP_N and
+    HIPBLAS_OP_T exchanged, updating the other triangle of the column-major view of C,
+    which is the uplo triangle of the row-major C. No data is copied.
+
+    The arguments are those of hipblasXsyrk, hipblasXsyrkBatched and
+    hipblasXsyrkStridedBatched, with A and C in row-major order.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSsyrk(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int                n,
+                                               int                k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               const float*       beta,
+                                               float*             C,
+                                               int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDsyrk(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               int                n,
+                                               int                k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               const double*      beta,
+                                               double*            C,
+                                               int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCsyrk(hipblasHandle_t       handle,
+                                               hipblasFillMode_t     uplo,
+                                               hipblasOperation_t    transA,
+                                               int                   n,
+                                               int                   k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int                   lda,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZsyrk(hipblasHandle_t             handle,
+                                               hipblasFillMode_t           uplo,
+                                               hipblasOperation_t          transA,
+                                               int                         n,
+                                               int                         k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int                         lda,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       C,
+                                               int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSsyrkBatched(hipblasHandle_t    handle,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      int                n,
+                                                      int                k,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int                lda,
+                                                      const float*       beta,
+                                                      float* const       C[],
+                                                      int                ldc,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDsyrkBatched(hipblasHandle_t     handle,
+                                                      hipblasFillMode_t   uplo,
+                                                      hipblasOperation_t  transA,
+                                                      int                 n,
+                                                      int                 k,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int                 lda,
+                                                      const double*       beta,
+                                                      double* const       C[],
+                                                      int                 ldc,
+                                                      int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCsyrkBatched(hipblasHandle_t             handle,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int                         lda,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       C[],
+                                                      int                         ldc,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZsyrkBatched(hipblasHandle_t                   handle,
+                                                      hipblasFillMode_t                 uplo,
+                                                      hipblasOperation_t                transA,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int                               lda,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       C[],
+                                                      int                               ldc,
+                                                      int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowSsyrkStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int                n,
+                                                             int                k,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       beta,
+                                                             float*             C,
+                                                             int                ldc,
+                                                             hipblasStride      strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowDsyrkStridedBatched(hipblasHandle_t    handle,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             int                n,
+                                                             int                k,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      beta,
+                                                             double*            C,
+                                                             int                ldc,
+                                                             hipblasStride      strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowCsyrkStridedBatched(hipblasHandle_t       handle,
+                                                             hipblasFillMode_t     uplo,
+                                                             hipblasOperation_t    transA,
+                                                             int                   n,
+                                                             int                   k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int                   lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       C,
+                                                             int                   ldc,
+                                                             hipblasStride         strideC,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRowZsyrkStridedBatched(hipblasHandle_t             handle,
+                                                             hipblasFillMode_t           uplo,
+                                                             hipblasOperation_t          transA,
+                                                             int                         n,
+                                                             int                         k,
+                                                             const hipblasDoubleComplex* alpha,
+                                                             const hipblasDoubleComplex* A,
+                                                             int                         lda,
+                                                             hipblasStride               strideA,
+                                                             const hipblasDoubleComplex* beta,
+                                                             hipblasDoubleComplex*       C,
+                                                             int                         ldc,
+                                                             hipblasStride               strideC,
+                                                             int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gepackCompact copies a strided batch of column-major matrices into the compact layout.
+
+    In the compact layout, the batchCount matrices of a call form one group stored
+    interleaved: element (i, j) of matrix b is at X[(i + j*ldx)*batchCount + b], so each
+    element of all the matrices is contiguous. hipBLAS has no routines computing on this
+    layout; it is converted for data exchanged with code that uses it, and the strided-batched
+    routines work on the unpacked matrices.
+
+    The copy is one geam transpose per column, or one in all when lda == ldac == m.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    m         [int]
+              number of rows of each matrix. m >= 0.
+    @param[in]
+    n         [int]
+              number of columns of each matrix. n >= 0.
+    @param[in]
+    A         device pointer to the first matrix of the strided batch.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. lda >= max( 1, m ).
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next. strideA >= lda*n when
+              batchCount > 1.
+    @param[out]
+    Ac        device pointer storing the matrices in the compact layout, of at least
+              ldac*n*batchCount elements.
+    @param[in]
+    ldac      [int]
+              specifies the leading dimension of the compact matrices. ldac >= max( 1, m ).
+    @param[in]
+    batchCount [int]
+              number of matrices, which form one group.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgepackCompact(hipblasHandle_t handle,
+                                                     int             m,
+                                                     int             n,
+                                                     const float*    A,
+                                                     int             lda,
+                                                     hipblasStride   strideA,
+                                                     float*          Ac,
+                                                     int             ldac,
+                                                     int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgepackCompact(hipblasHandle_t handle,
+                                                     int             m,
+                                                     int             n,
+                                                     const double*   A,
+                                                     int             lda,
+                                                     hipblasStride   strideA,
+                                                     double*         Ac,
+                                                     int             ldac,
+                                                     int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgepackCompact(hipblasHandle_t       handle,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     hipblasStride         strideA,
+                                                     hipblasComplex*       Ac,
+                                                     int                   ldac,
+                                                     int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgepackCompact(hipblasHandle_t             handle,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     hipblasStride               strideA,
+                                                     hipblasDoubleComplex*       Ac,
+                                                     int                         ldac,
+                                                     int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    geunpackCompact copies matrices in the compact layout of hipblasXgepackCompact back to a
+    strided batch of column-major matrices. The arguments are those of
+    hipblasXgepackCompact with Ac the input and A the output.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeunpackCompact(hipblasHandle_t handle,
+                                                       int             m,
+                                                       int             n,
+                                                       const float*    Ac,
+                                                       int             ldac,
+                                                       float*          A,
+                                                       int             lda,
+                                                       hipblasStride   strideA,
+                                                       int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeunpackCompact(hipblasHandle_t handle,
+                                                       int             m,
+                                                       int             n,
+                                                       const double*   Ac,
+                                                       int             ldac,
+                                                       double*         A,
+                                                       int             lda,
+                                                       hipblasStride   strideA,
+                                                       int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeunpackCompact(hipblasHandle_t       handle,
+                                                       int                   m,
+                                                       int                   n,
+                                                       const hipblasComplex* Ac,
+                                                       int                   ldac,
+                                                       hipblasComplex*       A,
+                                                       int                   lda,
+                                                       hipblasStride         strideA,
+                                                       int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeunpackCompact(hipblasHandle_t             handle,
+                                                       int                         m,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* Ac,
+                                                       int                         ldac,
+                                                       hipblasDoubleComplex*       A,
+                                                       int                         lda,
+                                                       hipblasStride               strideA,
+                                                       int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmBatchedVec performs the matrix-matrix operations
+
+        C_i = alpha_i*op( A_i )*op( B_i ) + beta_i*C_i, for i = 1, ..., batchCount,
+
+    as hipblasXgemmBatched, but with alpha and beta arrays of batchCount scalars indexed by
+    batch, in host or device memory as the pointer mode says.
+
+    With host scalars the scaling is applied on the device, in a number of calls that does
+    not grow with batchCount: one hipblasXgemmBatched writes the products
+    op( A_i )*op( B_i ) to the handle's workspace, or straight to C when every beta_i is
+    zero, and hipblasXdgmm, hipblasXdgmmBatched and hipblasXgeamBatched scale them and C_i
+    and add them. C_i is not read where beta_i is zero: those members are first copied to
+    the workspace and cleared there with one hipblasXgeamBatched. When all scalars are equal
+    this is a single hipblasXgemmBatched call. With device scalars the members run one at a
+    time through hipblasXgemmBatched, so the scalars are not read back to the host and the
+    function does not wait for the device. Backends without hipblasXdgmmBatched or
+    hipblasXgeamBatched read the pointer arrays to the host and take those steps one member
+    at a time.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatchedVec(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const float*       alpha,
+                                                      const float* const A[],
+                                                      int                lda,
+                                                      const float* const B[],
+                                                      int                ldb,
+                                                      const float*       beta,
+                                                      float* const       C[],
+                                                      int                ldc,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatchedVec(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      const double*       alpha,
+                                                      const double* const A[],
+                                                      int                 lda,
+                                                      const double* const B[],
+                                                      int                 ldb,
+                                                      const double*       beta,
+                                                      double* const       C[],
+                                                      int                 ldc,
+                                                      int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatchedVec(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const A[],
+                                                      int                         lda,
+                                                      const hipblasComplex* const B[],
+                                                      int                         ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       C[],
+                                                      int                         ldc,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatchedVec(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int                               m,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const A[],
+                                                      int                               lda,
+                                                      const hipblasDoubleComplex* const B[],
+                                                      int                               ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       C[],
+                                                      int                               ldc,
+                                                      int                               batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmStridedBatchedVec performs the matrix-matrix operations
+
+        C_i = alpha_i*op( A_i )*op( B_i ) + beta_i*C_i, for i = 1, ..., batchCount,
+
+    as hipblasXgemmStridedBatched, but with alpha and beta arrays of batchCount scalars
+    indexed by batch, in host or device memory as the pointer mode says.
+
+    With host scalars the scaling is applied to the whole batch at once: the products
+    op( A_i )*op( B_i ) go to the handle's workspace, or straight to C when every beta_i is
+    zero, and hipblasXdgmm and hipblasXgeam scale and add them with each column of C across
+    the batch as one matrix, the number of calls being fixed rather than growing with
+    batchCount. C_i is not read where beta_i is zero: those members are first cleared with
+    one hipblasXgeamBatched. With device scalars the members run one at a time through
+    hipblasXgemm, so the scalars are not read back to the host and the function does not
+    wait for the device. A_i and B_i are read even where alpha_i is zero. The C_i must not
+    overlap.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const float*       alpha,
+                                                             const float*       A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       B,
+                                                             int                ldb,
+                                                             hipblasStride      strideB,
+                                                             const float*       beta,
+                                                             float*             C,
+                                                             int                ldc,
+                                                             hipblasStride      strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const double*      alpha,
+                                                             const double*      A,
+                                                             int                lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      B,
+                                                             int                ldb,
+                                                             hipblasStride      strideB,
+                                                             const double*      beta,
+                                                             double*            C,
+                                                             int                ldc,
+                                                             hipblasStride      strideC,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatchedVec(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int                   m,
+                                                             int                   n,
+                                                             int                   k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* A,
+                                                             int                   lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* B,
+                                                             int                   ldb,
+                                                             hipblasStride         strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       C,
+                                                             int                   ldc,
+                                                             hipblasStride         strideC,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmStridedBatchedVec(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  hipblasOperation_t          transB,
+                                  int                         m,
+                                  int                         n,
+                                  int                         k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* A,
+                                  int                         lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* B,
+                                  int                         ldb,
+                                  hipblasStride               strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       C,
+                                  int                         ldc,
+                                  hipblasStride               strideC,
+                                  int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    axpyBatchedVec computes
+
+        y_i = alpha_i*x_i + y_i, for i = 1, ..., batchCount,
+
+    as hipblasXaxpyBatched, but with alpha an array of batchCount scalars indexed by batch,
+    in host or device memory as the pointer mode says. With positive increments each member
+    is scaled into the handle's workspace with one hipblasXdgmmBatched and added to y_i with
+    one hipblasXgeamBatched, without reading the scalars back or waiting for the device;
+    other increments read the pointer arrays and run one hipblasXaxpy per member.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatchedVec(hipblasHandle_t    handle,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int                incx,
+                                                      float* const       y[],
+                                                      int                incy,
+                                                      int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatchedVec(hipblasHandle_t     handle,
+                                                      int                 n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int                 incx,
+                                                      double* const       y[],
+                                                      int                 incy,
+                                                      int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatchedVec(hipblasHandle_t             handle,
+                                                      int                         n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      hipblasComplex* const       y[],
+                                                      int                         incy,
+                                                      int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatchedVec(hipblasHandle_t                   handle,
+                                                      int                               n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int                               incy,
+                                                      int                               batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    axpyStridedBatchedVec computes
+
+        y_i = alpha_i*x_i + y_i, for i = 1, ..., batchCount,
+
+    as hipblasXaxpyStridedBatched, but with alpha an array of batchCount scalars indexed by
+    batch, in host or device memory as the pointer mode says. With unit increments the batch
+    is treated as one n by batchCount matrix, scaled into the handle's workspace with
+    hipblasXdgmm and added to y with hipblasXgeam; other layouts run one hipblasXaxpy per
+    member.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int             incy,
+                                                             hipblasStride   stridey,
+                                                             int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int             incy,
+                                                             hipblasStride   stridey,
+                                                             int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatchedVec(hipblasHandle_t       handle,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int                   incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int                   incy,
+                                                             hipblasStride         stridey,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyStridedBatchedVec(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int                         incy,
+                                  hipblasStride               stridey,
+                                  int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    scalBatchedVec computes
+
+        x_i = alpha_i*x_i, for i = 1, ..., batchCount,
+
+    as hipblasXscalBatched, but with alpha an array of batchCount scalars indexed by batch,
+    in host or device memory as the pointer mode says. The members are scaled in place by
+    one hipblasXdgmmBatched, without reading the scalars back or waiting for the device.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatchedVec(hipblasHandle_t handle,
+                                                      int             n,
+                                                      const float*    alpha,
+                                                      float* const    x[],
+                                                      int             incx,
+                                                      int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatchedVec(hipblasHandle_t handle,
+                                                      int             n,
+                                                      const double*   alpha,
+                                                      double* const   x[],
+                                                      int             incx,
+                                                      int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatchedVec(hipblasHandle_t       handle,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const x[],
+                                                      int                   incx,
+                                                      int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatchedVec(hipblasHandle_t             handle,
+                                                      int                         n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int                         incx,
+                                                      int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 1 API
+
+    \details
+    scalStridedBatchedVec computes
+
+        x_i = alpha_i*x_i, for i = 1, ..., batchCount,
+
+    as hipblasXscalStridedBatched, but with alpha an array of batchCount scalars indexed by
+    batch, in host or device memory as the pointer mode says. With a unit increment the
+    batch is treated as one n by batchCount matrix and scaled in place by a single
+    hipblasXdgmm; other layouts run one hipblasXscal per member.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Supported precisions in cuBLAS  : s,d,c,z
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatchedVec(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const float*    alpha,
+                                                             float*          x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatchedVec(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const double*   alpha,
+                                                             double*         x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatchedVec(hipblasHandle_t       handle,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       x,
+                                                             int                   incx,
+                                                             hipblasStride         stridex,
+                                                             int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZscalStridedBatchedVec(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* alpha,
+                                  hipblasDoubleComplex*       x,
+                                  int                         incx,
+                                  hipblasStride               stridex,
+                                  int                         batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gemmBatchedExVec performs the matrix-matrix operations
+
+        C_i = alpha_i*op( A_i )*op( B_i ) + beta_i*C_i, for i = 1, ..., batchCount,
+
+    as hipblasGemmBatchedEx, but with alpha and beta arrays of batchCount scalars of
+    computeType indexed by batch, in host or device memory as the pointer mode says.
+    When cType is computeType and that is HIPBLAS_R_32F, HIPBLAS_R_64F, HIPBLAS_C_32F or
+    HIPBLAS_C_64F, the scaling is applied on the device as in hipblasXgemmBatchedVec, after
+    one hipblasGemmBatchedEx computing the products, or with device scalars one member at
+    a time through hipblasGemmBatchedEx. Otherwise the scalars are read to the
+    host, which in device pointer mode waits for the handle's stream, and members sharing
+    the same alpha_i and beta_i run as one hipblasGemmBatchedEx call.
+
+    - Supported precisions in rocBLAS : same as hipblasGemmBatchedEx
+    - Supported precisions in cuBLAS  : same as hipblasGemmBatchedEx
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExVec(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int                m,
+                                                       int                n,
+                                                       int                k,
+                                                       const void*        alpha,
+                                                       const void*        A[],
+                                                       hipblasDatatype_t  aType,
+                                                       int                lda,
+                                                       const void*        B[],
+                                                       hipblasDatatype_t  bType,
+                                                       int                ldb,
+                                                       const void*        beta,
+                                                       void*              C[],
+                                                       hipblasDatatype_t  cType,
+                                                       int                ldc,
+                                                       int                batchCount,
+                                                       hipblasDatatype_t  computeType,
+                                                       hipblasGemmAlgo_t  algo);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gemmStridedBatchedExVec performs the matrix-matrix operations
+
+        C_i = alpha_i*op( A_i )*op( B_i ) + beta_i*C_i, for i = 1, ..., batchCount,
+
+    as hipblasGemmStridedBatchedEx, but with alpha and beta arrays of batchCount scalars of
+    computeType indexed by batch, in host or device memory as the pointer mode says.
+    When cType is computeType and that is HIPBLAS_R_32F, HIPBLAS_R_64F, HIPBLAS_C_32F or
+    HIPBLAS_C_64F, the scaling is applied on the device as in hipblasXgemmStridedBatchedVec,
+    after one hipblasGemmStridedBatchedEx computing the products, or with device scalars
+    one member at a time through hipblasGemmEx. Otherwise the scalars are
+    read to the host, which in device pointer mode waits for the handle's stream, and
+    members sharing the same alpha_i and beta_i run as one hipblasGemmBatchedEx call on
+    pointer arrays built from the strides. When all scalars are equal on the host this is a
+    single hipblasGemmStridedBatchedEx call.
+
+    - Supported precisions in rocBLAS : same as hipblasGemmStridedBatchedEx
+    - Supported precisions in cuBLAS  : same as hipblasGemmStridedBatchedEx
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExVec(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int                m,
+                                                              int                n,
+                                                              int                k,
+                                                              const void*        alpha,
+                                                              const void*        A,
+                                                              hipblasDatatype_t  aType,
+                                                              int                lda,
+                                                              hipblasStride      strideA,
+                                                              const void*        B,
+                                                              hipblasDatatype_t  bType,
+                                                              int                ldb,
+                                                              hipblasStride      strideB,
+                                                              const void*        beta,
+                                                              void*              C,
+                                                              hipblasDatatype_t  cType,
+                                                              int                ldc,
+                                                              hipblasStride      strideC,
+                                                              int                batchCount,
+                                                              hipblasDatatype_t  computeType,
+                                                              hipblasGemmAlgo_t  algo);
+//! @}
+
+/*! @{
+    \brief BLAS EX API
+
+    \details
+    gemmScaledEx performs the matrix-matrix operation
+
+        C = alpha*diag( rowScale )*op( A )*op( B )*diag( colScale ) + beta*C,
+
+    as hipblasGemmEx with per-row and per-column scale vectors applied to the product, as
+    needed to dequantize an int8 GEMM. rowScale holds m and colScale n elements of cType in
+    device memory; either may be nullptr to leave that side unscaled, and with both nullptr
+    this is hipblasGemmEx. A bias can be added through beta*C.
+
+    For a cType of HIPBLAS_R_32F, HIPBLAS_R_64F, HIPBLAS_C_32F or HIPBLAS_C_64F matching the
+    compute type, there is one hipblasGemmEx: with aType and bType equal to cType,
+    diag( colScale ) is applied to a copy of op( B ) with dgmm ahead of it, and the GEMM writes
+    C directly unless rowScale is given. Otherwise the product goes to a cType workspace,
+    where dgmm applies the remaining diagonals, and geam adds it to beta*C. Half-precision
+    cTypes scale with strided-batched GEMMs of k = 1. The copies live in the handle's
+    workspace and the call does not wait for the stream.
+
+    - Supported precisions in rocBLAS : those of hipblasGemmEx with aType, bType and cType equal
+    - Supported precisions in cuBLAS  : as rocBLAS, and int8 inputs with float output
+
+    rocBLAS has no int8 GEMM with a floating-point output, and hipBLAS has no kernel to
+    convert an int32 product, so on the rocBLAS backend int8 inputs with a floating-point
+    cType return HIPBLAS_STATUS_NOT_SUPPORTED before any work is queued.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmScaledEx(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const void*        alpha,
+                                                   const void*        A,
+                                                   hipblasDatatype_t  aType,
+                                                   int                lda,
+                                                   const void*        B,
+                                                   hipblasDatatype_t  bType,
+                                                   int                ldb,
+                                                   const void*        beta,
+                                                   void*              C,
+                                                   hipblasDatatype_t  cType,
+                                                   int                ldc,
+                                                   const void*        rowScale,
+                                                   const void*        colScale,
+                                                   hipblasDatatype_t  computeType,
+                                                   hipblasGemmAlgo_t  algo);
+//! @}
+
 /*! HIPBLAS Auxiliary API
 
     \details
@@ -21,15 +21,31 @@
  *
  * ************************************************************************ */
 #include "hipblas.h"
+#include "deferred.hpp"
 #include "exceptions.hpp"
+#include "fast_float32.hpp"
+#include "gemm_broadcast.hpp"
+#include "graph.hpp"
+#include "half_complex.hpp"
+#include "handle_state.hpp"
+#include "logging.hpp"
+#include "managed_memory.hpp"
+#include "matmul_plan.hpp"
+#include "staging.hpp"
+#include "symmetric_gemm.hpp"
+#include "thread_stream.hpp"
 #include "limits.h"
 #include "rocblas/rocblas.h"
 #ifdef __HIP_PLATFORM_SOLVER__
 #include "rocsolver/rocsolver.h"
 #endif
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <math.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 extern "C" hipblasStatus_t rocBLASStatusToHIPStatus(rocblas_status_ error);
 
@@ -392,6 +408,7 @@ hipblasStatus_t rocBLASStatusToHIPStatus(rocblas_status_ error)
 hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     if(!handle)
         return HIPBLAS_STATUS_HANDLE_IS_NULLPTR;
 
@@ -406,6 +423,9 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_erase_handle_state(handle);
     return rocBLASStatusToHIPStatus(rocblas_destroy_handle((rocblas_handle)handle));
 }
 catch(...)
@@ -416,6 +436,9 @@ catch(...)
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(handle == nullptr)
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
@@ -430,6 +453,9 @@ catch(...)
 hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(handle == nullptr)
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
@@ -444,6 +470,9 @@ catch(...)
 hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_set_pointer_mode((rocblas_handle)handle, HIPPointerModeToRocblasPointerMode(mode)));
 }
@@ -455,6 +484,9 @@ catch(...)
 hipblasStatus_t hipblasGetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t* mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     rocblas_pointer_mode rocblas_mode;
     rocblas_status       status = rocblas_get_pointer_mode((rocblas_handle)handle, &rocblas_mode);
     *mode                       = RocblasPointerModeToHIPPointerMode(rocblas_mode);
@@ -468,6 +500,9 @@ catch(...)
 hipblasStatus_t hipblasSetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t int8Type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_set_int8_type_for_hipblas(
         (rocblas_handle)handle, HIPInt8DatatypeToRocblasInt8Datatype(int8Type)));
 }
@@ -479,6 +514,9 @@ catch(...)
 hipblasStatus_t hipblasGetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t* int8Type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     rocblas_int8_type_for_hipblas rocblas_type;
     rocblas_status                status
         = rocblas_get_int8_type_for_hipblas((rocblas_handle)handle, &rocblas_type);
@@ -493,6 +531,9 @@ catch(...)
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(true, n, 1, elemSize, x, incx, 0, y, incy, 0, nullptr, false);
     return rocBLASStatusToHIPStatus(rocblas_set_vector(n, elemSize, x, incx, y, incy));
 }
 catch(...)
@@ -503,6 +544,9 @@ catch(...)
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(false, n, 1, elemSize, x, incx, 0, y, incy, 0, nullptr, false);
     return rocBLASStatusToHIPStatus(rocblas_get_vector(n, elemSize, x, incx, y, incy));
 }
 catch(...)
@@ -514,6 +558,9 @@ hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(true, rows, cols, elemSize, A, 1, lda, B, 1, ldb, nullptr, false);
     return rocBLASStatusToHIPStatus(rocblas_set_matrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -525,6 +572,9 @@ hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(false, rows, cols, elemSize, A, 1, lda, B, 1, ldb, nullptr, false);
     return rocBLASStatusToHIPStatus(rocblas_get_matrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -536,6 +586,9 @@ hipblasStatus_t hipblasSetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(true, n, 1, elemSize, x, incx, 0, y, incy, 0, stream, true);
     return rocBLASStatusToHIPStatus(
         rocblas_set_vector_async(n, elemSize, x, incx, y, incy, stream));
 }
@@ -548,6 +601,9 @@ hipblasStatus_t hipblasGetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(false, n, 1, elemSize, x, incx, 0, y, incy, 0, stream, true);
     return rocBLASStatusToHIPStatus(
         rocblas_get_vector_async(n, elemSize, x, incx, y, incy, stream));
 }
@@ -560,6 +616,9 @@ hipblasStatus_t hipblasSetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(true, rows, cols, elemSize, A, 1, lda, B, 1, ldb, stream, true);
     return rocBLASStatusToHIPStatus(
         rocblas_set_matrix_async(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -572,6 +631,9 @@ hipblasStatus_t hipblasGetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(false, rows, cols, elemSize, A, 1, lda, B, 1, ldb, stream, true);
     return rocBLASStatusToHIPStatus(
         rocblas_get_matrix_async(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -584,6 +646,9 @@ catch(...)
 hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_set_atomics_mode(
         (rocblas_handle)handle, HIPAtomicsModeToRocblasAtomicsMode(atomics_mode)));
 }
@@ -595,6 +660,9 @@ catch(...)
 hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_get_atomics_mode((rocblas_handle)handle, (rocblas_atomics_mode*)atomics_mode));
 }
@@ -607,6 +675,9 @@ catch(...)
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -617,6 +688,9 @@ catch(...)
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -628,6 +702,9 @@ hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
 }
@@ -640,6 +717,9 @@ hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
 }
@@ -653,6 +733,9 @@ hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -665,6 +748,9 @@ hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -681,6 +767,9 @@ hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                      int*                        result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_icamax_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
 }
@@ -697,6 +786,9 @@ hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                      int*                              result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_izamax_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
 }
@@ -715,6 +807,9 @@ hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_isamax_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -732,6 +827,9 @@ hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_idamax_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -749,6 +847,9 @@ hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                             int*                  result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_icamax_strided_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
 }
@@ -766,6 +867,9 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                             int*                        result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_izamax_strided_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
 }
@@ -778,6 +882,9 @@ catch(...)
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_isamin((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -788,6 +895,9 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_idamin((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -799,6 +909,9 @@ hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_icamin((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
 }
@@ -811,6 +924,9 @@ hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_izamin((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
 }
@@ -824,6 +940,9 @@ hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_isamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -836,6 +955,9 @@ hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_idamin_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -852,6 +974,9 @@ hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                      int*                        result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_icamin_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
 }
@@ -868,6 +993,9 @@ hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                      int*                              result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_izamin_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
 }
@@ -886,6 +1014,9 @@ hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_isamin_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -903,6 +1034,9 @@ hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                             int*            result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_idamin_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -920,6 +1054,9 @@ hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             int*                  result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_icamin_strided_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
 }
@@ -937,6 +1074,9 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                             int*                        result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_izamin_strided_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
 }
@@ -949,6 +1089,9 @@ catch(...)
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sasum((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -960,6 +1103,9 @@ hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dasum((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -971,6 +1117,9 @@ hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_scasum((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
 }
@@ -983,6 +1132,9 @@ hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dzasum((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
 }
@@ -996,6 +1148,9 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -1012,6 +1167,9 @@ hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                     double*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dasum_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -1028,6 +1186,9 @@ hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                      float*                      result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scasum_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
 }
@@ -1044,6 +1205,9 @@ hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                      double*                           result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dzasum_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
 }
@@ -1062,6 +1226,9 @@ hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
                                            float*          result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sasum_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -1079,6 +1246,9 @@ hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                            double*         result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dasum_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -1096,6 +1266,9 @@ hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                             float*                result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scasum_strided_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
 }
@@ -1113,6 +1286,9 @@ hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                             double*                     result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dzasum_strided_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
 }
@@ -1131,6 +1307,9 @@ hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_haxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_half*)alpha,
@@ -1148,6 +1327,9 @@ hipblasStatus_t hipblasSaxpy(
     hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 's', n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(
         rocblas_saxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
 }
@@ -1165,6 +1347,9 @@ hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                              int             incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'd', n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(
         rocblas_daxpy((rocblas_handle)handle, n, alpha, x, incx, y, incy));
 }
@@ -1182,6 +1367,9 @@ hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'c', n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_caxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)alpha,
@@ -1204,6 +1392,9 @@ hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'z', n, alpha, x, incx, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)alpha,
@@ -1228,6 +1419,9 @@ hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_haxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_half*)alpha,
@@ -1252,6 +1446,9 @@ hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_saxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
 }
@@ -1270,6 +1467,9 @@ hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_daxpy_batched((rocblas_handle)handle, n, alpha, x, incx, y, incy, batchCount));
 }
@@ -1288,6 +1488,9 @@ hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_caxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex*)alpha,
@@ -1312,6 +1515,9 @@ hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex*)alpha,
@@ -1339,6 +1545,9 @@ hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_haxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_half*)alpha,
@@ -1367,6 +1576,9 @@ hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_saxpy_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1387,6 +1599,9 @@ hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_daxpy_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1407,6 +1622,9 @@ hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_caxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)alpha,
@@ -1435,6 +1653,9 @@ hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zaxpy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)alpha,
@@ -1456,6 +1677,9 @@ hipblasStatus_t
     hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scopy((rocblas_handle)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -1467,6 +1691,9 @@ hipblasStatus_t
     hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dcopy((rocblas_handle)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -1478,6 +1705,9 @@ hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ccopy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -1498,6 +1728,9 @@ hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zcopy((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -1520,6 +1753,9 @@ hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_scopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -1537,6 +1773,9 @@ hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dcopy_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -1554,6 +1793,9 @@ hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ccopy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -1576,6 +1818,9 @@ hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zcopy_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -1601,6 +1846,9 @@ hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scopy_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1620,6 +1868,9 @@ hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dcopy_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -1639,6 +1890,9 @@ hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ccopy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -1665,6 +1919,9 @@ hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zcopy_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -1690,6 +1947,9 @@ hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                             hipblasHalf*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_hdot((rocblas_handle)handle,
                                                  n,
                                                  (rocblas_half*)x,
@@ -1712,6 +1972,9 @@ hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                              hipblasBfloat16*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_bfdot((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_bfloat16*)x,
@@ -1734,6 +1997,9 @@ hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                             float*          result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(dot, handle, 's', n, x, incx, y, incy, result);
     return rocBLASStatusToHIPStatus(
         rocblas_sdot((rocblas_handle)handle, n, x, incx, y, incy, result));
 }
@@ -1751,6 +2017,9 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                             double*         result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(dot, handle, 'd', n, x, incx, y, incy, result);
     return rocBLASStatusToHIPStatus(
         rocblas_ddot((rocblas_handle)handle, n, x, incx, y, incy, result));
 }
@@ -1768,6 +2037,9 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotc((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -1790,6 +2062,9 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotu((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -1812,6 +2087,9 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotc((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -1834,6 +2112,9 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotu((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -1858,6 +2139,9 @@ hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                    hipblasHalf*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_hdot_batched((rocblas_handle)handle,
                                                          n,
                                                          (rocblas_half* const*)x,
@@ -1882,6 +2166,9 @@ hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                     hipblasBfloat16*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_bfdot_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_bfloat16* const*)x,
@@ -1906,6 +2193,9 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sdot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
 }
@@ -1924,6 +2214,9 @@ hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                    double*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ddot_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount, result));
 }
@@ -1942,6 +2235,9 @@ hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotc_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -1966,6 +2262,9 @@ hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotu_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -1990,6 +2289,9 @@ hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotc_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -2014,6 +2316,9 @@ hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotu_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -2041,6 +2346,9 @@ hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
                                           hipblasHalf*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_hdot_strided_batched((rocblas_handle)handle,
                                                                  n,
                                                                  (rocblas_half*)x,
@@ -2069,6 +2377,9 @@ hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                            hipblasBfloat16*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_bfdot_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_bfloat16*)x,
@@ -2097,6 +2408,9 @@ hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                           float*          result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sdot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
 }
@@ -2117,6 +2431,9 @@ hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                           double*         result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ddot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount, result));
 }
@@ -2137,6 +2454,9 @@ hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotc_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -2165,6 +2485,9 @@ hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdotu_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -2193,6 +2516,9 @@ hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotc_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -2221,6 +2547,9 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdotu_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -2241,6 +2570,9 @@ catch(...)
 hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_snrm2((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -2252,6 +2584,9 @@ hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dnrm2((rocblas_handle)handle, n, x, incx, result));
 }
 catch(...)
@@ -2263,6 +2598,9 @@ hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_scnrm2((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
 }
@@ -2275,6 +2613,9 @@ hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dznrm2((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
 }
@@ -2288,6 +2629,9 @@ hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_snrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -2304,6 +2648,9 @@ hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                     double*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dnrm2_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
 }
@@ -2320,6 +2667,9 @@ hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                      float*                      result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scnrm2_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex* const*)x, incx, batchCount, result));
 }
@@ -2336,6 +2686,9 @@ hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                      double*                           result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dznrm2_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex* const*)x, incx, batchCount, result));
 }
@@ -2354,6 +2707,9 @@ hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
                                            float*          result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_snrm2_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -2371,6 +2727,9 @@ hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                            double*         result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dnrm2_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, batchCount, result));
 }
@@ -2388,6 +2747,9 @@ hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             float*                result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_scnrm2_strided_batched(
         (rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, stridex, batchCount, result));
 }
@@ -2405,6 +2767,9 @@ hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                             double*                     result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dznrm2_strided_batched(
         (rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, stridex, batchCount, result));
 }
@@ -2424,6 +2789,9 @@ hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                             const float*    s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
 }
@@ -2442,6 +2810,9 @@ hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                             const double*   s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drot((rocblas_handle)handle, n, x, incx, y, incy, c, s));
 }
@@ -2460,6 +2831,9 @@ hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                             const hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crot((rocblas_handle)handle,
                                                  n,
                                                  (rocblas_float_complex*)x,
@@ -2484,6 +2858,9 @@ hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                              const float*    s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csrot((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -2508,6 +2885,9 @@ hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                             const hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrot((rocblas_handle)handle,
                                                  n,
                                                  (rocblas_double_complex*)x,
@@ -2532,6 +2912,9 @@ hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                              const double*         s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdrot((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -2558,6 +2941,9 @@ hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                    int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
 }
@@ -2577,6 +2963,9 @@ hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                    int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drot_batched((rocblas_handle)handle, n, x, incx, y, incy, c, s, batchCount));
 }
@@ -2596,6 +2985,9 @@ hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                    int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crot_batched((rocblas_handle)handle,
                                                          n,
                                                          (rocblas_float_complex**)x,
@@ -2622,6 +3014,9 @@ hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csrot_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -2648,6 +3043,9 @@ hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrot_batched((rocblas_handle)handle,
                                                          n,
                                                          (rocblas_double_complex**)x,
@@ -2674,6 +3072,9 @@ hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdrot_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -2703,6 +3104,9 @@ hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
 }
@@ -2724,6 +3128,9 @@ hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drot_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, c, s, batchCount));
 }
@@ -2745,6 +3152,9 @@ hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crot_strided_batched((rocblas_handle)handle,
                                                                  n,
                                                                  (rocblas_float_complex*)x,
@@ -2775,6 +3185,9 @@ hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csrot_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -2805,6 +3218,9 @@ hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrot_strided_batched((rocblas_handle)handle,
                                                                  n,
                                                                  (rocblas_double_complex*)x,
@@ -2835,6 +3251,9 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdrot_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -2856,6 +3275,9 @@ catch(...)
 hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srotg((rocblas_handle)handle, a, b, c, s));
 }
 catch(...)
@@ -2866,6 +3288,9 @@ catch(...)
 hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drotg((rocblas_handle)handle, a, b, c, s));
 }
 catch(...)
@@ -2877,6 +3302,9 @@ hipblasStatus_t hipblasCrotg(
     hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crotg((rocblas_handle)handle,
                                                   (rocblas_float_complex*)a,
                                                   (rocblas_float_complex*)b,
@@ -2895,6 +3323,9 @@ hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
                              hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrotg((rocblas_handle)handle,
                                                   (rocblas_double_complex*)a,
                                                   (rocblas_double_complex*)b,
@@ -2915,6 +3346,9 @@ hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
 }
@@ -2931,6 +3365,9 @@ hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drotg_batched((rocblas_handle)handle, a, b, c, s, batchCount));
 }
@@ -2947,6 +3384,9 @@ hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crotg_batched((rocblas_handle)handle,
                                                           (rocblas_float_complex**)a,
                                                           (rocblas_float_complex**)b,
@@ -2967,6 +3407,9 @@ hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrotg_batched((rocblas_handle)handle,
                                                           (rocblas_double_complex**)a,
                                                           (rocblas_double_complex**)b,
@@ -2992,6 +3435,9 @@ hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srotg_strided_batched(
         (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
 }
@@ -3012,6 +3458,9 @@ hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drotg_strided_batched(
         (rocblas_handle)handle, a, stride_a, b, stride_b, c, stride_c, s, stride_s, batchCount));
 }
@@ -3032,6 +3481,9 @@ hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_crotg_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_float_complex*)a,
                                                                   stride_a,
@@ -3060,6 +3512,9 @@ hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zrotg_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_double_complex*)a,
                                                                   stride_a,
@@ -3081,6 +3536,9 @@ hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srotm((rocblas_handle)handle, n, x, incx, y, incy, param));
 }
@@ -3093,6 +3551,9 @@ hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drotm((rocblas_handle)handle, n, x, incx, y, incy, param));
 }
@@ -3112,6 +3573,9 @@ hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
 }
@@ -3130,6 +3594,9 @@ hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drotm_batched((rocblas_handle)handle, n, x, incx, y, incy, param, batchCount));
 }
@@ -3152,6 +3619,9 @@ hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srotm_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   x,
@@ -3182,6 +3652,9 @@ hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drotm_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   x,
@@ -3204,6 +3677,9 @@ hipblasStatus_t hipblasSrotmg(
     hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -3215,6 +3691,9 @@ hipblasStatus_t hipblasDrotmg(
     hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drotmg((rocblas_handle)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -3232,6 +3711,9 @@ hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_srotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
 }
@@ -3249,6 +3731,9 @@ hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_drotmg_batched((rocblas_handle)handle, d1, d2, x1, y1, param, batchCount));
 }
@@ -3272,6 +3757,9 @@ hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_srotmg_strided_batched((rocblas_handle)handle,
                                                                    d1,
                                                                    stride_d1,
@@ -3304,6 +3792,9 @@ hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_drotmg_strided_batched((rocblas_handle)handle,
                                                                    d1,
                                                                    stride_d1,
@@ -3326,6 +3817,9 @@ catch(...)
 hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 's', n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_sscal((rocblas_handle)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -3337,6 +3831,9 @@ hipblasStatus_t
     hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'd', n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_dscal((rocblas_handle)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -3348,6 +3845,9 @@ hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'c', n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_cscal(
         (rocblas_handle)handle, n, (rocblas_float_complex*)alpha, (rocblas_float_complex*)x, incx));
 }
@@ -3360,6 +3860,9 @@ hipblasStatus_t
     hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_csscal((rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx));
 }
@@ -3375,6 +3878,9 @@ hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'z', n, alpha, x, incx);
     return rocBLASStatusToHIPStatus(rocblas_zscal((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)alpha,
@@ -3390,6 +3896,9 @@ hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zdscal((rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx));
 }
@@ -3403,6 +3912,9 @@ hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
 }
@@ -3415,6 +3927,9 @@ hipblasStatus_t hipblasDscalBatched(
     hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dscal_batched((rocblas_handle)handle, n, alpha, x, incx, batchCount));
 }
@@ -3431,6 +3946,9 @@ hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cscal_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex*)alpha,
@@ -3451,6 +3969,9 @@ hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zscal_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex*)alpha,
@@ -3471,6 +3992,9 @@ hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                      int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csscal_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_float_complex* const*)x, incx, batchCount));
 }
@@ -3487,6 +4011,9 @@ hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdscal_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_double_complex* const*)x, incx, batchCount));
 }
@@ -3505,6 +4032,9 @@ hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sscal_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
 }
@@ -3522,6 +4052,9 @@ hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dscal_strided_batched(
         (rocblas_handle)handle, n, alpha, x, incx, stridex, batchCount));
 }
@@ -3539,6 +4072,9 @@ hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cscal_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)alpha,
@@ -3561,6 +4097,9 @@ hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zscal_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)alpha,
@@ -3583,6 +4122,9 @@ hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                             int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csscal_strided_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_float_complex*)x, incx, stridex, batchCount));
 }
@@ -3600,6 +4142,9 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdscal_strided_batched(
         (rocblas_handle)handle, n, alpha, (rocblas_double_complex*)x, incx, stridex, batchCount));
 }
@@ -3612,6 +4157,9 @@ catch(...)
 hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sswap((rocblas_handle)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -3623,6 +4171,9 @@ hipblasStatus_t
     hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dswap((rocblas_handle)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -3634,6 +4185,9 @@ hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cswap((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_float_complex*)x,
@@ -3654,6 +4208,9 @@ hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zswap((rocblas_handle)handle,
                                                   n,
                                                   (rocblas_double_complex*)x,
@@ -3671,6 +4228,9 @@ hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -3683,6 +4243,9 @@ hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dswap_batched((rocblas_handle)handle, n, x, incx, y, incy, batchCount));
 }
@@ -3700,6 +4263,9 @@ hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                     int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cswap_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_float_complex**)x,
@@ -3722,6 +4288,9 @@ hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                     int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zswap_batched((rocblas_handle)handle,
                                                           n,
                                                           (rocblas_double_complex**)x,
@@ -3747,6 +4316,9 @@ hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sswap_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -3766,6 +4338,9 @@ hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dswap_strided_batched(
         (rocblas_handle)handle, n, x, incx, stridex, y, incy, stridey, batchCount));
 }
@@ -3785,6 +4360,9 @@ hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                            int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cswap_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_float_complex*)x,
@@ -3811,6 +4389,9 @@ hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zswap_strided_batched((rocblas_handle)handle,
                                                                   n,
                                                                   (rocblas_double_complex*)x,
@@ -3843,6 +4424,9 @@ hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3879,6 +4463,9 @@ hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3915,6 +4502,9 @@ hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3951,6 +4541,9 @@ hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -3989,6 +4582,9 @@ hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4027,6 +4623,9 @@ hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4065,6 +4664,9 @@ hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4103,6 +4705,9 @@ hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4145,6 +4750,9 @@ hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4189,6 +4797,9 @@ hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4233,6 +4844,9 @@ hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4277,6 +4891,9 @@ hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgbmv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4316,6 +4933,9 @@ hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 's', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_sgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4348,6 +4968,9 @@ hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'd', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_dgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4380,6 +5003,9 @@ hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'c', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_cgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4412,6 +5038,9 @@ hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'z', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return rocBLASStatusToHIPStatus(rocblas_zgemv((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(trans),
                                                   m,
@@ -4446,6 +5075,9 @@ hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4480,6 +5112,9 @@ hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4514,6 +5149,9 @@ hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4548,6 +5186,9 @@ hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgemv_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(trans),
                                                           m,
@@ -4586,6 +5227,9 @@ hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4626,6 +5270,9 @@ hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4666,6 +5313,9 @@ hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4706,6 +5356,9 @@ hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgemv_strided_batched((rocblas_handle)handle,
                                                                   hipOperationToHCCOperation(trans),
                                                                   m,
@@ -4741,6 +5394,9 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -4761,6 +5417,9 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -4781,6 +5440,9 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgeru((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4809,6 +5471,9 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgerc((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4837,6 +5502,9 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgeru((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4865,6 +5533,9 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgerc((rocblas_handle)handle,
                                                   m,
                                                   n,
@@ -4895,6 +5566,9 @@ hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sger_batched(
         (rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount));
 }
@@ -4916,6 +5590,9 @@ hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dger_batched(
         (rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda, batchCount));
 }
@@ -4937,6 +5614,9 @@ hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgeru_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4967,6 +5647,9 @@ hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgerc_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -4997,6 +5680,9 @@ hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgeru_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -5027,6 +5713,9 @@ hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgerc_batched((rocblas_handle)handle,
                                                           m,
                                                           n,
@@ -5061,6 +5750,9 @@ hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sger_strided_batched((rocblas_handle)handle,
                                                                  m,
                                                                  n,
@@ -5097,6 +5789,9 @@ hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                           int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dger_strided_batched((rocblas_handle)handle,
                                                                  m,
                                                                  n,
@@ -5133,6 +5828,9 @@ hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgeru_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5169,6 +5867,9 @@ hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgerc_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5205,6 +5906,9 @@ hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgeru_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5241,6 +5945,9 @@ hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgerc_strided_batched((rocblas_handle)handle,
                                                                   m,
                                                                   n,
@@ -5276,6 +5983,9 @@ hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5308,6 +6018,9 @@ hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5342,6 +6055,9 @@ hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5376,6 +6092,9 @@ hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5414,6 +6133,9 @@ hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5454,6 +6176,9 @@ hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5490,6 +6215,9 @@ hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5520,6 +6248,9 @@ hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5552,6 +6283,9 @@ hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5584,6 +6318,9 @@ hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5620,6 +6357,9 @@ hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5658,6 +6398,9 @@ hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -5690,6 +6433,9 @@ hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -5714,6 +6460,9 @@ hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -5740,6 +6489,9 @@ hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -5766,6 +6518,9 @@ hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -5795,6 +6550,9 @@ hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -5825,6 +6583,9 @@ hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -5855,6 +6616,9 @@ hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5883,6 +6647,9 @@ hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -5913,6 +6680,9 @@ hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5943,6 +6713,9 @@ hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -5977,6 +6750,9 @@ hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6013,6 +6789,9 @@ hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6046,6 +6825,9 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6074,6 +6856,9 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6104,6 +6889,9 @@ hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6134,6 +6922,9 @@ hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6168,6 +6959,9 @@ hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6204,6 +6998,9 @@ hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6234,6 +7031,9 @@ hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6256,6 +7056,9 @@ hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6280,6 +7083,9 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -6304,6 +7110,9 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -6331,6 +7140,9 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -6359,6 +7171,9 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -6387,6 +7202,9 @@ hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                              hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6413,6 +7231,9 @@ hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -6441,6 +7262,9 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6469,6 +7293,9 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6501,6 +7328,9 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chpr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6535,6 +7365,9 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhpr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6569,6 +7402,9 @@ hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -6591,6 +7427,9 @@ hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, k, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -6615,6 +7454,9 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6649,6 +7491,9 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6687,6 +7532,9 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6727,6 +7575,9 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsbmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6762,6 +7613,9 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -6782,6 +7636,9 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspmv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -6804,6 +7661,9 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6834,6 +7694,9 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -6868,6 +7731,9 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6904,6 +7770,9 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspmv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -6934,6 +7803,9 @@ hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                             float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sspr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP));
 }
@@ -6951,6 +7823,9 @@ hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                             double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dspr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP));
 }
@@ -6968,6 +7843,9 @@ hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cspr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -6990,6 +7868,9 @@ hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zspr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -7014,6 +7895,9 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP, batchCount));
 }
@@ -7032,6 +7916,9 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, AP, batchCount));
 }
@@ -7050,6 +7937,9 @@ hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cspr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7074,6 +7964,9 @@ hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zspr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7101,6 +7994,9 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7129,6 +8025,9 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7157,6 +8056,9 @@ hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7185,6 +8087,9 @@ hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zspr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7213,6 +8118,9 @@ hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                              float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sspr2((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP));
 }
@@ -7232,6 +8140,9 @@ hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                              double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dspr2((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP));
 }
@@ -7253,6 +8164,9 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspr2_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP, batchCount));
 }
@@ -7273,6 +8187,9 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspr2_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, AP, batchCount));
 }
@@ -7297,6 +8214,9 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sspr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7331,6 +8251,9 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dspr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7364,6 +8287,9 @@ hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -7385,6 +8311,9 @@ hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymv(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -7406,6 +8335,9 @@ hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -7436,6 +8368,9 @@ hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -7468,6 +8403,9 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7500,6 +8438,9 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7532,6 +8473,9 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7564,6 +8508,9 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -7600,6 +8547,9 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7638,6 +8588,9 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7676,6 +8629,9 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7714,6 +8670,9 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymv_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -7746,6 +8705,9 @@ hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda));
 }
@@ -7764,6 +8726,9 @@ hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyr((rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda));
 }
@@ -7782,6 +8747,9 @@ hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -7806,6 +8774,9 @@ hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr((rocblas_handle)handle,
                                                  (rocblas_fill)uplo,
                                                  n,
@@ -7832,6 +8803,9 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda, batchCount));
 }
@@ -7851,6 +8825,9 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr_batched(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, A, lda, batchCount));
 }
@@ -7870,6 +8847,9 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7896,6 +8876,9 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr_batched((rocblas_handle)handle,
                                                          (rocblas_fill)uplo,
                                                          n,
@@ -7925,6 +8908,9 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7955,6 +8941,9 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -7985,6 +8974,9 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -8015,6 +9007,9 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr_strided_batched((rocblas_handle)handle,
                                                                  (rocblas_fill)uplo,
                                                                  n,
@@ -8045,6 +9040,9 @@ hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -8065,6 +9063,9 @@ hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2(
         (rocblas_handle)handle, (rocblas_fill)uplo, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -8085,6 +9086,9 @@ hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -8113,6 +9117,9 @@ hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   n,
@@ -8143,6 +9150,9 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8173,6 +9183,9 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8203,6 +9216,9 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8233,6 +9249,9 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           n,
@@ -8267,6 +9286,9 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8303,6 +9325,9 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8339,6 +9364,9 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8375,6 +9403,9 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2_strided_batched((rocblas_handle)handle,
                                                                   (rocblas_fill)uplo,
                                                                   n,
@@ -8408,6 +9439,9 @@ hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8436,6 +9470,9 @@ hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8464,6 +9501,9 @@ hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8492,6 +9532,9 @@ hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztbmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8522,6 +9565,9 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8552,6 +9598,9 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8582,6 +9631,9 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8612,6 +9664,9 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztbmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8645,6 +9700,9 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_stbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8680,6 +9738,9 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8715,6 +9776,9 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8750,6 +9814,9 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztbmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -8783,6 +9850,9 @@ hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8811,6 +9881,9 @@ hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8839,6 +9912,9 @@ hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8867,6 +9943,9 @@ hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztbsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -8897,6 +9976,9 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8927,6 +10009,9 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8957,6 +10042,9 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -8987,6 +10075,9 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztbsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9020,6 +10111,9 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_stbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9055,6 +10149,9 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9090,6 +10187,9 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9125,6 +10225,9 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztbsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9156,6 +10259,9 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9180,6 +10286,9 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9204,6 +10313,9 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9228,6 +10340,9 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztpmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9254,6 +10369,9 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9280,6 +10398,9 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9306,6 +10427,9 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9332,6 +10456,9 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztpmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9361,6 +10488,9 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_stpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9392,6 +10522,9 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9423,6 +10556,9 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9454,6 +10590,9 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztpmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9483,6 +10622,9 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9507,6 +10649,9 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9531,6 +10676,9 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9555,6 +10703,9 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztpsv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9581,6 +10732,9 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_stpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9607,6 +10761,9 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9633,6 +10790,9 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9659,6 +10819,9 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztpsv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9688,6 +10851,9 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_stpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9719,6 +10885,9 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9750,6 +10919,9 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9781,6 +10953,9 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztpsv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -9811,6 +10986,9 @@ hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_strmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9837,6 +11015,9 @@ hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9863,6 +11044,9 @@ hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9889,6 +11073,9 @@ hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztrmv((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -9917,6 +11104,9 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_strmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9945,6 +11135,9 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -9973,6 +11166,9 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10001,6 +11197,9 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztrmv_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10032,6 +11231,9 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_strmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10065,6 +11267,9 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10098,6 +11303,9 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10131,6 +11339,9 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztrmv_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10162,6 +11373,9 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10189,6 +11403,9 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10216,6 +11433,9 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10243,6 +11463,9 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv((rocblas_handle)handle,
                                                (rocblas_fill)uplo,
@@ -10272,6 +11495,9 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10301,6 +11527,9 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10330,6 +11559,9 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10359,6 +11591,9 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv_batched((rocblas_handle)handle,
                                                        (rocblas_fill)uplo,
@@ -10391,6 +11626,9 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10424,6 +11662,9 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10457,6 +11698,9 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10490,6 +11734,9 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsv_strided_batched((rocblas_handle)handle,
                                                                (rocblas_fill)uplo,
@@ -10525,6 +11772,9 @@ hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cherk((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -10555,6 +11805,9 @@ hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zherk((rocblas_handle)handle,
                                                   (rocblas_fill)uplo,
                                                   hipOperationToHCCOperation(transA),
@@ -10587,6 +11840,9 @@ hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cherk_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10619,6 +11875,9 @@ hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zherk_batched((rocblas_handle)handle,
                                                           (rocblas_fill)uplo,
                                                           hipOperationToHCCOperation(transA),
@@ -10654,6 +11913,9 @@ hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_cherk_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10691,6 +11953,9 @@ hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zherk_strided_batched((rocblas_handle)handle,
                                       (rocblas_fill)uplo,
@@ -10728,6 +11993,9 @@ hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cherkx((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10762,6 +12030,9 @@ hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zherkx((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10798,6 +12069,9 @@ hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cherkx_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -10834,6 +12108,9 @@ hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zherkx_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -10874,6 +12151,9 @@ hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_cherkx_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -10917,6 +12197,9 @@ hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zherkx_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -10957,6 +12240,9 @@ hipblasStatus_t hipblasCher2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher2k((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -10991,6 +12277,9 @@ hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher2k((rocblas_handle)handle,
                                                    (rocblas_fill)uplo,
                                                    hipOperationToHCCOperation(transA),
@@ -11027,6 +12316,9 @@ hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cher2k_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -11063,6 +12355,9 @@ hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zher2k_batched((rocblas_handle)handle,
                                                            (rocblas_fill)uplo,
                                                            hipOperationToHCCOperation(transA),
@@ -11103,6 +12398,9 @@ hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_cher2k_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -11146,6 +12444,9 @@ hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zher2k_strided_batched((rocblas_handle)handle,
                                        (rocblas_fill)uplo,
@@ -11186,6 +12487,9 @@ hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11220,6 +12524,9 @@ hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11254,6 +12561,9 @@ hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11288,6 +12598,9 @@ hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -11324,6 +12637,9 @@ hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11360,6 +12676,9 @@ hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11396,6 +12715,9 @@ hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11432,6 +12754,9 @@ hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -11472,6 +12797,9 @@ hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11514,6 +12842,9 @@ hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11556,6 +12887,9 @@ hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11598,6 +12932,9 @@ hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsymm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -11635,6 +12972,9 @@ hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11665,6 +13005,9 @@ hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11695,6 +13038,9 @@ hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11725,6 +13071,9 @@ hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyrk((rocblas_handle)handle,
                                                   hipFillToHCCFill(uplo),
                                                   hipOperationToHCCOperation(transA),
@@ -11757,6 +13106,9 @@ hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11789,6 +13141,9 @@ hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11821,6 +13176,9 @@ hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11853,6 +13211,9 @@ hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyrk_batched((rocblas_handle)handle,
                                                           hipFillToHCCFill(uplo),
                                                           hipOperationToHCCOperation(transA),
@@ -11888,6 +13249,9 @@ hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11925,6 +13289,9 @@ hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11962,6 +13329,9 @@ hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_csyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -11999,6 +13369,9 @@ hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyrk_strided_batched((rocblas_handle)handle,
                                       hipFillToHCCFill(uplo),
@@ -12036,6 +13409,9 @@ hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12070,6 +13446,9 @@ hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12104,6 +13483,9 @@ hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12138,6 +13520,9 @@ hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2k((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12174,6 +13559,9 @@ hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12210,6 +13598,9 @@ hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12246,6 +13637,9 @@ hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12282,6 +13676,9 @@ hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyr2k_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12322,6 +13719,9 @@ hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12365,6 +13765,9 @@ hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12408,6 +13811,9 @@ hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_csyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12451,6 +13857,9 @@ hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyr2k_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12491,6 +13900,9 @@ hipblasStatus_t hipblasSsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12525,6 +13937,9 @@ hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12559,6 +13974,9 @@ hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12593,6 +14011,9 @@ hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyrkx((rocblas_handle)handle,
                                                    hipFillToHCCFill(uplo),
                                                    hipOperationToHCCOperation(transA),
@@ -12629,6 +14050,9 @@ hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                      int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ssyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12665,6 +14089,9 @@ hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                      int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dsyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12701,6 +14128,9 @@ hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                      int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_csyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12737,6 +14167,9 @@ hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                      int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zsyrkx_batched((rocblas_handle)handle,
                                                            hipFillToHCCFill(uplo),
                                                            hipOperationToHCCOperation(transA),
@@ -12777,6 +14210,9 @@ hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ssyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12820,6 +14256,9 @@ hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dsyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12863,6 +14302,9 @@ hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_csyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12906,6 +14348,9 @@ hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zsyrkx_strided_batched((rocblas_handle)handle,
                                        hipFillToHCCFill(uplo),
@@ -12946,6 +14391,9 @@ hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -12980,6 +14428,9 @@ hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -13014,6 +14465,9 @@ hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -13048,6 +14502,9 @@ hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgeam((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -13084,6 +14541,9 @@ hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13120,6 +14580,9 @@ hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13156,6 +14619,9 @@ hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13192,6 +14658,9 @@ hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zgeam_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -13232,6 +14701,9 @@ hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_sgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13275,6 +14747,9 @@ hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13318,6 +14793,9 @@ hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_cgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13361,6 +14839,9 @@ hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_zgeam_strided_batched((rocblas_handle)handle,
                                       hipOperationToHCCOperation(transa),
@@ -13401,6 +14882,9 @@ hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13435,6 +14919,9 @@ hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13471,6 +14958,9 @@ hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13507,6 +14997,9 @@ hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13547,6 +15040,9 @@ hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_chemm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -13589,6 +15085,9 @@ hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zhemm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   hipFillToHCCFill(uplo),
@@ -13627,6 +15126,9 @@ hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_strmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13659,6 +15161,9 @@ hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13691,6 +15196,9 @@ hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13723,6 +15231,9 @@ hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztrmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   hipFillToHCCFill(uplo),
@@ -13757,6 +15268,9 @@ hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_strmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13791,6 +15305,9 @@ hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_dtrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13825,6 +15342,9 @@ hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ctrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13859,6 +15379,9 @@ hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ztrmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           hipFillToHCCFill(uplo),
@@ -13896,6 +15419,9 @@ hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_strmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13935,6 +15461,9 @@ hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dtrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -13974,6 +15503,9 @@ hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ctrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -14013,6 +15545,9 @@ hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_ztrmm_strided_batched((rocblas_handle)handle,
                                       hipSideToHCCSide(side),
@@ -14050,6 +15585,9 @@ hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14083,6 +15621,9 @@ hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14116,6 +15657,9 @@ hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14149,6 +15693,9 @@ hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm((rocblas_handle)handle,
                                                hipSideToHCCSide(side),
@@ -14184,6 +15731,9 @@ hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14219,6 +15769,9 @@ hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14254,6 +15807,9 @@ hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                     int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14289,6 +15845,9 @@ hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm_batched((rocblas_handle)handle,
                                                        hipSideToHCCSide(side),
@@ -14327,6 +15886,9 @@ hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14366,6 +15928,9 @@ hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14405,6 +15970,9 @@ hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14444,6 +16012,9 @@ hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrsm_strided_batched((rocblas_handle)handle,
                                                                hipSideToHCCSide(side),
@@ -14477,6 +16048,9 @@ hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                               int               ldinvA)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14502,6 +16076,9 @@ hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                               int               ldinvA)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14527,6 +16104,9 @@ hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                               int                   ldinvA)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14552,6 +16132,9 @@ hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                               int                         ldinvA)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri((rocblas_handle)handle,
                                                 hipFillToHCCFill(uplo),
@@ -14579,6 +16162,9 @@ hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
                                      int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14606,6 +16192,9 @@ hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                      int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14633,6 +16222,9 @@ hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
                                      int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14660,6 +16252,9 @@ hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
                                      int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri_batched((rocblas_handle)handle,
                                                         hipFillToHCCFill(uplo),
@@ -14690,6 +16285,9 @@ hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
                                             int               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_strtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14721,6 +16319,9 @@ hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
                                             int               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_dtrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14752,6 +16353,9 @@ hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
                                             int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ctrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14783,6 +16387,9 @@ hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
                                             int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_DEMAND_ALLOC(
         rocBLASStatusToHIPStatus(rocblas_ztrtri_strided_batched((rocblas_handle)handle,
                                                                 hipFillToHCCFill(uplo),
@@ -14814,6 +16421,9 @@ hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm(
         (rocblas_handle)handle, hipSideToHCCSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -14834,6 +16444,9 @@ hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm(
         (rocblas_handle)handle, hipSideToHCCSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -14854,6 +16467,9 @@ hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   m,
@@ -14882,6 +16498,9 @@ hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm((rocblas_handle)handle,
                                                   hipSideToHCCSide(side),
                                                   m,
@@ -14912,6 +16531,9 @@ hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14942,6 +16564,9 @@ hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -14972,6 +16597,9 @@ hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -15002,6 +16630,9 @@ hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm_batched((rocblas_handle)handle,
                                                           hipSideToHCCSide(side),
                                                           m,
@@ -15036,6 +16667,9 @@ hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_sdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15072,6 +16706,9 @@ hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_ddgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15108,6 +16745,9 @@ hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_cdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15144,6 +16784,9 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_zdgmm_strided_batched((rocblas_handle)handle,
                                                                   hipSideToHCCSide(side),
                                                                   m,
@@ -15217,6 +16860,9 @@ hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
             rocsolver_sgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
@@ -15233,6 +16879,9 @@ hipblasStatus_t hipblasDgetrf(
     hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
             rocsolver_dgetrf((rocblas_handle)handle, n, n, A, lda, ipiv, info)));
@@ -15249,6 +16898,9 @@ hipblasStatus_t hipblasCgetrf(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf(
             (rocblas_handle)handle, n, n, (rocblas_float_complex*)A, lda, ipiv, info)));
@@ -15269,6 +16921,9 @@ hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
                               int*                  info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_zgetrf(
             (rocblas_handle)handle, n, n, (rocblas_double_complex*)A, lda, ipiv, info)));
@@ -15291,6 +16946,9 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_batched(
             (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
@@ -15312,6 +16970,9 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_batched(
             (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
@@ -15333,6 +16994,9 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(
             rocBLASStatusToHIPStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
@@ -15362,6 +17026,9 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(
             rocBLASStatusToHIPStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
@@ -15394,6 +17061,9 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_strided_batched(
             (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
@@ -15417,6 +17087,9 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_strided_batched(
             (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
@@ -15440,6 +17113,9 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(
             rocBLASStatusToHIPStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
@@ -15479,6 +17155,9 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(
             rocBLASStatusToHIPStatus(rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
@@ -15520,6 +17199,9 @@ hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15561,6 +17243,9 @@ hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15602,6 +17287,9 @@ hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15651,6 +17339,9 @@ hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
                               int*                     info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15702,6 +17393,9 @@ hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15756,6 +17450,9 @@ hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15810,6 +17507,9 @@ hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15864,6 +17564,9 @@ hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15922,6 +17625,9 @@ hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -15981,6 +17687,9 @@ hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -16040,6 +17749,9 @@ hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -16099,6 +17811,9 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
                                             const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
@@ -16154,6 +17869,9 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetri_outofplace_batched(
             (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
@@ -16178,6 +17896,9 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetri_outofplace_batched(
             (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
@@ -16202,6 +17923,9 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(
             rocBLASStatusToHIPStatus(rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
@@ -16241,6 +17965,9 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(ipiv != nullptr)
         return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
             rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
@@ -16279,6 +18006,9 @@ hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16311,6 +18041,9 @@ hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16343,6 +18076,9 @@ hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
                               int*            info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16380,6 +18116,9 @@ hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
                               int*                  info)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16419,6 +18158,9 @@ hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16454,6 +18196,9 @@ hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16489,6 +18234,9 @@ hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16530,6 +18278,9 @@ hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16574,6 +18325,9 @@ hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16611,6 +18365,9 @@ hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16648,6 +18405,9 @@ hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16693,6 +18453,9 @@ hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
                                             const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(m < 0)
@@ -16740,6 +18503,9 @@ hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
                              int*               deviceInfo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -16793,6 +18559,9 @@ hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
                              int*               deviceInfo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -16846,6 +18615,9 @@ hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
                              int*               deviceInfo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -16899,6 +18671,9 @@ hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
                              int*                  deviceInfo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -16954,6 +18729,9 @@ hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
                                     const int          batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -17011,6 +18789,9 @@ hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
                                     const int          batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -17068,6 +18849,9 @@ hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
                                     const int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -17125,6 +18909,9 @@ hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
                                     const int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -17185,6 +18972,9 @@ hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
                                            const int           batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -17246,6 +19036,9 @@ hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
                                            const int           batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
@@ -17307,6 +19100,9 @@ hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
                                            const int           batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -17368,6 +19164,9 @@ hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
                                            const int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     if(info == NULL)
         return HIPBLAS_STATUS_INVALID_VALUE;
     else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
@@ -17432,6 +19231,53 @@ hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'h', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+
     return rocBLASStatusToHIPStatus(rocblas_hgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -17468,6 +19314,55 @@ hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 's', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(
+        float, handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+
     return rocBLASStatusToHIPStatus(rocblas_sgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -17504,6 +19399,55 @@ hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'd', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(
+        double, handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+
     return rocBLASStatusToHIPStatus(rocblas_dgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -17540,6 +19484,72 @@ hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'c', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           0,
+                           B,
+                           ldb,
+                           0,
+                           beta,
+                           C,
+                           ldc,
+                           0,
+                           1);
+
     return rocBLASStatusToHIPStatus(rocblas_cgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -17576,6 +19586,72 @@ hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'z', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           0,
+                           B,
+                           ldb,
+                           0,
+                           beta,
+                           C,
+                           ldc,
+                           0,
+                           1);
+
     return rocBLASStatusToHIPStatus(rocblas_zgemm((rocblas_handle)handle,
                                                   hipOperationToHCCOperation(transa),
                                                   hipOperationToHCCOperation(transb),
@@ -17614,6 +19690,33 @@ hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm_batched",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+
     return rocBLASStatusToHIPStatus(rocblas_hgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17652,6 +19755,35 @@ hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm_batched",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(
+        float, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
     return rocBLASStatusToHIPStatus(rocblas_sgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17690,6 +19822,35 @@ hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm_batched",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(
+        double, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
     return rocBLASStatusToHIPStatus(rocblas_dgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17728,6 +19889,49 @@ hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm_batched",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           batchCount);
+
     return rocBLASStatusToHIPStatus(rocblas_cgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17766,6 +19970,49 @@ hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm_batched",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           batchCount);
+
     return rocBLASStatusToHIPStatus(rocblas_zgemm_batched((rocblas_handle)handle,
                                                           hipOperationToHCCOperation(transa),
                                                           hipOperationToHCCOperation(transb),
@@ -17808,6 +20055,53 @@ hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm_strided_batched",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
     {
@@ -17865,6 +20159,72 @@ hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm_strided_batched",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(float,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17932,6 +20292,72 @@ hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm_strided_batched",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(double,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -17999,6 +20425,72 @@ hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm_strided_batched",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -18066,6 +20558,72 @@ hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm_strided_batched",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     int bsa_int, bsb_int, bsc_int;
     if(bsa < INT_MAX && bsb < INT_MAX && bsc < INT_MAX)
         try
@@ -18113,6 +20671,60 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// fast f32
+// Whether the current device has the xf32 matrix cores of gfx940, gfx941 and
+// gfx942, which rocBLAS uses for f32 GEMMs in rocblas_xf32_xdl_math_op
+static bool hipblas_tf32_supported()
+{
+    static std::once_flag    once;
+    static std::vector<char> supported;
+    std::call_once(once, [] {
+        int count = 0;
+        if(hipGetDeviceCount(&count) != hipSuccess)
+            return;
+        supported.resize(count);
+        for(int i = 0; i < count; i++)
+        {
+            hipDeviceProp_t props;
+            supported[i] = hipGetDeviceProperties(&props, i) == hipSuccess
+                           && !strncmp(props.gcnArchName, "gfx94", 5);
+        }
+    });
+
+    int device;
+    return hipGetDevice(&device) == hipSuccess && device < int(supported.size())
+           && supported[device];
+}
+
+// The handle in the xf32 math mode for the lifetime of the object, if enabled.
+// The mode is the handle's, so other threads using the handle meanwhile see
+// it too, unless bound by hipblasSetThreadStream; hipblasSetFloat32Mode
+// documents this.
+class hipblas_tf32_math
+{
+    rocblas_handle    handle;
+    rocblas_math_mode saved  = rocblas_default_math;
+    bool              active = false;
+
+public:
+    hipblas_tf32_math(hipblasHandle_t handle, bool enable)
+        : handle((rocblas_handle)handle)
+    {
+        active = enable && rocblas_get_math_mode(this->handle, &saved) == rocblas_status_success
+                 && rocblas_set_math_mode(this->handle, rocblas_xf32_xdl_math_op)
+                        == rocblas_status_success;
+    }
+
+    ~hipblas_tf32_math()
+    {
+        if(active)
+            (void)rocblas_set_math_mode(handle, saved);
+    }
+
+    hipblas_tf32_math(const hipblas_tf32_math&) = delete;
+    hipblas_tf32_math& operator=(const hipblas_tf32_math&) = delete;
+};
+
 // gemm_ex
 // Note for int8 users - For rocBLAS backend, please read rocblas_gemm_ex documentation on int8
 // data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
@@ -18138,6 +20750,99 @@ hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         c_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+
+    if(a_type == HIPBLAS_C_16F)
+        return hipblas_half_complex_gemm(handle,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         B,
+                                         b_type,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         c_type,
+                                         ldc,
+                                         compute_type,
+                                         algo);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_16bx3(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  0,
+                                  B,
+                                  ldb,
+                                  0,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  0,
+                                  1,
+                                  algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     uint32_t           solution_index = 0;
     rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
 
@@ -18175,6 +20880,237 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// matmul plan
+struct hipblasMatmulPlan : hipblas_matmul_plan
+{
+    rocblas_operation  roc_transa, roc_transb;
+    rocblas_datatype   roc_a_type, roc_b_type, roc_c_type, roc_compute_type;
+    rocblas_gemm_algo  roc_algo;
+    rocblas_gemm_flags flags = rocblas_gemm_flags_none;
+};
+
+hipblasStatus_t hipblasMatmulPlanCreate(hipblasHandle_t         handle,
+                                        hipblasMatmulPlan_t*    plan,
+                                        hipblasOperation_t      transa,
+                                        hipblasOperation_t      transb,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        hipblasDatatype_t       a_type,
+                                        int                     lda,
+                                        hipblasDatatype_t       b_type,
+                                        int                     ldb,
+                                        hipblasDatatype_t       c_type,
+                                        int                     ldc,
+                                        hipblasDatatype_t       compute_type,
+                                        hipblasGemmAlgo_t       algo,
+                                        hipblasMatmulEpilogue_t epilogue)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!plan)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto            p      = std::make_unique<hipblasMatmulPlan>();
+    hipblasStatus_t status = hipblas_matmul_plan_init(*p,
+                                                      transa,
+                                                      transb,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      a_type,
+                                                      lda,
+                                                      b_type,
+                                                      ldb,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type,
+                                                      algo,
+                                                      epilogue);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    p->roc_transa       = hipOperationToHCCOperation(transa);
+    p->roc_transb       = hipOperationToHCCOperation(transb);
+    p->roc_a_type       = HIPDatatypeToRocblasDatatype(a_type);
+    p->roc_b_type       = HIPDatatypeToRocblasDatatype(b_type);
+    p->roc_c_type       = HIPDatatypeToRocblasDatatype(c_type);
+    p->roc_compute_type = HIPDatatypeToRocblasDatatype(compute_type);
+    p->roc_algo         = HIPGemmAlgoToRocblasGemmAlgo(algo);
+
+    rocblas_handle rocblas_h = (rocblas_handle)handle;
+    rocblas_status rb_status = rocblas_query_int8_layout_flag(rocblas_h, &p->flags);
+    if(rb_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(rb_status);
+
+    // The size query only reads the arguments, so the plan's own scalar can
+    // stand in for alpha and beta. No solution is selected here: solution
+    // index 0 lets rocBLAS pick the kernel for the shape on each execution.
+    rb_status = rocblas_start_device_memory_size_query(rocblas_h);
+    if(rb_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(rb_status);
+    rocblas_status query_status = rocblas_gemm_ex(rocblas_h,
+                                                  p->roc_transa,
+                                                  p->roc_transb,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  p->one,
+                                                  nullptr,
+                                                  p->roc_a_type,
+                                                  lda,
+                                                  nullptr,
+                                                  p->roc_b_type,
+                                                  ldb,
+                                                  p->one,
+                                                  nullptr,
+                                                  p->roc_c_type,
+                                                  ldc,
+                                                  nullptr,
+                                                  p->roc_c_type,
+                                                  ldc,
+                                                  p->roc_compute_type,
+                                                  p->roc_algo,
+                                                  0,
+                                                  p->flags);
+    rb_status = rocblas_stop_device_memory_size_query(rocblas_h, &p->workspace_size);
+
+    // During the query a supported GEMM reports whether it grew the size;
+    // anything else, such as an unsupported type combination, is its error
+    if(query_status != rocblas_status_success && query_status != rocblas_status_size_increased
+       && query_status != rocblas_status_size_unchanged)
+        return rocBLASStatusToHIPStatus(query_status);
+    if(rb_status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(rb_status);
+
+    *plan = p.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanExecute(hipblasHandle_t     handle,
+                                         hipblasMatmulPlan_t plan,
+                                         const void*         alpha,
+                                         const void*         A,
+                                         const void*         B,
+                                         const void*         beta,
+                                         void*               C,
+                                         const void*         bias)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(!plan || !hipblas_matmul_plan_current(*plan))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex",
+                     plan->a_type,
+                     plan->b_type,
+                     plan->c_type,
+                     plan->compute_type,
+                     plan->transa,
+                     plan->transb,
+                     plan->m,
+                     plan->n,
+                     plan->k,
+                     alpha,
+                     A,
+                     plan->lda,
+                     0,
+                     B,
+                     plan->ldb,
+                     0,
+                     beta,
+                     C,
+                     plan->ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         plan->a_type,
+                         plan->b_type,
+                         plan->c_type,
+                         plan->transa,
+                         plan->transb,
+                         plan->m,
+                         plan->n,
+                         plan->k,
+                         A,
+                         plan->lda,
+                         0,
+                         B,
+                         plan->ldb,
+                         0,
+                         C,
+                         plan->ldc,
+                         0,
+                         1);
+
+    rocblas_status status = rocblas_gemm_ex((rocblas_handle)handle,
+                                            plan->roc_transa,
+                                            plan->roc_transb,
+                                            plan->m,
+                                            plan->n,
+                                            plan->k,
+                                            alpha,
+                                            A,
+                                            plan->roc_a_type,
+                                            plan->lda,
+                                            B,
+                                            plan->roc_b_type,
+                                            plan->ldb,
+                                            beta,
+                                            C,
+                                            plan->roc_c_type,
+                                            plan->ldc,
+                                            C,
+                                            plan->roc_c_type,
+                                            plan->ldc,
+                                            plan->roc_compute_type,
+                                            plan->roc_algo,
+                                            0,
+                                            plan->flags);
+    if(status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(status);
+
+    return hipblas_matmul_plan_epilogue(handle, *plan, C, bias);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanGetWorkspaceSize(hipblasMatmulPlan_t plan, size_t* size)
+try
+{
+    if(!plan || !size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *size = plan->workspace_size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanDestroy(hipblasMatmulPlan_t plan)
+try
+{
+    delete plan;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasOperation_t transa,
                                      hipblasOperation_t transb,
@@ -18197,6 +21133,57 @@ hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_batched_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batch_count);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_batched_16bx3(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          B,
+                                          ldb,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count,
+                                          algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     uint32_t           solution_index = 0;
     rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
 
@@ -18261,6 +21248,81 @@ hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_strided_batched_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     beta,
+                     C,
+                     ldc,
+                     stride_C,
+                     batch_count);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         c_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         stride_A,
+                         B,
+                         ldb,
+                         stride_B,
+                         C,
+                         ldc,
+                         stride_C,
+                         batch_count);
+    hipblas_gemm_collapse_broadcast(
+        transa, transb, m, n, lda, ldb, ldc, stride_A, stride_B, stride_C, batch_count);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_16bx3(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  stride_A,
+                                  B,
+                                  ldb,
+                                  stride_B,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  stride_C,
+                                  batch_count,
+                                  algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     uint32_t           solution_index = 0;
     rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
 
@@ -18304,6 +21366,329 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasGemmExD(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const void*        alpha,
+                               const void*        A,
+                               hipblasDatatype_t  a_type,
+                               int                lda,
+                               const void*        B,
+                               hipblasDatatype_t  b_type,
+                               int                ldb,
+                               const void*        beta,
+                               const void*        C,
+                               hipblasDatatype_t  c_type,
+                               int                ldc,
+                               void*              D,
+                               hipblasDatatype_t  d_type,
+                               int                ldd,
+                               hipblasDatatype_t  compute_type,
+                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     D,
+                     ldd,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         d_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         D,
+                         ldd,
+                         0,
+                         1,
+                         C,
+                         ldc,
+                         0);
+
+    uint32_t           solution_index = 0;
+    rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
+
+    rocblas_status status = rocblas_query_int8_layout_flag((rocblas_handle)handle, &flags);
+    if(status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(status);
+
+    return rocBLASStatusToHIPStatus(
+        rocblas_gemm_ex((rocblas_handle)handle,
+                        hipOperationToHCCOperation(transa),
+                        hipOperationToHCCOperation(transb),
+                        m,
+                        n,
+                        k,
+                        alpha,
+                        A,
+                        HIPDatatypeToRocblasDatatype(a_type),
+                        lda,
+                        B,
+                        HIPDatatypeToRocblasDatatype(b_type),
+                        ldb,
+                        beta,
+                        C,
+                        HIPDatatypeToRocblasDatatype(c_type),
+                        ldc,
+                        D,
+                        HIPDatatypeToRocblasDatatype(d_type),
+                        ldd,
+                        HIPDatatypeToRocblasDatatype(compute_type),
+                        HIPGemmAlgoToRocblasGemmAlgo(algo),
+                        solution_index,
+                        flags));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExD(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const void*        A[],
+                                      hipblasDatatype_t  a_type,
+                                      int                lda,
+                                      const void*        B[],
+                                      hipblasDatatype_t  b_type,
+                                      int                ldb,
+                                      const void*        beta,
+                                      const void*        C[],
+                                      hipblasDatatype_t  c_type,
+                                      int                ldc,
+                                      void*              D[],
+                                      hipblasDatatype_t  d_type,
+                                      int                ldd,
+                                      int                batch_count,
+                                      hipblasDatatype_t  compute_type,
+                                      hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_batched_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     D,
+                     ldd,
+                     0,
+                     batch_count);
+
+    uint32_t           solution_index = 0;
+    rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
+
+    rocblas_status status = rocblas_query_int8_layout_flag((rocblas_handle)handle, &flags);
+    if(status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(status);
+
+    return rocBLASStatusToHIPStatus(
+        rocblas_gemm_batched_ex((rocblas_handle)handle,
+                                hipOperationToHCCOperation(transa),
+                                hipOperationToHCCOperation(transb),
+                                m,
+                                n,
+                                k,
+                                alpha,
+                                (void*)A,
+                                HIPDatatypeToRocblasDatatype(a_type),
+                                lda,
+                                (void*)B,
+                                HIPDatatypeToRocblasDatatype(b_type),
+                                ldb,
+                                beta,
+                                (void*)C,
+                                HIPDatatypeToRocblasDatatype(c_type),
+                                ldc,
+                                (void*)D,
+                                HIPDatatypeToRocblasDatatype(d_type),
+                                ldd,
+                                batch_count,
+                                HIPDatatypeToRocblasDatatype(compute_type),
+                                HIPGemmAlgoToRocblasGemmAlgo(algo),
+                                solution_index,
+                                flags));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExD(hipblasHandle_t    handle,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             hipblasStride      stride_A,
+                                             const void*        B,
+                                             hipblasDatatype_t  b_type,
+                                             int                ldb,
+                                             hipblasStride      stride_B,
+                                             const void*        beta,
+                                             const void*        C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasStride      stride_C,
+                                             void*              D,
+                                             hipblasDatatype_t  d_type,
+                                             int                ldd,
+                                             hipblasStride      stride_D,
+                                             int                batch_count,
+                                             hipblasDatatype_t  compute_type,
+                                             hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_strided_batched_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     beta,
+                     D,
+                     ldd,
+                     stride_D,
+                     batch_count);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         d_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         stride_A,
+                         B,
+                         ldb,
+                         stride_B,
+                         D,
+                         ldd,
+                         stride_D,
+                         batch_count,
+                         C,
+                         ldc,
+                         stride_C);
+
+    uint32_t           solution_index = 0;
+    rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
+
+    rocblas_status status = rocblas_query_int8_layout_flag((rocblas_handle)handle, &flags);
+    if(status != rocblas_status_success)
+        return rocBLASStatusToHIPStatus(status);
+
+    return rocBLASStatusToHIPStatus(
+        rocblas_gemm_strided_batched_ex((rocblas_handle)handle,
+                                        hipOperationToHCCOperation(transa),
+                                        hipOperationToHCCOperation(transb),
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        HIPDatatypeToRocblasDatatype(a_type),
+                                        lda,
+                                        stride_A,
+                                        B,
+                                        HIPDatatypeToRocblasDatatype(b_type),
+                                        ldb,
+                                        stride_B,
+                                        beta,
+                                        C,
+                                        HIPDatatypeToRocblasDatatype(c_type),
+                                        ldc,
+                                        stride_C,
+                                        D,
+                                        HIPDatatypeToRocblasDatatype(d_type),
+                                        ldd,
+                                        stride_D,
+                                        batch_count,
+                                        HIPDatatypeToRocblasDatatype(compute_type),
+                                        HIPGemmAlgoToRocblasGemmAlgo(algo),
+                                        solution_index,
+                                        flags));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // trsm_ex
 hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasSideMode_t  side,
@@ -18322,6 +21707,9 @@ hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_trsm_ex((rocblas_handle)handle,
                                                     hipSideToHCCSide(side),
                                                     hipFillToHCCFill(uplo),
@@ -18361,6 +21749,9 @@ hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
                                      hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_trsm_batched_ex((rocblas_handle)handle,
                                 hipSideToHCCSide(side),
@@ -18405,6 +21796,9 @@ hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasDatatype_t  compute_type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_trsm_strided_batched_ex((rocblas_handle)handle,
                                         hipSideToHCCSide(side),
@@ -18491,6 +21885,12 @@ hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_axpy(
+            handle, n, alpha, alphaType, x, incx, y, yType, incy, executionType);
     return rocBLASStatusToHIPStatus(rocblas_axpy_ex((rocblas_handle)handle,
                                                     n,
                                                     alpha,
@@ -18522,6 +21922,9 @@ hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_axpy_batched_ex((rocblas_handle)handle,
                                 n,
@@ -18557,6 +21960,9 @@ hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_axpy_strided_batched_ex((rocblas_handle)handle,
                                         n,
@@ -18592,6 +21998,12 @@ hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_dot(
+            handle, n, x, incx, y, yType, incy, result, resultType, executionType, false);
     return rocBLASStatusToHIPStatus(rocblas_dot_ex((rocblas_handle)handle,
                                                    n,
                                                    x,
@@ -18622,6 +22034,12 @@ hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_dot(
+            handle, n, x, incx, y, yType, incy, result, resultType, executionType, true);
     return rocBLASStatusToHIPStatus(rocblas_dotc_ex((rocblas_handle)handle,
                                                     n,
                                                     x,
@@ -18653,6 +22071,9 @@ hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dot_batched_ex((rocblas_handle)handle,
                                n,
@@ -18686,6 +22107,9 @@ hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dotc_batched_ex((rocblas_handle)handle,
                                 n,
@@ -18721,6 +22145,9 @@ hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dot_strided_batched_ex((rocblas_handle)handle,
                                        n,
@@ -18758,6 +22185,9 @@ hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_dotc_strided_batched_ex((rocblas_handle)handle,
                                         n,
@@ -18790,6 +22220,11 @@ hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_nrm2(handle, n, x, incx, result, resultType, executionType);
     return rocBLASStatusToHIPStatus(rocblas_nrm2_ex((rocblas_handle)handle,
                                                     n,
                                                     x,
@@ -18815,6 +22250,9 @@ hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_nrm2_batched_ex((rocblas_handle)handle,
                                 n,
@@ -18843,6 +22281,9 @@ hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_nrm2_strided_batched_ex((rocblas_handle)handle,
                                         n,
@@ -18875,6 +22316,9 @@ hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(rocblas_rot_ex((rocblas_handle)handle,
                                                    n,
                                                    x,
@@ -18908,6 +22352,9 @@ hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_rot_batched_ex((rocblas_handle)handle,
                                n,
@@ -18945,6 +22392,9 @@ hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_rot_strided_batched_ex((rocblas_handle)handle,
                                        n,
@@ -18978,6 +22428,11 @@ hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_scal(handle, n, alpha, alphaType, x, incx, executionType);
     return rocBLASStatusToHIPStatus(rocblas_scal_ex((rocblas_handle)handle,
                                                     n,
                                                     alpha,
@@ -19003,6 +22458,9 @@ hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_scal_batched_ex((rocblas_handle)handle,
                                 n,
@@ -19031,6 +22489,9 @@ hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return rocBLASStatusToHIPStatus(
         rocblas_scal_strided_batched_ex((rocblas_handle)handle,
                                         n,
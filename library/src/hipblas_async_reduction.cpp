@@ -0,0 +1,457 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "memory_type.hpp"
+#include "thread_stream.hpp"
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // The device writes the result: pinned or registered host memory,
+    // managed or device memory, but not pageable memory
+    bool device_accessible(const void* ptr)
+    {
+        return hipblas_get_memory_type(ptr) != hipblas_memory_type::pageable;
+    }
+
+    // Run the reduction in device pointer mode, so that the result is written
+    // in stream order instead of being waited for, then record event
+    template <typename F>
+    hipblasStatus_t
+        async_reduction(hipblasHandle_t handle, const void* result, hipEvent_t event, F reduction)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(result == nullptr || !device_accessible(result))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_internal_call_guard guard;
+        hipblasPointerMode_t        mode;
+        hipblasStatus_t             status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(mode != HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        status = reduction();
+
+        if(mode != HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            hipblasStatus_t restore_status = hipblasSetPointerMode(handle, mode);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = restore_status;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && event)
+        {
+            hipStream_t stream;
+            status = hipblasGetStream(handle, &stream);
+            if(status == HIPBLAS_STATUS_SUCCESS && hipEventRecord(event, stream) != hipSuccess)
+                status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        return status;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSdotAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const float*    x,
+                                 int             incx,
+                                 const float*    y,
+                                 int             incy,
+                                 float*          result,
+                                 hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasSdot(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const double*   x,
+                                 int             incx,
+                                 const double*   y,
+                                 int             incy,
+                                 double*         result,
+                                 hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasDdot(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotuAsync(hipblasHandle_t       handle,
+                                  int                   n,
+                                  const hipblasComplex* x,
+                                  int                   incx,
+                                  const hipblasComplex* y,
+                                  int                   incy,
+                                  hipblasComplex*       result,
+                                  hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasCdotu(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotcAsync(hipblasHandle_t       handle,
+                                  int                   n,
+                                  const hipblasComplex* x,
+                                  int                   incx,
+                                  const hipblasComplex* y,
+                                  int                   incy,
+                                  hipblasComplex*       result,
+                                  hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasCdotc(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotuAsync(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  const hipblasDoubleComplex* y,
+                                  int                         incy,
+                                  hipblasDoubleComplex*       result,
+                                  hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasZdotu(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotcAsync(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  const hipblasDoubleComplex* y,
+                                  int                         incy,
+                                  hipblasDoubleComplex*       result,
+                                  hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasZdotc(handle, n, x, incx, y, incy, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2Async(hipblasHandle_t handle,
+                                  int             n,
+                                  const float*    x,
+                                  int             incx,
+                                  float*          result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasSnrm2(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2Async(hipblasHandle_t handle,
+                                  int             n,
+                                  const double*   x,
+                                  int             incx,
+                                  double*         result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasDnrm2(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2Async(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   float*                result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasScnrm2(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2Async(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   double*                     result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasDznrm2(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasumAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const float*    x,
+                                  int             incx,
+                                  float*          result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasSasum(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasumAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const double*   x,
+                                  int             incx,
+                                  double*         result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasDasum(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasumAsync(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   float*                result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasScasum(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasumAsync(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   double*                     result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasDzasum(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamaxAsync(hipblasHandle_t handle,
+                                   int             n,
+                                   const float*    x,
+                                   int             incx,
+                                   int*            result,
+                                   hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasIsamax(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamaxAsync(hipblasHandle_t handle,
+                                   int             n,
+                                   const double*   x,
+                                   int             incx,
+                                   int*            result,
+                                   hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasIdamax(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamaxAsync(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   int*                  result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasIcamax(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamaxAsync(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   int*                        result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    return async_reduction(handle, result, event, [&] {
+        return hipblasIzamax(handle, n, x, incx, result);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
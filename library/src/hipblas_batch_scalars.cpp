@@ -0,0 +1,1330 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "batch_scalars.hpp"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+#include <map>
+#include <string>
+
+hipblasStatus_t batch_scalars_get(hipblasHandle_t handle,
+                                  const void*     alpha,
+                                  const void*     beta,
+                                  size_t          size,
+                                  int             count,
+                                  batch_scalars&  s)
+{
+    s.handle               = handle;
+    s.size                 = size;
+    s.count                = count;
+    s.alpha                = alpha;
+    s.beta                 = beta;
+    hipblasStatus_t status = hipblasGetPointerMode(handle, &s.pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &s.stream);
+    return status;
+}
+
+hipblasStatus_t batch_scalars_read(hipblasHandle_t handle,
+                                   const void*     alpha,
+                                   const void*     beta,
+                                   size_t          size,
+                                   int             count,
+                                   batch_scalars&  s)
+{
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, beta, size, count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS || s.on_host() || (!alpha && !beta))
+        return status;
+
+    size_t       bytes    = size * count;
+    const void** given[2] = {&s.alpha, &s.beta};
+    s.copy.resize(2 * bytes);
+    for(int i = 0; i < 2; i++)
+    {
+        if(!*given[i])
+            continue;
+        char* host = s.copy.data() + i * bytes;
+        if(hipMemcpyAsync(host, *given[i], bytes, hipMemcpyDeviceToHost, s.stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        *given[i] = host;
+    }
+    if(hipStreamSynchronize(s.stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t batch_scalars_pointers(const batch_scalars&      s,
+                                       const void* const*        array,
+                                       std::vector<const void*>& host)
+{
+    if(!array)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    host.resize(s.count);
+    if(hipMemcpyAsync(
+           host.data(), array, s.count * sizeof(void*), hipMemcpyDeviceToHost, s.stream)
+           != hipSuccess
+       || hipStreamSynchronize(s.stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t batch_scalars_check_gemm(hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         int                lda,
+                                         int                ldb,
+                                         const void*        beta,
+                                         int                ldc,
+                                         int                batch_count)
+{
+    for(hipblasOperation_t op : {transa, transb})
+        if(op != HIPBLAS_OP_N && op != HIPBLAS_OP_T && op != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_rows)
+       || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m && n && batch_count && (!alpha || !beta))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // Check an Ex call, whose scalars are of the compute type, and get its
+    // scalars. Returns true with status set when the call is complete without
+    // further work.
+    bool gemm_ex_check(hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const void*        alpha,
+                       int                lda,
+                       int                ldb,
+                       const void*        beta,
+                       int                ldc,
+                       int                batch_count,
+                       hipblasDatatype_t  compute_type,
+                       batch_scalars&     s,
+                       hipblasStatus_t&   status)
+    {
+        size_t size = hipblas_datatype_size(compute_type);
+        if(handle == nullptr)
+            status = HIPBLAS_STATUS_NOT_INITIALIZED;
+        else if(!size)
+            status = HIPBLAS_STATUS_INVALID_ENUM;
+        else
+            status = batch_scalars_check_gemm(
+                transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+            return true;
+        status = batch_scalars_get(handle, alpha, beta, size, batch_count, s);
+        return status != HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // hipblasGemmBatchedEx for each group of members sharing their scalars,
+    // in the order of their first appearance, operands holding the host
+    // pointer arrays of A, B and C. The scalars are read to the host, which
+    // in device pointer mode waits for the stream.
+    hipblasStatus_t gemm_ex_grouped(const batch_scalars&                         given,
+                                    hipblasOperation_t                           transa,
+                                    hipblasOperation_t                           transb,
+                                    int                                          m,
+                                    int                                          n,
+                                    int                                          k,
+                                    hipblasDatatype_t                            a_type,
+                                    int                                          lda,
+                                    hipblasDatatype_t                            b_type,
+                                    int                                          ldb,
+                                    hipblasDatatype_t                            c_type,
+                                    int                                          ldc,
+                                    hipblasDatatype_t                            compute_type,
+                                    hipblasGemmAlgo_t                            algo,
+                                    const std::vector<std::vector<const void*>>& operands)
+    {
+        batch_scalars   s;
+        hipblasStatus_t status = batch_scalars_read(
+            given.handle, given.alpha, given.beta, given.size, given.count, s);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        std::map<std::string, size_t> index;
+        std::vector<std::vector<int>> groups;
+        for(int i = 0; i < s.count; i++)
+        {
+            std::string key(static_cast<const char*>(s.alpha_at(i)), s.size);
+            key.append(static_cast<const char*>(s.beta_at(i)), s.size);
+            auto found = index.emplace(key, groups.size());
+            if(found.second)
+                groups.emplace_back();
+            groups[found.first->second].push_back(i);
+        }
+
+        std::vector<const void*> packed;
+        packed.reserve(operands.size() * s.count);
+        for(const auto& group : groups)
+            for(const auto& operand : operands)
+                for(int i : group)
+                    packed.push_back(operand[i]);
+
+        return batch_scalars_run(s, packed.size() * sizeof(void*), [&](void* W) {
+            auto arrays = static_cast<const void**>(W);
+            if(hipMemcpyAsync(arrays,
+                              packed.data(),
+                              packed.size() * sizeof(void*),
+                              hipMemcpyHostToDevice,
+                              s.stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(size_t g = 0; g < groups.size() && status == HIPBLAS_STATUS_SUCCESS; g++)
+            {
+                int count = int(groups[g].size());
+                status    = hipblasGemmBatchedEx(s.handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 s.alpha_at(groups[g][0]),
+                                                 arrays,
+                                                 a_type,
+                                                 lda,
+                                                 arrays + count,
+                                                 b_type,
+                                                 ldb,
+                                                 s.beta_at(groups[g][0]),
+                                                 (void**)(arrays + 2 * count),
+                                                 c_type,
+                                                 ldc,
+                                                 count,
+                                                 compute_type,
+                                                 algo);
+                arrays += operands.size() * count;
+            }
+            return status;
+        });
+    }
+
+    hipblasStatus_t gemm_batched_ex_vec(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  a_type,
+                                        int                lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  b_type,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  c_type,
+                                        int                ldc,
+                                        int                batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        hipblasGemmAlgo_t  algo)
+    {
+        batch_scalars   s;
+        hipblasStatus_t status;
+        if(gemm_ex_check(handle,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         alpha,
+                         lda,
+                         ldb,
+                         beta,
+                         ldc,
+                         batch_count,
+                         compute_type,
+                         s,
+                         status))
+            return status;
+        if(s.uniform())
+            return hipblasGemmBatchedEx(handle,
+                                        transa,
+                                        transb,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_type,
+                                        lda,
+                                        B,
+                                        b_type,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        c_type,
+                                        ldc,
+                                        batch_count,
+                                        compute_type,
+                                        algo);
+
+        auto device = [&](auto type) {
+            using T = decltype(type);
+            return batch_scalars_combine_batched<T>(
+                s,
+                m,
+                n,
+                (T* const*)C,
+                ldc,
+                [&](T* const Y[], int ldy) {
+                    const T one  = gemmt_real_scalar<T>(1);
+                    const T zero = gemmt_real_scalar<T>(0);
+                    return hipblasGemmBatchedEx(handle,
+                                                transa,
+                                                transb,
+                                                m,
+                                                n,
+                                                k,
+                                                &one,
+                                                A,
+                                                a_type,
+                                                lda,
+                                                B,
+                                                b_type,
+                                                ldb,
+                                                &zero,
+                                                (void**)Y,
+                                                c_type,
+                                                ldy,
+                                                batch_count,
+                                                compute_type,
+                                                algo);
+                },
+                [&](int i) {
+                    return hipblasGemmBatchedEx(handle,
+                                                transa,
+                                                transb,
+                                                m,
+                                                n,
+                                                k,
+                                                static_cast<const T*>(alpha) + i,
+                                                A + i,
+                                                a_type,
+                                                lda,
+                                                B + i,
+                                                b_type,
+                                                ldb,
+                                                static_cast<const T*>(beta) + i,
+                                                C + i,
+                                                c_type,
+                                                ldc,
+                                                1,
+                                                compute_type,
+                                                algo);
+                });
+        };
+        if(c_type == compute_type && hipblas_functions_call(compute_type, device, status))
+            return status;
+
+        std::vector<std::vector<const void*>> operands(3);
+        const void* const* arrays[3] = {A, B, (const void* const*)C};
+        for(int o = 0; o < 3 && status == HIPBLAS_STATUS_SUCCESS; o++)
+            status = batch_scalars_pointers(s, arrays[o], operands[o]);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return gemm_ex_grouped(s,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               a_type,
+                               lda,
+                               b_type,
+                               ldb,
+                               c_type,
+                               ldc,
+                               compute_type,
+                               algo,
+                               operands);
+    }
+
+    hipblasStatus_t gemm_strided_batched_ex_vec(hipblasHandle_t    handle,
+                                                hipblasOperation_t transa,
+                                                hipblasOperation_t transb,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  a_type,
+                                                int                lda,
+                                                hipblasStride      stride_a,
+                                                const void*        B,
+                                                hipblasDatatype_t  b_type,
+                                                int                ldb,
+                                                hipblasStride      stride_b,
+                                                const void*        beta,
+                                                void*              C,
+                                                hipblasDatatype_t  c_type,
+                                                int                ldc,
+                                                hipblasStride      stride_c,
+                                                int                batch_count,
+                                                hipblasDatatype_t  compute_type,
+                                                hipblasGemmAlgo_t  algo)
+    {
+        batch_scalars   s;
+        hipblasStatus_t status;
+        if(gemm_ex_check(handle,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         alpha,
+                         lda,
+                         ldb,
+                         beta,
+                         ldc,
+                         batch_count,
+                         compute_type,
+                         s,
+                         status))
+            return status;
+        if(s.uniform())
+            return hipblasGemmStridedBatchedEx(handle,
+                                               transa,
+                                               transb,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               A,
+                                               a_type,
+                                               lda,
+                                               stride_a,
+                                               B,
+                                               b_type,
+                                               ldb,
+                                               stride_b,
+                                               beta,
+                                               C,
+                                               c_type,
+                                               ldc,
+                                               stride_c,
+                                               batch_count,
+                                               compute_type,
+                                               algo);
+
+        // The members' pointers follow from the strides
+        const void*       bases[3]   = {A, B, C};
+        hipblasStride     strides[3] = {stride_a, stride_b, stride_c};
+        hipblasDatatype_t types[3]   = {a_type, b_type, c_type};
+        size_t            sizes[3];
+        for(int o = 0; o < 3; o++)
+            if(!(sizes[o] = hipblas_datatype_size(types[o])))
+                return HIPBLAS_STATUS_INVALID_ENUM;
+        auto member = [&](int o, int i) {
+            return static_cast<const char*>(bases[o]) + i * strides[o] * sizes[o];
+        };
+
+        auto device = [&](auto type) {
+            using T = decltype(type);
+            return batch_scalars_combine_strided<T>(
+                s,
+                m,
+                n,
+                static_cast<T*>(C),
+                ldc,
+                stride_c,
+                [&](T* Y, int ldy, hipblasStride stride_y) {
+                    const T one  = gemmt_real_scalar<T>(1);
+                    const T zero = gemmt_real_scalar<T>(0);
+                    return hipblasGemmStridedBatchedEx(handle,
+                                                       transa,
+                                                       transb,
+                                                       m,
+                                                       n,
+                                                       k,
+                                                       &one,
+                                                       A,
+                                                       a_type,
+                                                       lda,
+                                                       stride_a,
+                                                       B,
+                                                       b_type,
+                                                       ldb,
+                                                       stride_b,
+                                                       &zero,
+                                                       Y,
+                                                       c_type,
+                                                       ldy,
+                                                       stride_y,
+                                                       batch_count,
+                                                       compute_type,
+                                                       algo);
+                },
+                [&](int i) {
+                    return hipblasGemmEx(handle,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         static_cast<const T*>(alpha) + i,
+                                         member(0, i),
+                                         a_type,
+                                         lda,
+                                         member(1, i),
+                                         b_type,
+                                         ldb,
+                                         static_cast<const T*>(beta) + i,
+                                         (void*)member(2, i),
+                                         c_type,
+                                         ldc,
+                                         compute_type,
+                                         algo);
+                });
+        };
+        if(c_type == compute_type && hipblas_functions_call(compute_type, device, status))
+            return status;
+
+        std::vector<std::vector<const void*>> operands(3);
+        for(int o = 0; o < 3; o++)
+            for(int i = 0; i < batch_count; i++)
+                operands[o].push_back(member(o, i));
+        return gemm_ex_grouped(s,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               a_type,
+                               lda,
+                               b_type,
+                               ldb,
+                               c_type,
+                               ldc,
+                               compute_type,
+                               algo,
+                               operands);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSgemmBatchedVec(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const B[],
+                                       int                ldb,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_batched<float>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatchedVec(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transa,
+                                       hipblasOperation_t  transb,
+                                       int                 m,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const B[],
+                                       int                 ldb,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_batched<double>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatchedVec(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transa,
+                                       hipblasOperation_t          transb,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const B[],
+                                       int                         ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_batched<hipblasComplex>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatchedVec(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transa,
+                                       hipblasOperation_t                transb,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int                               ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_batched<hipblasDoubleComplex>(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      stride_a,
+                                              const float*       B,
+                                              int                ldb,
+                                              hipblasStride      stride_b,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              hipblasStride      stride_c,
+                                              int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_strided<float>(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_a,
+                                             B,
+                                             ldb,
+                                             stride_b,
+                                             beta,
+                                             C,
+                                             ldc,
+                                             stride_c,
+                                             batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      stride_a,
+                                              const double*      B,
+                                              int                ldb,
+                                              hipblasStride      stride_b,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              hipblasStride      stride_c,
+                                              int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_strided<double>(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              stride_a,
+                                              B,
+                                              ldb,
+                                              stride_b,
+                                              beta,
+                                              C,
+                                              ldc,
+                                              stride_c,
+                                              batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchedVec(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         stride_a,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              hipblasStride         stride_b,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              hipblasStride         stride_c,
+                                              int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_strided<hipblasComplex>(handle,
+                                                      transa,
+                                                      transb,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      alpha,
+                                                      A,
+                                                      lda,
+                                                      stride_a,
+                                                      B,
+                                                      ldb,
+                                                      stride_b,
+                                                      beta,
+                                                      C,
+                                                      ldc,
+                                                      stride_c,
+                                                      batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedVec(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               stride_a,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              hipblasStride               stride_b,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              hipblasStride               stride_c,
+                                              int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_gemm_strided<hipblasDoubleComplex>(handle,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha,
+                                                            A,
+                                                            lda,
+                                                            stride_a,
+                                                            B,
+                                                            ldb,
+                                                            stride_b,
+                                                            beta,
+                                                            C,
+                                                            ldc,
+                                                            stride_c,
+                                                            batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpyBatchedVec(hipblasHandle_t    handle,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int                incx,
+                                       float* const       y[],
+                                       int                incy,
+                                       int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_batched<float>(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyBatchedVec(hipblasHandle_t     handle,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int                 incx,
+                                       double* const       y[],
+                                       int                 incy,
+                                       int                 batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_batched<double>(handle, n, alpha, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyBatchedVec(hipblasHandle_t             handle,
+                                       int                         n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       hipblasComplex* const       y[],
+                                       int                         incy,
+                                       int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_batched<hipblasComplex>(
+        handle, n, alpha, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyBatchedVec(hipblasHandle_t                   handle,
+                                       int                               n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int                               incy,
+                                       int                               batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_batched<hipblasDoubleComplex>(
+        handle, n, alpha, x, incx, y, incy, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_strided<float>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_strided<double>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatchedVec(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int                   incy,
+                                              hipblasStride         stridey,
+                                              int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_strided<hipblasComplex>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatchedVec(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int                         incy,
+                                              hipblasStride               stridey,
+                                              int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_axpy_strided<hipblasDoubleComplex>(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSscalBatchedVec(hipblasHandle_t handle,
+                                       int             n,
+                                       const float*    alpha,
+                                       float* const    x[],
+                                       int             incx,
+                                       int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_batched<float>(handle, n, alpha, x, incx, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscalBatchedVec(hipblasHandle_t handle,
+                                       int             n,
+                                       const double*   alpha,
+                                       double* const   x[],
+                                       int             incx,
+                                       int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_batched<double>(handle, n, alpha, x, incx, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscalBatchedVec(hipblasHandle_t       handle,
+                                       int                   n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const x[],
+                                       int                   incx,
+                                       int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_batched<hipblasComplex>(handle, n, alpha, x, incx, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscalBatchedVec(hipblasHandle_t             handle,
+                                       int                         n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const x[],
+                                       int                         incx,
+                                       int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_batched<hipblasDoubleComplex>(handle, n, alpha, x, incx, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSscalStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              float*          x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_strided<float>(handle, n, alpha, x, incx, stridex, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDscalStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              double*         x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_strided<double>(handle, n, alpha, x, incx, stridex, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCscalStridedBatchedVec(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_strided<hipblasComplex>(
+        handle, n, alpha, x, incx, stridex, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZscalStridedBatchedVec(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return batch_scalars_scal_strided<hipblasDoubleComplex>(
+        handle, n, alpha, x, incx, stridex, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExVec(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  a_type,
+                                        int                lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  b_type,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  c_type,
+                                        int                ldc,
+                                        int                batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemm_batched_ex_vec(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               a_type,
+                               lda,
+                               B,
+                               b_type,
+                               ldb,
+                               beta,
+                               C,
+                               c_type,
+                               ldc,
+                               batch_count,
+                               compute_type,
+                               algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExVec(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  a_type,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const void*        B,
+                                               hipblasDatatype_t  b_type,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  c_type,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count,
+                                               hipblasDatatype_t  compute_type,
+                                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemm_strided_batched_ex_vec(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       stride_a,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       stride_b,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       stride_c,
+                                       batch_count,
+                                       compute_type,
+                                       algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,410 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "staging.hpp"
+
+namespace
+{
+    bool vector_args_invalid(int n, int elemSize, int incx, int incy, int batchCount)
+    {
+        return n < 0 || elemSize <= 0 || incx <= 0 || incy <= 0 || batchCount < 0;
+    }
+
+    bool matrix_args_invalid(int rows, int cols, int elemSize, int lda, int ldb, int batchCount)
+    {
+        return rows < 0 || cols < 0 || elemSize <= 0 || lda <= 0 || ldb <= 0 || lda < rows
+               || ldb < rows || batchCount < 0;
+    }
+
+    // Vectors with unit increments that do not overlap are the columns of one
+    // matrix; others are copied as rows with the increment as leading dimension
+    hipblasStatus_t copy_vectors(bool          to_device,
+                                 int           n,
+                                 int           elemSize,
+                                 const void*   x,
+                                 int           incx,
+                                 hipblasStride stridex,
+                                 void*         y,
+                                 int           incy,
+                                 hipblasStride stridey,
+                                 int           batchCount,
+                                 hipStream_t   stream)
+    {
+        if(incx == 1 && incy == 1 && stridex >= n && stridey >= n)
+            return hipblas_copy_strided_batched(
+                to_device, n, batchCount, elemSize, x, stridex, 0, y, stridey, 0, 1, stream, true);
+        if(incx == 1 && incy == 1)
+            return hipblas_copy_strided_batched(to_device,
+                                                n,
+                                                1,
+                                                elemSize,
+                                                x,
+                                                n,
+                                                stridex,
+                                                y,
+                                                n,
+                                                stridey,
+                                                batchCount,
+                                                stream,
+                                                true);
+        return hipblas_copy_strided_batched(to_device,
+                                            1,
+                                            n,
+                                            elemSize,
+                                            x,
+                                            incx,
+                                            stridex,
+                                            y,
+                                            incy,
+                                            stridey,
+                                            batchCount,
+                                            stream,
+                                            true);
+    }
+
+    // Arrays of pointers the same number of elements apart, as batched
+    // allocations usually are, are copied as a strided batch
+    bool regular_stride(const void* const ptrs[],
+                        int               batchCount,
+                        int               elemSize,
+                        hipblasStride&    stride)
+    {
+        stride = 0;
+        if(batchCount < 2)
+            return true;
+        auto    base = reinterpret_cast<intptr_t>(ptrs[0]);
+        int64_t step = reinterpret_cast<intptr_t>(ptrs[1]) - base;
+        if(step < 0 || step % elemSize)
+            return false;
+        for(int b = 2; b < batchCount; b++)
+            if(reinterpret_cast<intptr_t>(ptrs[b]) - base != step * b)
+                return false;
+        stride = step / elemSize;
+        return true;
+    }
+
+    hipblasStatus_t copy_vectors_batched(bool              to_device,
+                                         int               n,
+                                         int               elemSize,
+                                         const void* const x[],
+                                         int               incx,
+                                         void* const       y[],
+                                         int               incy,
+                                         int               batchCount,
+                                         hipStream_t       stream)
+    {
+        hipblasStride stridex, stridey;
+        if(regular_stride(x, batchCount, elemSize, stridex)
+           && regular_stride(y, batchCount, elemSize, stridey))
+            return copy_vectors(to_device,
+                                n,
+                                elemSize,
+                                x[0],
+                                incx,
+                                stridex,
+                                y[0],
+                                incy,
+                                stridey,
+                                batchCount,
+                                stream);
+
+        for(int b = 0; b < batchCount; b++)
+        {
+            hipblasStatus_t status
+                = copy_vectors(to_device, n, elemSize, x[b], incx, 0, y[b], incy, 0, 1, stream);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t copy_matrices_batched(bool              to_device,
+                                          int               rows,
+                                          int               cols,
+                                          int               elemSize,
+                                          const void* const A[],
+                                          int               lda,
+                                          void* const       B[],
+                                          int               ldb,
+                                          int               batchCount,
+                                          hipStream_t       stream)
+    {
+        hipblasStride strideA, strideB;
+        if(regular_stride(A, batchCount, elemSize, strideA)
+           && regular_stride(B, batchCount, elemSize, strideB))
+            return hipblas_copy_strided_batched(to_device,
+                                                rows,
+                                                cols,
+                                                elemSize,
+                                                A[0],
+                                                lda,
+                                                strideA,
+                                                B[0],
+                                                ldb,
+                                                strideB,
+                                                batchCount,
+                                                stream,
+                                                true);
+
+        for(int b = 0; b < batchCount; b++)
+        {
+            hipblasStatus_t status = hipblas_copy_strided_batched(
+                to_device, rows, cols, elemSize, A[b], lda, 0, B[b], ldb, 0, 1, stream, true);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetVectorBatchedAsync(int               n,
+                                             int               elemSize,
+                                             const void* const x[],
+                                             int               incx,
+                                             void* const       y[],
+                                             int               incy,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(vector_args_invalid(n, elemSize, incx, incy, batchCount))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_vectors_batched(true, n, elemSize, x, incx, y, incy, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetVectorBatchedAsync(int               n,
+                                             int               elemSize,
+                                             const void* const x[],
+                                             int               incx,
+                                             void* const       y[],
+                                             int               incy,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(vector_args_invalid(n, elemSize, incx, incy, batchCount))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_vectors_batched(false, n, elemSize, x, incx, y, incy, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetVectorStridedBatchedAsync(int           n,
+                                                    int           elemSize,
+                                                    const void*   x,
+                                                    int           incx,
+                                                    hipblasStride stridex,
+                                                    void*         y,
+                                                    int           incy,
+                                                    hipblasStride stridey,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(vector_args_invalid(n, elemSize, incx, incy, batchCount) || stridex < 0 || stridey < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_vectors(true, n, elemSize, x, incx, stridex, y, incy, stridey, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetVectorStridedBatchedAsync(int           n,
+                                                    int           elemSize,
+                                                    const void*   x,
+                                                    int           incx,
+                                                    hipblasStride stridex,
+                                                    void*         y,
+                                                    int           incy,
+                                                    hipblasStride stridey,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(vector_args_invalid(n, elemSize, incx, incy, batchCount) || stridex < 0 || stridey < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(n == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_vectors(false, n, elemSize, x, incx, stridex, y, incy, stridey, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(matrix_args_invalid(rows, cols, elemSize, lda, ldb, batchCount))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(rows == 0 || cols == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_matrices_batched(true, rows, cols, elemSize, AP, lda, BP, ldb, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(matrix_args_invalid(rows, cols, elemSize, lda, ldb, batchCount))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(rows == 0 || cols == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return copy_matrices_batched(false, rows, cols, elemSize, AP, lda, BP, ldb, batchCount, stream);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(matrix_args_invalid(rows, cols, elemSize, lda, ldb, batchCount) || strideA < 0
+       || strideB < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(rows == 0 || cols == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_copy_strided_batched(
+        true, rows, cols, elemSize, AP, lda, strideA, BP, ldb, strideB, batchCount, stream, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(matrix_args_invalid(rows, cols, elemSize, lda, ldb, batchCount) || strideA < 0
+       || strideB < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(rows == 0 || cols == 0 || batchCount == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!AP || !BP)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_copy_strided_batched(
+        false, rows, cols, elemSize, AP, lda, strideA, BP, ldb, strideB, batchCount, stream, true);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
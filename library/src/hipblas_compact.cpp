@@ -0,0 +1,253 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "compact.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+
+extern "C" {
+
+hipblasStatus_t hipblasSgepackCompact(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const float*    A,
+                                      int             lda,
+                                      hipblasStride   stride_a,
+                                      float*          Ac,
+                                      int             ldac,
+                                      int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<float>(handle, false, m, n, lda, stride_a, ldac, A, Ac, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgepackCompact(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const double*   A,
+                                      int             lda,
+                                      hipblasStride   stride_a,
+                                      double*         Ac,
+                                      int             ldac,
+                                      int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<double>(handle, false, m, n, lda, stride_a, ldac, A, Ac, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgepackCompact(hipblasHandle_t       handle,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      hipblasStride         stride_a,
+                                      hipblasComplex*       Ac,
+                                      int                   ldac,
+                                      int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<hipblasComplex>(handle,
+                                        false,
+                                        m,
+                                        n,
+                                        lda,
+                                        stride_a,
+                                        ldac,
+                                        A,
+                                        Ac,
+                                        batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgepackCompact(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      hipblasStride               stride_a,
+                                      hipblasDoubleComplex*       Ac,
+                                      int                         ldac,
+                                      int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<hipblasDoubleComplex>(handle,
+                                              false,
+                                              m,
+                                              n,
+                                              lda,
+                                              stride_a,
+                                              ldac,
+                                              A,
+                                              Ac,
+                                              batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeunpackCompact(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const float*    Ac,
+                                        int             ldac,
+                                        float*          A,
+                                        int             lda,
+                                        hipblasStride   stride_a,
+                                        int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<float>(handle, true, m, n, lda, stride_a, ldac, Ac, A, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeunpackCompact(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const double*   Ac,
+                                        int             ldac,
+                                        double*         A,
+                                        int             lda,
+                                        hipblasStride   stride_a,
+                                        int             batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<double>(handle, true, m, n, lda, stride_a, ldac, Ac, A, batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeunpackCompact(hipblasHandle_t       handle,
+                                        int                   m,
+                                        int                   n,
+                                        const hipblasComplex* Ac,
+                                        int                   ldac,
+                                        hipblasComplex*       A,
+                                        int                   lda,
+                                        hipblasStride         stride_a,
+                                        int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<hipblasComplex>(handle,
+                                        true,
+                                        m,
+                                        n,
+                                        lda,
+                                        stride_a,
+                                        ldac,
+                                        Ac,
+                                        A,
+                                        batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeunpackCompact(hipblasHandle_t             handle,
+                                        int                         m,
+                                        int                         n,
+                                        const hipblasDoubleComplex* Ac,
+                                        int                         ldac,
+                                        hipblasDoubleComplex*       A,
+                                        int                         lda,
+                                        hipblasStride               stride_a,
+                                        int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return compact_pack<hipblasDoubleComplex>(handle,
+                                              true,
+                                              m,
+                                              n,
+                                              lda,
+                                              stride_a,
+                                              ldac,
+                                              Ac,
+                                              A,
+                                              batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
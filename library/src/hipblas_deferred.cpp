@@ -0,0 +1,449 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "deferred.hpp"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "functions.hpp"
+#include "handle_state.hpp"
+#include "thread_stream.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+
+std::atomic<int>  hipblas_deferred_handles{0};
+thread_local bool hipblas_deferred_internal = false;
+
+namespace
+{
+    // Guards every queue, since the entry points without a handle may flush a
+    // queue on their stream from another thread, and lists the queues holding
+    // calls so that they need not visit every handle
+    std::mutex                                deferred_lock;
+    std::vector<hipblas_deferred_gemm_queue*> pending_queues;
+
+    // Byte stride if every pointer is base + i * stride with a whole number of
+    // elements between them, otherwise -1
+    int64_t constant_stride(const std::vector<char*>& p, size_t elem_size)
+    {
+        int64_t stride = p[1] - p[0];
+        if(stride < 0 || stride % elem_size)
+            return -1;
+        for(size_t i = 2; i < p.size(); i++)
+            if(p[i] - p[i - 1] != stride)
+                return -1;
+        return stride;
+    }
+
+    template <typename T>
+    hipblasStatus_t issue_queue(hipblasHandle_t handle, hipblas_deferred_gemm_queue& q)
+    {
+        using F         = hipblas_functions<T>;
+        int batch_count = int(q.C.size());
+        auto alpha      = (const T*)q.alpha;
+        auto beta       = (const T*)q.beta;
+
+        if(batch_count == 1)
+            return F::gemm(handle,
+                           q.transA,
+                           q.transB,
+                           q.m,
+                           q.n,
+                           q.k,
+                           alpha,
+                           (const T*)q.A[0],
+                           q.lda,
+                           (const T*)q.B[0],
+                           q.ldb,
+                           beta,
+                           (T*)q.C[0],
+                           q.ldc);
+
+        // Calls laid out at regular offsets become one strided batched call,
+        // which needs no pointer arrays on the device
+        int64_t stride_a = constant_stride(q.A, sizeof(T));
+        int64_t stride_b = constant_stride(q.B, sizeof(T));
+        int64_t stride_c = constant_stride(q.C, sizeof(T));
+        if(stride_a >= 0 && stride_b >= 0 && stride_c > 0)
+            return F::gemm_strided_batched(handle,
+                                           q.transA,
+                                           q.transB,
+                                           q.m,
+                                           q.n,
+                                           q.k,
+                                           alpha,
+                                           (const T*)q.A[0],
+                                           q.lda,
+                                           stride_a / int64_t(sizeof(T)),
+                                           (const T*)q.B[0],
+                                           q.ldb,
+                                           stride_b / int64_t(sizeof(T)),
+                                           beta,
+                                           (T*)q.C[0],
+                                           q.ldc,
+                                           stride_c / int64_t(sizeof(T)),
+                                           batch_count);
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        auto& slot        = q.slots[q.next_slot];
+        q.next_slot       = (q.next_slot + 1) % hipblas_deferred_gemm_queue::deferred_array_slots;
+        size_t array_size = 3 * size_t(batch_count);
+
+        // The slot was last used deferred_array_slots flushes ago, so this
+        // rarely waits
+        if(slot.done && hipEventSynchronize(slot.done) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(!slot.done && hipEventCreateWithFlags(&slot.done, hipEventDisableTiming) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(slot.capacity < array_size)
+        {
+            (void)hipHostFree(slot.host);
+            (void)hipFree(slot.device);
+            slot.host     = nullptr;
+            slot.device   = nullptr;
+            slot.capacity = 0;
+            if(hipHostMalloc((void**)&slot.host, array_size * sizeof(void*)) != hipSuccess
+               || hipMalloc((void**)&slot.device, array_size * sizeof(void*)) != hipSuccess)
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            slot.capacity = array_size;
+        }
+
+        std::copy(q.A.begin(), q.A.end(), slot.host);
+        std::copy(q.B.begin(), q.B.end(), slot.host + batch_count);
+        std::copy(q.C.begin(), q.C.end(), slot.host + 2 * batch_count);
+        if(hipMemcpyAsync(slot.device,
+                          slot.host,
+                          array_size * sizeof(void*),
+                          hipMemcpyHostToDevice,
+                          stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        status = F::gemm_batched(handle,
+                                 q.transA,
+                                 q.transB,
+                                 q.m,
+                                 q.n,
+                                 q.k,
+                                 alpha,
+                                 (const T* const*)slot.device,
+                                 q.lda,
+                                 (const T* const*)(slot.device + batch_count),
+                                 q.ldb,
+                                 beta,
+                                 (T* const*)(slot.device + 2 * batch_count),
+                                 q.ldc,
+                                 batch_count);
+
+        if(hipEventRecord(slot.done, stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return status;
+    }
+
+    hipblasStatus_t issue_typed(hipblasHandle_t handle, hipblas_deferred_gemm_queue& q)
+    {
+        switch(q.precision)
+        {
+        case 'h':
+            return issue_queue<hipblasHalf>(handle, q);
+        case 's':
+            return issue_queue<float>(handle, q);
+        case 'd':
+            return issue_queue<double>(handle, q);
+        case 'c':
+            return issue_queue<hipblasComplex>(handle, q);
+        case 'z':
+            return issue_queue<hipblasDoubleComplex>(handle, q);
+        }
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // The queue is issued on the stream its calls were made on, which a thread
+    // bound by hipblasSetThreadStream may have switched the handle away from.
+    // Called with deferred_lock held.
+    hipblasStatus_t flush_queue(hipblasHandle_t handle, hipblas_deferred_gemm_queue& q)
+    {
+        if(!q.precision)
+            return HIPBLAS_STATUS_SUCCESS;
+        pending_queues.erase(std::find(pending_queues.begin(), pending_queues.end(), &q));
+
+        hipblas_internal_call_guard guard;
+        hipStream_t                 current = q.stream;
+        hipblasStatus_t             status  = hipblasGetStream(handle, &current);
+        if(status == HIPBLAS_STATUS_SUCCESS && current != q.stream)
+            status = hipblasSetStream(handle, q.stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = issue_typed(handle, q);
+        if(current != q.stream)
+        {
+            hipblasStatus_t restore = hipblasSetStream(handle, current);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = restore;
+        }
+
+        q.precision = 0;
+        q.A.clear();
+        q.B.clear();
+        q.C.clear();
+        return status;
+    }
+
+    // A new call may join the queue if it has the same parameters and neither
+    // writes memory a queued call touches nor reads memory a queued call writes
+    bool can_join(const hipblas_deferred_gemm_queue& q,
+                  size_t                             a_bytes,
+                  size_t                             b_bytes,
+                  size_t                             c_bytes,
+                  const char*                        A,
+                  const char*                        B,
+                  const char*                        C)
+    {
+        for(size_t i = 0; i < q.C.size(); i++)
+        {
+            if(hipblas_overlaps(C, c_bytes, q.A[i], a_bytes)
+               || hipblas_overlaps(C, c_bytes, q.B[i], b_bytes)
+               || hipblas_overlaps(C, c_bytes, q.C[i], c_bytes)
+               || hipblas_overlaps(A, a_bytes, q.C[i], c_bytes)
+               || hipblas_overlaps(B, b_bytes, q.C[i], c_bytes))
+                return false;
+        }
+        return true;
+    }
+}
+
+hipblas_deferred_gemm_queue::~hipblas_deferred_gemm_queue()
+{
+    // Calls still queued when the handle is destroyed are dropped
+    if(precision)
+    {
+        std::lock_guard<std::mutex> lock(deferred_lock);
+        pending_queues.erase(std::find(pending_queues.begin(), pending_queues.end(), this));
+    }
+    for(auto& slot : slots)
+    {
+        if(slot.done)
+        {
+            (void)hipEventSynchronize(slot.done);
+            (void)hipEventDestroy(slot.done);
+        }
+        (void)hipHostFree(slot.host);
+        (void)hipFree(slot.device);
+    }
+}
+
+hipblasStatus_t hipblas_deferred_gemm(hipblasHandle_t    handle,
+                                      char               precision,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const void*        A,
+                                      int                lda,
+                                      const void*        B,
+                                      int                ldb,
+                                      const void*        beta,
+                                      void*              C,
+                                      int                ldc,
+                                      bool&              queued)
+{
+    queued                      = false;
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // GEMMs are not queued while capturing a graph, the pointer array ring is
+    // not safe to capture
+    if(state->graph)
+        return hipblas_deferred_flush(handle);
+    if(state->deferred_mode != HIPBLAS_DEFERRED_MODE_ENABLED)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    auto& q = state->deferred;
+
+    // Only calls with host scalars and no quick return are deferred; anything
+    // else runs directly after the queue
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    {
+        hipblas_internal_call_guard guard;
+        hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    std::lock_guard<std::mutex> lock(deferred_lock);
+    if(pointer_mode != HIPBLAS_POINTER_MODE_HOST || !alpha || !beta || !A || !B || !C || m <= 0
+       || n <= 0 || k <= 0)
+        return flush_queue(handle, q);
+
+    size_t elem_size = hipblas_precision_size(precision);
+    size_t a_bytes   = hipblas_matrix_span(
+        transA == HIPBLAS_OP_N ? m : k, transA == HIPBLAS_OP_N ? k : m, lda, elem_size);
+    size_t b_bytes   = hipblas_matrix_span(
+        transB == HIPBLAS_OP_N ? k : n, transB == HIPBLAS_OP_N ? n : k, ldb, elem_size);
+    size_t c_bytes   = hipblas_matrix_span(m, n, ldc, elem_size);
+
+    bool same = q.precision == precision && q.transA == transA && q.transB == transB && q.m == m
+                && q.n == n && q.k == k && q.lda == lda && q.ldb == ldb && q.ldc == ldc
+                && q.stream == stream && !memcmp(q.alpha, alpha, elem_size)
+                && !memcmp(q.beta, beta, elem_size);
+    if(!same || !can_join(q, a_bytes, b_bytes, c_bytes, (const char*)A, (const char*)B, (char*)C))
+    {
+        hipblasStatus_t status = flush_queue(handle, q);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        q.precision = precision;
+        q.transA    = transA;
+        q.transB    = transB;
+        q.m         = m;
+        q.n         = n;
+        q.k         = k;
+        q.lda       = lda;
+        q.ldb       = ldb;
+        q.ldc       = ldc;
+        q.stream    = stream;
+        q.handle    = handle;
+        q.owner     = std::this_thread::get_id();
+        memcpy(q.alpha, alpha, elem_size);
+        memcpy(q.beta, beta, elem_size);
+        pending_queues.push_back(&q);
+    }
+
+    q.A.push_back((char*)A);
+    q.B.push_back((char*)B);
+    q.C.push_back((char*)C);
+    queued = true;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_deferred_flush(hipblasHandle_t handle)
+{
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status;
+    {
+        std::lock_guard<std::mutex> lock(deferred_lock);
+        status = flush_queue(handle, state->deferred);
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS && state->graph)
+        status = hipblas_graph_flush(handle, *state->graph);
+    return status;
+}
+
+hipblasStatus_t hipblas_deferred_flush_stream(hipStream_t stream)
+{
+    hipblasStatus_t result = HIPBLAS_STATUS_SUCCESS;
+    {
+        std::lock_guard<std::mutex>               lock(deferred_lock);
+        std::vector<hipblas_deferred_gemm_queue*> queues;
+        for(auto q : pending_queues)
+            if(q->owner == std::this_thread::get_id() || q->stream == stream)
+                queues.push_back(q);
+        for(auto q : queues)
+        {
+            hipblasStatus_t status = flush_queue(q->handle, *q);
+            if(result == HIPBLAS_STATUS_SUCCESS)
+                result = status;
+        }
+    }
+
+    // Graphs are captured in hipStreamCaptureModeThreadLocal, so only the
+    // calling thread can be recording one
+    hipblasStatus_t status = hipblas_graph_flush_thread();
+    return result != HIPBLAS_STATUS_SUCCESS ? result : status;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetDeferredMode(hipblasHandle_t handle, hipblasDeferredMode_t mode)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_DEFERRED_MODE_DISABLED && mode != HIPBLAS_DEFERRED_MODE_ENABLED)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.deferred_mode == mode)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status;
+    {
+        std::lock_guard<std::mutex> lock(deferred_lock);
+        status = flush_queue(handle, state.deferred);
+    }
+    state.deferred_mode = mode;
+    if(mode == HIPBLAS_DEFERRED_MODE_ENABLED)
+        hipblas_deferred_handles++;
+    else
+        hipblas_deferred_handles--;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetDeferredMode(hipblasHandle_t handle, hipblasDeferredMode_t* mode)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    *mode = state ? state->deferred_mode : HIPBLAS_DEFERRED_MODE_DISABLED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasFlush(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    return hipblas_deferred_flush(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
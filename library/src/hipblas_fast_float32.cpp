@@ -0,0 +1,641 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipblas.h"
+#include "batch_scalars.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "fast_float32.hpp"
+#include "handle_state.hpp"
+#include "thread_stream.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+std::atomic<int> hipblas_float32_handles{0};
+
+hipblasFloat32Mode_t hipblas_float32_mode(hipblasHandle_t handle)
+{
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    return state ? state->float32_mode : HIPBLAS_FLOAT32_MODE_DEFAULT;
+}
+
+hipblasStatus_t hipblas_float32_resolve(hipblasHandle_t       handle,
+                                        hipblasDatatype_t     a_type,
+                                        hipblasDatatype_t     b_type,
+                                        hipblasDatatype_t     c_type,
+                                        hipblasDatatype_t&    compute_type,
+                                        bool                  (*tf32_supported)(),
+                                        hipblas_float32_path& path)
+{
+    path        = hipblas_float32_path_full;
+    bool single = a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F;
+
+    hipblasFloat32Mode_t mode;
+    switch(compute_type)
+    {
+    case HIPBLAS_R_32F_FAST:
+        mode = HIPBLAS_FLOAT32_MODE_FAST;
+        break;
+    case HIPBLAS_R_32F_FAST_TF32:
+        mode = HIPBLAS_FLOAT32_MODE_FAST_TF32;
+        break;
+    case HIPBLAS_R_32F_FAST_16BX3:
+        mode = HIPBLAS_FLOAT32_MODE_FAST_16BX3;
+        break;
+    case HIPBLAS_R_32F:
+        if(!single || hipblas_deferred_internal)
+            return HIPBLAS_STATUS_SUCCESS;
+        mode = hipblas_float32_mode(handle);
+        break;
+    default:
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(!single)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    compute_type = HIPBLAS_R_32F;
+
+    // bf16x3 only when asked for: FAST without TF32 stays in f32
+    if(mode == HIPBLAS_FLOAT32_MODE_FAST_16BX3)
+        path = hipblas_float32_path_16bx3;
+    else if(mode != HIPBLAS_FLOAT32_MODE_DEFAULT && tf32_supported())
+        path = hipblas_float32_path_tf32;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+namespace
+{
+    // 1, 0 and -1 in f32 and 1 in bf16, uploaded to the head of each call's
+    // workspace for the split and for the GEMMs of device scalars
+    struct split_constants
+    {
+        float    one, zero, minus_one;
+        uint16_t bf16_one;
+    };
+
+    constexpr split_constants host_constants = {1, 0, -1, 0x3F80};
+    constexpr size_t          constants_size = 16;
+    static_assert(sizeof(split_constants) <= constants_size, "");
+
+    // Sizes of the split operands of a call, A and B being split once when
+    // their stride is 0, after the constants and an f32 scratch matrix of the
+    // larger
+    struct split_layout
+    {
+        int    rows_a, cols_a, count_a;
+        int    rows_b, cols_b, count_b;
+        size_t size_a, size_b, scratch;
+
+        split_layout(hipblasOperation_t transa,
+                     hipblasOperation_t transb,
+                     int                m,
+                     int                n,
+                     int                k,
+                     hipblasStride      stride_a,
+                     hipblasStride      stride_b,
+                     int                batch_count)
+            : rows_a(transa == HIPBLAS_OP_N ? m : k)
+            , cols_a(transa == HIPBLAS_OP_N ? k : m)
+            , count_a(stride_a ? batch_count : 1)
+            , rows_b(transb == HIPBLAS_OP_N ? k : n)
+            , cols_b(transb == HIPBLAS_OP_N ? n : k)
+            , count_b(stride_b ? batch_count : 1)
+            , size_a(size_t(rows_a) * cols_a)
+            , size_b(size_t(rows_b) * cols_b)
+            , scratch(std::max(size_a * count_a, size_b * count_b))
+        {
+        }
+
+        size_t bytes() const
+        {
+            return constants_size + scratch * sizeof(float)
+                   + 2 * (size_a * count_a + size_b * count_b) * sizeof(uint16_t);
+        }
+    };
+
+    // The split operands in a workspace laid out as split_layout describes,
+    // with the constants in the run's pointer mode
+    struct split_parts
+    {
+        split_constants*       device;
+        const split_constants* scalars;
+        float*                 S;
+        uint16_t *             a_hi, *a_lo, *b_hi, *b_lo;
+
+        split_parts(const batch_scalars& s, const split_layout& layout, void* W)
+            : device(static_cast<split_constants*>(W))
+            , scalars(s.on_host() ? &host_constants : device)
+            , S(reinterpret_cast<float*>(static_cast<char*>(W) + constants_size))
+            , a_hi(reinterpret_cast<uint16_t*>(S + layout.scratch))
+            , a_lo(a_hi + layout.size_a * layout.count_a)
+            , b_hi(a_lo + layout.size_a * layout.count_a)
+            , b_lo(b_hi + layout.size_b * layout.count_b)
+        {
+        }
+    };
+
+    // bf16 values of the upper halves of count f32 values
+    hipError_t upper_halves(uint16_t* dst, const float* src, size_t count, hipStream_t stream)
+    {
+        return hipMemcpy2DAsync(dst,
+                                sizeof(uint16_t),
+                                reinterpret_cast<const char*>(src) + sizeof(uint16_t),
+                                sizeof(float),
+                                sizeof(uint16_t),
+                                count,
+                                hipMemcpyDeviceToDevice,
+                                stream);
+    }
+
+    // Split the count f32 values packed in S into hi, their values truncated
+    // to bf16, and lo, the remainders truncated to bf16. The remainders are
+    // left in S by a GEMM adding -hi times a bf16 1 to it, which is exact as
+    // hi is S with fewer mantissa bits, so that the only strided copies are
+    // the two picking the upper halves.
+    hipblasStatus_t split_16bx3(const batch_scalars& s,
+                                const split_parts&   parts,
+                                float*               S,
+                                size_t               count,
+                                uint16_t*            hi,
+                                uint16_t*            lo)
+    {
+        if(upper_halves(hi, S, count, s.stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t done = 0; done < count && status == HIPBLAS_STATUS_SUCCESS; done += INT_MAX)
+        {
+            int chunk = int(std::min(count - done, size_t(INT_MAX)));
+            status    = hipblasGemmEx(s.handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      chunk,
+                                      1,
+                                      1,
+                                      &parts.scalars->minus_one,
+                                      hi + done,
+                                      HIPBLAS_R_16B,
+                                      chunk,
+                                      &parts.device->bf16_one,
+                                      HIPBLAS_R_16B,
+                                      1,
+                                      &parts.scalars->one,
+                                      S + done,
+                                      HIPBLAS_R_32F,
+                                      chunk,
+                                      HIPBLAS_R_32F,
+                                      HIPBLAS_GEMM_DEFAULT);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && upper_halves(lo, S, count, s.stream) != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return status;
+    }
+
+    // Upload the constants, then split A and B after pack(S, operand) has
+    // packed A (operand 0) or B (operand 1) into S with leading dimension rows
+    template <typename Pack>
+    hipblasStatus_t split_operands(const batch_scalars& s,
+                                   const split_layout&  layout,
+                                   const split_parts&   parts,
+                                   Pack                 pack)
+    {
+        if(hipMemcpyAsync(parts.device,
+                          &host_constants,
+                          sizeof(split_constants),
+                          hipMemcpyHostToDevice,
+                          s.stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipblasStatus_t status = pack(parts.S, 0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = split_16bx3(
+                s, parts, parts.S, layout.size_a * layout.count_a, parts.a_hi, parts.a_lo);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pack(parts.S, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = split_16bx3(
+                s, parts, parts.S, layout.size_b * layout.count_b, parts.b_hi, parts.b_lo);
+        return status;
+    }
+
+    // Pack count r by c f32 matrices X into S with leading dimension r
+    hipblasStatus_t pack_strided(const batch_scalars& s,
+                                 int                  r,
+                                 int                  c,
+                                 const float*         X,
+                                 int                  ldx,
+                                 hipblasStride        stride_x,
+                                 int                  count,
+                                 float*               S)
+    {
+        size_t     size  = size_t(r) * c;
+        size_t     width = r * sizeof(float);
+        hipError_t err   = hipSuccess;
+        if(count == 1 || stride_x == hipblasStride(ldx) * c)
+            err = hipMemcpy2DAsync(S,
+                                   width,
+                                   X,
+                                   ldx * sizeof(float),
+                                   width,
+                                   size_t(c) * count,
+                                   hipMemcpyDeviceToDevice,
+                                   s.stream);
+        else
+            for(int b = 0; b < count && err == hipSuccess; b++)
+                err = hipMemcpy2DAsync(S + b * size,
+                                       width,
+                                       X + b * stride_x,
+                                       ldx * sizeof(float),
+                                       width,
+                                       c,
+                                       hipMemcpyDeviceToDevice,
+                                       s.stream);
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // The same for an array of count device pointers, as one geamBatched into
+    // the members of S listed in S_ptrs. Backends without geamBatched read the
+    // array once and copy member by member.
+    hipblasStatus_t pack_batched(const batch_scalars& s,
+                                 const split_parts&   parts,
+                                 int                  r,
+                                 int                  c,
+                                 const float* const   X[],
+                                 int                  ldx,
+                                 int                  count,
+                                 float* const         S_ptrs[],
+                                 float*               S)
+    {
+        hipblasStatus_t status = hipblasSgeamBatched(s.handle,
+                                                     HIPBLAS_OP_N,
+                                                     HIPBLAS_OP_N,
+                                                     r,
+                                                     c,
+                                                     &parts.scalars->one,
+                                                     X,
+                                                     ldx,
+                                                     &parts.scalars->zero,
+                                                     X,
+                                                     ldx,
+                                                     S_ptrs,
+                                                     r,
+                                                     count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+
+        batch_scalars            members = s;
+        std::vector<const void*> x;
+        members.count = count;
+        status        = batch_scalars_pointers(members, (const void* const*)X, x);
+        for(int b = 0; b < count && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = pack_strided(
+                s, r, c, static_cast<const float*>(x[b]), ldx, 0, 1, S + b * size_t(r) * c);
+        return status;
+    }
+
+    bool invalid_16bx3(hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       int                lda,
+                       int                ldb,
+                       int                ldc,
+                       int                batch_count)
+    {
+        int rows_a = transa == HIPBLAS_OP_N ? m : k;
+        int rows_b = transb == HIPBLAS_OP_N ? k : n;
+        return m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, rows_a)
+               || ldb < std::max(1, rows_b) || ldc < std::max(1, m);
+    }
+
+    // Whether C = beta*C needs no products: k is 0, or alpha is known to be
+    bool no_products(const batch_scalars& s, int k)
+    {
+        return !k || (s.on_host() && *static_cast<const float*>(s.alpha) == 0);
+    }
+}
+
+hipblasStatus_t hipblas_gemm_16bx3(hipblasHandle_t    handle,
+                                   hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const void*        alpha,
+                                   const void*        A,
+                                   int                lda,
+                                   hipblasStride      stride_a,
+                                   const void*        B,
+                                   int                ldb,
+                                   hipblasStride      stride_b,
+                                   const void*        beta,
+                                   void*              C,
+                                   int                ldc,
+                                   hipblasStride      stride_c,
+                                   int                batch_count,
+                                   hipblasGemmAlgo_t  algo)
+{
+    if(invalid_16bx3(transa, transb, m, n, k, lda, ldb, ldc, batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, beta, sizeof(float), 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(no_products(s, k))
+        return hipblasGemmStridedBatchedEx(handle,
+                                           transa,
+                                           transb,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           A,
+                                           HIPBLAS_R_32F,
+                                           lda,
+                                           stride_a,
+                                           B,
+                                           HIPBLAS_R_32F,
+                                           ldb,
+                                           stride_b,
+                                           beta,
+                                           C,
+                                           HIPBLAS_R_32F,
+                                           ldc,
+                                           stride_c,
+                                           batch_count,
+                                           HIPBLAS_R_32F,
+                                           algo);
+    if(!A || !B || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    split_layout layout(transa, transb, m, n, k, stride_a, stride_b, batch_count);
+
+    auto body = [&](void* W) {
+        split_parts     parts(s, layout, W);
+        hipblasStatus_t status = split_operands(s, layout, parts, [&](float* S, int operand) {
+            return operand ? pack_strided(s,
+                                          layout.rows_b,
+                                          layout.cols_b,
+                                          static_cast<const float*>(B),
+                                          ldb,
+                                          stride_b,
+                                          layout.count_b,
+                                          S)
+                           : pack_strided(s,
+                                          layout.rows_a,
+                                          layout.cols_a,
+                                          static_cast<const float*>(A),
+                                          lda,
+                                          stride_a,
+                                          layout.count_a,
+                                          S);
+        });
+
+        // Smallest terms first, each accumulated into C in f32
+        const uint16_t* terms[3][2] = {{parts.a_lo, parts.b_hi},
+                                       {parts.a_hi, parts.b_lo},
+                                       {parts.a_hi, parts.b_hi}};
+        hipblasStride   split_sa    = stride_a ? layout.size_a : 0;
+        hipblasStride   split_sb    = stride_b ? layout.size_b : 0;
+        for(int t = 0; t < 3 && status == HIPBLAS_STATUS_SUCCESS; t++)
+            status = hipblasGemmStridedBatchedEx(handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 terms[t][0],
+                                                 HIPBLAS_R_16B,
+                                                 layout.rows_a,
+                                                 split_sa,
+                                                 terms[t][1],
+                                                 HIPBLAS_R_16B,
+                                                 layout.rows_b,
+                                                 split_sb,
+                                                 t ? &parts.scalars->one : beta,
+                                                 C,
+                                                 HIPBLAS_R_32F,
+                                                 ldc,
+                                                 stride_c,
+                                                 batch_count,
+                                                 HIPBLAS_R_32F,
+                                                 algo);
+        return status;
+    };
+    return batch_scalars_run(s, layout.bytes(), body, s.pointer_mode);
+}
+
+hipblasStatus_t hipblas_gemm_batched_16bx3(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const void*        alpha,
+                                           const void*        A[],
+                                           int                lda,
+                                           const void*        B[],
+                                           int                ldb,
+                                           const void*        beta,
+                                           void*              C[],
+                                           int                ldc,
+                                           int                batch_count,
+                                           hipblasGemmAlgo_t  algo)
+{
+    if(invalid_16bx3(transa, transb, m, n, k, lda, ldb, ldc, batch_count))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, beta, sizeof(float), 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(no_products(s, k))
+        return hipblasGemmBatchedEx(handle,
+                                    transa,
+                                    transb,
+                                    m,
+                                    n,
+                                    k,
+                                    alpha,
+                                    A,
+                                    HIPBLAS_R_32F,
+                                    lda,
+                                    B,
+                                    HIPBLAS_R_32F,
+                                    ldb,
+                                    beta,
+                                    C,
+                                    HIPBLAS_R_32F,
+                                    ldc,
+                                    batch_count,
+                                    HIPBLAS_R_32F,
+                                    algo);
+    if(!A || !B || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Every member is split into the workspace, as for a strided batch, with
+    // device arrays of pointers to the members packed into S, those of A then
+    // those of B, and to the members of each split part for the GEMMs
+    split_layout         layout(transa, transb, m, n, k, 1, 1, batch_count);
+    batch_scalars_layout w;
+    size_t               split   = w.add(layout.bytes());
+    size_t               arrays  = w.add(6 * size_t(batch_count) * sizeof(void*));
+    batch_scalars        members = s;
+    members.count                = batch_count;
+
+    auto body = [&](void* W) {
+        split_parts parts(s, layout, batch_scalars_part<char>(W, split));
+        void**      ptrs  = batch_scalars_part<void*>(W, arrays);
+        auto        array = [&](int p) { return ptrs + p * size_t(batch_count); };
+
+        void*  bases[6] = {parts.S, parts.S, parts.a_hi, parts.a_lo, parts.b_hi, parts.b_lo};
+        size_t sizes[6] = {layout.size_a * sizeof(float),
+                           layout.size_b * sizeof(float),
+                           layout.size_a * sizeof(uint16_t),
+                           layout.size_a * sizeof(uint16_t),
+                           layout.size_b * sizeof(uint16_t),
+                           layout.size_b * sizeof(uint16_t)};
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int p = 0; p < 6 && status == HIPBLAS_STATUS_SUCCESS; p++)
+            status = batch_scalars_upload_pointers(members,
+                                                   static_cast<char*>(bases[p]),
+                                                   hipblasStride(sizes[p]),
+                                                   reinterpret_cast<char**>(array(p)));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = split_operands(s, layout, parts, [&](float* S, int operand) {
+                return operand ? pack_batched(s,
+                                              parts,
+                                              layout.rows_b,
+                                              layout.cols_b,
+                                              reinterpret_cast<const float* const*>(B),
+                                              ldb,
+                                              batch_count,
+                                              reinterpret_cast<float* const*>(array(1)),
+                                              S)
+                               : pack_batched(s,
+                                              parts,
+                                              layout.rows_a,
+                                              layout.cols_a,
+                                              reinterpret_cast<const float* const*>(A),
+                                              lda,
+                                              batch_count,
+                                              reinterpret_cast<float* const*>(array(0)),
+                                              S);
+            });
+
+        // Smallest terms first, of the parts a_hi, a_lo, b_hi and b_lo at 2 to 5
+        const int terms[3][2] = {{3, 4}, {2, 5}, {2, 4}};
+        for(int t = 0; t < 3 && status == HIPBLAS_STATUS_SUCCESS; t++)
+            status = hipblasGemmBatchedEx(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          const_cast<const void**>(array(terms[t][0])),
+                                          HIPBLAS_R_16B,
+                                          layout.rows_a,
+                                          const_cast<const void**>(array(terms[t][1])),
+                                          HIPBLAS_R_16B,
+                                          layout.rows_b,
+                                          t ? &parts.scalars->one : beta,
+                                          C,
+                                          HIPBLAS_R_32F,
+                                          ldc,
+                                          batch_count,
+                                          HIPBLAS_R_32F,
+                                          algo);
+        return status;
+    };
+    return batch_scalars_run(s, w.bytes, body, s.pointer_mode);
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetFloat32Mode(hipblasHandle_t handle, hipblasFloat32Mode_t mode)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_FLOAT32_MODE_DEFAULT && mode != HIPBLAS_FLOAT32_MODE_FAST
+       && mode != HIPBLAS_FLOAT32_MODE_FAST_TF32 && mode != HIPBLAS_FLOAT32_MODE_FAST_16BX3)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(mode == HIPBLAS_FLOAT32_MODE_DEFAULT && !hipblas_find_handle_state(handle))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.float32_mode == mode)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state.float32_mode == HIPBLAS_FLOAT32_MODE_DEFAULT)
+        hipblas_float32_handles++;
+    else if(mode == HIPBLAS_FLOAT32_MODE_DEFAULT)
+        hipblas_float32_handles--;
+    state.float32_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetFloat32Mode(hipblasHandle_t handle, hipblasFloat32Mode_t* mode)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = hipblas_float32_mode(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "gemm_broadcast.hpp"
+#include <climits>
+#include <cstdlib>
+
+namespace
+{
+    bool gemm_broadcast_enabled()
+    {
+        static const bool enabled = [] {
+            const char* env = getenv("HIPBLAS_GEMM_BROADCAST");
+            return !env || atoi(env) != 0;
+        }();
+        return enabled;
+    }
+}
+
+bool hipblas_gemm_collapse_broadcast(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int&               m,
+                                     int&               n,
+                                     int                lda,
+                                     int                ldb,
+                                     int                ldc,
+                                     int64_t            stride_a,
+                                     int64_t            stride_b,
+                                     int64_t            stride_c,
+                                     int&               batch_count)
+{
+    if(batch_count <= 1 || m <= 0 || n <= 0 || !gemm_broadcast_enabled())
+        return false;
+
+    const int64_t batch = batch_count;
+    if(stride_a == 0 && n * batch <= INT_MAX)
+    {
+        // B is k x n*batch, or n*batch x k transposed, with leading dimension ldb
+        bool b_packed = transB == HIPBLAS_OP_N ? stride_b == int64_t(ldb) * n
+                                               : stride_b == n && ldb >= n * batch;
+        if(b_packed && stride_c == int64_t(ldc) * n)
+        {
+            n           = int(n * batch);
+            batch_count = 1;
+            return true;
+        }
+    }
+    else if(stride_b == 0 && m * batch <= INT_MAX)
+    {
+        // A is m*batch x k, or k x m*batch transposed, with leading dimension lda
+        bool a_packed = transA == HIPBLAS_OP_N ? stride_a == m && lda >= m * batch
+                                               : stride_a == int64_t(lda) * m;
+        if(a_packed && stride_c == m && ldc >= m * batch)
+        {
+            m           = int(m * batch);
+            batch_count = 1;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "gemm_ex_d.hpp"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+namespace
+{
+    // Checks common to both forms. Sets done when D needs no copy.
+    hipblasStatus_t prepare_copy(hipblasHandle_t   handle,
+                                 hipblasDatatype_t c_type,
+                                 hipblasDatatype_t d_type,
+                                 hipblasDatatype_t compute_type,
+                                 int               m,
+                                 int               n,
+                                 const void*       beta,
+                                 int               ldc,
+                                 int               ldd,
+                                 int               batch_count,
+                                 hipStream_t&      stream,
+                                 bool&             done)
+    {
+        done = true;
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(c_type != d_type)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || batch_count < 0 || ldc < std::max(1, m) || ldd < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count || !hipblas_datatype_size(c_type))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(beta == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_internal_call_guard guard;
+        hipblasPointerMode_t        pointer_mode;
+        hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+        {
+            auto   bytes = static_cast<const unsigned char*>(beta);
+            size_t size  = hipblas_datatype_size(compute_type);
+            if(size && std::all_of(bytes, bytes + size, [](unsigned char b) { return !b; }))
+                return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        done = false;
+        return hipblasGetStream(handle, &stream);
+    }
+
+    // D[b] = C[b] for every member, member by member from the pointer arrays
+    // read back from the device, which may write them earlier on the stream
+    hipblasStatus_t copy_members(hipStream_t       stream,
+                                 hipblasDatatype_t type,
+                                 int               m,
+                                 int               n,
+                                 const void* const C[],
+                                 int               ldc,
+                                 void* const       D[],
+                                 int               ldd,
+                                 int               batch_count)
+    {
+        std::vector<const void*> c_ptrs(batch_count);
+        std::vector<void*>       d_ptrs(batch_count);
+        size_t                   ptr_bytes = batch_count * sizeof(void*);
+        if(hipMemcpyAsync(c_ptrs.data(), C, ptr_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(d_ptrs.data(), D, ptr_bytes, hipMemcpyDeviceToHost, stream)
+                  != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        size_t es = hipblas_datatype_size(type);
+        for(int b = 0; b < batch_count; b++)
+            if(c_ptrs[b] != d_ptrs[b] || ldc != ldd)
+                if(hipMemcpy2DAsync(d_ptrs[b],
+                                    ldd * es,
+                                    c_ptrs[b],
+                                    ldc * es,
+                                    m * es,
+                                    n,
+                                    hipMemcpyDeviceToDevice,
+                                    stream)
+                   != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // D[b] = C[b] for every member as one geamBatched of the type of the
+    // matrices, so that the pointer arrays never leave the device
+    template <typename T, typename Geam>
+    hipblasStatus_t geam_copy(Geam              geam,
+                              hipblasHandle_t   handle,
+                              hipblasDatatype_t type,
+                              int               m,
+                              int               n,
+                              const void* const C[],
+                              int               ldc,
+                              void* const       D[],
+                              int               ldd,
+                              int               batch_count)
+    {
+        alignas(16) unsigned char one[16] = {}, zero[16] = {};
+        hipblas_write_one(type, one);
+        return geam(handle,
+                    HIPBLAS_OP_N,
+                    HIPBLAS_OP_N,
+                    m,
+                    n,
+                    reinterpret_cast<const T*>(one),
+                    reinterpret_cast<const T* const*>(C),
+                    ldc,
+                    reinterpret_cast<const T*>(zero),
+                    reinterpret_cast<const T* const*>(C),
+                    ldc,
+                    reinterpret_cast<T* const*>(D),
+                    ldd,
+                    batch_count);
+    }
+}
+
+hipblasStatus_t hipblas_gemm_ex_d_copy(hipblasHandle_t   handle,
+                                       hipblasDatatype_t c_type,
+                                       hipblasDatatype_t d_type,
+                                       hipblasDatatype_t compute_type,
+                                       int               m,
+                                       int               n,
+                                       const void*       beta,
+                                       const void*       C,
+                                       int               ldc,
+                                       hipblasStride     stride_c,
+                                       void*             D,
+                                       int               ldd,
+                                       hipblasStride     stride_d,
+                                       int               batch_count)
+{
+    hipStream_t     stream;
+    bool            done;
+    hipblasStatus_t status = prepare_copy(
+        handle, c_type, d_type, compute_type, m, n, beta, ldc, ldd, batch_count, stream, done);
+    if(done || (C == D && ldc == ldd && (batch_count == 1 || stride_c == stride_d)))
+        return status;
+
+    // One 3D copy when every matrix starts on a whole column of both strides
+    size_t es     = hipblas_datatype_size(c_type);
+    auto   slices = [&](int ld, hipblasStride stride) {
+        return stride >= 0 && stride % ld == 0 && stride / ld >= n;
+    };
+    if(batch_count > 1 && slices(ldc, stride_c) && slices(ldd, stride_d))
+    {
+        hipMemcpy3DParms params{};
+        params.srcPtr = make_hipPitchedPtr(const_cast<void*>(C), ldc * es, m * es, stride_c / ldc);
+        params.dstPtr = make_hipPitchedPtr(D, ldd * es, m * es, stride_d / ldd);
+        params.extent = make_hipExtent(m * es, n, batch_count);
+        params.kind   = hipMemcpyDeviceToDevice;
+        return hipMemcpy3DAsync(&params, stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                               : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    for(int b = 0; b < batch_count; b++)
+        if(hipMemcpy2DAsync(static_cast<char*>(D) + b * stride_d * es,
+                            ldd * es,
+                            static_cast<const char*>(C) + b * stride_c * es,
+                            ldc * es,
+                            m * es,
+                            n,
+                            hipMemcpyDeviceToDevice,
+                            stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_gemm_batched_ex_d_copy(hipblasHandle_t   handle,
+                                               hipblasDatatype_t c_type,
+                                               hipblasDatatype_t d_type,
+                                               hipblasDatatype_t compute_type,
+                                               int               m,
+                                               int               n,
+                                               const void*       beta,
+                                               const void* const C[],
+                                               int               ldc,
+                                               void* const       D[],
+                                               int               ldd,
+                                               int               batch_count)
+{
+    hipStream_t     stream;
+    bool            done;
+    hipblasStatus_t status = prepare_copy(
+        handle, c_type, d_type, compute_type, m, n, beta, ldc, ldd, batch_count, stream, done);
+    if(done || (C == D && ldc == ldd))
+        return status;
+    if(C == nullptr || D == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The scalars of the copy live on the host, whatever the handle's pointer mode
+    hipblas_internal_call_guard guard;
+    hipblasPointerMode_t        pointer_mode;
+    status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    switch(c_type)
+    {
+    case HIPBLAS_R_32F:
+        status = geam_copy<float>(
+            hipblasSgeamBatched, handle, c_type, m, n, C, ldc, D, ldd, batch_count);
+        break;
+    case HIPBLAS_R_64F:
+        status = geam_copy<double>(
+            hipblasDgeamBatched, handle, c_type, m, n, C, ldc, D, ldd, batch_count);
+        break;
+    case HIPBLAS_C_32F:
+        status = geam_copy<hipblasComplex>(
+            hipblasCgeamBatched, handle, c_type, m, n, C, ldc, D, ldd, batch_count);
+        break;
+    case HIPBLAS_C_64F:
+        status = geam_copy<hipblasDoubleComplex>(
+            hipblasZgeamBatched, handle, c_type, m, n, C, ldc, D, ldd, batch_count);
+        break;
+    default:
+        // The backends have no batched copy of the 16-bit and integer types, so
+        // their pointer arrays are read once on the host
+        status = copy_members(stream, c_type, m, n, C, ldc, D, ldd, batch_count);
+    }
+
+    if(pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+    return status;
+}
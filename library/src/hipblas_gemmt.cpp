@@ -0,0 +1,582 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "gemmt.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+
+extern "C" {
+
+hipblasStatus_t hipblasSgemmt(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const float*       alpha,
+                              const float*       A,
+                              int                lda,
+                              const float*       B,
+                              int                ldb,
+                              const float*       beta,
+                              float*             C,
+                              int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<float>(handle,
+                                        uplo,
+                                        transa,
+                                        transb,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        0,
+                                        B,
+                                        ldb,
+                                        0,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        0,
+                                        1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmt(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<double>(handle,
+                                         uplo,
+                                         transa,
+                                         transb,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         0,
+                                         B,
+                                         ldb,
+                                         0,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmt(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              hipblasOperation_t    transa,
+                              hipblasOperation_t    transb,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              const hipblasComplex* B,
+                              int                   ldb,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       C,
+                              int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<hipblasComplex>(handle,
+                                                 uplo,
+                                                 transa,
+                                                 transb,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 lda,
+                                                 0,
+                                                 B,
+                                                 ldb,
+                                                 0,
+                                                 beta,
+                                                 C,
+                                                 ldc,
+                                                 0,
+                                                 1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmt(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              hipblasOperation_t          transa,
+                              hipblasOperation_t          transb,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              const hipblasDoubleComplex* B,
+                              int                         ldb,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       C,
+                              int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<hipblasDoubleComplex>(handle,
+                                                       uplo,
+                                                       transa,
+                                                       transb,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       lda,
+                                                       0,
+                                                       B,
+                                                       ldb,
+                                                       0,
+                                                       beta,
+                                                       C,
+                                                       ldc,
+                                                       0,
+                                                       1);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmtBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     int                lda,
+                                     const float* const B[],
+                                     int                ldb,
+                                     const float*       beta,
+                                     float* const       C[],
+                                     int                ldc,
+                                     int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_batched<float>(handle,
+                                uplo,
+                                transa,
+                                transb,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                beta,
+                                C,
+                                ldc,
+                                batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmtBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     hipblasOperation_t  transa,
+                                     hipblasOperation_t  transb,
+                                     int                 n,
+                                     int                 k,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     int                 lda,
+                                     const double* const B[],
+                                     int                 ldb,
+                                     const double*       beta,
+                                     double* const       C[],
+                                     int                 ldc,
+                                     int                 batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_batched<double>(handle,
+                                 uplo,
+                                 transa,
+                                 transb,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 B,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmtBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transa,
+                                     hipblasOperation_t          transb,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     const hipblasComplex* const B[],
+                                     int                         ldb,
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       C[],
+                                     int                         ldc,
+                                     int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_batched<hipblasComplex>(handle,
+                                         uplo,
+                                         transa,
+                                         transb,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         B,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmtBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     hipblasOperation_t                transa,
+                                     hipblasOperation_t                transb,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     const hipblasDoubleComplex* const B[],
+                                     int                               ldb,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       C[],
+                                     int                               ldc,
+                                     int                               batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_batched<hipblasDoubleComplex>(handle,
+                                               uplo,
+                                               transa,
+                                               transb,
+                                               n,
+                                               k,
+                                               alpha,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               beta,
+                                               C,
+                                               ldc,
+                                               batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmtStridedBatched(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            hipblasStride      stride_a,
+                                            const float*       B,
+                                            int                ldb,
+                                            hipblasStride      stride_b,
+                                            const float*       beta,
+                                            float*             C,
+                                            int                ldc,
+                                            hipblasStride      stride_c,
+                                            int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<float>(handle,
+                                        uplo,
+                                        transa,
+                                        transb,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        stride_a,
+                                        B,
+                                        ldb,
+                                        stride_b,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        stride_c,
+                                        batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmtStridedBatched(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            hipblasStride      stride_a,
+                                            const double*      B,
+                                            int                ldb,
+                                            hipblasStride      stride_b,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc,
+                                            hipblasStride      stride_c,
+                                            int                batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<double>(handle,
+                                         uplo,
+                                         transa,
+                                         transb,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         stride_a,
+                                         B,
+                                         ldb,
+                                         stride_b,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         stride_c,
+                                         batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmtStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transa,
+                                            hipblasOperation_t    transb,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         stride_a,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            hipblasStride         stride_b,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc,
+                                            hipblasStride         stride_c,
+                                            int                   batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<hipblasComplex>(handle,
+                                                 uplo,
+                                                 transa,
+                                                 transb,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A,
+                                                 lda,
+                                                 stride_a,
+                                                 B,
+                                                 ldb,
+                                                 stride_b,
+                                                 beta,
+                                                 C,
+                                                 ldc,
+                                                 stride_c,
+                                                 batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmtStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               stride_a,
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
+                                            hipblasStride               stride_b,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc,
+                                            hipblasStride               stride_c,
+                                            int                         batch_count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemmt_strided_batched<hipblasDoubleComplex>(handle,
+                                                       uplo,
+                                                       transa,
+                                                       transb,
+                                                       n,
+                                                       k,
+                                                       alpha,
+                                                       A,
+                                                       lda,
+                                                       stride_a,
+                                                       B,
+                                                       ldb,
+                                                       stride_b,
+                                                       beta,
+                                                       C,
+                                                       ldc,
+                                                       stride_c,
+                                                       batch_count);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,644 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "exceptions.hpp"
+#include "functions.hpp"
+#include "graph.hpp"
+#include "handle_state.hpp"
+#include "thread_stream.hpp"
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+    // Handles that began a capture on this thread
+    thread_local std::vector<hipblasHandle_t> capturing_handles;
+
+    // Arithmetic type for combining host scalars
+    template <typename T>
+    struct graph_scalar
+    {
+        using type = T;
+    };
+
+    template <>
+    struct graph_scalar<hipblasComplex>
+    {
+        using type = std::complex<float>;
+    };
+
+    template <>
+    struct graph_scalar<hipblasDoubleComplex>
+    {
+        using type = std::complex<double>;
+    };
+
+    template <typename T>
+    typename graph_scalar<T>::type load_scalar(const unsigned char* bytes)
+    {
+        typename graph_scalar<T>::type value;
+        memcpy(&value, bytes, sizeof(value));
+        return value;
+    }
+
+    template <typename T>
+    void store_scalar(unsigned char* bytes, typename graph_scalar<T>::type value)
+    {
+        memcpy(bytes, &value, sizeof(value));
+    }
+
+    hipblasStatus_t
+        dot(hipblasHandle_t handle, const float* x, const float* y, const hipblas_graph_op& op)
+    {
+        return hipblasSdot(handle, op.n, x, op.incx, y, op.incy, (float*)op.result);
+    }
+
+    hipblasStatus_t
+        dot(hipblasHandle_t handle, const double* x, const double* y, const hipblas_graph_op& op)
+    {
+        return hipblasDdot(handle, op.n, x, op.incx, y, op.incy, (double*)op.result);
+    }
+
+    // Byte stride if the pointer selected by member is base + i * stride for
+    // every call in [first, last) with a whole number of elements between
+    // them, otherwise -1
+    int64_t constant_stride(const hipblas_graph_op* first,
+                            const hipblas_graph_op* last,
+                            char* hipblas_graph_op::*member,
+                            size_t                  elem_size)
+    {
+        int64_t stride = first[1].*member - first[0].*member;
+        if(stride < 0 || stride % elem_size)
+            return -1;
+        for(auto op = first + 2; op < last; op++)
+            if(op->*member - op[-1].*member != stride)
+                return -1;
+        return stride;
+    }
+
+    template <typename T>
+    hipblasStatus_t issue_op(hipblasHandle_t handle, const hipblas_graph_op& op)
+    {
+        using F = hipblas_functions<T>;
+        switch(op.kind)
+        {
+        case hipblas_graph_op::op_scal:
+            return F::scal(handle, op.n, (const T*)op.alpha, (T*)op.x, op.incx);
+        case hipblas_graph_op::op_axpy:
+            return F::axpy(
+                handle, op.n, (const T*)op.alpha, (const T*)op.x, op.incx, (T*)op.y, op.incy);
+        case hipblas_graph_op::op_gemv:
+            return F::gemv(handle,
+                           op.trans,
+                           op.m,
+                           op.n,
+                           (const T*)op.alpha,
+                           (const T*)op.A,
+                           op.lda,
+                           (const T*)op.x,
+                           op.incx,
+                           (const T*)op.beta,
+                           (T*)op.y,
+                           op.incy);
+        case hipblas_graph_op::op_dot:
+            if constexpr(std::is_same<T, float>{} || std::is_same<T, double>{})
+                return dot(handle, (const T*)op.x, (const T*)op.y, op);
+            break;
+        }
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // Issue the calls in [first, last), which can_join accepted as one run
+    template <typename T>
+    hipblasStatus_t
+        issue_run(hipblasHandle_t handle, hipblas_graph_op* first, hipblas_graph_op* last)
+    {
+        using F   = hipblas_functions<T>;
+        using S   = typename graph_scalar<T>::type;
+        int count = int(last - first);
+
+        // scal and axpy calls updating one vector y from at most one other vector x
+        // leave y = beta * y + alpha * x
+        if(count > 1 && first->kind != hipblas_graph_op::op_gemv
+           && first->kind != hipblas_graph_op::op_dot)
+        {
+            S                 alpha = 0, beta = 1;
+            hipblas_graph_op* axpy  = nullptr;
+            for(auto op = first; op < last; op++)
+            {
+                S a = load_scalar<T>(op->alpha);
+                if(op->kind == hipblas_graph_op::op_scal)
+                {
+                    alpha *= a;
+                    beta *= a;
+                }
+                else
+                {
+                    alpha += a;
+                    axpy = op;
+                }
+            }
+
+            if(!axpy)
+            {
+                store_scalar<T>(first->alpha, beta);
+                return issue_op<T>(handle, *first);
+            }
+            store_scalar<T>(axpy->alpha, alpha);
+            if(beta == S(1))
+                return issue_op<T>(handle, *axpy);
+
+            // Vectors with positive increments are the rows of 1 x n matrices, which one
+            // in-place GEAM updates in a single pass
+            T h_beta;
+            store_scalar<T>((unsigned char*)&h_beta, beta);
+            if(axpy->incx > 0 && axpy->incy > 0)
+                return F::geam(handle,
+                               HIPBLAS_OP_N,
+                               HIPBLAS_OP_N,
+                               1,
+                               axpy->n,
+                               (const T*)axpy->alpha,
+                               (const T*)axpy->x,
+                               axpy->incx,
+                               &h_beta,
+                               (const T*)axpy->y,
+                               axpy->incy,
+                               (T*)axpy->y,
+                               axpy->incy);
+
+            hipblasStatus_t status = F::scal(handle, axpy->n, &h_beta, (T*)axpy->y, axpy->incy);
+            return status != HIPBLAS_STATUS_SUCCESS ? status : issue_op<T>(handle, *axpy);
+        }
+
+        if(count > 1 && first->kind == hipblas_graph_op::op_gemv)
+        {
+            int     x_len    = first->trans == HIPBLAS_OP_N ? first->n : first->m;
+            int     y_len    = first->trans == HIPBLAS_OP_N ? first->m : first->n;
+            int64_t stride_x = constant_stride(first, last, &hipblas_graph_op::x, sizeof(T));
+            int64_t stride_y = constant_stride(first, last, &hipblas_graph_op::y, sizeof(T));
+
+            // Vectors laid out as the columns of a matrix make one GEMM that
+            // reads A once
+            if(first->incx == 1 && first->incy == 1 && stride_x >= int64_t(x_len * sizeof(T))
+               && stride_y >= int64_t(y_len * sizeof(T)))
+                return F::gemm(handle,
+                               first->trans,
+                               HIPBLAS_OP_N,
+                               y_len,
+                               count,
+                               x_len,
+                               (const T*)first->alpha,
+                               (const T*)first->A,
+                               first->lda,
+                               (const T*)first->x,
+                               int(stride_x / sizeof(T)),
+                               (const T*)first->beta,
+                               (T*)first->y,
+                               int(stride_y / sizeof(T)));
+
+            if(stride_x >= 0 && stride_y > 0)
+                return F::gemv_strided_batched(handle,
+                                               first->trans,
+                                               first->m,
+                                               first->n,
+                                               (const T*)first->alpha,
+                                               (const T*)first->A,
+                                               first->lda,
+                                               0,
+                                               (const T*)first->x,
+                                               first->incx,
+                                               stride_x / int64_t(sizeof(T)),
+                                               (const T*)first->beta,
+                                               (T*)first->y,
+                                               first->incy,
+                                               stride_y / int64_t(sizeof(T)),
+                                               count);
+        }
+
+        if constexpr(std::is_same<T, float>{} || std::is_same<T, double>{})
+        {
+            if(count > 1 && first->kind == hipblas_graph_op::op_dot)
+            {
+                int64_t stride_y = constant_stride(first, last, &hipblas_graph_op::y, sizeof(T));
+                int64_t stride_r
+                    = constant_stride(first, last, &hipblas_graph_op::result, sizeof(T));
+
+                // Dots against the columns of a matrix make one transposed GEMV
+                // that reads the shared vector once
+                if(first->incy == 1 && stride_y >= int64_t(first->n * sizeof(T)) && stride_r > 0)
+                {
+                    const T         one = 1, zero = 0;
+                    hipblasStatus_t status
+                        = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+                    if(status != HIPBLAS_STATUS_SUCCESS)
+                        return status;
+                    status = F::gemv(handle,
+                                     HIPBLAS_OP_T,
+                                     first->n,
+                                     count,
+                                     &one,
+                                     (const T*)first->y,
+                                     int(stride_y / sizeof(T)),
+                                     (const T*)first->x,
+                                     first->incx,
+                                     &zero,
+                                     (T*)first->result,
+                                     int(stride_r / sizeof(T)));
+                    hipblasStatus_t restore
+                        = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+                    return status != HIPBLAS_STATUS_SUCCESS ? status : restore;
+                }
+            }
+        }
+
+        // No combined form, issue the calls one by one
+        for(auto op = first; op < last; op++)
+        {
+            hipblasStatus_t status = issue_op<T>(handle, *op);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t x_span(const hipblas_graph_op& op, size_t elem_size)
+    {
+        int len = op.kind == hipblas_graph_op::op_gemv && op.trans != HIPBLAS_OP_N ? op.m : op.n;
+        return hipblas_vector_span(len, op.incx, elem_size);
+    }
+
+    size_t y_span(const hipblas_graph_op& op, size_t elem_size)
+    {
+        int len = op.kind == hipblas_graph_op::op_gemv && op.trans == HIPBLAS_OP_N ? op.m : op.n;
+        return hipblas_vector_span(len, op.incy, elem_size);
+    }
+
+    // The vector a scal or axpy call writes
+    std::pair<char*, int> updated(const hipblas_graph_op& op)
+    {
+        return op.kind == hipblas_graph_op::op_scal ? std::make_pair(op.x, op.incx)
+                                                    : std::make_pair(op.y, op.incy);
+    }
+
+    bool is_update(const hipblas_graph_op& op)
+    {
+        return op.kind == hipblas_graph_op::op_scal || op.kind == hipblas_graph_op::op_axpy;
+    }
+
+    // Whether op can be combined with the run [first, last), computing the
+    // same values up to rounding. Calls in a run are of one routine, or a mix
+    // of scal and axpy calls updating one vector, and share every parameter
+    // but the vectors they combine, and no call writes memory another call in
+    // the run touches.
+    bool can_join(const hipblas_graph_op* first, const hipblas_graph_op* last, hipblas_graph_op& op)
+    {
+        bool mixed = is_update(op) && is_update(*first);
+        if((op.kind != first->kind && !mixed) || op.precision != first->precision
+           || op.n != first->n)
+            return false;
+
+        size_t es = hipblas_precision_size(op.precision);
+        switch(op.kind)
+        {
+        case hipblas_graph_op::op_scal:
+        case hipblas_graph_op::op_axpy:
+        {
+            // Updates of one vector, in place. scal ignores negative increments,
+            // so only those with positive increments mix with axpy.
+            if(updated(op) != updated(*first)
+               || (op.kind != first->kind && updated(op).second <= 0))
+                return false;
+            if(op.kind == hipblas_graph_op::op_scal)
+                return true;
+            if(hipblas_overlaps(op.x, x_span(op, es), op.y, y_span(op, es)))
+                return false;
+            for(auto prev = first; prev < last; prev++)
+                if(prev->kind == hipblas_graph_op::op_axpy)
+                    return op.x == prev->x && op.incx == prev->incx;
+            return true;
+        }
+
+        case hipblas_graph_op::op_gemv:
+        {
+            size_t a_bytes = hipblas_matrix_span(op.m, op.n, op.lda, es);
+            if(op.A != first->A || op.trans != first->trans || op.m != first->m
+               || op.lda != first->lda || op.incx != first->incx || op.incy != first->incy
+               || memcmp(op.alpha, first->alpha, es) || memcmp(op.beta, first->beta, es)
+               || hipblas_overlaps(op.y, y_span(op, es), op.A, a_bytes)
+               || hipblas_overlaps(op.y, y_span(op, es), op.x, x_span(op, es)))
+                return false;
+            for(auto prev = first; prev < last; prev++)
+                if(hipblas_overlaps(op.y, y_span(op, es), prev->x, x_span(*prev, es))
+                   || hipblas_overlaps(op.y, y_span(op, es), prev->y, y_span(*prev, es))
+                   || hipblas_overlaps(op.x, x_span(op, es), prev->y, y_span(*prev, es)))
+                    return false;
+            return true;
+        }
+
+        case hipblas_graph_op::op_dot:
+        {
+            // Dots are symmetric, so keep the vector shared with the run in x
+            if(op.x != first->x && op.y == first->x && op.incy == first->incx)
+            {
+                std::swap(op.x, op.y);
+                std::swap(op.incx, op.incy);
+            }
+            if(op.x != first->x || op.incx != first->incx || op.incy != first->incy)
+                return false;
+            for(auto prev = first; prev < last; prev++)
+                if(hipblas_overlaps(op.result, es, prev->x, x_span(*prev, es))
+                   || hipblas_overlaps(op.result, es, prev->y, y_span(*prev, es))
+                   || hipblas_overlaps(op.result, es, prev->result, es)
+                   || hipblas_overlaps(prev->result, es, op.x, x_span(op, es))
+                   || hipblas_overlaps(prev->result, es, op.y, y_span(op, es)))
+                    return false;
+            return true;
+        }
+        }
+        return false;
+    }
+}
+
+hipblas_graph_recording::~hipblas_graph_recording()
+{
+    // Only still capturing if the handle was destroyed while recording
+    if(capturing)
+    {
+        hipGraph_t graph = nullptr;
+        if(hipStreamEndCapture(stream, &graph) == hipSuccess && graph)
+            (void)hipGraphDestroy(graph);
+    }
+    if(owns_stream)
+        (void)hipStreamDestroy(stream);
+}
+
+hipblasStatus_t hipblas_graph_record(hipblasHandle_t   handle,
+                                     hipblas_graph_op& op,
+                                     const void*       alpha,
+                                     const void*       beta,
+                                     bool&             recorded)
+{
+    recorded                    = false;
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!state->graph)
+        return hipblas_deferred_flush(handle);
+
+    // Scaling and update calls are recorded with host scalars, reductions with
+    // device results; anything else is captured directly after the window
+    hipblasPointerMode_t pointer_mode;
+    {
+        hipblas_internal_call_guard guard;
+        hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    bool is_dot = op.kind == hipblas_graph_op::op_dot;
+    if(pointer_mode != (is_dot ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST)
+       || op.n <= 0 || !op.x || !op.incx || (is_dot && !op.result)
+       || (op.kind != hipblas_graph_op::op_scal && (!op.y || !op.incy))
+       || (op.kind == hipblas_graph_op::op_gemv && (op.m <= 0 || !op.A || !beta))
+       || (!is_dot && !alpha))
+        return hipblas_deferred_flush(handle);
+
+    // No GEMMs are queued while capturing, so the window holds all pending calls
+    size_t es = hipblas_precision_size(op.precision);
+    if(alpha)
+        memcpy(op.alpha, alpha, es);
+    if(beta)
+        memcpy(op.beta, beta, es);
+
+    state->graph->window.push_back(op);
+    recorded = true;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_graph_flush(hipblasHandle_t handle, hipblas_graph_recording& recording)
+{
+    auto& window = recording.window;
+    if(window.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_internal_call_guard guard;
+    hipblasStatus_t             result = HIPBLAS_STATUS_SUCCESS;
+    hipblas_graph_op*           first  = window.data();
+    hipblas_graph_op*           end    = first + window.size();
+    while(first < end)
+    {
+        hipblas_graph_op* last = first + 1;
+        while(last < end && can_join(first, last, *last))
+            last++;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        switch(first->precision)
+        {
+        case 's':
+            status = issue_run<float>(handle, first, last);
+            break;
+        case 'd':
+            status = issue_run<double>(handle, first, last);
+            break;
+        case 'c':
+            status = issue_run<hipblasComplex>(handle, first, last);
+            break;
+        case 'z':
+            status = issue_run<hipblasDoubleComplex>(handle, first, last);
+            break;
+        }
+        if(result == HIPBLAS_STATUS_SUCCESS)
+            result = status;
+        first = last;
+    }
+
+    window.clear();
+    return result;
+}
+
+hipblasStatus_t hipblas_graph_flush_thread()
+{
+    // Forget handles destroyed while capturing
+    auto destroyed = [](hipblasHandle_t handle) {
+        hipblas_handle_state* state = hipblas_find_handle_state(handle);
+        return !state || !state->graph;
+    };
+    capturing_handles.erase(
+        std::remove_if(capturing_handles.begin(), capturing_handles.end(), destroyed),
+        capturing_handles.end());
+
+    hipblasStatus_t result = HIPBLAS_STATUS_SUCCESS;
+    for(hipblasHandle_t handle : capturing_handles)
+    {
+        hipblas_handle_state* state  = hipblas_find_handle_state(handle);
+        hipblasStatus_t       status = hipblas_graph_flush(handle, *state->graph);
+        if(result == HIPBLAS_STATUS_SUCCESS)
+            result = status;
+    }
+    return result;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGraphBegin(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipblas_deferred_flush(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_internal_call_guard guard;
+    auto                        recording = std::make_unique<hipblas_graph_recording>();
+    status = hipblasGetStream(handle, &recording->saved_stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The default stream cannot be captured
+    recording->stream = recording->saved_stream;
+    if(!recording->stream)
+    {
+        if(hipStreamCreateWithFlags(&recording->stream, hipStreamNonBlocking) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        recording->owns_stream = true;
+        status                 = hipblasSetStream(handle, recording->stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    if(hipStreamBeginCapture(recording->stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+    {
+        (void)hipblasSetStream(handle, recording->saved_stream);
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+    recording->capturing = true;
+
+    state.graph = std::move(recording);
+    capturing_handles.push_back(handle);
+    hipblas_deferred_handles++;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphEnd(hipblasHandle_t handle, hipblasGraph_t* graph)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(graph == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    if(!state || !state->graph)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasStatus_t status = hipblas_deferred_flush(handle);
+
+    std::unique_ptr<hipblas_graph_recording> recording = std::move(state->graph);
+    capturing_handles.erase(
+        std::remove(capturing_handles.begin(), capturing_handles.end(), handle),
+        capturing_handles.end());
+    hipblas_deferred_handles--;
+
+    hipGraph_t captured = nullptr;
+    hipError_t error    = hipStreamEndCapture(recording->stream, &captured);
+
+    recording->capturing = false;
+    {
+        hipblas_internal_call_guard guard;
+        hipblasStatus_t             restore = hipblasSetStream(handle, recording->saved_stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+
+    auto compiled   = std::make_unique<hipblasGraph>();
+    compiled->graph = captured;
+    if(status == HIPBLAS_STATUS_SUCCESS && (error != hipSuccess || !captured))
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    if(status == HIPBLAS_STATUS_SUCCESS
+       && hipGraphInstantiate(&compiled->exec, captured, nullptr, nullptr, 0) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasGraphDestroy(compiled.release());
+        return status;
+    }
+
+    *graph = compiled.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphLaunch(hipblasGraph_t graph, hipStream_t stream)
+try
+{
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    if(graph == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return hipGraphLaunch(graph->exec, stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                             : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph)
+try
+{
+    if(graph == nullptr)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(graph->exec)
+        (void)hipGraphExecDestroy(graph->exec);
+    if(graph->graph)
+        (void)hipGraphDestroy(graph->graph);
+    delete graph;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
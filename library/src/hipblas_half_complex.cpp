@@ -0,0 +1,721 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "batch_scalars.hpp"
+#include "deferred.hpp"
+#include "half_complex.hpp"
+#include "workspace.hpp"
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // The 2 by 2 real matrices of z -> f(z) on [re(z); im(z)], column major,
+    // ordered so that i*f(z) is times_i(f)
+    enum pair_op
+    {
+        pair_one,
+        pair_i,
+        pair_minus_one,
+        pair_minus_i,
+        pair_conj,
+        pair_i_conj,
+        pair_minus_conj,
+        pair_minus_i_conj,
+        pair_count
+    };
+
+    constexpr int pair_matrix[pair_count][4] = {{1, 0, 0, 1},
+                                                {0, 1, -1, 0},
+                                                {-1, 0, 0, -1},
+                                                {0, -1, 1, 0},
+                                                {1, 0, 0, -1},
+                                                {0, 1, 1, 0},
+                                                {-1, 0, 0, 1},
+                                                {0, -1, -1, 0}};
+
+    pair_op times_i(pair_op f)
+    {
+        return pair_op((f & 4) | ((f + 1) & 3));
+    }
+
+    // The matrices in f16 and f32, and 1 and 0 for scalars in device memory,
+    // copied to the head of each call's workspace
+    struct pair_tables
+    {
+        uint16_t half[pair_count][4];
+        float    single[pair_count][4];
+        float    unit[2];
+    };
+
+    const pair_tables& pair_host()
+    {
+        static const pair_tables tables = [] {
+            pair_tables t;
+            for(int f = 0; f < pair_count; f++)
+                for(int e = 0; e < 4; e++)
+                {
+                    int v           = pair_matrix[f][e];
+                    t.half[f][e]    = v ? (v > 0 ? 0x3C00 : 0xBC00) : 0;
+                    t.single[f][e]  = float(v);
+                }
+            t.unit[0] = 1;
+            t.unit[1] = 0;
+            return t;
+        }();
+        return tables;
+    }
+
+    hipblasStatus_t pair_upload(const batch_scalars& s, void* W)
+    {
+        if(hipMemcpyAsync(W, &pair_host(), sizeof(pair_tables), hipMemcpyHostToDevice, s.stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The real type of the parts of C_16F or C_32F
+    hipblasDatatype_t part_type(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_C_16F ? HIPBLAS_R_16F : HIPBLAS_R_32F;
+    }
+
+    size_t part_size(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_C_16F ? 2 : 4;
+    }
+
+    const void* parts_at(const void* p, int64_t parts, hipblasDatatype_t type)
+    {
+        return static_cast<const char*>(p) + parts * part_size(type);
+    }
+
+    void* parts_at(void* p, int64_t parts, hipblasDatatype_t type)
+    {
+        return static_cast<char*>(p) + parts * part_size(type);
+    }
+
+    // Y_b = alpha*f(X_b) + beta*Y_b for count batches of cols elements, each X_b
+    // and Y_b the 2 by cols real view of its elements. Leading dimensions and
+    // strides count parts, W holds the uploaded pair_tables, and alpha and beta
+    // are in the handle's pointer mode.
+    hipblasStatus_t pair_apply(hipblasHandle_t   handle,
+                               const void*       W,
+                               pair_op           f,
+                               hipblasDatatype_t type,
+                               int               cols,
+                               const float*      alpha,
+                               const void*       X,
+                               int               ldx,
+                               hipblasStride     stride_x,
+                               const float*      beta,
+                               void*             Y,
+                               int               ldy,
+                               hipblasStride     stride_y,
+                               int               count)
+    {
+        auto        tables = static_cast<const pair_tables*>(W);
+        const void* S      = tables->single[f];
+        if(type == HIPBLAS_C_16F)
+            S = tables->half[f];
+        return hipblasGemmStridedBatchedEx(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           2,
+                                           cols,
+                                           2,
+                                           alpha,
+                                           S,
+                                           part_type(type),
+                                           2,
+                                           0,
+                                           X,
+                                           part_type(type),
+                                           ldx,
+                                           stride_x,
+                                           beta,
+                                           Y,
+                                           part_type(type),
+                                           ldy,
+                                           stride_y,
+                                           count,
+                                           HIPBLAS_R_32F,
+                                           HIPBLAS_GEMM_DEFAULT);
+    }
+
+    // The same with host scalars
+    hipblasStatus_t pair_apply(hipblasHandle_t   handle,
+                               const void*       W,
+                               pair_op           f,
+                               hipblasDatatype_t type,
+                               int               cols,
+                               float             alpha,
+                               const void*       X,
+                               int               ldx,
+                               hipblasStride     stride_x,
+                               float             beta,
+                               void*             Y,
+                               int               ldy,
+                               hipblasStride     stride_y,
+                               int               count)
+    {
+        return pair_apply(
+            handle, W, f, type, cols, &alpha, X, ldx, stride_x, &beta, Y, ldy, stride_y, count);
+    }
+
+    // The real and imaginary parts of a host scalar of type R_32F or C_32F
+    bool scalar_parts(const void* scalar, hipblasDatatype_t type, float parts[2])
+    {
+        if(type != HIPBLAS_R_32F && type != HIPBLAS_C_32F)
+            return false;
+        parts[1] = 0;
+        memcpy(parts, scalar, type == HIPBLAS_C_32F ? 2 * sizeof(float) : sizeof(float));
+        return true;
+    }
+
+    // Two negative increments pair the same elements as their negations
+    bool positive_increments(int& incx, int& incy)
+    {
+        if(incx < 0 && incy < 0)
+        {
+            incx = -incx;
+            incy = -incy;
+        }
+        return incx > 0 && incy > 0;
+    }
+}
+
+hipblasStatus_t hipblas_half_complex_gemm(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int                ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo)
+{
+    if(b_type != HIPBLAS_C_16F || (c_type != HIPBLAS_C_16F && c_type != HIPBLAS_C_32F)
+       || compute_type != HIPBLAS_C_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, beta, sizeof(hipblasComplex), 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Device scalars stay on the device, in the caller's pointer mode, and
+    // their parts are taken as they are: C is then always scaled by beta, and
+    // read, and both parts of alpha take a GEMM.
+    bool  known = s.on_host();
+    float a[2]  = {}, b[2] = {};
+    if(known)
+    {
+        scalar_parts(alpha, HIPBLAS_C_32F, a);
+        scalar_parts(beta, HIPBLAS_C_32F, b);
+        if(!k && b[0] == 1 && b[1] == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The real representation of op(A), the real view of op(B) when it is not
+    // B's own, and C scaled by a complex beta, or by any beta when k is 0
+    bool   scale_c = !known || b[1] != 0 || !k;
+    size_t bytes_a = 4 * size_t(m) * k * 2;
+    size_t bytes_b = transb == HIPBLAS_OP_N ? 0 : 2 * size_t(k) * n * 2;
+    size_t bytes_c = scale_c ? 2 * size_t(m) * n * part_size(c_type) : 0;
+    size_t bytes   = sizeof(pair_tables) + bytes_a + bytes_b + bytes_c;
+    return batch_scalars_run(
+        s,
+        bytes,
+        [&](void* W) {
+            void* At = static_cast<char*>(W) + sizeof(pair_tables);
+            void* Bt = static_cast<char*>(At) + bytes_a;
+            void* Ct = static_cast<char*>(Bt) + bytes_b;
+
+            const float host_unit[2] = {1, 0};
+
+            const float* unit   = known ? host_unit : static_cast<const pair_tables*>(W)->unit;
+            const float* one    = unit;
+            const float* zero   = unit + 1;
+            const float* a_part = known ? a : static_cast<const float*>(alpha);
+            const float* b_part = known ? b : static_cast<const float*>(beta);
+            const float* beta_c = b_part;
+
+            hipblasStatus_t status = pair_upload(s, W);
+            if(status == HIPBLAS_STATUS_SUCCESS && scale_c)
+            {
+                // beta*C by columns, then the product is added to it
+                if(known && b[0] == 0 && b[1] == 0)
+                {
+                    size_t width = 2 * size_t(m) * part_size(c_type);
+                    if(hipMemset2DAsync(C, ldc * 2 * part_size(c_type), 0, width, n, s.stream)
+                       != hipSuccess)
+                        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                }
+                else
+                {
+                    status = pair_apply(handle,
+                                        W,
+                                        pair_one,
+                                        c_type,
+                                        m,
+                                        b_part,
+                                        C,
+                                        2,
+                                        2 * int64_t(ldc),
+                                        zero,
+                                        Ct,
+                                        2,
+                                        2 * m,
+                                        n);
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = pair_apply(handle,
+                                            W,
+                                            pair_i,
+                                            c_type,
+                                            m,
+                                            b_part + 1,
+                                            C,
+                                            2,
+                                            2 * int64_t(ldc),
+                                            one,
+                                            Ct,
+                                            2,
+                                            2 * m,
+                                            n);
+                    size_t width = 2 * size_t(m) * part_size(c_type);
+                    if(status == HIPBLAS_STATUS_SUCCESS
+                       && hipMemcpy2DAsync(C,
+                                           ldc * 2 * part_size(c_type),
+                                           Ct,
+                                           width,
+                                           width,
+                                           n,
+                                           hipMemcpyDeviceToDevice,
+                                           s.stream)
+                              != hipSuccess)
+                        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                }
+                beta_c = one;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS || !k)
+                return status;
+
+            // The real view of op(B), 2k by n
+            const void* Bh  = B;
+            int         ldh = 2 * ldb;
+            if(transb != HIPBLAS_OP_N)
+            {
+                status = pair_apply(handle,
+                                    W,
+                                    transb == HIPBLAS_OP_C ? pair_conj : pair_one,
+                                    HIPBLAS_C_16F,
+                                    n,
+                                    one,
+                                    B,
+                                    2,
+                                    2 * int64_t(ldb),
+                                    zero,
+                                    Bt,
+                                    2 * k,
+                                    2,
+                                    k);
+                Bh  = Bt;
+                ldh = 2 * k;
+            }
+
+            // C's real view plus the real representation of each part of alpha
+            // times op(A) times the real view of op(B). Column p of op(A) has the
+            // blocks of columns 2p and 2p + 1, being f(A(:, p)) and i*f(A(:, p)) in
+            // real view, and the imaginary part of alpha takes i*f.
+            bool          plain    = transa == HIPBLAS_OP_N;
+            int           ld_a     = plain ? 2 : 2 * lda;
+            hipblasStride stride_a = plain ? 2 * int64_t(lda) : 2;
+            pair_op       f        = transa == HIPBLAS_OP_C ? pair_conj : pair_one;
+            for(int part = 0; part < 2 && status == HIPBLAS_STATUS_SUCCESS;
+                part++, f = times_i(f))
+            {
+                if(part && known && a[1] == 0)
+                    break;
+                status = pair_apply(handle,
+                                    W,
+                                    f,
+                                    HIPBLAS_C_16F,
+                                    m,
+                                    one,
+                                    A,
+                                    ld_a,
+                                    stride_a,
+                                    zero,
+                                    At,
+                                    2,
+                                    4 * int64_t(m),
+                                    k);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = pair_apply(handle,
+                                        W,
+                                        times_i(f),
+                                        HIPBLAS_C_16F,
+                                        m,
+                                        one,
+                                        A,
+                                        ld_a,
+                                        stride_a,
+                                        zero,
+                                        parts_at(At, 2 * int64_t(m), HIPBLAS_C_16F),
+                                        2,
+                                        4 * int64_t(m),
+                                        k);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasGemmEx(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           2 * m,
+                                           n,
+                                           2 * k,
+                                           a_part + part,
+                                           At,
+                                           HIPBLAS_R_16F,
+                                           2 * m,
+                                           Bh,
+                                           HIPBLAS_R_16F,
+                                           ldh,
+                                           beta_c,
+                                           C,
+                                           part_type(c_type),
+                                           2 * ldc,
+                                           HIPBLAS_R_32F,
+                                           algo);
+                beta_c = one;
+            }
+            return status;
+        },
+        s.pointer_mode);
+}
+
+hipblasStatus_t hipblas_half_complex_axpy(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       alpha,
+                                          hipblasDatatype_t alpha_type,
+                                          const void*       x,
+                                          int               incx,
+                                          void*             y,
+                                          hipblasDatatype_t y_type,
+                                          int               incy,
+                                          hipblasDatatype_t execution_type)
+{
+    if(y_type != HIPBLAS_C_16F || execution_type != HIPBLAS_C_32F
+       || (alpha_type != HIPBLAS_R_32F && alpha_type != HIPBLAS_C_32F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(n <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!positive_increments(incx, incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    size_t          size   = alpha_type == HIPBLAS_C_32F ? sizeof(hipblasComplex) : sizeof(float);
+    hipblasStatus_t status = batch_scalars_read(handle, alpha, nullptr, size, 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    float a[2];
+    scalar_parts(s.alpha_at(0), alpha_type, a);
+
+    // A real alpha is an axpy of the parts
+    if(a[1] == 0 && incx == 1 && incy == 1)
+        return batch_scalars_run(s, 0, [&](void*) {
+            return hipblasAxpyEx(handle,
+                                 2 * n,
+                                 a,
+                                 HIPBLAS_R_32F,
+                                 x,
+                                 HIPBLAS_R_16F,
+                                 1,
+                                 y,
+                                 HIPBLAS_R_16F,
+                                 1,
+                                 HIPBLAS_R_32F);
+        });
+
+    return batch_scalars_run(s, sizeof(pair_tables), [&](void* W) {
+        hipblasStatus_t status = pair_upload(s, W);
+        if(status == HIPBLAS_STATUS_SUCCESS && a[0] != 0)
+            status = pair_apply(
+                handle, W, pair_one, HIPBLAS_C_16F, n, a[0], x, 2 * incx, 0, 1, y, 2 * incy, 0, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS && a[1] != 0)
+            status = pair_apply(
+                handle, W, pair_i, HIPBLAS_C_16F, n, a[1], x, 2 * incx, 0, 1, y, 2 * incy, 0, 1);
+        return status;
+    });
+}
+
+hipblasStatus_t hipblas_half_complex_dot(hipblasHandle_t   handle,
+                                         int               n,
+                                         const void*       x,
+                                         int               incx,
+                                         const void*       y,
+                                         hipblasDatatype_t y_type,
+                                         int               incy,
+                                         void*             result,
+                                         hipblasDatatype_t result_type,
+                                         hipblasDatatype_t execution_type,
+                                         bool              conjugate)
+{
+    if(y_type != HIPBLAS_C_16F || (result_type != HIPBLAS_C_16F && result_type != HIPBLAS_C_32F)
+       || execution_type != HIPBLAS_C_32F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(!result)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    hipblasStatus_t             status = batch_scalars_read(handle, nullptr, nullptr, 0, 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    size_t bytes_r = 2 * part_size(result_type);
+    if(n <= 0)
+    {
+        if(s.pointer_mode == HIPBLAS_POINTER_MODE_HOST)
+            memset(result, 0, bytes_r);
+        else if(hipMemsetAsync(result, 0, bytes_r, s.stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(!positive_increments(incx, incy))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // The result pair is x's parts as a 1 by 2n row times the 2n by 2 matrix
+    // whose columns are the parts of g(y) and h(y), with x_j*y_j or
+    // conj(x_j)*y_j having real part <x_j, g(y_j)> and imaginary <x_j, h(y_j)>
+    size_t bytes_y = 4 * size_t(n) * 2;
+    size_t bytes_x = incx == 1 ? 0 : 2 * size_t(n) * 2;
+    bool   staged  = s.pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+    status = batch_scalars_run(
+        s, sizeof(pair_tables) + bytes_y + bytes_x + (staged ? bytes_r : 0), [&](void* W) {
+            void* Yt = static_cast<char*>(W) + sizeof(pair_tables);
+            void* Xt = static_cast<char*>(Yt) + bytes_y;
+            void* Rt = static_cast<char*>(Xt) + bytes_x;
+
+            hipblasStatus_t status = pair_upload(s, W);
+            pair_op         g      = conjugate ? pair_one : pair_conj;
+            pair_op         h      = conjugate ? pair_minus_i : pair_i_conj;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = pair_apply(
+                    handle, W, g, HIPBLAS_C_16F, n, 1, y, 2 * incy, 0, 0, Yt, 2, 0, 1);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = pair_apply(handle,
+                                    W,
+                                    h,
+                                    HIPBLAS_C_16F,
+                                    n,
+                                    1,
+                                    y,
+                                    2 * incy,
+                                    0,
+                                    0,
+                                    parts_at(Yt, 2 * int64_t(n), HIPBLAS_C_16F),
+                                    2,
+                                    0,
+                                    1);
+
+            // x's parts made contiguous
+            const void* xh = x;
+            if(status == HIPBLAS_STATUS_SUCCESS && incx != 1)
+            {
+                if(hipMemcpy2DAsync(Xt,
+                                    2 * sizeof(uint16_t),
+                                    x,
+                                    incx * 2 * sizeof(uint16_t),
+                                    2 * sizeof(uint16_t),
+                                    n,
+                                    hipMemcpyDeviceToDevice,
+                                    s.stream)
+                   != hipSuccess)
+                    status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                xh = Xt;
+            }
+
+            float one = 1, zero = 0;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGemmEx(handle,
+                                       HIPBLAS_OP_N,
+                                       HIPBLAS_OP_N,
+                                       1,
+                                       2,
+                                       2 * n,
+                                       &one,
+                                       xh,
+                                       HIPBLAS_R_16F,
+                                       1,
+                                       Yt,
+                                       HIPBLAS_R_16F,
+                                       2 * n,
+                                       &zero,
+                                       staged ? Rt : result,
+                                       part_type(result_type),
+                                       1,
+                                       HIPBLAS_R_32F,
+                                       HIPBLAS_GEMM_DEFAULT);
+            if(status == HIPBLAS_STATUS_SUCCESS && staged
+               && hipMemcpyAsync(result, Rt, bytes_r, hipMemcpyDeviceToHost, s.stream)
+                      != hipSuccess)
+                status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            return status;
+        });
+
+    // A result on the host is complete on return, as with the other dot functions
+    if(status == HIPBLAS_STATUS_SUCCESS && staged && hipStreamSynchronize(s.stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+
+hipblasStatus_t hipblas_half_complex_scal(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       alpha,
+                                          hipblasDatatype_t alpha_type,
+                                          void*             x,
+                                          int               incx,
+                                          hipblasDatatype_t execution_type)
+{
+    if(execution_type != HIPBLAS_C_32F
+       || (alpha_type != HIPBLAS_R_32F && alpha_type != HIPBLAS_C_32F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(n <= 0 || incx <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_internal_call_guard internal;
+    batch_scalars               s;
+    size_t          size   = alpha_type == HIPBLAS_C_32F ? sizeof(hipblasComplex) : sizeof(float);
+    hipblasStatus_t status = batch_scalars_read(handle, alpha, nullptr, size, 1, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    float a[2];
+    scalar_parts(s.alpha_at(0), alpha_type, a);
+
+    // A real alpha scales the parts in place
+    if(a[1] == 0)
+        return batch_scalars_run(s, 0, [&](void*) {
+            if(incx == 1)
+                return hipblasScalEx(
+                    handle, 2 * n, a, HIPBLAS_R_32F, x, HIPBLAS_R_16F, 1, HIPBLAS_R_32F);
+            hipblasStatus_t status = hipblasScalEx(
+                handle, n, a, HIPBLAS_R_32F, x, HIPBLAS_R_16F, 2 * incx, HIPBLAS_R_32F);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasScalEx(handle,
+                                       n,
+                                       a,
+                                       HIPBLAS_R_32F,
+                                       parts_at(x, 1, HIPBLAS_C_16F),
+                                       HIPBLAS_R_16F,
+                                       2 * incx,
+                                       HIPBLAS_R_32F);
+            return status;
+        });
+
+    // Otherwise alpha*x goes to a workspace, then back to x
+    size_t bytes_x = 2 * size_t(n) * 2;
+    return batch_scalars_run(s, sizeof(pair_tables) + bytes_x, [&](void* W) {
+        void*           Xt     = static_cast<char*>(W) + sizeof(pair_tables);
+        hipblasStatus_t status = pair_upload(s, W);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pair_apply(
+                handle, W, pair_one, HIPBLAS_C_16F, n, a[0], x, 2 * incx, 0, 0, Xt, 2, 0, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pair_apply(
+                handle, W, pair_i, HIPBLAS_C_16F, n, a[1], x, 2 * incx, 0, 1, Xt, 2, 0, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipMemcpy2DAsync(x,
+                               incx * 2 * sizeof(uint16_t),
+                               Xt,
+                               2 * sizeof(uint16_t),
+                               2 * sizeof(uint16_t),
+                               n,
+                               hipMemcpyDeviceToDevice,
+                               s.stream)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return status;
+    });
+}
+
+hipblasStatus_t hipblas_half_complex_nrm2(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       x,
+                                          int               incx,
+                                          void*             result,
+                                          hipblasDatatype_t result_type,
+                                          hipblasDatatype_t execution_type)
+{
+    // The norm of the parts, made contiguous when incx is not 1
+    hipblas_internal_call_guard internal;
+    if(n <= 0 || incx <= 0)
+        return hipblasNrm2Ex(handle, 0, x, HIPBLAS_R_16F, 1, result, result_type, execution_type);
+    if(incx == 1)
+        return hipblasNrm2Ex(
+            handle, 2 * n, x, HIPBLAS_R_16F, 1, result, result_type, execution_type);
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipblas_workspace_scope scope(handle, 2 * size_t(n) * 2);
+    if(scope.status() != HIPBLAS_STATUS_SUCCESS)
+        return scope.status();
+    void* Xt = scope.data();
+    if(hipMemcpy2DAsync(Xt,
+                        2 * sizeof(uint16_t),
+                        x,
+                        incx * 2 * sizeof(uint16_t),
+                        2 * sizeof(uint16_t),
+                        n,
+                        hipMemcpyDeviceToDevice,
+                        stream)
+       != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasNrm2Ex(
+            handle, 2 * n, Xt, HIPBLAS_R_16F, 1, result, result_type, execution_type);
+    return status;
+}
@@ -0,0 +1,384 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <vector>
+
+// Handles created by a hipblasHandlePool_t, each tied to the device current
+// when it was created
+struct hipblasHandlePool
+{
+    struct entry
+    {
+        hipblasHandle_t      handle;
+        int                  device;
+        hipblasAtomicsMode_t atomics_mode; // as created, restored on release
+        bool                 idle;
+    };
+
+    std::mutex         mutex;
+    std::vector<entry> entries;
+
+    ~hipblasHandlePool()
+    {
+        hipblas_internal_call_guard guard;
+        for(auto& e : entries)
+            (void)hipblasDestroy(e.handle);
+    }
+};
+
+namespace
+{
+    hipblasStatus_t
+        create_entry(hipblasHandlePool* pool, int device, bool idle, hipblasHandle_t& handle)
+    {
+        hipblasHandlePool::entry e{nullptr, device, HIPBLAS_ATOMICS_NOT_ALLOWED, idle};
+        hipblasStatus_t          status = hipblasCreate(&e.handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        status = hipblasGetAtomicsMode(e.handle, &e.atomics_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            (void)hipblasDestroy(e.handle);
+            return status;
+        }
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->entries.push_back(e);
+        handle = e.handle;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Return a released handle to the settings hipblasCreate gives it
+    hipblasStatus_t reset_handle(const hipblasHandlePool::entry& e)
+    {
+        hipblasStatus_t status = hipblasClearThreadStream(e.handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetDeferredMode(e.handle, HIPBLAS_DEFERRED_MODE_DISABLED);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(e.handle, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(e.handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(e.handle, e.atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetManagedMemoryPolicy(e.handle, HIPBLAS_MANAGED_MEMORY_POLICY_NONE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetSymmetricOutput(e.handle, HIPBLAS_SYMMETRIC_OUTPUT_NONE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetFloat32Mode(e.handle, HIPBLAS_FLOAT32_MODE_DEFAULT);
+        return status;
+    }
+
+    struct warmup_operands
+    {
+        size_t rows_a, cols_a, rows_b, cols_b;
+        size_t bytes_a, bytes_b, bytes_c; // for the whole batch
+    };
+
+    hipblasStatus_t warmup_layout(const hipblasGemmShape_t& shape, warmup_operands& ops)
+    {
+        size_t size_a = hipblas_datatype_size(shape.aType);
+        size_t size_b = hipblas_datatype_size(shape.bType);
+        size_t size_c = hipblas_datatype_size(shape.cType);
+        if(shape.m < 0 || shape.n < 0 || shape.k < 0 || shape.batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!size_a || !size_b || !size_c)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        size_t batch = std::max(shape.batchCount, 1);
+        ops.rows_a   = std::max(shape.transA == HIPBLAS_OP_N ? shape.m : shape.k, 1);
+        ops.cols_a   = shape.transA == HIPBLAS_OP_N ? shape.k : shape.m;
+        ops.rows_b   = std::max(shape.transB == HIPBLAS_OP_N ? shape.k : shape.n, 1);
+        ops.cols_b   = shape.transB == HIPBLAS_OP_N ? shape.n : shape.k;
+        ops.bytes_a  = ops.rows_a * ops.cols_a * size_a * batch;
+        ops.bytes_b  = ops.rows_b * ops.cols_b * size_b * batch;
+        ops.bytes_c  = std::max(shape.m, 1) * size_t(shape.n) * size_c * batch;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t warmup_gemm(hipblasHandle_t          handle,
+                                const hipblasGemmShape_t& shape,
+                                const warmup_operands&   ops,
+                                const unsigned char*     one,
+                                const unsigned char*     zero,
+                                unsigned char*           buffer)
+    {
+        unsigned char* A   = buffer;
+        unsigned char* B   = A + ops.bytes_a;
+        unsigned char* C   = B + ops.bytes_b;
+        int            lda = int(ops.rows_a), ldb = int(ops.rows_b), ldc = std::max(shape.m, 1);
+        if(shape.batchCount <= 1)
+            return hipblasGemmEx(handle,
+                                 shape.transA,
+                                 shape.transB,
+                                 shape.m,
+                                 shape.n,
+                                 shape.k,
+                                 one,
+                                 A,
+                                 shape.aType,
+                                 lda,
+                                 B,
+                                 shape.bType,
+                                 ldb,
+                                 zero,
+                                 C,
+                                 shape.cType,
+                                 ldc,
+                                 shape.computeType,
+                                 HIPBLAS_GEMM_DEFAULT);
+
+        return hipblasGemmStridedBatchedEx(handle,
+                                           shape.transA,
+                                           shape.transB,
+                                           shape.m,
+                                           shape.n,
+                                           shape.k,
+                                           one,
+                                           A,
+                                           shape.aType,
+                                           lda,
+                                           hipblasStride(ops.rows_a * ops.cols_a),
+                                           B,
+                                           shape.bType,
+                                           ldb,
+                                           hipblasStride(ops.rows_b * ops.cols_b),
+                                           zero,
+                                           C,
+                                           shape.cType,
+                                           ldc,
+                                           hipblasStride(ldc) * shape.n,
+                                           shape.batchCount,
+                                           shape.computeType,
+                                           HIPBLAS_GEMM_DEFAULT);
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool)
+try
+{
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *pool = new hipblasHandlePool;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+try
+{
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    delete pool;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolReserve(hipblasHandlePool_t pool, int count)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int idle = 0;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        for(auto& e : pool->entries)
+            idle += e.idle && e.device == device;
+    }
+    for(; idle < count; idle++)
+    {
+        hipblasHandle_t created;
+        hipblasStatus_t status = create_entry(pool, device, true, created);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        for(auto& e : pool->entries)
+            if(e.idle && e.device == device)
+            {
+                e.idle  = false;
+                *handle = e.handle;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+    }
+
+    // None idle: create one outside the lock so that other threads can still
+    // acquire and release while it initializes
+    return create_entry(pool, device, false, *handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    auto acquired = [&](const hipblasHandlePool::entry& e) {
+        return e.handle == handle && !e.idle;
+    };
+
+    // Entries may move while the lock is not held, so work on a copy
+    hipblasHandlePool::entry released;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        auto it = std::find_if(pool->entries.begin(), pool->entries.end(), acquired);
+        if(it == pool->entries.end())
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        released = *it;
+    }
+
+    hipblasStatus_t             status = reset_handle(released);
+    std::lock_guard<std::mutex> lock(pool->mutex);
+    std::find_if(pool->entries.begin(), pool->entries.end(), acquired)->idle = true;
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t
+    hipblasWarmup(hipblasHandle_t handle, const hipblasGemmShape_t* shapes, int shapeCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(shapeCount < 0 || (shapeCount && shapes == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<warmup_operands> ops(shapeCount);
+    size_t                       buffer_bytes = 0;
+    for(int i = 0; i < shapeCount; i++)
+    {
+        hipblasStatus_t status = warmup_layout(shapes[i], ops[i]);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        buffer_bytes = std::max(buffer_bytes, ops[i].bytes_a + ops[i].bytes_b + ops[i].bytes_c);
+    }
+    if(!buffer_bytes)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Zero operands keep the results finite; they are never read back
+    unsigned char* buffer;
+    if(hipMalloc(&buffer, buffer_bytes) != hipSuccess)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    if(hipMemsetAsync(buffer, 0, buffer_bytes, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // The scalars live on the host, whatever the handle's pointer mode
+    hipblas_internal_call_guard guard;
+    hipblasPointerMode_t        pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    for(int i = 0; i < shapeCount && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        unsigned char one[16] = {}, zero[16] = {};
+        if(!hipblas_write_one(shapes[i].computeType, one))
+            status = HIPBLAS_STATUS_INVALID_ENUM;
+        else
+            status = warmup_gemm(handle, shapes[i], ops[i], one, zero, buffer);
+    }
+
+    if(pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+
+    // Kernels are loaded and workspace sized once the calls have completed
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    (void)hipFree(buffer);
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle_state.hpp"
+#include "fast_float32.hpp"
+#include "managed_memory.hpp"
+#include "symmetric_gemm.hpp"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    struct handle_registry
+    {
+        std::mutex                                                                mutex;
+        std::unordered_map<hipblasHandle_t, std::unique_ptr<hipblas_handle_state>> states;
+    };
+
+    // Never destroyed, so handles still alive at exit do not release device
+    // resources after the runtime has shut down
+    handle_registry& get_registry()
+    {
+        static handle_registry* registry = new handle_registry;
+        return *registry;
+    }
+}
+
+hipblas_handle_state& hipblas_get_handle_state(hipblasHandle_t handle)
+{
+    auto&                       registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto&                       state = registry.states[handle];
+    if(!state)
+        state = std::make_unique<hipblas_handle_state>();
+    return *state;
+}
+
+hipblas_handle_state* hipblas_find_handle_state(hipblasHandle_t handle)
+{
+    auto&                       registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto                        it = registry.states.find(handle);
+    return it == registry.states.end() ? nullptr : it->second.get();
+}
+
+void hipblas_erase_handle_state(hipblasHandle_t handle)
+{
+    std::unique_ptr<hipblas_handle_state> state;
+    {
+        auto&                       registry = get_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto                        it = registry.states.find(handle);
+        if(it == registry.states.end())
+            return;
+        state = std::move(it->second);
+        registry.states.erase(it);
+    }
+    if(state->deferred_mode == HIPBLAS_DEFERRED_MODE_ENABLED)
+        hipblas_deferred_handles--;
+    if(state->graph)
+        hipblas_deferred_handles--;
+    if(state->managed_policy != HIPBLAS_MANAGED_MEMORY_POLICY_NONE)
+        hipblas_managed_handles--;
+    if(state->symmetric_output != HIPBLAS_SYMMETRIC_OUTPUT_NONE)
+        hipblas_symmetric_handles--;
+    if(state->float32_mode != HIPBLAS_FLOAT32_MODE_DEFAULT)
+        hipblas_float32_handles--;
+    if(state->thread_streams)
+        hipblas_thread_stream_handles--;
+}
+
+std::vector<hipblasHandle_t> hipblas_handles_with_state()
+{
+    auto&                        registry = get_registry();
+    std::lock_guard<std::mutex>  lock(registry.mutex);
+    std::vector<hipblasHandle_t> handles;
+    for(auto& kv : registry.states)
+        handles.push_back(kv.first);
+    return handles;
+}
@@ -0,0 +1,616 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "logging.hpp"
+#include "datatype.hpp"
+#include <hip/hip_runtime_api.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+    const char* datatype_string(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return "f16_r";
+        case HIPBLAS_R_32F:
+            return "f32_r";
+        case HIPBLAS_R_64F:
+            return "f64_r";
+        case HIPBLAS_C_16F:
+            return "f16_c";
+        case HIPBLAS_C_32F:
+            return "f32_c";
+        case HIPBLAS_C_64F:
+            return "f64_c";
+        case HIPBLAS_R_8I:
+            return "i8_r";
+        case HIPBLAS_R_8U:
+            return "u8_r";
+        case HIPBLAS_R_32I:
+            return "i32_r";
+        case HIPBLAS_R_32U:
+            return "u32_r";
+        case HIPBLAS_C_8I:
+            return "i8_c";
+        case HIPBLAS_C_8U:
+            return "u8_c";
+        case HIPBLAS_C_32I:
+            return "i32_c";
+        case HIPBLAS_C_32U:
+            return "u32_c";
+        case HIPBLAS_R_16B:
+            return "bf16_r";
+        case HIPBLAS_C_16B:
+            return "bf16_c";
+        case HIPBLAS_R_32F_FAST:
+            return "f32_fast_r";
+        case HIPBLAS_R_32F_FAST_TF32:
+            return "f32_fast_tf32_r";
+        case HIPBLAS_R_32F_FAST_16BX3:
+            return "f32_fast_16bx3_r";
+        default:
+            return "invalid";
+        }
+    }
+
+    char operation_char(hipblasOperation_t op)
+    {
+        switch(op)
+        {
+        case HIPBLAS_OP_N:
+            return 'N';
+        case HIPBLAS_OP_T:
+            return 'T';
+        case HIPBLAS_OP_C:
+            return 'C';
+        }
+        return '*';
+    }
+
+    float half_bits_to_float(uint16_t h)
+    {
+        int   exponent = (h >> 10) & 0x1f;
+        int   mantissa = h & 0x3ff;
+        float sign     = (h & 0x8000) ? -1.0f : 1.0f;
+        if(exponent == 0)
+            return sign * std::ldexp(float(mantissa), -24);
+        if(exponent == 31)
+            return mantissa ? NAN : sign * INFINITY;
+        return sign * std::ldexp(float(mantissa | 0x400), exponent - 25);
+    }
+
+    float bf16_bits_to_float(uint16_t b)
+    {
+        uint32_t bits = uint32_t(b) << 16;
+        float    f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+
+    // The hipblas-bench yaml fields of a GEMM call before and after alpha
+    void gemm_shape_strings(const char*        func,
+                            hipblasDatatype_t  a_type,
+                            hipblasDatatype_t  b_type,
+                            hipblasDatatype_t  c_type,
+                            hipblasDatatype_t  compute_type,
+                            hipblasOperation_t transA,
+                            hipblasOperation_t transB,
+                            int                m,
+                            int                n,
+                            int                k,
+                            int                lda,
+                            int64_t            stride_a,
+                            int                ldb,
+                            int64_t            stride_b,
+                            int                ldc,
+                            int64_t            stride_c,
+                            int                batch_count,
+                            std::string&       prefix,
+                            std::string&       suffix)
+    {
+        std::ostringstream p, s;
+        p << "hipblas_function: " << func << ", a_type: " << datatype_string(a_type)
+          << ", b_type: " << datatype_string(b_type) << ", c_type: " << datatype_string(c_type)
+          << ", d_type: " << datatype_string(c_type)
+          << ", compute_type: " << datatype_string(compute_type)
+          << ", transA: " << operation_char(transA) << ", transB: " << operation_char(transB)
+          << ", M: " << m << ", N: " << n << ", K: " << k;
+        s << "lda: " << lda << ", ldb: " << ldb << ", ldc: " << ldc << ", ldd: " << ldc
+          << ", stride_a: " << stride_a << ", stride_b: " << stride_b
+          << ", stride_c: " << stride_c << ", stride_d: " << stride_c
+          << ", batch_count: " << batch_count;
+        prefix = p.str();
+        suffix = s.str();
+    }
+
+    // Read a host scalar of the given type as (real, imag)
+    bool read_scalar(hipblasDatatype_t type, const void* p, double& re, double& im)
+    {
+        re = im = 0;
+        if(!p)
+            return false;
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            re = half_bits_to_float(*(const uint16_t*)p);
+            return true;
+        case HIPBLAS_C_16F:
+            re = half_bits_to_float(((const uint16_t*)p)[0]);
+            im = half_bits_to_float(((const uint16_t*)p)[1]);
+            return true;
+        case HIPBLAS_R_16B:
+            re = bf16_bits_to_float(*(const uint16_t*)p);
+            return true;
+        case HIPBLAS_C_16B:
+            re = bf16_bits_to_float(((const uint16_t*)p)[0]);
+            im = bf16_bits_to_float(((const uint16_t*)p)[1]);
+            return true;
+        case HIPBLAS_R_32F:
+            re = *(const float*)p;
+            return true;
+        case HIPBLAS_C_32F:
+            re = ((const float*)p)[0];
+            im = ((const float*)p)[1];
+            return true;
+        case HIPBLAS_R_64F:
+            re = *(const double*)p;
+            return true;
+        case HIPBLAS_C_64F:
+            re = ((const double*)p)[0];
+            im = ((const double*)p)[1];
+            return true;
+        case HIPBLAS_R_32I:
+            re = *(const int32_t*)p;
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // alpha/beta are bucketed into zero, one, other and device so that calls
+    // differing only in a non-trivial scalar value share one histogram entry.
+    // The first value seen for an "other" bucket is kept as the representative.
+    struct scalar_class
+    {
+        char   tag;
+        double re, im;
+    };
+
+    scalar_class classify_scalar(bool device_mode, hipblasDatatype_t type, const void* p)
+    {
+        scalar_class s{'d', 1.0, 0.0};
+        if(device_mode || !read_scalar(type, p, s.re, s.im))
+            return s;
+        if(s.re == 0 && s.im == 0)
+            s.tag = '0';
+        else if(s.re == 1 && s.im == 0)
+            s.tag = '1';
+        else
+            s.tag = 'x';
+        return s;
+    }
+
+    struct profile_entry
+    {
+        std::string  yaml_prefix;
+        std::string  yaml_suffix;
+        scalar_class alpha, beta;
+        uint64_t     count = 0;
+    };
+
+    class gemm_profile
+    {
+        std::mutex                           mutex;
+        std::map<std::string, profile_entry> entries;
+
+    public:
+        void add(const std::string& key,
+                 std::string        prefix,
+                 std::string        suffix,
+                 scalar_class       alpha,
+                 scalar_class       beta)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto&                       e = entries[key];
+            if(!e.count++)
+            {
+                e.yaml_prefix = std::move(prefix);
+                e.yaml_suffix = std::move(suffix);
+                e.alpha       = alpha;
+                e.beta        = beta;
+            }
+        }
+
+        // Written at process exit, most frequent shapes first
+        ~gemm_profile()
+        {
+            std::vector<const profile_entry*> sorted;
+            for(auto& kv : entries)
+                sorted.push_back(&kv.second);
+            if(sorted.empty())
+                return;
+            std::stable_sort(sorted.begin(), sorted.end(), [](auto a, auto b) {
+                return a->count > b->count;
+            });
+
+            const char* path = getenv("HIPBLAS_LOG_PROFILE_PATH");
+            FILE*       os   = path ? fopen(path, "w") : nullptr;
+            if(!os)
+                os = stderr;
+
+            fputs("# hipBLAS GEMM shape profile, one entry per distinct call shape.\n"
+                  "# Use with: hipblas-bench --yaml <this file>\n",
+                  os);
+            for(auto e : sorted)
+                fprintf(os,
+                        "- { %s, alpha: %g, alphai: %g, %s, beta: %g, betai: %g, call_count: "
+                        "%llu }\n",
+                        e->yaml_prefix.c_str(),
+                        e->alpha.re,
+                        e->alpha.im,
+                        e->yaml_suffix.c_str(),
+                        e->beta.re,
+                        e->beta.im,
+                        (unsigned long long)e->count);
+            if(os != stderr)
+                fclose(os);
+        }
+    };
+
+    gemm_profile& get_gemm_profile()
+    {
+        static gemm_profile profile;
+        return profile;
+    }
+
+    // Records are appended as calls are made so a crashed application still
+    // leaves a usable trace; the file is closed at process exit.
+    class gemm_trace
+    {
+        std::mutex                            mutex;
+        FILE*                                 os = nullptr;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+        gemm_trace()
+        {
+            const char* path = getenv("HIPBLAS_LOG_TRACE_PATH");
+            os               = fopen(path ? path : "hipblas_trace.bin", "wb");
+            if(!os)
+                return;
+            hipblas_trace_header header{};
+            memcpy(header.magic, HIPBLAS_TRACE_MAGIC, sizeof(header.magic));
+            header.version     = HIPBLAS_TRACE_VERSION;
+            header.record_size = sizeof(hipblas_trace_record);
+            fwrite(&header, sizeof(header), 1, os);
+            start = std::chrono::steady_clock::now();
+        }
+
+        void add(hipblas_trace_record& record)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(!os)
+                return;
+            record.time_us = std::chrono::duration<double, std::micro>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+            fwrite(&record, sizeof(record), 1, os);
+        }
+
+        ~gemm_trace()
+        {
+            if(os)
+                fclose(os);
+        }
+    };
+
+    gemm_trace& get_gemm_trace()
+    {
+        static gemm_trace trace;
+        return trace;
+    }
+
+    // roctx and NVTX share the signatures of these entry points
+    struct range_api
+    {
+        int (*push)(const char*)  = nullptr;
+        int (*pop)()              = nullptr;
+        void (*mark)(const char*) = nullptr;
+
+        range_api()
+        {
+#ifndef _WIN32
+            static const char* const libraries[][4]
+                = {{"libroctx64.so", "roctxRangePushA", "roctxRangePop", "roctxMarkA"},
+                   {"libnvToolsExt.so.1", "nvtxRangePushA", "nvtxRangePop", "nvtxMarkA"},
+                   {"libnvToolsExt.so", "nvtxRangePushA", "nvtxRangePop", "nvtxMarkA"}};
+            for(auto& lib : libraries)
+            {
+                void* so = dlopen(lib[0], RTLD_NOW | RTLD_GLOBAL);
+                if(!so)
+                    continue;
+                push = (int (*)(const char*))dlsym(so, lib[1]);
+                pop  = (int (*)())dlsym(so, lib[2]);
+                mark = (void (*)(const char*))dlsym(so, lib[3]);
+                if(push && pop && mark)
+                    return;
+                push = nullptr;
+                pop  = nullptr;
+                mark = nullptr;
+            }
+#endif
+        }
+    };
+
+    const range_api& get_range_api()
+    {
+        static const range_api api;
+        return api;
+    }
+}
+
+uint32_t hipblas_get_layer_mode()
+{
+    static const uint32_t mode = [] {
+        const char* env = getenv("HIPBLAS_LAYER");
+        uint32_t    m   = env ? uint32_t(strtoul(env, nullptr, 0)) : hipblas_layer_mode_none;
+        // Construct the profile now so it is destroyed after any static
+        // objects in the application that might still call hipBLAS.
+        if(m & hipblas_layer_mode_log_profile)
+            get_gemm_profile();
+        if(m & hipblas_layer_mode_log_trace)
+            get_gemm_trace();
+        if(m & (hipblas_layer_mode_log_range | hipblas_layer_mode_log_shape))
+            get_range_api();
+        return m;
+    }();
+    return mode;
+}
+
+void hipblas_log_gemm_profile(hipblasHandle_t    handle,
+                              const char*        func,
+                              hipblasDatatype_t  a_type,
+                              hipblasDatatype_t  b_type,
+                              hipblasDatatype_t  c_type,
+                              hipblasDatatype_t  compute_type,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              int                lda,
+                              int64_t            stride_a,
+                              const void*        B,
+                              int                ldb,
+                              int64_t            stride_b,
+                              const void*        beta,
+                              const void*        C,
+                              int                ldc,
+                              int64_t            stride_c,
+                              int                batch_count)
+try
+{
+    hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS)
+        return;
+    bool device_mode = mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+    // For GemmEx the scalars are of compute_type; for typed GEMM they match a_type
+    scalar_class alpha_class = classify_scalar(device_mode, compute_type, alpha);
+    scalar_class beta_class  = classify_scalar(device_mode, compute_type, beta);
+
+    std::string prefix, suffix;
+    gemm_shape_strings(func,
+                       a_type,
+                       b_type,
+                       c_type,
+                       compute_type,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       lda,
+                       stride_a,
+                       ldb,
+                       stride_b,
+                       ldc,
+                       stride_c,
+                       batch_count,
+                       prefix,
+                       suffix);
+
+    std::string key = prefix + '|' + suffix + '|' + alpha_class.tag + beta_class.tag;
+    get_gemm_profile().add(key, prefix, suffix, alpha_class, beta_class);
+}
+catch(...)
+{
+    // Logging must never change the result of the call being logged
+}
+
+void hipblas_log_gemm_trace(hipblasHandle_t    handle,
+                            const char*        func,
+                            hipblasDatatype_t  a_type,
+                            hipblasDatatype_t  b_type,
+                            hipblasDatatype_t  c_type,
+                            hipblasDatatype_t  compute_type,
+                            hipblasOperation_t transA,
+                            hipblasOperation_t transB,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            int                lda,
+                            int64_t            stride_a,
+                            const void*        B,
+                            int                ldb,
+                            int64_t            stride_b,
+                            const void*        beta,
+                            const void*        C,
+                            int                ldc,
+                            int64_t            stride_c,
+                            int                batch_count)
+try
+{
+    hipblas_trace_record record{};
+    snprintf(record.function, sizeof(record.function), "%s", func);
+
+    hipblasPointerMode_t mode   = HIPBLAS_POINTER_MODE_HOST;
+    hipStream_t          stream = nullptr;
+    int                  device = 0;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS
+       || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return;
+    (void)hipGetDevice(&device);
+
+    record.handle       = uint64_t(uintptr_t(handle));
+    record.stream       = uint64_t(uintptr_t(stream));
+    record.A            = uint64_t(uintptr_t(A));
+    record.B            = uint64_t(uintptr_t(B));
+    record.C            = uint64_t(uintptr_t(C));
+    record.stride_a     = stride_a;
+    record.stride_b     = stride_b;
+    record.stride_c     = stride_c;
+    record.device       = device;
+    record.pointer_mode = mode;
+    record.a_type       = a_type;
+    record.b_type       = b_type;
+    record.c_type       = c_type;
+    record.compute_type = compute_type;
+    record.transA       = transA;
+    record.transB       = transB;
+    record.m            = m;
+    record.n            = n;
+    record.k            = k;
+    record.lda          = lda;
+    record.ldb          = ldb;
+    record.ldc          = ldc;
+    record.batch_count  = batch_count;
+
+    size_t scalar_size = std::min(hipblas_datatype_size(compute_type), sizeof(record.alpha));
+    if(mode == HIPBLAS_POINTER_MODE_HOST && alpha && beta)
+    {
+        memcpy(record.alpha, alpha, scalar_size);
+        memcpy(record.beta, beta, scalar_size);
+    }
+
+    get_gemm_trace().add(record);
+}
+catch(...)
+{
+    // Logging must never change the result of the call being logged
+}
+
+void hipblas_range_push(const char* name)
+{
+    auto& api = get_range_api();
+    if(api.push)
+        api.push(name);
+}
+
+void hipblas_range_pop()
+{
+    auto& api = get_range_api();
+    if(api.pop)
+        api.pop();
+}
+
+void hipblas_range_mark(const char* message)
+{
+    auto& api = get_range_api();
+    if(api.mark)
+        api.mark(message);
+}
+
+void hipblas_log_gemm_shape(hipblasHandle_t    handle,
+                            const char*        func,
+                            hipblasDatatype_t  a_type,
+                            hipblasDatatype_t  b_type,
+                            hipblasDatatype_t  c_type,
+                            hipblasDatatype_t  compute_type,
+                            hipblasOperation_t transA,
+                            hipblasOperation_t transB,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            int                lda,
+                            int64_t            stride_a,
+                            const void*        B,
+                            int                ldb,
+                            int64_t            stride_b,
+                            const void*        beta,
+                            const void*        C,
+                            int                ldc,
+                            int64_t            stride_c,
+                            int                batch_count)
+try
+{
+    if(!get_range_api().mark)
+        return;
+
+    std::string prefix, suffix;
+    gemm_shape_strings(func,
+                       a_type,
+                       b_type,
+                       c_type,
+                       compute_type,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       k,
+                       lda,
+                       stride_a,
+                       ldb,
+                       stride_b,
+                       ldc,
+                       stride_c,
+                       batch_count,
+                       prefix,
+                       suffix);
+    hipblas_range_mark(("{ " + prefix + ", " + suffix + " }").c_str());
+}
+catch(...)
+{
+    // Logging must never change the result of the call being logged
+}
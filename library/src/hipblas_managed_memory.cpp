@@ -0,0 +1,223 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "managed_memory.hpp"
+#include "thread_stream.hpp"
+#include <hip/hip_runtime_api.h>
+
+std::atomic<int> hipblas_managed_handles{0};
+
+namespace
+{
+    struct managed_region
+    {
+        const void* ptr;
+        size_t      bytes;
+        bool        output;
+    };
+
+    // Allocations advised per handle before the set is cleared, so that it
+    // does not grow with every allocation a long-running program passes
+    constexpr size_t managed_advised_max = 256;
+
+    // Add the bytes spanned by batch_count rows x cols matrices if they are
+    // managed. Arguments the backend will reject are skipped.
+    void add_region(managed_region* regions,
+                    int&            count,
+                    const void*     ptr,
+                    int             rows,
+                    int             cols,
+                    int             ld,
+                    int64_t         stride,
+                    int             batch_count,
+                    size_t          elem_size,
+                    bool            output)
+    {
+        if(!ptr || rows <= 0 || cols <= 0 || ld < rows || stride < 0 || !elem_size)
+            return;
+
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return;
+        }
+        if(!attr.isManaged)
+            return;
+
+        size_t bytes = hipblas_matrix_span(rows, cols, ld, elem_size)
+                       + size_t(stride) * (batch_count - 1) * elem_size;
+        regions[count++] = {ptr, bytes, output};
+    }
+}
+
+void hipblas_managed_prefetch_gemm(hipblasHandle_t    handle,
+                                   hipblasDatatype_t  a_type,
+                                   hipblasDatatype_t  b_type,
+                                   hipblasDatatype_t  c_type,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const void*        A,
+                                   int                lda,
+                                   int64_t            stride_a,
+                                   const void*        B,
+                                   int                ldb,
+                                   int64_t            stride_b,
+                                   const void*        C,
+                                   int                ldc,
+                                   int64_t            stride_c,
+                                   int                batch_count,
+                                   const void*        Cin,
+                                   int                ldc_in,
+                                   int64_t            stride_c_in)
+{
+    hipblas_handle_state* state = handle ? hipblas_find_handle_state(handle) : nullptr;
+    if(!state || state->managed_policy == HIPBLAS_MANAGED_MEMORY_POLICY_NONE || m <= 0 || n <= 0
+       || batch_count <= 0)
+        return;
+
+    // op(A) is m x k and op(B) is k x n
+    int            ra = transA == HIPBLAS_OP_N ? m : k;
+    int            rb = transB == HIPBLAS_OP_N ? k : n;
+    size_t         size_a = hipblas_datatype_size(a_type);
+    size_t         size_b = hipblas_datatype_size(b_type);
+    size_t         size_c = hipblas_datatype_size(c_type);
+    managed_region regions[4];
+    int            count = 0;
+    add_region(regions, count, A, ra, m + k - ra, lda, stride_a, batch_count, size_a, false);
+    add_region(regions, count, B, rb, k + n - rb, ldb, stride_b, batch_count, size_b, false);
+    add_region(regions, count, C, m, n, ldc, stride_c, batch_count, size_c, true);
+    if(Cin != C || ldc_in != ldc || stride_c_in != stride_c)
+        add_region(regions, count, Cin, m, n, ldc_in, stride_c_in, batch_count, size_c, false);
+    if(!count)
+        return;
+
+    int         device;
+    hipStream_t stream;
+    {
+        hipblas_internal_call_guard guard;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        {
+            (void)hipGetLastError();
+            return;
+        }
+    }
+
+    // The runtime cannot tell which pages are resident, so every region is
+    // prefetched; pages already on the device are not migrated again. Regions
+    // that together exceed the device's memory would evict each other, so they
+    // are read in place instead.
+    size_t needed = 0;
+    for(int i = 0; i < count; i++)
+        needed += regions[i].bytes;
+    size_t free_bytes = 0, total_bytes = 0;
+    bool   fits = hipMemGetInfo(&free_bytes, &total_bytes) == hipSuccess && needed <= total_bytes;
+
+    for(int i = 0; i < count; i++)
+    {
+        const managed_region& r = regions[i];
+        if(!fits || state->managed_policy == HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE)
+        {
+            hipMemoryAdvise advice = !fits      ? hipMemAdviseSetAccessedBy
+                                     : r.output ? hipMemAdviseSetPreferredLocation
+                                                : hipMemAdviseSetReadMostly;
+
+            // Advice is given to whole allocations, once each
+            void*  base = const_cast<void*>(r.ptr);
+            size_t size = r.bytes;
+            if(hipMemGetAddressRange(&base, &size, const_cast<void*>(r.ptr)) != hipSuccess)
+            {
+                base = const_cast<void*>(r.ptr);
+                size = r.bytes;
+            }
+            if(state->managed_advised.size() >= managed_advised_max)
+                state->managed_advised.clear();
+            if(state->managed_advised.insert({base, size, advice}).second)
+                (void)hipMemAdvise(base, size, advice, device);
+        }
+        if(fits)
+            (void)hipMemPrefetchAsync(r.ptr, r.bytes, device, stream);
+    }
+    (void)hipGetLastError();
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetManagedMemoryPolicy(hipblasHandle_t              handle,
+                                              hipblasManagedMemoryPolicy_t policy)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(policy != HIPBLAS_MANAGED_MEMORY_POLICY_NONE
+       && policy != HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH
+       && policy != HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.managed_policy == policy)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state.managed_policy == HIPBLAS_MANAGED_MEMORY_POLICY_NONE)
+        hipblas_managed_handles++;
+    else if(policy == HIPBLAS_MANAGED_MEMORY_POLICY_NONE)
+        hipblas_managed_handles--;
+    state.managed_policy = policy;
+    state.managed_advised.clear();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetManagedMemoryPolicy(hipblasHandle_t               handle,
+                                              hipblasManagedMemoryPolicy_t* policy)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(policy == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    *policy = state ? state->managed_policy : HIPBLAS_MANAGED_MEMORY_POLICY_NONE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,156 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "matmul_plan.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+hipblas_matmul_plan::~hipblas_matmul_plan()
+{
+    (void)hipFree(ones);
+}
+
+hipblasStatus_t hipblas_matmul_plan_init(hipblas_matmul_plan&    plan,
+                                         hipblasOperation_t      transa,
+                                         hipblasOperation_t      transb,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         hipblasDatatype_t       a_type,
+                                         int                     lda,
+                                         hipblasDatatype_t       b_type,
+                                         int                     ldb,
+                                         hipblasDatatype_t       c_type,
+                                         int                     ldc,
+                                         hipblasDatatype_t       compute_type,
+                                         hipblasGemmAlgo_t       algo,
+                                         hipblasMatmulEpilogue_t epilogue)
+{
+    if(epilogue != HIPBLAS_MATMUL_EPILOGUE_DEFAULT && epilogue != HIPBLAS_MATMUL_EPILOGUE_BIAS)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Complex half GEMMs are hipBLAS's own, with no backend call to prepare
+    if(a_type == HIPBLAS_C_16F || b_type == HIPBLAS_C_16F || c_type == HIPBLAS_C_16F)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    plan.transa       = transa;
+    plan.transb       = transb;
+    plan.m            = m;
+    plan.n            = n;
+    plan.k            = k;
+    plan.lda          = lda;
+    plan.ldb          = ldb;
+    plan.ldc          = ldc;
+    plan.a_type       = a_type;
+    plan.b_type       = b_type;
+    plan.c_type       = c_type;
+    plan.compute_type = compute_type;
+    plan.algo         = algo;
+    plan.epilogue     = epilogue;
+    if(hipGetDevice(&plan.device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    if(epilogue == HIPBLAS_MATMUL_EPILOGUE_BIAS && n > 0)
+    {
+        // The bias is added by a GEMM in c_type, which integer outputs lack
+        unsigned char one[16];
+        size_t        c_size = c_type == HIPBLAS_R_32I ? 0 : hipblas_write_one(c_type, one);
+        if(!c_size || !hipblas_write_one(compute_type, plan.one))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        std::vector<unsigned char> ones(c_size * n);
+        for(int j = 0; j < n; j++)
+            memcpy(ones.data() + j * c_size, one, c_size);
+        if(hipMalloc(&plan.ones, ones.size()) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        if(hipMemcpy(plan.ones, ones.data(), ones.size(), hipMemcpyHostToDevice) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+bool hipblas_matmul_plan_current(const hipblas_matmul_plan& plan)
+{
+    int device;
+    return hipGetDevice(&device) == hipSuccess && device == plan.device;
+}
+
+hipblasStatus_t hipblas_matmul_plan_epilogue(hipblasHandle_t            handle,
+                                             const hipblas_matmul_plan& plan,
+                                             void*                      C,
+                                             const void*                bias)
+{
+    if(plan.epilogue == HIPBLAS_MATMUL_EPILOGUE_DEFAULT || !plan.m || !plan.n)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!bias)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The epilogue scalars live in the plan, on the host
+    hipblas_internal_call_guard guard;
+    hipblasPointerMode_t        pointer_mode;
+    hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    status = hipblasGemmEx(handle,
+                           HIPBLAS_OP_N,
+                           HIPBLAS_OP_N,
+                           plan.m,
+                           plan.n,
+                           1,
+                           plan.one,
+                           bias,
+                           plan.c_type,
+                           plan.m,
+                           plan.ones,
+                           plan.c_type,
+                           1,
+                           plan.one,
+                           C,
+                           plan.c_type,
+                           plan.ldc,
+                           plan.compute_type,
+                           plan.algo);
+
+    if(pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+    {
+        hipblasStatus_t restore = hipblasSetPointerMode(handle, pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = restore;
+    }
+    return status;
+}
@@ -82,6 +82,9 @@ module hipblas_enums
         enumerator :: HIPBLAS_C_32U = 167
         enumerator :: HIPBLAS_R_16B = 168
         enumerator :: HIPBLAS_C_16B = 169
+        enumerator :: HIPBLAS_R_32F_FAST = 170
+        enumerator :: HIPBLAS_R_32F_FAST_TF32 = 171
+        enumerator :: HIPBLAS_R_32F_FAST_16BX3 = 172
     end enum
 
     enum, bind(c)
@@ -98,6 +101,49 @@ module hipblas_enums
         enumerator :: HIPBLAS_ATOMICS_ALLOWED = 1
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPBLAS_DEFERRED_MODE_DISABLED = 0
+        enumerator :: HIPBLAS_DEFERRED_MODE_ENABLED = 1
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_MANAGED_MEMORY_POLICY_NONE = 0
+        enumerator :: HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH = 1
+        enumerator :: HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE = 2
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_SYMMETRIC_OUTPUT_NONE = 0
+        enumerator :: HIPBLAS_SYMMETRIC_OUTPUT_UPPER = 1
+        enumerator :: HIPBLAS_SYMMETRIC_OUTPUT_LOWER = 2
+        enumerator :: HIPBLAS_SYMMETRIC_OUTPUT_FULL = 3
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_FLOAT32_MODE_DEFAULT = 0
+        enumerator :: HIPBLAS_FLOAT32_MODE_FAST = 1
+        enumerator :: HIPBLAS_FLOAT32_MODE_FAST_TF32 = 2
+        enumerator :: HIPBLAS_FLOAT32_MODE_FAST_16BX3 = 3
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_MATMUL_EPILOGUE_DEFAULT = 0
+        enumerator :: HIPBLAS_MATMUL_EPILOGUE_BIAS = 1
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_XT_GEMM = 0
+        enumerator :: HIPBLAS_XT_SYRK = 1
+        enumerator :: HIPBLAS_XT_TRSM = 2
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_XT_FLOAT = 0
+        enumerator :: HIPBLAS_XT_DOUBLE = 1
+        enumerator :: HIPBLAS_XT_COMPLEX = 2
+        enumerator :: HIPBLAS_XT_DOUBLECOMPLEX = 3
+    end enum
+
     enum, bind(c)
         enumerator :: HIPBLAS_INT8_DATATYPE_DEFAULT = 0
         enumerator :: HIPBLAS_INT8_DATATYPE_INT8 = 1
@@ -136,6 +182,78 @@ module hipblas
         end function hipblasDestroy
     end interface
 
+    ! handle pool
+    interface
+        function hipblasHandlePoolCreate(pool) &
+            bind(c, name='hipblasHandlePoolCreate')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHandlePoolCreate
+            type(c_ptr), value :: pool
+        end function hipblasHandlePoolCreate
+    end interface
+
+    interface
+        function hipblasHandlePoolDestroy(pool) &
+            bind(c, name='hipblasHandlePoolDestroy')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHandlePoolDestroy
+            type(c_ptr), value :: pool
+        end function hipblasHandlePoolDestroy
+    end interface
+
+    interface
+        function hipblasHandlePoolReserve(pool, count) &
+            bind(c, name='hipblasHandlePoolReserve')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHandlePoolReserve
+            type(c_ptr), value :: pool
+            integer(c_int), value :: count
+        end function hipblasHandlePoolReserve
+    end interface
+
+    interface
+        function hipblasHandlePoolAcquire(pool, handle) &
+            bind(c, name='hipblasHandlePoolAcquire')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHandlePoolAcquire
+            type(c_ptr), value :: pool
+            type(c_ptr), value :: handle
+        end function hipblasHandlePoolAcquire
+    end interface
+
+    interface
+        function hipblasHandlePoolRelease(pool, handle) &
+            bind(c, name='hipblasHandlePoolRelease')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHandlePoolRelease
+            type(c_ptr), value :: pool
+            type(c_ptr), value :: handle
+        end function hipblasHandlePoolRelease
+    end interface
+
+    interface
+        function hipblasWarmup(handle, shapes, shapeCount) &
+            bind(c, name='hipblasWarmup')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasWarmup
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: shapes
+            integer(c_int), value :: shapeCount
+        end function hipblasWarmup
+    end interface
+
     interface
         function hipblasSetStream(handle, streamId) &
             bind(c, name='hipblasSetStream')
@@ -320,6 +438,153 @@ module hipblas
         end function hipblasGetMatrixAsync
     end interface
 
+    ! batched and strided batched transfers
+    interface
+        function hipblasSetVectorBatchedAsync(n, elemSize, x, incx, y, incy, batchCount, stream) &
+            bind(c, name='hipblasSetVectorBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVectorBatchedAsync
+            integer(c_int), value :: n
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasSetVectorBatchedAsync
+
+        function hipblasGetVectorBatchedAsync(n, elemSize, x, incx, y, incy, batchCount, stream) &
+            bind(c, name='hipblasGetVectorBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVectorBatchedAsync
+            integer(c_int), value :: n
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasGetVectorBatchedAsync
+
+        function hipblasSetVectorStridedBatchedAsync(n, elemSize, x, incx, stridex, &
+                                                     y, incy, stridey, batchCount, stream) &
+            bind(c, name='hipblasSetVectorStridedBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetVectorStridedBatchedAsync
+            integer(c_int), value :: n
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasSetVectorStridedBatchedAsync
+
+        function hipblasGetVectorStridedBatchedAsync(n, elemSize, x, incx, stridex, &
+                                                     y, incy, stridey, batchCount, stream) &
+            bind(c, name='hipblasGetVectorStridedBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetVectorStridedBatchedAsync
+            integer(c_int), value :: n
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasGetVectorStridedBatchedAsync
+
+        function hipblasSetMatrixBatchedAsync(rows, cols, elemSize, A, lda, B, ldb, batchCount, stream) &
+            bind(c, name='hipblasSetMatrixBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrixBatchedAsync
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasSetMatrixBatchedAsync
+
+        function hipblasGetMatrixBatchedAsync(rows, cols, elemSize, A, lda, B, ldb, batchCount, stream) &
+            bind(c, name='hipblasGetMatrixBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrixBatchedAsync
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasGetMatrixBatchedAsync
+
+        function hipblasSetMatrixStridedBatchedAsync(rows, cols, elemSize, A, lda, strideA, &
+                                                     B, ldb, strideB, batchCount, stream) &
+            bind(c, name='hipblasSetMatrixStridedBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetMatrixStridedBatchedAsync
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasSetMatrixStridedBatchedAsync
+
+        function hipblasGetMatrixStridedBatchedAsync(rows, cols, elemSize, A, lda, strideA, &
+                                                     B, ldb, strideB, batchCount, stream) &
+            bind(c, name='hipblasGetMatrixStridedBatchedAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetMatrixStridedBatchedAsync
+            integer(c_int), value :: rows
+            integer(c_int), value :: cols
+            integer(c_int), value :: elemSize
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: stream
+        end function hipblasGetMatrixStridedBatchedAsync
+    end interface
+
     ! atomics mode
     interface
         function hipblasSetAtomicsMode(handle, atomics_mode) &
@@ -345,157 +610,339 @@ module hipblas
         end function hipblasGetAtomicsMode
     end interface
 
-    !--------!
-    ! blas 1 !
-    !--------!
-
-    ! scal
+    ! deferred mode
     interface
-        function hipblasSscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasSscal')
+        function hipblasSetDeferredMode(handle, mode) &
+            bind(c, name='hipblasSetDeferredMode')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetDeferredMode
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasSscal
+            integer(kind(HIPBLAS_DEFERRED_MODE_ENABLED)), value :: mode
+        end function hipblasSetDeferredMode
     end interface
 
     interface
-        function hipblasDscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasDscal')
+        function hipblasGetDeferredMode(handle, mode) &
+            bind(c, name='hipblasGetDeferredMode')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetDeferredMode
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasDscal
+            type(c_ptr), value :: mode
+        end function hipblasGetDeferredMode
     end interface
 
     interface
-        function hipblasCscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasCscal')
+        function hipblasFlush(handle) &
+            bind(c, name='hipblasFlush')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasFlush
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasCscal
+        end function hipblasFlush
     end interface
 
+    ! thread stream
     interface
-        function hipblasZscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasZscal')
+        function hipblasSetThreadStream(handle, stream) &
+            bind(c, name='hipblasSetThreadStream')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetThreadStream
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasZscal
+            type(c_ptr), value :: stream
+        end function hipblasSetThreadStream
     end interface
 
     interface
-        function hipblasCsscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasCsscal')
+        function hipblasClearThreadStream(handle) &
+            bind(c, name='hipblasClearThreadStream')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCsscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasClearThreadStream
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasCsscal
+        end function hipblasClearThreadStream
     end interface
 
+    ! managed memory policy
     interface
-        function hipblasZdscal(handle, n, alpha, x, incx) &
-            bind(c, name='hipblasZdscal')
+        function hipblasSetManagedMemoryPolicy(handle, policy) &
+            bind(c, name='hipblasSetManagedMemoryPolicy')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdscal
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetManagedMemoryPolicy
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-        end function hipblasZdscal
+            integer(kind(HIPBLAS_MANAGED_MEMORY_POLICY_NONE)), value :: policy
+        end function hipblasSetManagedMemoryPolicy
     end interface
 
-    ! scalBatched
     interface
-        function hipblasSscalBatched(handle, n, alpha, x, incx, batch_count) &
-            bind(c, name='hipblasSscalBatched')
+        function hipblasGetManagedMemoryPolicy(handle, policy) &
+            bind(c, name='hipblasGetManagedMemoryPolicy')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscalBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetManagedMemoryPolicy
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int), value :: batch_count
-        end function hipblasSscalBatched
+            type(c_ptr), value :: policy
+        end function hipblasGetManagedMemoryPolicy
     end interface
 
+    ! symmetric output
     interface
-        function hipblasDscalBatched(handle, n, alpha, x, incx, batch_count) &
-            bind(c, name='hipblasDscalBatched')
+        function hipblasSetSymmetricOutput(handle, output) &
+            bind(c, name='hipblasSetSymmetricOutput')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscalBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetSymmetricOutput
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int), value :: batch_count
-        end function hipblasDscalBatched
+            integer(kind(HIPBLAS_SYMMETRIC_OUTPUT_NONE)), value :: output
+        end function hipblasSetSymmetricOutput
     end interface
 
     interface
-        function hipblasCscalBatched(handle, n, alpha, x, incx, batch_count) &
-            bind(c, name='hipblasCscalBatched')
+        function hipblasGetSymmetricOutput(handle, output) &
+            bind(c, name='hipblasGetSymmetricOutput')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscalBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetSymmetricOutput
             type(c_ptr), value :: handle
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int), value :: batch_count
-        end function hipblasCscalBatched
+            type(c_ptr), value :: output
+        end function hipblasGetSymmetricOutput
     end interface
 
+    ! float32 mode
     interface
-        function hipblasZscalBatched(handle, n, alpha, x, incx, batch_count) &
-            bind(c, name='hipblasZscalBatched')
+        function hipblasSetFloat32Mode(handle, mode) &
+            bind(c, name='hipblasSetFloat32Mode')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscalBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetFloat32Mode
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FLOAT32_MODE_DEFAULT)), value :: mode
+        end function hipblasSetFloat32Mode
+    end interface
+
+    interface
+        function hipblasGetFloat32Mode(handle, mode) &
+            bind(c, name='hipblasGetFloat32Mode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetFloat32Mode
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: mode
+        end function hipblasGetFloat32Mode
+    end interface
+
+    ! graph
+    interface
+        function hipblasGraphBegin(handle) &
+            bind(c, name='hipblasGraphBegin')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGraphBegin
+            type(c_ptr), value :: handle
+        end function hipblasGraphBegin
+    end interface
+
+    interface
+        function hipblasGraphEnd(handle, graph) &
+            bind(c, name='hipblasGraphEnd')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGraphEnd
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: graph
+        end function hipblasGraphEnd
+    end interface
+
+    interface
+        function hipblasGraphLaunch(graph, stream) &
+            bind(c, name='hipblasGraphLaunch')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGraphLaunch
+            type(c_ptr), value :: graph
+            type(c_ptr), value :: stream
+        end function hipblasGraphLaunch
+    end interface
+
+    interface
+        function hipblasGraphDestroy(graph) &
+            bind(c, name='hipblasGraphDestroy')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGraphDestroy
+            type(c_ptr), value :: graph
+        end function hipblasGraphDestroy
+    end interface
+
+    !--------!
+    ! blas 1 !
+    !--------!
+
+    ! scal
+    interface
+        function hipblasSscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasSscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasSscal
+    end interface
+
+    interface
+        function hipblasDscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasDscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasDscal
+    end interface
+
+    interface
+        function hipblasCscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasCscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasCscal
+    end interface
+
+    interface
+        function hipblasZscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasZscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasZscal
+    end interface
+
+    interface
+        function hipblasCsscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasCsscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCsscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasCsscal
+    end interface
+
+    interface
+        function hipblasZdscal(handle, n, alpha, x, incx) &
+            bind(c, name='hipblasZdscal')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdscal
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+        end function hipblasZdscal
+    end interface
+
+    ! scalBatched
+    interface
+        function hipblasSscalBatched(handle, n, alpha, x, incx, batch_count) &
+            bind(c, name='hipblasSscalBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscalBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batch_count
+        end function hipblasSscalBatched
+    end interface
+
+    interface
+        function hipblasDscalBatched(handle, n, alpha, x, incx, batch_count) &
+            bind(c, name='hipblasDscalBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscalBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batch_count
+        end function hipblasDscalBatched
+    end interface
+
+    interface
+        function hipblasCscalBatched(handle, n, alpha, x, incx, batch_count) &
+            bind(c, name='hipblasCscalBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscalBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batch_count
+        end function hipblasCscalBatched
+    end interface
+
+    interface
+        function hipblasZscalBatched(handle, n, alpha, x, incx, batch_count) &
+            bind(c, name='hipblasZscalBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscalBatched
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
@@ -1294,163 +1741,271 @@ module hipblas
         end function hipblasZdotcStridedBatched
     end interface
 
-    ! swap
     interface
-        function hipblasSswap(handle, n, x, incx, y, incy) &
-            bind(c, name='hipblasSswap')
+        function hipblasSdotAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasSdotAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswap
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdotAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function hipblasSswap
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasSdotAsync
     end interface
 
     interface
-        function hipblasDswap(handle, n, x, incx, y, incy) &
-            bind(c, name='hipblasDswap')
+        function hipblasDdotAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasDdotAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDswap
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdotAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function hipblasDswap
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasDdotAsync
     end interface
 
     interface
-        function hipblasCswap(handle, n, x, incx, y, incy) &
-            bind(c, name='hipblasCswap')
+        function hipblasCdotuAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasCdotuAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCswap
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdotuAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function hipblasCswap
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasCdotuAsync
     end interface
 
     interface
-        function hipblasZswap(handle, n, x, incx, y, incy) &
-            bind(c, name='hipblasZswap')
+        function hipblasCdotcAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasCdotcAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZswap
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdotcAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-        end function hipblasZswap
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasCdotcAsync
     end interface
 
-    ! swapBatched
     interface
-        function hipblasSswapBatched(handle, n, x, incx, y, incy, batch_count) &
-            bind(c, name='hipblasSswapBatched')
+        function hipblasZdotuAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasZdotuAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswapBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdotuAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function hipblasSswapBatched
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasZdotuAsync
     end interface
 
     interface
-        function hipblasDswapBatched(handle, n, x, incx, y, incy, batch_count) &
-            bind(c, name='hipblasDswapBatched')
+        function hipblasZdotcAsync(handle, n, x, incx, y, incy, result, event) &
+            bind(c, name='hipblasZdotcAsync')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDswapBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdotcAsync
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function hipblasDswapBatched
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasZdotcAsync
     end interface
 
+    ! swap
     interface
-        function hipblasCswapBatched(handle, n, x, incx, y, incy, batch_count) &
-            bind(c, name='hipblasCswapBatched')
+        function hipblasSswap(handle, n, x, incx, y, incy) &
+            bind(c, name='hipblasSswap')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCswapBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswap
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function hipblasCswapBatched
+        end function hipblasSswap
     end interface
 
     interface
-        function hipblasZswapBatched(handle, n, x, incx, y, incy, batch_count) &
-            bind(c, name='hipblasZswapBatched')
+        function hipblasDswap(handle, n, x, incx, y, incy) &
+            bind(c, name='hipblasDswap')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZswapBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDswap
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int), value :: batch_count
-        end function hipblasZswapBatched
+        end function hipblasDswap
     end interface
 
-    ! swapStridedBatched
     interface
-        function hipblasSswapStridedBatched(handle, n, x, incx, stride_x, y, incy, stride_y, batch_count) &
-            bind(c, name='hipblasSswapStridedBatched')
+        function hipblasCswap(handle, n, x, incx, y, incy) &
+            bind(c, name='hipblasCswap')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswapStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCswap
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: x
             integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
             type(c_ptr), value :: y
             integer(c_int), value :: incy
-            integer(c_int64_t), value :: stride_y
-            integer(c_int), value :: batch_count
-        end function hipblasSswapStridedBatched
+        end function hipblasCswap
     end interface
 
     interface
-        function hipblasDswapStridedBatched(handle, n, x, incx, stride_x, y, incy, stride_y, batch_count) &
-            bind(c, name='hipblasDswapStridedBatched')
+        function hipblasZswap(handle, n, x, incx, y, incy) &
+            bind(c, name='hipblasZswap')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZswap
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function hipblasZswap
+    end interface
+
+    ! swapBatched
+    interface
+        function hipblasSswapBatched(handle, n, x, incx, y, incy, batch_count) &
+            bind(c, name='hipblasSswapBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswapBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function hipblasSswapBatched
+    end interface
+
+    interface
+        function hipblasDswapBatched(handle, n, x, incx, y, incy, batch_count) &
+            bind(c, name='hipblasDswapBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDswapBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function hipblasDswapBatched
+    end interface
+
+    interface
+        function hipblasCswapBatched(handle, n, x, incx, y, incy, batch_count) &
+            bind(c, name='hipblasCswapBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCswapBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function hipblasCswapBatched
+    end interface
+
+    interface
+        function hipblasZswapBatched(handle, n, x, incx, y, incy, batch_count) &
+            bind(c, name='hipblasZswapBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZswapBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batch_count
+        end function hipblasZswapBatched
+    end interface
+
+    ! swapStridedBatched
+    interface
+        function hipblasSswapStridedBatched(handle, n, x, incx, stride_x, y, incy, stride_y, batch_count) &
+            bind(c, name='hipblasSswapStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSswapStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stride_y
+            integer(c_int), value :: batch_count
+        end function hipblasSswapStridedBatched
+    end interface
+
+    interface
+        function hipblasDswapStridedBatched(handle, n, x, incx, stride_x, y, incy, stride_y, batch_count) &
+            bind(c, name='hipblasDswapStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
@@ -1978,6 +2533,70 @@ module hipblas
         end function hipblasDzasumStridedBatched
     end interface
 
+    interface
+        function hipblasSasumAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasSasumAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSasumAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasSasumAsync
+    end interface
+
+    interface
+        function hipblasDasumAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasDasumAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDasumAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasDasumAsync
+    end interface
+
+    interface
+        function hipblasScasumAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasScasumAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasScasumAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasScasumAsync
+    end interface
+
+    interface
+        function hipblasDzasumAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasDzasumAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDzasumAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasDzasumAsync
+    end interface
+
     ! nrm2
     interface
         function hipblasSnrm2(handle, n, x, incx, result) &
@@ -2173,6 +2792,70 @@ module hipblas
         end function hipblasDznrm2StridedBatched
     end interface
 
+    interface
+        function hipblasSnrm2Async(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasSnrm2Async')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSnrm2Async
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasSnrm2Async
+    end interface
+
+    interface
+        function hipblasDnrm2Async(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasDnrm2Async')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDnrm2Async
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasDnrm2Async
+    end interface
+
+    interface
+        function hipblasScnrm2Async(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasScnrm2Async')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasScnrm2Async
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasScnrm2Async
+    end interface
+
+    interface
+        function hipblasDznrm2Async(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasDznrm2Async')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDznrm2Async
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasDznrm2Async
+    end interface
+
     ! amax
     interface
         function hipblasIsamax(handle, n, x, incx, result) &
@@ -2368,6 +3051,70 @@ module hipblas
         end function hipblasIzamaxStridedBatched
     end interface
 
+    interface
+        function hipblasIsamaxAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasIsamaxAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasIsamaxAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasIsamaxAsync
+    end interface
+
+    interface
+        function hipblasIdamaxAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasIdamaxAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasIdamaxAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasIdamaxAsync
+    end interface
+
+    interface
+        function hipblasIcamaxAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasIcamaxAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasIcamaxAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasIcamaxAsync
+    end interface
+
+    interface
+        function hipblasIzamaxAsync(handle, n, x, incx, result, event) &
+            bind(c, name='hipblasIzamaxAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasIzamaxAsync
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: result
+            type(c_ptr), value :: event
+        end function hipblasIzamaxAsync
+    end interface
+
     ! amin
     interface
         function hipblasIsamin(handle, n, x, incx, result) &
@@ -10174,927 +10921,4451 @@ module hipblas
         end function hipblasZsyrkxStridedBatched
     end interface
 
-    ! trmm
+    ! row-major
     interface
-        function hipblasStrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasStrmm')
+        function hipblasRowHgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, &
+                                 beta, C, ldc) &
+            bind(c, name='hipblasRowHgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowHgemm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function hipblasStrmm
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowHgemm
     end interface
 
     interface
-        function hipblasDtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasDtrmm')
+        function hipblasRowSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, &
+                                 beta, C, ldc) &
+            bind(c, name='hipblasRowSgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function hipblasDtrmm
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowSgemm
     end interface
 
     interface
-        function hipblasCtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasCtrmm')
+        function hipblasRowDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, &
+                                 beta, C, ldc) &
+            bind(c, name='hipblasRowDgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function hipblasCtrmm
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowDgemm
     end interface
 
     interface
-        function hipblasZtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasZtrmm')
+        function hipblasRowCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, &
+                                 beta, C, ldc) &
+            bind(c, name='hipblasRowCgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function hipblasZtrmm
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowCgemm
     end interface
 
-    ! trmmBatched
     interface
-        function hipblasStrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasStrmmBatched')
+        function hipblasRowZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, &
+                                 beta, C, ldc) &
+            bind(c, name='hipblasRowZgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasStrmmBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowZgemm
     end interface
 
     interface
-        function hipblasDtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasDtrmmBatched')
+        function hipblasRowHgemmBatched(handle, transA, transB, m, n, k, alpha, A, lda, B, &
+                                        ldb, beta, C, ldc, batchCount) &
+            bind(c, name='hipblasRowHgemmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowHgemmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasDtrmmBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowHgemmBatched
     end interface
 
     interface
-        function hipblasCtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasCtrmmBatched')
+        function hipblasRowSgemmBatched(handle, transA, transB, m, n, k, alpha, A, lda, B, &
+                                        ldb, beta, C, ldc, batchCount) &
+            bind(c, name='hipblasRowSgemmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasCtrmmBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowSgemmBatched
     end interface
 
     interface
-        function hipblasZtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasZtrmmBatched')
+        function hipblasRowDgemmBatched(handle, transA, transB, m, n, k, alpha, A, lda, B, &
+                                        ldb, beta, C, ldc, batchCount) &
+            bind(c, name='hipblasRowDgemmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasZtrmmBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowDgemmBatched
     end interface
 
-    ! trmmStridedBatched
     interface
-        function hipblasStrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasStrmmStridedBatched')
+        function hipblasRowCgemmBatched(handle, transA, transB, m, n, k, alpha, A, lda, B, &
+                                        ldb, beta, C, ldc, batchCount) &
+            bind(c, name='hipblasRowCgemmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            integer(c_int), value :: batch_count
-        end function hipblasStrmmStridedBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowCgemmBatched
     end interface
 
     interface
-        function hipblasDtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasDtrmmStridedBatched')
+        function hipblasRowZgemmBatched(handle, transA, transB, m, n, k, alpha, A, lda, B, &
+                                        ldb, beta, C, ldc, batchCount) &
+            bind(c, name='hipblasRowZgemmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            integer(c_int), value :: batch_count
-        end function hipblasDtrmmStridedBatched
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowZgemmBatched
     end interface
 
     interface
-        function hipblasCtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasCtrmmStridedBatched')
+        function hipblasRowHgemmStridedBatched(handle, transA, transB, m, n, k, alpha, A, &
+                                               lda, strideA, B, ldb, strideB, beta, C, &
+                                               ldc, strideC, batchCount) &
+            bind(c, name='hipblasRowHgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowHgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            integer(c_int64_t), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            integer(c_int), value :: batch_count
-        end function hipblasCtrmmStridedBatched
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowHgemmStridedBatched
     end interface
 
     interface
-        function hipblasZtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasZtrmmStridedBatched')
+        function hipblasRowSgemmStridedBatched(handle, transA, transB, m, n, k, alpha, A, &
+                                               lda, strideA, B, ldb, strideB, beta, C, &
+                                               ldc, strideC, batchCount) &
+            bind(c, name='hipblasRowSgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            integer(c_int64_t), value :: strideA
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            integer(c_int), value :: batch_count
-        end function hipblasZtrmmStridedBatched
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowSgemmStridedBatched
     end interface
 
-    ! trtri
     interface
-        function hipblasStrtri(handle, uplo, diag, n, &
-                               A, lda, invA, ldinvA) &
-            bind(c, name='hipblasStrtri')
+        function hipblasRowDgemmStridedBatched(handle, transA, transB, m, n, k, alpha, A, &
+                                               lda, strideA, B, ldb, strideB, beta, C, &
+                                               ldc, strideC, batchCount) &
+            bind(c, name='hipblasRowDgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtri
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-        end function hipblasStrtri
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowDgemmStridedBatched
     end interface
 
     interface
-        function hipblasDtrtri(handle, uplo, diag, n, &
-                               A, lda, invA, ldinvA) &
-            bind(c, name='hipblasDtrtri')
+        function hipblasRowCgemmStridedBatched(handle, transA, transB, m, n, k, alpha, A, &
+                                               lda, strideA, B, ldb, strideB, beta, C, &
+                                               ldc, strideC, batchCount) &
+            bind(c, name='hipblasRowCgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtri
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-        end function hipblasDtrtri
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowCgemmStridedBatched
     end interface
 
     interface
-        function hipblasCtrtri(handle, uplo, diag, n, &
-                               A, lda, invA, ldinvA) &
-            bind(c, name='hipblasCtrtri')
+        function hipblasRowZgemmStridedBatched(handle, transA, transB, m, n, k, alpha, A, &
+                                               lda, strideA, B, ldb, strideB, beta, C, &
+                                               ldc, strideC, batchCount) &
+            bind(c, name='hipblasRowZgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtri
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-        end function hipblasCtrtri
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowZgemmStridedBatched
     end interface
 
     interface
-        function hipblasZtrtri(handle, uplo, diag, n, &
-                               A, lda, invA, ldinvA) &
-            bind(c, name='hipblasZtrtri')
+        function hipblasRowGemmEx(handle, transA, transB, m, n, k, alpha, A, aType, lda, &
+                                  B, bType, ldb, beta, C, cType, ldc, computeType, algo) &
+            bind(c, name='hipblasRowGemmEx')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtri
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowGemmEx
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-        end function hipblasZtrtri
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasRowGemmEx
+    end interface
+
+    interface
+        function hipblasRowGemmBatchedEx(handle, transA, transB, m, n, k, alpha, A, aType, &
+                                         lda, B, bType, ldb, beta, C, cType, ldc, &
+                                         batchCount, computeType, algo) &
+            bind(c, name='hipblasRowGemmBatchedEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowGemmBatchedEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasRowGemmBatchedEx
+    end interface
+
+    interface
+        function hipblasRowGemmStridedBatchedEx(handle, transA, transB, m, n, k, alpha, A, &
+                                                aType, lda, strideA, B, bType, ldb, &
+                                                strideB, beta, C, cType, ldc, strideC, &
+                                                batchCount, computeType, algo) &
+            bind(c, name='hipblasRowGemmStridedBatchedEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowGemmStridedBatchedEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasRowGemmStridedBatchedEx
+    end interface
+
+    interface
+        function hipblasRowSgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, &
+                                 incy) &
+            bind(c, name='hipblasRowSgemv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemv
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function hipblasRowSgemv
+    end interface
+
+    interface
+        function hipblasRowDgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, &
+                                 incy) &
+            bind(c, name='hipblasRowDgemv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemv
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function hipblasRowDgemv
+    end interface
+
+    interface
+        function hipblasRowCgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, &
+                                 incy) &
+            bind(c, name='hipblasRowCgemv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemv
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function hipblasRowCgemv
+    end interface
+
+    interface
+        function hipblasRowZgemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, &
+                                 incy) &
+            bind(c, name='hipblasRowZgemv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemv
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+        end function hipblasRowZgemv
+    end interface
+
+    interface
+        function hipblasRowSgemvBatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, &
+                                        y, incy, batchCount) &
+            bind(c, name='hipblasRowSgemvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemvBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasRowSgemvBatched
+    end interface
+
+    interface
+        function hipblasRowDgemvBatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, &
+                                        y, incy, batchCount) &
+            bind(c, name='hipblasRowDgemvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemvBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasRowDgemvBatched
+    end interface
+
+    interface
+        function hipblasRowCgemvBatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, &
+                                        y, incy, batchCount) &
+            bind(c, name='hipblasRowCgemvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemvBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasRowCgemvBatched
+    end interface
+
+    interface
+        function hipblasRowZgemvBatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, &
+                                        y, incy, batchCount) &
+            bind(c, name='hipblasRowZgemvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemvBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: trans
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasRowZgemvBatched
+    end interface
+
+    interface
+        function hipblasRowSgemvStridedBatched(handle, transA, m, n, alpha, A, lda, &
+                                               strideA, x, incx, stridex, beta, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasRowSgemvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSgemvStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasRowSgemvStridedBatched
+    end interface
+
+    interface
+        function hipblasRowDgemvStridedBatched(handle, transA, m, n, alpha, A, lda, &
+                                               strideA, x, incx, stridex, beta, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasRowDgemvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDgemvStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasRowDgemvStridedBatched
+    end interface
+
+    interface
+        function hipblasRowCgemvStridedBatched(handle, transA, m, n, alpha, A, lda, &
+                                               strideA, x, incx, stridex, beta, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasRowCgemvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCgemvStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasRowCgemvStridedBatched
+    end interface
+
+    interface
+        function hipblasRowZgemvStridedBatched(handle, transA, m, n, alpha, A, lda, &
+                                               strideA, x, incx, stridex, beta, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasRowZgemvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZgemvStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasRowZgemvStridedBatched
+    end interface
+
+    interface
+        function hipblasRowStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, &
+                                 ldb) &
+            bind(c, name='hipblasRowStrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowStrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasRowStrsm
+    end interface
+
+    interface
+        function hipblasRowDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, &
+                                 ldb) &
+            bind(c, name='hipblasRowDtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasRowDtrsm
+    end interface
+
+    interface
+        function hipblasRowCtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, &
+                                 ldb) &
+            bind(c, name='hipblasRowCtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasRowCtrsm
+    end interface
+
+    interface
+        function hipblasRowZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, &
+                                 ldb) &
+            bind(c, name='hipblasRowZtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasRowZtrsm
+    end interface
+
+    interface
+        function hipblasRowStrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, A, &
+                                        lda, B, ldb, batchCount) &
+            bind(c, name='hipblasRowStrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowStrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+        end function hipblasRowStrsmBatched
+    end interface
+
+    interface
+        function hipblasRowDtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, A, &
+                                        lda, B, ldb, batchCount) &
+            bind(c, name='hipblasRowDtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+        end function hipblasRowDtrsmBatched
+    end interface
+
+    interface
+        function hipblasRowCtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, A, &
+                                        lda, B, ldb, batchCount) &
+            bind(c, name='hipblasRowCtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+        end function hipblasRowCtrsmBatched
+    end interface
+
+    interface
+        function hipblasRowZtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, A, &
+                                        lda, B, ldb, batchCount) &
+            bind(c, name='hipblasRowZtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+        end function hipblasRowZtrsmBatched
+    end interface
+
+    interface
+        function hipblasRowStrsmStridedBatched(handle, side, uplo, transA, diag, m, n, &
+                                               alpha, A, lda, strideA, B, ldb, strideB, &
+                                               batchCount) &
+            bind(c, name='hipblasRowStrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowStrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+        end function hipblasRowStrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasRowDtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, &
+                                               alpha, A, lda, strideA, B, ldb, strideB, &
+                                               batchCount) &
+            bind(c, name='hipblasRowDtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+        end function hipblasRowDtrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasRowCtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, &
+                                               alpha, A, lda, strideA, B, ldb, strideB, &
+                                               batchCount) &
+            bind(c, name='hipblasRowCtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+        end function hipblasRowCtrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasRowZtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, &
+                                               alpha, A, lda, strideA, B, ldb, strideB, &
+                                               batchCount) &
+            bind(c, name='hipblasRowZtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+        end function hipblasRowZtrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasRowTrsmEx(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
+                                  B, ldb, invA, invAsize, computeType) &
+            bind(c, name='hipblasRowTrsmEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowTrsmEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: invA
+            integer(c_int), value :: invAsize
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+        end function hipblasRowTrsmEx
+    end interface
+
+    interface
+        function hipblasRowTrsmBatchedEx(handle, side, uplo, transA, diag, m, n, alpha, A, &
+                                         lda, B, ldb, batchCount, invA, invAsize, &
+                                         computeType) &
+            bind(c, name='hipblasRowTrsmBatchedEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowTrsmBatchedEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: invA
+            integer(c_int), value :: invAsize
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+        end function hipblasRowTrsmBatchedEx
+    end interface
+
+    interface
+        function hipblasRowTrsmStridedBatchedEx(handle, side, uplo, transA, diag, m, n, &
+                                                alpha, A, lda, strideA, B, ldb, strideB, &
+                                                batchCount, invA, invAsize, strideInvA, &
+                                                computeType) &
+            bind(c, name='hipblasRowTrsmStridedBatchedEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowTrsmStridedBatchedEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: invA
+            integer(c_int), value :: invAsize
+            integer(c_int64_t), value :: strideInvA
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+        end function hipblasRowTrsmStridedBatchedEx
+    end interface
+
+    interface
+        function hipblasRowSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, &
+                                 ldc) &
+            bind(c, name='hipblasRowSsyrk')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSsyrk
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowSsyrk
+    end interface
+
+    interface
+        function hipblasRowDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, &
+                                 ldc) &
+            bind(c, name='hipblasRowDsyrk')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDsyrk
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowDsyrk
+    end interface
+
+    interface
+        function hipblasRowCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, &
+                                 ldc) &
+            bind(c, name='hipblasRowCsyrk')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCsyrk
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowCsyrk
+    end interface
+
+    interface
+        function hipblasRowZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, &
+                                 ldc) &
+            bind(c, name='hipblasRowZsyrk')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZsyrk
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasRowZsyrk
+    end interface
+
+    interface
+        function hipblasRowSsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, &
+                                        C, ldc, batchCount) &
+            bind(c, name='hipblasRowSsyrkBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSsyrkBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowSsyrkBatched
+    end interface
+
+    interface
+        function hipblasRowDsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, &
+                                        C, ldc, batchCount) &
+            bind(c, name='hipblasRowDsyrkBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDsyrkBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowDsyrkBatched
+    end interface
+
+    interface
+        function hipblasRowCsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, &
+                                        C, ldc, batchCount) &
+            bind(c, name='hipblasRowCsyrkBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCsyrkBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowCsyrkBatched
+    end interface
+
+    interface
+        function hipblasRowZsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, &
+                                        C, ldc, batchCount) &
+            bind(c, name='hipblasRowZsyrkBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZsyrkBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasRowZsyrkBatched
+    end interface
+
+    interface
+        function hipblasRowSsyrkStridedBatched(handle, uplo, transA, n, k, alpha, A, lda, &
+                                               strideA, beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasRowSsyrkStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowSsyrkStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowSsyrkStridedBatched
+    end interface
+
+    interface
+        function hipblasRowDsyrkStridedBatched(handle, uplo, transA, n, k, alpha, A, lda, &
+                                               strideA, beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasRowDsyrkStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowDsyrkStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowDsyrkStridedBatched
+    end interface
+
+    interface
+        function hipblasRowCsyrkStridedBatched(handle, uplo, transA, n, k, alpha, A, lda, &
+                                               strideA, beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasRowCsyrkStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowCsyrkStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowCsyrkStridedBatched
+    end interface
+
+    interface
+        function hipblasRowZsyrkStridedBatched(handle, uplo, transA, n, k, alpha, A, lda, &
+                                               strideA, beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasRowZsyrkStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasRowZsyrkStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasRowZsyrkStridedBatched
+    end interface
+
+    ! gemmt
+    interface
+        function hipblasSgemmt(handle, uplo, transA, transB, n, k, alpha, &
+                               A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasSgemmt')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmt
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasSgemmt
+    end interface
+
+    interface
+        function hipblasDgemmt(handle, uplo, transA, transB, n, k, alpha, &
+                               A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasDgemmt')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmt
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasDgemmt
+    end interface
+
+    interface
+        function hipblasCgemmt(handle, uplo, transA, transB, n, k, alpha, &
+                               A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasCgemmt')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmt
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasCgemmt
+    end interface
+
+    interface
+        function hipblasZgemmt(handle, uplo, transA, transB, n, k, alpha, &
+                               A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasZgemmt')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmt
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasZgemmt
+    end interface
+
+    interface
+        function hipblasSgemmtBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                      A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasSgemmtBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmtBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasSgemmtBatched
+    end interface
+
+    interface
+        function hipblasDgemmtBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                      A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasDgemmtBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmtBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasDgemmtBatched
+    end interface
+
+    interface
+        function hipblasCgemmtBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                      A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasCgemmtBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmtBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasCgemmtBatched
+    end interface
+
+    interface
+        function hipblasZgemmtBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                      A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasZgemmtBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmtBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasZgemmtBatched
+    end interface
+
+    interface
+        function hipblasSgemmtStridedBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                             A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasSgemmtStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmtStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasSgemmtStridedBatched
+    end interface
+
+    interface
+        function hipblasDgemmtStridedBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                             A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasDgemmtStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmtStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasDgemmtStridedBatched
+    end interface
+
+    interface
+        function hipblasCgemmtStridedBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                             A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasCgemmtStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmtStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasCgemmtStridedBatched
+    end interface
+
+    interface
+        function hipblasZgemmtStridedBatched(handle, uplo, transA, transB, n, k, alpha, &
+                                             A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasZgemmtStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmtStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasZgemmtStridedBatched
+    end interface
+
+    ! compact layout
+    interface
+        function hipblasSgepackCompact(handle, m, n, A, lda, strideA, &
+                                       Ac, ldac, batchCount) &
+            bind(c, name='hipblasSgepackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgepackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            integer(c_int), value :: batchCount
+        end function hipblasSgepackCompact
+    end interface
+
+    interface
+        function hipblasDgepackCompact(handle, m, n, A, lda, strideA, &
+                                       Ac, ldac, batchCount) &
+            bind(c, name='hipblasDgepackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgepackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            integer(c_int), value :: batchCount
+        end function hipblasDgepackCompact
+    end interface
+
+    interface
+        function hipblasCgepackCompact(handle, m, n, A, lda, strideA, &
+                                       Ac, ldac, batchCount) &
+            bind(c, name='hipblasCgepackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgepackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            integer(c_int), value :: batchCount
+        end function hipblasCgepackCompact
+    end interface
+
+    interface
+        function hipblasZgepackCompact(handle, m, n, A, lda, strideA, &
+                                       Ac, ldac, batchCount) &
+            bind(c, name='hipblasZgepackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgepackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            integer(c_int), value :: batchCount
+        end function hipblasZgepackCompact
+    end interface
+
+    interface
+        function hipblasSgeunpackCompact(handle, m, n, Ac, ldac, A, lda, &
+                                         strideA, batchCount) &
+            bind(c, name='hipblasSgeunpackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeunpackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            integer(c_int), value :: batchCount
+        end function hipblasSgeunpackCompact
+    end interface
+
+    interface
+        function hipblasDgeunpackCompact(handle, m, n, Ac, ldac, A, lda, &
+                                         strideA, batchCount) &
+            bind(c, name='hipblasDgeunpackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeunpackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            integer(c_int), value :: batchCount
+        end function hipblasDgeunpackCompact
+    end interface
+
+    interface
+        function hipblasCgeunpackCompact(handle, m, n, Ac, ldac, A, lda, &
+                                         strideA, batchCount) &
+            bind(c, name='hipblasCgeunpackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeunpackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            integer(c_int), value :: batchCount
+        end function hipblasCgeunpackCompact
+    end interface
+
+    interface
+        function hipblasZgeunpackCompact(handle, m, n, Ac, ldac, A, lda, &
+                                         strideA, batchCount) &
+            bind(c, name='hipblasZgeunpackCompact')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeunpackCompact
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: Ac
+            integer(c_int), value :: ldac
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            integer(c_int), value :: batchCount
+        end function hipblasZgeunpackCompact
+    end interface
+
+    ! per-batch scalars
+    interface
+        function hipblasSgemmBatchedVec(handle, transA, transB, m, n, k, &
+                                        alpha, A, lda, B, ldb, beta, C, &
+                                        ldc, batchCount) &
+            bind(c, name='hipblasSgemmBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasSgemmBatchedVec
+    end interface
+
+    interface
+        function hipblasDgemmBatchedVec(handle, transA, transB, m, n, k, &
+                                        alpha, A, lda, B, ldb, beta, C, &
+                                        ldc, batchCount) &
+            bind(c, name='hipblasDgemmBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasDgemmBatchedVec
+    end interface
+
+    interface
+        function hipblasCgemmBatchedVec(handle, transA, transB, m, n, k, &
+                                        alpha, A, lda, B, ldb, beta, C, &
+                                        ldc, batchCount) &
+            bind(c, name='hipblasCgemmBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasCgemmBatchedVec
+    end interface
+
+    interface
+        function hipblasZgemmBatchedVec(handle, transA, transB, m, n, k, &
+                                        alpha, A, lda, B, ldb, beta, C, &
+                                        ldc, batchCount) &
+            bind(c, name='hipblasZgemmBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+        end function hipblasZgemmBatchedVec
+    end interface
+
+    interface
+        function hipblasSgemmStridedBatchedVec(handle, transA, transB, &
+                                               m, n, k, alpha, A, lda, &
+                                               strideA, B, ldb, strideB, &
+                                               beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasSgemmStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasSgemmStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasDgemmStridedBatchedVec(handle, transA, transB, &
+                                               m, n, k, alpha, A, lda, &
+                                               strideA, B, ldb, strideB, &
+                                               beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasDgemmStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasDgemmStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasCgemmStridedBatchedVec(handle, transA, transB, &
+                                               m, n, k, alpha, A, lda, &
+                                               strideA, B, ldb, strideB, &
+                                               beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasCgemmStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasCgemmStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasZgemmStridedBatchedVec(handle, transA, transB, &
+                                               m, n, k, alpha, A, lda, &
+                                               strideA, B, ldb, strideB, &
+                                               beta, C, ldc, strideC, &
+                                               batchCount) &
+            bind(c, name='hipblasZgemmStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+        end function hipblasZgemmStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasSaxpyBatchedVec(handle, n, alpha, x, incx, y, &
+                                        incy, batchCount) &
+            bind(c, name='hipblasSaxpyBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSaxpyBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasSaxpyBatchedVec
+    end interface
+
+    interface
+        function hipblasDaxpyBatchedVec(handle, n, alpha, x, incx, y, &
+                                        incy, batchCount) &
+            bind(c, name='hipblasDaxpyBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDaxpyBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasDaxpyBatchedVec
+    end interface
+
+    interface
+        function hipblasCaxpyBatchedVec(handle, n, alpha, x, incx, y, &
+                                        incy, batchCount) &
+            bind(c, name='hipblasCaxpyBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCaxpyBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasCaxpyBatchedVec
+    end interface
+
+    interface
+        function hipblasZaxpyBatchedVec(handle, n, alpha, x, incx, y, &
+                                        incy, batchCount) &
+            bind(c, name='hipblasZaxpyBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZaxpyBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int), value :: batchCount
+        end function hipblasZaxpyBatchedVec
+    end interface
+
+    interface
+        function hipblasSaxpyStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasSaxpyStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSaxpyStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasSaxpyStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasDaxpyStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasDaxpyStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDaxpyStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasDaxpyStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasCaxpyStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasCaxpyStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCaxpyStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasCaxpyStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasZaxpyStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, y, incy, &
+                                               stridey, batchCount) &
+            bind(c, name='hipblasZaxpyStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZaxpyStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            type(c_ptr), value :: y
+            integer(c_int), value :: incy
+            integer(c_int64_t), value :: stridey
+            integer(c_int), value :: batchCount
+        end function hipblasZaxpyStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasSscalBatchedVec(handle, n, alpha, x, incx, &
+                                        batchCount) &
+            bind(c, name='hipblasSscalBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscalBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batchCount
+        end function hipblasSscalBatchedVec
+    end interface
+
+    interface
+        function hipblasDscalBatchedVec(handle, n, alpha, x, incx, &
+                                        batchCount) &
+            bind(c, name='hipblasDscalBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscalBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batchCount
+        end function hipblasDscalBatchedVec
+    end interface
+
+    interface
+        function hipblasCscalBatchedVec(handle, n, alpha, x, incx, &
+                                        batchCount) &
+            bind(c, name='hipblasCscalBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscalBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batchCount
+        end function hipblasCscalBatchedVec
+    end interface
+
+    interface
+        function hipblasZscalBatchedVec(handle, n, alpha, x, incx, &
+                                        batchCount) &
+            bind(c, name='hipblasZscalBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscalBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int), value :: batchCount
+        end function hipblasZscalBatchedVec
+    end interface
+
+    interface
+        function hipblasSscalStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, &
+                                               batchCount) &
+            bind(c, name='hipblasSscalStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSscalStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            integer(c_int), value :: batchCount
+        end function hipblasSscalStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasDscalStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, &
+                                               batchCount) &
+            bind(c, name='hipblasDscalStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDscalStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            integer(c_int), value :: batchCount
+        end function hipblasDscalStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasCscalStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, &
+                                               batchCount) &
+            bind(c, name='hipblasCscalStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCscalStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            integer(c_int), value :: batchCount
+        end function hipblasCscalStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasZscalStridedBatchedVec(handle, n, alpha, x, &
+                                               incx, stridex, &
+                                               batchCount) &
+            bind(c, name='hipblasZscalStridedBatchedVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZscalStridedBatchedVec
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stridex
+            integer(c_int), value :: batchCount
+        end function hipblasZscalStridedBatchedVec
+    end interface
+
+    interface
+        function hipblasGemmBatchedExVec(handle, transA, transB, m, n, &
+                                         k, alpha, A, aType, lda, B, &
+                                         bType, ldb, beta, C, cType, &
+                                         ldc, batchCount, computeType, &
+                                         algo) &
+            bind(c, name='hipblasGemmBatchedExVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmBatchedExVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batchCount
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmBatchedExVec
+    end interface
+
+    interface
+        function hipblasGemmStridedBatchedExVec(handle, transA, transB, &
+                                                m, n, k, alpha, A, &
+                                                aType, lda, strideA, B, &
+                                                bType, ldb, strideB, &
+                                                beta, C, cType, ldc, &
+                                                strideC, batchCount, &
+                                                computeType, algo) &
+            bind(c, name='hipblasGemmStridedBatchedExVec')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmStridedBatchedExVec
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            integer(c_int), value :: batchCount
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmStridedBatchedExVec
+    end interface
+
+    ! scaled gemm
+    interface
+        function hipblasGemmScaledEx(handle, transA, transB, m, n, k, &
+                                     alpha, A, aType, lda, B, bType, &
+                                     ldb, beta, C, cType, ldc, rowScale, &
+                                     colScale, computeType, algo) &
+            bind(c, name='hipblasGemmScaledEx')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmScaledEx
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: aType
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: bType
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: cType
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: rowScale
+            type(c_ptr), value :: colScale
+            integer(kind(HIPBLAS_R_16F)), value :: computeType
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmScaledEx
+    end interface
+
+    ! trmm
+    interface
+        function hipblasStrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasStrmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasStrmm
+    end interface
+
+    interface
+        function hipblasDtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasDtrmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasDtrmm
+    end interface
+
+    interface
+        function hipblasCtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasCtrmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasCtrmm
+    end interface
+
+    interface
+        function hipblasZtrmm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasZtrmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasZtrmm
+    end interface
+
+    ! trmmBatched
+    interface
+        function hipblasStrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasStrmmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasStrmmBatched
+    end interface
+
+    interface
+        function hipblasDtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasDtrmmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasDtrmmBatched
+    end interface
+
+    interface
+        function hipblasCtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasCtrmmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasCtrmmBatched
+    end interface
+
+    interface
+        function hipblasZtrmmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasZtrmmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasZtrmmBatched
+    end interface
+
+    ! trmmStridedBatched
+    interface
+        function hipblasStrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasStrmmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrmmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasStrmmStridedBatched
+    end interface
+
+    interface
+        function hipblasDtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasDtrmmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrmmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasDtrmmStridedBatched
+    end interface
+
+    interface
+        function hipblasCtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasCtrmmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrmmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasCtrmmStridedBatched
+    end interface
+
+    interface
+        function hipblasZtrmmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasZtrmmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrmmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasZtrmmStridedBatched
+    end interface
+
+    ! trtri
+    interface
+        function hipblasStrtri(handle, uplo, diag, n, &
+                               A, lda, invA, ldinvA) &
+            bind(c, name='hipblasStrtri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+        end function hipblasStrtri
+    end interface
+
+    interface
+        function hipblasDtrtri(handle, uplo, diag, n, &
+                               A, lda, invA, ldinvA) &
+            bind(c, name='hipblasDtrtri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+        end function hipblasDtrtri
+    end interface
+
+    interface
+        function hipblasCtrtri(handle, uplo, diag, n, &
+                               A, lda, invA, ldinvA) &
+            bind(c, name='hipblasCtrtri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+        end function hipblasCtrtri
+    end interface
+
+    interface
+        function hipblasZtrtri(handle, uplo, diag, n, &
+                               A, lda, invA, ldinvA) &
+            bind(c, name='hipblasZtrtri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtri
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+        end function hipblasZtrtri
     end interface
 
     ! trtriBatched
     interface
-        function hipblasStrtriBatched(handle, uplo, diag, n, &
-                                      A, lda, invA, ldinvA, batch_count) &
-            bind(c, name='hipblasStrtriBatched')
+        function hipblasStrtriBatched(handle, uplo, diag, n, &
+                                      A, lda, invA, ldinvA, batch_count) &
+            bind(c, name='hipblasStrtriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int), value :: batch_count
+        end function hipblasStrtriBatched
+    end interface
+
+    interface
+        function hipblasDtrtriBatched(handle, uplo, diag, n, &
+                                      A, lda, invA, ldinvA, batch_count) &
+            bind(c, name='hipblasDtrtriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int), value :: batch_count
+        end function hipblasDtrtriBatched
+    end interface
+
+    interface
+        function hipblasCtrtriBatched(handle, uplo, diag, n, &
+                                      A, lda, invA, ldinvA, batch_count) &
+            bind(c, name='hipblasCtrtriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int), value :: batch_count
+        end function hipblasCtrtriBatched
+    end interface
+
+    interface
+        function hipblasZtrtriBatched(handle, uplo, diag, n, &
+                                      A, lda, invA, ldinvA, batch_count) &
+            bind(c, name='hipblasZtrtriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtriBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int), value :: batch_count
+        end function hipblasZtrtriBatched
+    end interface
+
+    ! trtriStridedBatched
+    interface
+        function hipblasStrtriStridedBatched(handle, uplo, diag, n, &
+                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+            bind(c, name='hipblasStrtriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_invA
+            integer(c_int), value :: batch_count
+        end function hipblasStrtriStridedBatched
+    end interface
+
+    interface
+        function hipblasDtrtriStridedBatched(handle, uplo, diag, n, &
+                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+            bind(c, name='hipblasDtrtriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_invA
+            integer(c_int), value :: batch_count
+        end function hipblasDtrtriStridedBatched
+    end interface
+
+    interface
+        function hipblasCtrtriStridedBatched(handle, uplo, diag, n, &
+                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+            bind(c, name='hipblasCtrtriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_invA
+            integer(c_int), value :: batch_count
+        end function hipblasCtrtriStridedBatched
+    end interface
+
+    interface
+        function hipblasZtrtriStridedBatched(handle, uplo, diag, n, &
+                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
+            bind(c, name='hipblasZtrtriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtriStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: invA
+            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_invA
+            integer(c_int), value :: batch_count
+        end function hipblasZtrtriStridedBatched
+    end interface
+
+    ! trsm
+    interface
+        function hipblasStrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasStrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasStrsm
+    end interface
+
+    interface
+        function hipblasDtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasDtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasDtrsm
+    end interface
+
+    interface
+        function hipblasCtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasCtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasCtrsm
+    end interface
+
+    interface
+        function hipblasZtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                              A, lda, B, ldb) &
+            bind(c, name='hipblasZtrsm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasZtrsm
+    end interface
+
+    ! trsmBatched
+    interface
+        function hipblasStrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasStrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasStrsmBatched
+    end interface
+
+    interface
+        function hipblasDtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasDtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasDtrsmBatched
+    end interface
+
+    interface
+        function hipblasCtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasCtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasCtrsmBatched
+    end interface
+
+    interface
+        function hipblasZtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                     A, lda, B, ldb, batch_count) &
+            bind(c, name='hipblasZtrsmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int), value :: batch_count
+        end function hipblasZtrsmBatched
+    end interface
+
+    ! trsmStridedBatched
+    interface
+        function hipblasStrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasStrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasStrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasDtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasDtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasDtrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasCtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasCtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasCtrsmStridedBatched
+    end interface
+
+    interface
+        function hipblasZtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
+            bind(c, name='hipblasZtrsmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            integer(c_int), value :: batch_count
+        end function hipblasZtrsmStridedBatched
+    end interface
+
+    ! gemm
+    interface
+        function hipblasHgemm(handle, transA, transB, m, n, k, alpha, &
+                              A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasHgemm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasHgemm
+    end interface
+
+    interface
+        function hipblasSgemm(handle, transA, transB, m, n, k, alpha, &
+                              A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasSgemm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasSgemm
+    end interface
+
+    interface
+        function hipblasDgemm(handle, transA, transB, m, n, k, alpha, &
+                              A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasDgemm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasDgemm
+    end interface
+
+    interface
+        function hipblasCgemm(handle, transA, transB, m, n, k, alpha, &
+                              A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasCgemm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasCgemm
+    end interface
+
+    interface
+        function hipblasZgemm(handle, transA, transB, m, n, k, alpha, &
+                              A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasZgemm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasZgemm
+    end interface
+
+    ! gemmBatched
+    interface
+        function hipblasHgemmBatched(handle, transA, transB, m, n, k, alpha, &
+                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasHgemmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasHgemmBatched
+    end interface
+
+    interface
+        function hipblasSgemmBatched(handle, transA, transB, m, n, k, alpha, &
+                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasSgemmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasSgemmBatched
+    end interface
+
+    interface
+        function hipblasDgemmBatched(handle, transA, transB, m, n, k, alpha, &
+                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasDgemmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasDgemmBatched
+    end interface
+
+    interface
+        function hipblasCgemmBatched(handle, transA, transB, m, n, k, alpha, &
+                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasCgemmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasCgemmBatched
+    end interface
+
+    interface
+        function hipblasZgemmBatched(handle, transA, transB, m, n, k, alpha, &
+                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
+            bind(c, name='hipblasZgemmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int), value :: batch_count
+        end function hipblasZgemmBatched
+    end interface
+
+    ! gemmStridedBatched
+    interface
+        function hipblasHgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasHgemmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasHgemmStridedBatched
+    end interface
+
+    interface
+        function hipblasSgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasSgemmStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasSgemmStridedBatched
+    end interface
+
+    interface
+        function hipblasDgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasDgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function hipblasStrtriBatched
+        end function hipblasDgemmStridedBatched
     end interface
 
     interface
-        function hipblasDtrtriBatched(handle, uplo, diag, n, &
-                                      A, lda, invA, ldinvA, batch_count) &
-            bind(c, name='hipblasDtrtriBatched')
+        function hipblasCgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasCgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function hipblasDtrtriBatched
+        end function hipblasCgemmStridedBatched
     end interface
 
     interface
-        function hipblasCtrtriBatched(handle, uplo, diag, n, &
-                                      A, lda, invA, ldinvA, batch_count) &
-            bind(c, name='hipblasCtrtriBatched')
+        function hipblasZgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
+                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasZgemmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function hipblasCtrtriBatched
+        end function hipblasZgemmStridedBatched
     end interface
 
+    ! dgmm
     interface
-        function hipblasZtrtriBatched(handle, uplo, diag, n, &
-                                      A, lda, invA, ldinvA, batch_count) &
-            bind(c, name='hipblasZtrtriBatched')
+        function hipblasSdgmm(handle, side, m, n, &
+                              A, lda, x, incx, C, ldc) &
+            bind(c, name='hipblasSdgmm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmm
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasSdgmm
+    end interface
+
+    interface
+        function hipblasDdgmm(handle, side, m, n, &
+                              A, lda, x, incx, C, ldc) &
+            bind(c, name='hipblasDdgmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasDdgmm
+    end interface
+
+    interface
+        function hipblasCdgmm(handle, side, m, n, &
+                              A, lda, x, incx, C, ldc) &
+            bind(c, name='hipblasCdgmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasCdgmm
+    end interface
+
+    interface
+        function hipblasZdgmm(handle, side, m, n, &
+                              A, lda, x, incx, C, ldc) &
+            bind(c, name='hipblasZdgmm')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmm
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasZdgmm
+    end interface
+
+    ! dgmmBatched
+    interface
+        function hipblasSdgmmBatched(handle, side, m, n, &
+                                     A, lda, x, incx, C, ldc, batch_count) &
+            bind(c, name='hipblasSdgmmBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmmBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasZtrtriBatched
+        end function hipblasSdgmmBatched
     end interface
 
-    ! trtriStridedBatched
     interface
-        function hipblasStrtriStridedBatched(handle, uplo, diag, n, &
-                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
-            bind(c, name='hipblasStrtriStridedBatched')
+        function hipblasDdgmmBatched(handle, side, m, n, &
+                                     A, lda, x, incx, C, ldc, batch_count) &
+            bind(c, name='hipblasDdgmmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrtriStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-            integer(c_int64_t), value :: stride_invA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasStrtriStridedBatched
+        end function hipblasDdgmmBatched
     end interface
 
     interface
-        function hipblasDtrtriStridedBatched(handle, uplo, diag, n, &
-                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
-            bind(c, name='hipblasDtrtriStridedBatched')
+        function hipblasCdgmmBatched(handle, side, m, n, &
+                                     A, lda, x, incx, C, ldc, batch_count) &
+            bind(c, name='hipblasCdgmmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrtriStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-            integer(c_int64_t), value :: stride_invA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasDtrtriStridedBatched
+        end function hipblasCdgmmBatched
     end interface
 
     interface
-        function hipblasCtrtriStridedBatched(handle, uplo, diag, n, &
-                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
-            bind(c, name='hipblasCtrtriStridedBatched')
+        function hipblasZdgmmBatched(handle, side, m, n, &
+                                     A, lda, x, incx, C, ldc, batch_count) &
+            bind(c, name='hipblasZdgmmBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrtriStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmmBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-            integer(c_int64_t), value :: stride_invA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasCtrtriStridedBatched
+        end function hipblasZdgmmBatched
     end interface
 
+    ! dgmmStridedBatched
     interface
-        function hipblasZtrtriStridedBatched(handle, uplo, diag, n, &
-                                             A, lda, stride_A, invA, ldinvA, stride_invA, batch_count) &
-            bind(c, name='hipblasZtrtriStridedBatched')
+        function hipblasSdgmmStridedBatched(handle, side, m, n, &
+                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasSdgmmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrtriStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmmStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: invA
-            integer(c_int), value :: ldinvA
-            integer(c_int64_t), value :: stride_invA
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function hipblasZtrtriStridedBatched
+        end function hipblasSdgmmStridedBatched
     end interface
 
-    ! trsm
     interface
-        function hipblasStrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasStrsm')
+        function hipblasDdgmmStridedBatched(handle, side, m, n, &
+                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasDdgmmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmmStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-        end function hipblasStrsm
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasDdgmmStridedBatched
     end interface
 
     interface
-        function hipblasDtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasDtrsm')
+        function hipblasCdgmmStridedBatched(handle, side, m, n, &
+                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasCdgmmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmmStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-        end function hipblasDtrsm
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasCdgmmStridedBatched
     end interface
 
     interface
-        function hipblasCtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasCtrsm')
+        function hipblasZdgmmStridedBatched(handle, side, m, n, &
+                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasZdgmmStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmmStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-        end function hipblasCtrsm
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: x
+            integer(c_int), value :: incx
+            integer(c_int64_t), value :: stride_x
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasZdgmmStridedBatched
     end interface
 
+    ! geam
     interface
-        function hipblasZtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
-                              A, lda, B, ldb) &
-            bind(c, name='hipblasZtrsm')
+        function hipblasSgeam(handle, transA, transB, m, n, alpha, &
+                              A, lda, beta, B, ldb, C, ldc) &
+            bind(c, name='hipblasSgeam')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeam
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-        end function hipblasZtrsm
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasSgeam
     end interface
 
-    ! trsmBatched
     interface
-        function hipblasStrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasStrsmBatched')
+        function hipblasDgeam(handle, transA, transB, m, n, alpha, &
+                              A, lda, beta, B, ldb, C, ldc) &
+            bind(c, name='hipblasDgeam')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeam
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasStrsmBatched
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasDgeam
     end interface
 
     interface
-        function hipblasDtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasDtrsmBatched')
+        function hipblasCgeam(handle, transA, transB, m, n, alpha, &
+                              A, lda, beta, B, ldb, C, ldc) &
+            bind(c, name='hipblasCgeam')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeam
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasDtrsmBatched
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasCgeam
     end interface
 
     interface
-        function hipblasCtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasCtrsmBatched')
+        function hipblasZgeam(handle, transA, transB, m, n, alpha, &
+                              A, lda, beta, B, ldb, C, ldc) &
+            bind(c, name='hipblasZgeam')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeam
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int), value :: batch_count
-        end function hipblasCtrsmBatched
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+        end function hipblasZgeam
     end interface
 
+    ! geamBatched
     interface
-        function hipblasZtrsmBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                     A, lda, B, ldb, batch_count) &
-            bind(c, name='hipblasZtrsmBatched')
+        function hipblasSgeamBatched(handle, transA, transB, m, n, alpha, &
+                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
+            bind(c, name='hipblasSgeamBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeamBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasZtrsmBatched
+        end function hipblasSgeamBatched
     end interface
 
-    ! trsmStridedBatched
     interface
-        function hipblasStrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasStrsmStridedBatched')
+        function hipblasDgeamBatched(handle, transA, transB, m, n, alpha, &
+                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
+            bind(c, name='hipblasDgeamBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeamBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasStrsmStridedBatched
+        end function hipblasDgeamBatched
     end interface
 
     interface
-        function hipblasDtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasDtrsmStridedBatched')
+        function hipblasCgeamBatched(handle, transA, transB, m, n, alpha, &
+                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
+            bind(c, name='hipblasCgeamBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeamBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasDtrsmStridedBatched
+        end function hipblasCgeamBatched
     end interface
 
     interface
-        function hipblasCtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasCtrsmStridedBatched')
+        function hipblasZgeamBatched(handle, transA, transB, m, n, alpha, &
+                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
+            bind(c, name='hipblasZgeamBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeamBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
             integer(c_int), value :: batch_count
-        end function hipblasCtrsmStridedBatched
+        end function hipblasZgeamBatched
     end interface
 
+    ! geamStridedBatched
     interface
-        function hipblasZtrsmStridedBatched(handle, side, uplo, transA, diag, m, n, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, batch_count) &
-            bind(c, name='hipblasZtrsmStridedBatched')
+        function hipblasSgeamStridedBatched(handle, transA, transB, m, n, alpha, &
+                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasSgeamStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeamStridedBatched
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
+            integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
             integer(c_int64_t), value :: stride_B
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_C
             integer(c_int), value :: batch_count
-        end function hipblasZtrsmStridedBatched
+        end function hipblasSgeamStridedBatched
     end interface
 
-    ! gemm
     interface
-        function hipblasHgemm(handle, transA, transB, m, n, k, alpha, &
-                              A, lda, B, ldb, beta, C, ldc) &
-            bind(c, name='hipblasHgemm')
+        function hipblasDgeamStridedBatched(handle, transA, transB, m, n, alpha, &
+                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasDgeamStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeamStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasHgemm
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasDgeamStridedBatched
     end interface
 
     interface
-        function hipblasSgemm(handle, transA, transB, m, n, k, alpha, &
-                              A, lda, B, ldb, beta, C, ldc) &
-            bind(c, name='hipblasSgemm')
+        function hipblasCgeamStridedBatched(handle, transA, transB, m, n, alpha, &
+                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasCgeamStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeamStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasSgemm
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasCgeamStridedBatched
     end interface
 
     interface
-        function hipblasDgemm(handle, transA, transB, m, n, k, alpha, &
-                              A, lda, B, ldb, beta, C, ldc) &
-            bind(c, name='hipblasDgemm')
+        function hipblasZgeamStridedBatched(handle, transA, transB, m, n, alpha, &
+                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
+            bind(c, name='hipblasZgeamStridedBatched')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeamStridedBatched
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_A
+            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
+            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasDgemm
+            integer(c_int64_t), value :: stride_C
+            integer(c_int), value :: batch_count
+        end function hipblasZgeamStridedBatched
     end interface
 
+    !-----------------!
+    ! blas Extensions !
+    !-----------------!
+
+    ! gemmEx
     interface
-        function hipblasCgemm(handle, transA, transB, m, n, k, alpha, &
-                              A, lda, B, ldb, beta, C, ldc) &
-            bind(c, name='hipblasCgemm')
+        function hipblasGemmEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+                               b, b_type, ldb, beta, c, c_type, ldc, &
+                               compute_type, algo, solution_index, flags) &
+            bind(c, name='hipblasGemmEx')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11102,24 +15373,34 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
-        end function hipblasCgemm
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            ! No unsigned types in fortran. If larger values are needed
+            ! we will need a workaround.
+            integer(c_int32_t), value :: flags
+        end function hipblasGemmEx
     end interface
 
     interface
-        function hipblasZgemm(handle, transA, transB, m, n, k, alpha, &
-                              A, lda, B, ldb, beta, C, ldc) &
-            bind(c, name='hipblasZgemm')
+        function hipblasGemmBatchedEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+                                      b, b_type, ldb, beta, c, c_type, ldc, &
+                                      batch_count, compute_type, algo, solution_index, flags) &
+            bind(c, name='hipblasGemmBatchedEx')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmBatchedEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11127,25 +15408,35 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
-        end function hipblasZgemm
+            integer(c_int), value :: batch_count
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            ! No unsigned types in fortran. If larger values are needed
+            ! we will need a workaround.
+            integer(c_int32_t), value :: flags
+        end function hipblasGemmBatchedEx
     end interface
 
-    ! gemmBatched
     interface
-        function hipblasHgemmBatched(handle, transA, transB, m, n, k, alpha, &
-                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
-            bind(c, name='hipblasHgemmBatched')
+        function hipblasGemmStridedBatchedEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
+                                             b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, &
+                                             batch_count, compute_type, algo, solution_index, flags) &
+            bind(c, name='hipblasGemmStridedBatchedEx')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmStridedBatchedEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11153,25 +15444,38 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            integer(c_int64_t), value :: stride_a
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_b
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_c
             integer(c_int), value :: batch_count
-        end function hipblasHgemmBatched
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            ! No unsigned types in fortran. If larger values are needed
+            ! we will need a workaround.
+            integer(c_int32_t), value :: flags
+        end function hipblasGemmStridedBatchedEx
     end interface
 
+    ! gemmExD
     interface
-        function hipblasSgemmBatched(handle, transA, transB, m, n, k, alpha, &
-                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
-            bind(c, name='hipblasSgemmBatched')
+        function hipblasGemmExD(handle, transA, transB, m, n, k, alpha, a, a_type, lda, b, b_type, ldb, beta, &
+                                c, c_type, ldc, d, d_type, ldd, compute_type, algo) &
+            bind(c, name='hipblasGemmExD')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmExD
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11179,25 +15483,32 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasSgemmBatched
+            type(c_ptr), value :: d
+            integer(kind(HIPBLAS_R_16F)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmExD
     end interface
 
     interface
-        function hipblasDgemmBatched(handle, transA, transB, m, n, k, alpha, &
-                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
-            bind(c, name='hipblasDgemmBatched')
+        function hipblasGemmBatchedExD(handle, transA, transB, m, n, k, alpha, a, a_type, lda, b, b_type, ldb, beta, &
+                                       c, c_type, ldc, d, d_type, ldd, batch_count, compute_type, algo) &
+            bind(c, name='hipblasGemmBatchedExD')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmBatchedExD
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11205,25 +15516,34 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
+            type(c_ptr), value :: d
+            integer(kind(HIPBLAS_R_16F)), value :: d_type
+            integer(c_int), value :: ldd
             integer(c_int), value :: batch_count
-        end function hipblasDgemmBatched
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmBatchedExD
     end interface
 
     interface
-        function hipblasCgemmBatched(handle, transA, transB, m, n, k, alpha, &
-                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
-            bind(c, name='hipblasCgemmBatched')
+        function hipblasGemmStridedBatchedExD(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, b, b_type, &
+                                              ldb, stride_b, beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
+                                              batch_count, compute_type, algo) &
+            bind(c, name='hipblasGemmStridedBatchedExD')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmStridedBatchedExD
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11231,81 +15551,108 @@ module hipblas
             integer(c_int), value :: n
             integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            type(c_ptr), value :: a
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            integer(c_int64_t), value :: stride_a
+            type(c_ptr), value :: b
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_b
             type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            type(c_ptr), value :: c
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_c
+            type(c_ptr), value :: d
+            integer(kind(HIPBLAS_R_16F)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(c_int64_t), value :: stride_d
             integer(c_int), value :: batch_count
-        end function hipblasCgemmBatched
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+        end function hipblasGemmStridedBatchedExD
     end interface
 
+    ! matmulPlan
     interface
-        function hipblasZgemmBatched(handle, transA, transB, m, n, k, alpha, &
-                                     A, lda, B, ldb, beta, C, ldc, batch_count) &
-            bind(c, name='hipblasZgemmBatched')
+        function hipblasMatmulPlanCreate(handle, plan, transA, transB, m, n, k, &
+                                         a_type, lda, b_type, ldb, c_type, ldc, &
+                                         compute_type, algo, epilogue) &
+            bind(c, name='hipblasMatmulPlanCreate')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasMatmulPlanCreate
             type(c_ptr), value :: handle
+            type(c_ptr), value :: plan
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
             integer(c_int), value :: k
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
+            integer(kind(HIPBLAS_R_16F)), value :: a_type
             integer(c_int), value :: lda
-            type(c_ptr), value :: B
+            integer(kind(HIPBLAS_R_16F)), value :: b_type
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
+            integer(kind(HIPBLAS_R_16F)), value :: c_type
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasZgemmBatched
+            integer(kind(HIPBLAS_R_16F)), value :: compute_type
+            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
+            integer(kind(HIPBLAS_MATMUL_EPILOGUE_DEFAULT)), value :: epilogue
+        end function hipblasMatmulPlanCreate
+    end interface
+
+    interface
+        function hipblasMatmulPlanExecute(handle, plan, alpha, a, b, beta, c, bias) &
+            bind(c, name='hipblasMatmulPlanExecute')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasMatmulPlanExecute
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: plan
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            type(c_ptr), value :: b
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            type(c_ptr), value :: bias
+        end function hipblasMatmulPlanExecute
+    end interface
+
+    interface
+        function hipblasMatmulPlanGetWorkspaceSize(plan, size) &
+            bind(c, name='hipblasMatmulPlanGetWorkspaceSize')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasMatmulPlanGetWorkspaceSize
+            type(c_ptr), value :: plan
+            type(c_ptr), value :: size
+        end function hipblasMatmulPlanGetWorkspaceSize
     end interface
 
-    ! gemmStridedBatched
     interface
-        function hipblasHgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasHgemmStridedBatched')
+        function hipblasMatmulPlanDestroy(plan) &
+            bind(c, name='hipblasMatmulPlanDestroy')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasHgemmStridedBatched
-            type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasHgemmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasMatmulPlanDestroy
+            type(c_ptr), value :: plan
+        end function hipblasMatmulPlanDestroy
     end interface
 
+    ! gemmOutOfCore
     interface
-        function hipblasSgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasSgemmStridedBatched')
+        function hipblasSgemmOutOfCore(handle, transA, transB, m, n, k, alpha, &
+                                       A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasSgemmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgemmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11315,26 +15662,22 @@ module hipblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasSgemmStridedBatched
+        end function hipblasSgemmOutOfCore
     end interface
 
     interface
-        function hipblasDgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasDgemmStridedBatched')
+        function hipblasDgemmOutOfCore(handle, transA, transB, m, n, k, alpha, &
+                                       A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasDgemmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgemmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11344,26 +15687,22 @@ module hipblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasDgemmStridedBatched
+        end function hipblasDgemmOutOfCore
     end interface
 
     interface
-        function hipblasCgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasCgemmStridedBatched')
+        function hipblasCgemmOutOfCore(handle, transA, transB, m, n, k, alpha, &
+                                       A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasCgemmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgemmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11373,26 +15712,22 @@ module hipblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasCgemmStridedBatched
+        end function hipblasCgemmOutOfCore
     end interface
 
     interface
-        function hipblasZgemmStridedBatched(handle, transA, transB, m, n, k, alpha, &
-                                            A, lda, stride_A, B, ldb, stride_B, beta, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasZgemmStridedBatched')
+        function hipblasZgemmOutOfCore(handle, transA, transB, m, n, k, alpha, &
+                                       A, lda, B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasZgemmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgemmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
@@ -11402,717 +15737,562 @@ module hipblas
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasZgemmStridedBatched
+        end function hipblasZgemmOutOfCore
     end interface
 
-    ! dgmm
+    ! syrkOutOfCore
     interface
-        function hipblasSdgmm(handle, side, m, n, &
-                              A, lda, x, incx, C, ldc) &
-            bind(c, name='hipblasSdgmm')
+        function hipblasSsyrkOutOfCore(handle, uplo, transA, n, k, alpha, A, &
+                                       lda, beta, C, ldc) &
+            bind(c, name='hipblasSsyrkOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSsyrkOutOfCore
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasSdgmm
+        end function hipblasSsyrkOutOfCore
     end interface
 
     interface
-        function hipblasDdgmm(handle, side, m, n, &
-                              A, lda, x, incx, C, ldc) &
-            bind(c, name='hipblasDdgmm')
+        function hipblasDsyrkOutOfCore(handle, uplo, transA, n, k, alpha, A, &
+                                       lda, beta, C, ldc) &
+            bind(c, name='hipblasDsyrkOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDsyrkOutOfCore
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasDdgmm
+        end function hipblasDsyrkOutOfCore
     end interface
 
     interface
-        function hipblasCdgmm(handle, side, m, n, &
-                              A, lda, x, incx, C, ldc) &
-            bind(c, name='hipblasCdgmm')
+        function hipblasCsyrkOutOfCore(handle, uplo, transA, n, k, alpha, A, &
+                                       lda, beta, C, ldc) &
+            bind(c, name='hipblasCsyrkOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCsyrkOutOfCore
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasCdgmm
+        end function hipblasCsyrkOutOfCore
     end interface
 
     interface
-        function hipblasZdgmm(handle, side, m, n, &
-                              A, lda, x, incx, C, ldc) &
-            bind(c, name='hipblasZdgmm')
+        function hipblasZsyrkOutOfCore(handle, uplo, transA, n, k, alpha, A, &
+                                       lda, beta, C, ldc) &
+            bind(c, name='hipblasZsyrkOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmm
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZsyrkOutOfCore
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasZdgmm
+        end function hipblasZsyrkOutOfCore
     end interface
 
-    ! dgmmBatched
+    ! trsmOutOfCore
     interface
-        function hipblasSdgmmBatched(handle, side, m, n, &
-                                     A, lda, x, incx, C, ldc, batch_count) &
-            bind(c, name='hipblasSdgmmBatched')
+        function hipblasStrsmOutOfCore(handle, side, uplo, transA, diag, m, n, &
+                                       alpha, A, lda, B, ldb) &
+            bind(c, name='hipblasStrsmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStrsmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasSdgmmBatched
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasStrsmOutOfCore
     end interface
 
     interface
-        function hipblasDdgmmBatched(handle, side, m, n, &
-                                     A, lda, x, incx, C, ldc, batch_count) &
-            bind(c, name='hipblasDdgmmBatched')
+        function hipblasDtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, &
+                                       alpha, A, lda, B, ldb) &
+            bind(c, name='hipblasDtrsmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDtrsmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasDdgmmBatched
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasDtrsmOutOfCore
     end interface
 
     interface
-        function hipblasCdgmmBatched(handle, side, m, n, &
-                                     A, lda, x, incx, C, ldc, batch_count) &
-            bind(c, name='hipblasCdgmmBatched')
+        function hipblasCtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, &
+                                       alpha, A, lda, B, ldb) &
+            bind(c, name='hipblasCtrsmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCtrsmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasCdgmmBatched
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasCtrsmOutOfCore
     end interface
 
     interface
-        function hipblasZdgmmBatched(handle, side, m, n, &
-                                     A, lda, x, incx, C, ldc, batch_count) &
-            bind(c, name='hipblasZdgmmBatched')
+        function hipblasZtrsmOutOfCore(handle, side, uplo, transA, diag, m, n, &
+                                       alpha, A, lda, B, ldb) &
+            bind(c, name='hipblasZtrsmOutOfCore')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmmBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZtrsmOutOfCore
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(kind(HIPBLAS_OP_N)), value :: transA
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
+            type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasZdgmmBatched
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+        end function hipblasZtrsmOutOfCore
     end interface
 
-    ! dgmmStridedBatched
+    ! hipblasXt
     interface
-        function hipblasSdgmmStridedBatched(handle, side, m, n, &
-                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasSdgmmStridedBatched')
+        function hipblasXtCreate(handle) &
+            bind(c, name='hipblasXtCreate')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSdgmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtCreate
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasSdgmmStridedBatched
+        end function hipblasXtCreate
     end interface
 
     interface
-        function hipblasDdgmmStridedBatched(handle, side, m, n, &
-                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasDdgmmStridedBatched')
+        function hipblasXtDestroy(handle) &
+            bind(c, name='hipblasXtDestroy')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDdgmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtDestroy
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasDdgmmStridedBatched
+        end function hipblasXtDestroy
     end interface
 
     interface
-        function hipblasCdgmmStridedBatched(handle, side, m, n, &
-                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasCdgmmStridedBatched')
+        function hipblasXtDeviceSelect(handle, nbDevices, deviceId) &
+            bind(c, name='hipblasXtDeviceSelect')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCdgmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtDeviceSelect
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasCdgmmStridedBatched
+            integer(c_int), value :: nbDevices
+            type(c_ptr), value :: deviceId
+        end function hipblasXtDeviceSelect
     end interface
 
     interface
-        function hipblasZdgmmStridedBatched(handle, side, m, n, &
-                                            A, lda, stride_A, x, incx, stride_x, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasZdgmmStridedBatched')
+        function hipblasXtSetBlockDim(handle, blockDim) &
+            bind(c, name='hipblasXtSetBlockDim')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZdgmmStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtSetBlockDim
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: x
-            integer(c_int), value :: incx
-            integer(c_int64_t), value :: stride_x
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasZdgmmStridedBatched
+            integer(c_int), value :: blockDim
+        end function hipblasXtSetBlockDim
     end interface
 
-    ! geam
     interface
-        function hipblasSgeam(handle, transA, transB, m, n, alpha, &
-                              A, lda, beta, B, ldb, C, ldc) &
-            bind(c, name='hipblasSgeam')
+        function hipblasXtGetBlockDim(handle, blockDim) &
+            bind(c, name='hipblasXtGetBlockDim')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeam
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtGetBlockDim
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function hipblasSgeam
+            type(c_ptr), value :: blockDim
+        end function hipblasXtGetBlockDim
     end interface
 
     interface
-        function hipblasDgeam(handle, transA, transB, m, n, alpha, &
-                              A, lda, beta, B, ldb, C, ldc) &
-            bind(c, name='hipblasDgeam')
+        function hipblasXtSetCpuRatio(handle, blasOp, opType, ratio) &
+            bind(c, name='hipblasXtSetCpuRatio')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeam
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtSetCpuRatio
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function hipblasDgeam
+            integer(kind(HIPBLAS_XT_GEMM)), value :: blasOp
+            integer(kind(HIPBLAS_XT_FLOAT)), value :: opType
+            real(c_float), value :: ratio
+        end function hipblasXtSetCpuRatio
     end interface
 
     interface
-        function hipblasCgeam(handle, transA, transB, m, n, alpha, &
-                              A, lda, beta, B, ldb, C, ldc) &
-            bind(c, name='hipblasCgeam')
+        function hipblasXtSetCpuRoutine(handle, blasOp, opType, blasFunctor) &
+            bind(c, name='hipblasXtSetCpuRoutine')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeam
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtSetCpuRoutine
             type(c_ptr), value :: handle
-            integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            type(c_ptr), value :: alpha
-            type(c_ptr), value :: A
-            integer(c_int), value :: lda
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-        end function hipblasCgeam
+            integer(kind(HIPBLAS_XT_GEMM)), value :: blasOp
+            integer(kind(HIPBLAS_XT_FLOAT)), value :: opType
+            type(c_funptr), value :: blasFunctor
+        end function hipblasXtSetCpuRoutine
     end interface
 
     interface
-        function hipblasZgeam(handle, transA, transB, m, n, alpha, &
-                              A, lda, beta, B, ldb, C, ldc) &
-            bind(c, name='hipblasZgeam')
+        function hipblasXtSgemm(handle, transA, transB, m, n, k, alpha, A, lda, &
+                                B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasXtSgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeam
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtSgemm
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-        end function hipblasZgeam
+        end function hipblasXtSgemm
     end interface
 
-    ! geamBatched
     interface
-        function hipblasSgeamBatched(handle, transA, transB, m, n, alpha, &
-                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
-            bind(c, name='hipblasSgeamBatched')
+        function hipblasXtDgemm(handle, transA, transB, m, n, k, alpha, A, lda, &
+                                B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasXtDgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeamBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtDgemm
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasSgeamBatched
+        end function hipblasXtDgemm
     end interface
 
     interface
-        function hipblasDgeamBatched(handle, transA, transB, m, n, alpha, &
-                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
-            bind(c, name='hipblasDgeamBatched')
+        function hipblasXtCgemm(handle, transA, transB, m, n, k, alpha, A, lda, &
+                                B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasXtCgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeamBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtCgemm
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasDgeamBatched
+        end function hipblasXtCgemm
     end interface
 
     interface
-        function hipblasCgeamBatched(handle, transA, transB, m, n, alpha, &
-                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
-            bind(c, name='hipblasCgeamBatched')
+        function hipblasXtZgemm(handle, transA, transB, m, n, k, alpha, A, lda, &
+                                B, ldb, beta, C, ldc) &
+            bind(c, name='hipblasXtZgemm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeamBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtZgemm
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_OP_N)), value :: transB
             integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasCgeamBatched
+        end function hipblasXtZgemm
     end interface
 
     interface
-        function hipblasZgeamBatched(handle, transA, transB, m, n, alpha, &
-                                     A, lda, beta, B, ldb, C, ldc, batch_count) &
-            bind(c, name='hipblasZgeamBatched')
+        function hipblasXtSsyrk(handle, uplo, transA, n, k, alpha, A, lda, &
+                                beta, C, ldc) &
+            bind(c, name='hipblasXtSsyrk')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeamBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtSsyrk
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
             type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-        end function hipblasZgeamBatched
+        end function hipblasXtSsyrk
     end interface
 
-    ! geamStridedBatched
     interface
-        function hipblasSgeamStridedBatched(handle, transA, transB, m, n, alpha, &
-                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasSgeamStridedBatched')
+        function hipblasXtDsyrk(handle, uplo, transA, n, k, alpha, A, lda, &
+                                beta, C, ldc) &
+            bind(c, name='hipblasXtDsyrk')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgeamStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtDsyrk
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasSgeamStridedBatched
+        end function hipblasXtDsyrk
     end interface
 
     interface
-        function hipblasDgeamStridedBatched(handle, transA, transB, m, n, alpha, &
-                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasDgeamStridedBatched')
+        function hipblasXtCsyrk(handle, uplo, transA, n, k, alpha, A, lda, &
+                                beta, C, ldc) &
+            bind(c, name='hipblasXtCsyrk')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgeamStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtCsyrk
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasDgeamStridedBatched
+        end function hipblasXtCsyrk
     end interface
 
     interface
-        function hipblasCgeamStridedBatched(handle, transA, transB, m, n, alpha, &
-                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasCgeamStridedBatched')
+        function hipblasXtZsyrk(handle, uplo, transA, n, k, alpha, A, lda, &
+                                beta, C, ldc) &
+            bind(c, name='hipblasXtZsyrk')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgeamStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtZsyrk
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
-            integer(c_int), value :: m
             integer(c_int), value :: n
+            integer(c_int), value :: k
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
             type(c_ptr), value :: beta
-            type(c_ptr), value :: B
-            integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasCgeamStridedBatched
+        end function hipblasXtZsyrk
     end interface
 
     interface
-        function hipblasZgeamStridedBatched(handle, transA, transB, m, n, alpha, &
-                                            A, lda, stride_A, beta, B, ldb, stride_B, C, ldc, stride_C, batch_count) &
-            bind(c, name='hipblasZgeamStridedBatched')
+        function hipblasXtStrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                                A, lda, B, ldb) &
+            bind(c, name='hipblasXtStrsm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgeamStridedBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtStrsm
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
             type(c_ptr), value :: alpha
             type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_A
-            type(c_ptr), value :: beta
             type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_B
-            type(c_ptr), value :: C
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_C
-            integer(c_int), value :: batch_count
-        end function hipblasZgeamStridedBatched
+        end function hipblasXtStrsm
     end interface
 
-    !-----------------!
-    ! blas Extensions !
-    !-----------------!
-
-    ! gemmEx
     interface
-        function hipblasGemmEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-                               b, b_type, ldb, beta, c, c_type, ldc, &
-                               compute_type, algo, solution_index, flags) &
-            bind(c, name='hipblasGemmEx')
+        function hipblasXtDtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                                A, lda, B, ldb) &
+            bind(c, name='hipblasXtDtrsm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmEx
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtDtrsm
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: a
-            integer(kind(HIPBLAS_R_16F)), value :: a_type
+            type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: b
-            integer(kind(HIPBLAS_R_16F)), value :: b_type
+            type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: c
-            integer(kind(HIPBLAS_R_16F)), value :: c_type
-            integer(c_int), value :: ldc
-            integer(kind(HIPBLAS_R_16F)), value :: compute_type
-            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
-            integer(c_int32_t), value :: solution_index
-            ! No unsigned types in fortran. If larger values are needed
-            ! we will need a workaround.
-            integer(c_int32_t), value :: flags
-        end function hipblasGemmEx
+        end function hipblasXtDtrsm
     end interface
 
     interface
-        function hipblasGemmBatchedEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
-                                      b, b_type, ldb, beta, c, c_type, ldc, &
-                                      batch_count, compute_type, algo, solution_index, flags) &
-            bind(c, name='hipblasGemmBatchedEx')
+        function hipblasXtCtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                                A, lda, B, ldb) &
+            bind(c, name='hipblasXtCtrsm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmBatchedEx
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtCtrsm
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: a
-            integer(kind(HIPBLAS_R_16F)), value :: a_type
+            type(c_ptr), value :: A
             integer(c_int), value :: lda
-            type(c_ptr), value :: b
-            integer(kind(HIPBLAS_R_16F)), value :: b_type
+            type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: c
-            integer(kind(HIPBLAS_R_16F)), value :: c_type
-            integer(c_int), value :: ldc
-            integer(c_int), value :: batch_count
-            integer(kind(HIPBLAS_R_16F)), value :: compute_type
-            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
-            integer(c_int32_t), value :: solution_index
-            ! No unsigned types in fortran. If larger values are needed
-            ! we will need a workaround.
-            integer(c_int32_t), value :: flags
-        end function hipblasGemmBatchedEx
+        end function hipblasXtCtrsm
     end interface
 
     interface
-        function hipblasGemmStridedBatchedEx(handle, transA, transB, m, n, k, alpha, a, a_type, lda, stride_a, &
-                                             b, b_type, ldb, stride_b, beta, c, c_type, ldc, stride_c, &
-                                             batch_count, compute_type, algo, solution_index, flags) &
-            bind(c, name='hipblasGemmStridedBatchedEx')
+        function hipblasXtZtrsm(handle, side, uplo, transA, diag, m, n, alpha, &
+                                A, lda, B, ldb) &
+            bind(c, name='hipblasXtZtrsm')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGemmStridedBatchedEx
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasXtZtrsm
             type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
-            integer(kind(HIPBLAS_OP_N)), value :: transB
+            integer(kind(HIPBLAS_DIAG_NON_UNIT)), value :: diag
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), value :: alpha
-            type(c_ptr), value :: a
-            integer(kind(HIPBLAS_R_16F)), value :: a_type
+            type(c_ptr), value :: A
             integer(c_int), value :: lda
-            integer(c_int64_t), value :: stride_a
-            type(c_ptr), value :: b
-            integer(kind(HIPBLAS_R_16F)), value :: b_type
+            type(c_ptr), value :: B
             integer(c_int), value :: ldb
-            integer(c_int64_t), value :: stride_b
-            type(c_ptr), value :: beta
-            type(c_ptr), value :: c
-            integer(kind(HIPBLAS_R_16F)), value :: c_type
-            integer(c_int), value :: ldc
-            integer(c_int64_t), value :: stride_c
-            integer(c_int), value :: batch_count
-            integer(kind(HIPBLAS_R_16F)), value :: compute_type
-            integer(kind(HIPBLAS_GEMM_DEFAULT)), value :: algo
-            integer(c_int32_t), value :: solution_index
-            ! No unsigned types in fortran. If larger values are needed
-            ! we will need a workaround.
-            integer(c_int32_t), value :: flags
-        end function hipblasGemmStridedBatchedEx
+        end function hipblasXtZtrsm
     end interface
 
     ! trsmEx
@@ -12126,7 +16306,7 @@ module hipblas
             integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasTrsmEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
@@ -12152,7 +16332,7 @@ module hipblas
             integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasTrsmBatchedEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
@@ -12179,7 +16359,7 @@ module hipblas
             integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasTrsmStridedBatchedEx
             type(c_ptr), value :: handle
             integer(kind(HIPBLAS_SIDE_LEFT)), value :: side
-            integer(kind(HIPBLAS_FILL_MODE_UPPER)), value :: uplo
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
             integer(kind(HIPBLAS_OP_N)), value :: transA
             integer(kind(HIPBLAS_DIAG_UNIT)), value :: diag
             integer(c_int), value :: m
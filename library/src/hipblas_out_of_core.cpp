@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "out_of_core.hpp"
+#include "thread_stream.hpp"
+
+extern "C" {
+
+hipblasStatus_t hipblasSgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       B,
+                                      int                ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<float>(
+        handle, ooc_gemm<float>{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      B,
+                                      int                ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<double>(
+        handle, ooc_gemm<double>{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmOutOfCore(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transa,
+                                      hipblasOperation_t    transb,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    ooc_gemm<hipblasComplex> problem{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc};
+    return ooc_run<hipblasComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmOutOfCore(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transa,
+                                      hipblasOperation_t          transb,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    ooc_gemm<hipblasDoubleComplex> problem{
+        transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc};
+    return ooc_run<hipblasDoubleComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkOutOfCore(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       beta,
+                                      float*             C,
+                                      int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<float>(handle, ooc_syrk<float>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkOutOfCore(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int                n,
+                                      int                k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      beta,
+                                      double*            C,
+                                      int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<double>(
+        handle, ooc_syrk<double>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkOutOfCore(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<hipblasComplex>(
+        handle, ooc_syrk<hipblasComplex>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkOutOfCore(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<hipblasDoubleComplex>(
+        handle, ooc_syrk<hipblasDoubleComplex>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      float*             B,
+                                      int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<float>(
+        handle, ooc_trsm<float>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      double*            B,
+                                      int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<double>(
+        handle, ooc_trsm<double>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmOutOfCore(hipblasHandle_t       handle,
+                                      hipblasSideMode_t     side,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      hipblasDiagType_t     diag,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      hipblasComplex*       B,
+                                      int                   ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    return ooc_run<hipblasComplex>(
+        handle, ooc_trsm<hipblasComplex>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmOutOfCore(hipblasHandle_t             handle,
+                                      hipblasSideMode_t           side,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      hipblasDiagType_t           diag,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      hipblasDoubleComplex*       B,
+                                      int                         ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_internal_call_guard internal;
+    ooc_trsm<hipblasDoubleComplex> problem{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb};
+    return ooc_run<hipblasDoubleComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,2218 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "logging.hpp"
+
+// A row-major matrix is the column-major transpose of itself at the same address
+// with the same leading dimension. Each hipblasRow* call is rewritten on those
+// transposes and forwarded to its column-major counterpart, so no data is moved:
+//
+//   C = op(A) * op(B)     becomes  C^T = op(B^T) * op(A^T)
+//   y = op(A) * x         becomes  y = op'(A^T) * x, op' swapping N and T
+//   op(A) * X = alpha*B   becomes  X^T * op(A^T) = alpha*B^T, on the other side
+//   C = op(A) * op(A)^T   becomes  op'(A^T)^T * op'(A^T), in the other triangle
+
+namespace
+{
+    hipblasFillMode_t row_major_uplo(hipblasFillMode_t uplo)
+    {
+        if(uplo == HIPBLAS_FILL_MODE_UPPER)
+            return HIPBLAS_FILL_MODE_LOWER;
+        if(uplo == HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_FILL_MODE_UPPER;
+        return uplo;
+    }
+
+    hipblasSideMode_t row_major_side(hipblasSideMode_t side)
+    {
+        if(side == HIPBLAS_SIDE_LEFT)
+            return HIPBLAS_SIDE_RIGHT;
+        if(side == HIPBLAS_SIDE_RIGHT)
+            return HIPBLAS_SIDE_LEFT;
+        return side;
+    }
+
+    // HIPBLAS_OP_C is the transpose for the real types. A conjugate without the
+    // transpose has no hipblasOperation_t, so the complex entry points handle
+    // HIPBLAS_OP_C before calling this.
+    hipblasOperation_t row_major_transpose(hipblasOperation_t trans)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return HIPBLAS_OP_T;
+        if(trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C)
+            return HIPBLAS_OP_N;
+        return trans;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasRowHgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const hipblasHalf* alpha,
+                                const hipblasHalf* A,
+                                int                lda,
+                                const hipblasHalf* B,
+                                int                ldb,
+                                const hipblasHalf* beta,
+                                hipblasHalf*       C,
+                                int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasHgemm(handle, transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       B,
+                                int                ldb,
+                                const float*       beta,
+                                float*             C,
+                                int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemm(handle, transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      B,
+                                int                ldb,
+                                const double*      beta,
+                                double*            C,
+                                int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemm(handle, transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemm(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int                   m,
+                                int                   n,
+                                int                   k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* B,
+                                int                   ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCgemm(handle, transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemm(hipblasHandle_t             handle,
+                                hipblasOperation_t          transA,
+                                hipblasOperation_t          transB,
+                                int                         m,
+                                int                         n,
+                                int                         k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* B,
+                                int                         ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZgemm(handle, transB, transA, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowHgemmBatched(hipblasHandle_t          handle,
+                                       hipblasOperation_t       transA,
+                                       hipblasOperation_t       transB,
+                                       int                      m,
+                                       int                      n,
+                                       int                      k,
+                                       const hipblasHalf*       alpha,
+                                       const hipblasHalf* const A[],
+                                       int                      lda,
+                                       const hipblasHalf* const B[],
+                                       int                      ldb,
+                                       const hipblasHalf*       beta,
+                                       hipblasHalf* const       C[],
+                                       int                      ldc,
+                                       int                      batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasHgemmBatched(handle,
+                               transB,
+                               transA,
+                               n,
+                               m,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemmBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const B[],
+                                       int                ldb,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemmBatched(handle,
+                               transB,
+                               transA,
+                               n,
+                               m,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemmBatched(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transA,
+                                       hipblasOperation_t  transB,
+                                       int                 m,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const B[],
+                                       int                 ldb,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemmBatched(handle,
+                               transB,
+                               transA,
+                               n,
+                               m,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemmBatched(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const B[],
+                                       int                         ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCgemmBatched(handle,
+                               transB,
+                               transA,
+                               n,
+                               m,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemmBatched(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transA,
+                                       hipblasOperation_t                transB,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int                               ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZgemmBatched(handle,
+                               transB,
+                               transA,
+                               n,
+                               m,
+                               k,
+                               alpha,
+                               B,
+                               ldb,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowHgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const hipblasHalf* alpha,
+                                              const hipblasHalf* A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const hipblasHalf* B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const hipblasHalf* beta,
+                                              hipblasHalf*       C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasHgemmStridedBatched(handle,
+                                      transB,
+                                      transA,
+                                      n,
+                                      m,
+                                      k,
+                                      alpha,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const float*       B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemmStridedBatched(handle,
+                                      transB,
+                                      transA,
+                                      n,
+                                      m,
+                                      k,
+                                      alpha,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const double*      B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemmStridedBatched(handle,
+                                      transB,
+                                      transA,
+                                      n,
+                                      m,
+                                      k,
+                                      alpha,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemmStridedBatched(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              long long             strideA,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              long long             strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              long long             strideC,
+                                              int                   batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCgemmStridedBatched(handle,
+                                      transB,
+                                      transA,
+                                      n,
+                                      m,
+                                      k,
+                                      alpha,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemmStridedBatched(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              long long                   strideA,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              long long                   strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              long long                   strideC,
+                                              int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZgemmStridedBatched(handle,
+                                      transB,
+                                      transA,
+                                      n,
+                                      m,
+                                      k,
+                                      alpha,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowGemmEx(hipblasHandle_t    handle,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipblasDatatype_t  aType,
+                                 int                lda,
+                                 const void*        B,
+                                 hipblasDatatype_t  bType,
+                                 int                ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 hipblasDatatype_t  cType,
+                                 int                ldc,
+                                 hipblasDatatype_t  computeType,
+                                 hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasGemmEx(handle,
+                         transB,
+                         transA,
+                         n,
+                         m,
+                         k,
+                         alpha,
+                         B,
+                         bType,
+                         ldb,
+                         A,
+                         aType,
+                         lda,
+                         beta,
+                         C,
+                         cType,
+                         ldc,
+                         computeType,
+                         algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowGemmBatchedEx(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  aType,
+                                        int                lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  bType,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  cType,
+                                        int                ldc,
+                                        int                batchCount,
+                                        hipblasDatatype_t  computeType,
+                                        hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasGemmBatchedEx(handle,
+                                transB,
+                                transA,
+                                n,
+                                m,
+                                k,
+                                alpha,
+                                B,
+                                bType,
+                                ldb,
+                                A,
+                                aType,
+                                lda,
+                                beta,
+                                C,
+                                cType,
+                                ldc,
+                                batchCount,
+                                computeType,
+                                algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  aType,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               const void*        B,
+                                               hipblasDatatype_t  bType,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  cType,
+                                               int                ldc,
+                                               hipblasStride      strideC,
+                                               int                batchCount,
+                                               hipblasDatatype_t  computeType,
+                                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasGemmStridedBatchedEx(handle,
+                                       transB,
+                                       transA,
+                                       n,
+                                       m,
+                                       k,
+                                       alpha,
+                                       B,
+                                       bType,
+                                       ldb,
+                                       strideB,
+                                       A,
+                                       aType,
+                                       lda,
+                                       strideA,
+                                       beta,
+                                       C,
+                                       cType,
+                                       ldc,
+                                       strideC,
+                                       batchCount,
+                                       computeType,
+                                       algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       x,
+                                int                incx,
+                                const float*       beta,
+                                float*             y,
+                                int                incy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemv(handle,
+                        row_major_transpose(trans),
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        x,
+                        incx,
+                        beta,
+                        y,
+                        incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      x,
+                                int                incx,
+                                const double*      beta,
+                                double*            y,
+                                int                incy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemv(handle,
+                        row_major_transpose(trans),
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        x,
+                        incx,
+                        beta,
+                        y,
+                        incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemv(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int                   m,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int                   incy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasCgemv(handle,
+                        row_major_transpose(trans),
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        x,
+                        incx,
+                        beta,
+                        y,
+                        incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemv(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int                         m,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int                         incy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasZgemv(handle,
+                        row_major_transpose(trans),
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        x,
+                        incx,
+                        beta,
+                        y,
+                        incy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemvBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int                m,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const x[],
+                                       int                incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int                incy,
+                                       int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemvBatched(handle,
+                               row_major_transpose(trans),
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               beta,
+                               y,
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemvBatched(hipblasHandle_t     handle,
+                                       hipblasOperation_t  trans,
+                                       int                 m,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const x[],
+                                       int                 incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int                 incy,
+                                       int                 batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemvBatched(handle,
+                               row_major_transpose(trans),
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               beta,
+                               y,
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemvBatched(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int                         m,
+                                       int                         n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int                         incy,
+                                       int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasCgemvBatched(handle,
+                               row_major_transpose(trans),
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               beta,
+                               y,
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemvBatched(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                trans,
+                                       int                               m,
+                                       int                               n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int                               incy,
+                                       int                               batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(trans == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasZgemvBatched(handle,
+                               row_major_transpose(trans),
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               x,
+                               incx,
+                               beta,
+                               y,
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSgemvStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int                m,
+                                              int                n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int                incy,
+                                              hipblasStride      stridey,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSgemvStridedBatched(handle,
+                                      row_major_transpose(transA),
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDgemvStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int                incy,
+                                              hipblasStride      stridey,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDgemvStridedBatched(handle,
+                                      row_major_transpose(transA),
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCgemvStridedBatched(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              int                   m,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int                   incy,
+                                              hipblasStride         stridey,
+                                              int                   batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasCgemvStridedBatched(handle,
+                                      row_major_transpose(transA),
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZgemvStridedBatched(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              int                         m,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int                         incy,
+                                              hipblasStride               stridey,
+                                              int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // conj(A^T) * x cannot be expressed without conjugating a copy
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    return hipblasZgemvStridedBatched(handle,
+                                      row_major_transpose(transA),
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowStrsm(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const float*       alpha,
+                                float*             A,
+                                int                lda,
+                                float*             B,
+                                int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasStrsm(handle,
+                        row_major_side(side),
+                        row_major_uplo(uplo),
+                        transA,
+                        diag,
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        B,
+                        ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDtrsm(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const double*      alpha,
+                                double*            A,
+                                int                lda,
+                                double*            B,
+                                int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDtrsm(handle,
+                        row_major_side(side),
+                        row_major_uplo(uplo),
+                        transA,
+                        diag,
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        B,
+                        ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCtrsm(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int                   m,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                hipblasComplex*       A,
+                                int                   lda,
+                                hipblasComplex*       B,
+                                int                   ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCtrsm(handle,
+                        row_major_side(side),
+                        row_major_uplo(uplo),
+                        transA,
+                        diag,
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        B,
+                        ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZtrsm(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int                         m,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       A,
+                                int                         lda,
+                                hipblasDoubleComplex*       B,
+                                int                         ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZtrsm(handle,
+                        row_major_side(side),
+                        row_major_uplo(uplo),
+                        transA,
+                        diag,
+                        n,
+                        m,
+                        alpha,
+                        A,
+                        lda,
+                        B,
+                        ldb);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowStrsmBatched(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int                m,
+                                       int                n,
+                                       const float*       alpha,
+                                       float* const       A[],
+                                       int                lda,
+                                       float*             B[],
+                                       int                ldb,
+                                       int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasStrsmBatched(handle,
+                               row_major_side(side),
+                               row_major_uplo(uplo),
+                               transA,
+                               diag,
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDtrsmBatched(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int                m,
+                                       int                n,
+                                       const double*      alpha,
+                                       double* const      A[],
+                                       int                lda,
+                                       double*            B[],
+                                       int                ldb,
+                                       int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDtrsmBatched(handle,
+                               row_major_side(side),
+                               row_major_uplo(uplo),
+                               transA,
+                               diag,
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCtrsmBatched(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int                   m,
+                                       int                   n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const A[],
+                                       int                   lda,
+                                       hipblasComplex*       B[],
+                                       int                   ldb,
+                                       int                   batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCtrsmBatched(handle,
+                               row_major_side(side),
+                               row_major_uplo(uplo),
+                               transA,
+                               diag,
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZtrsmBatched(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int                         m,
+                                       int                         n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const A[],
+                                       int                         lda,
+                                       hipblasDoubleComplex*       B[],
+                                       int                         ldb,
+                                       int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZtrsmBatched(handle,
+                               row_major_side(side),
+                               row_major_uplo(uplo),
+                               transA,
+                               diag,
+                               n,
+                               m,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowStrsmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const float*       alpha,
+                                              float*             A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              float*             B,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasStrsmStridedBatched(handle,
+                                      row_major_side(side),
+                                      row_major_uplo(uplo),
+                                      transA,
+                                      diag,
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDtrsmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              double*            A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              double*            B,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDtrsmStridedBatched(handle,
+                                      row_major_side(side),
+                                      row_major_uplo(uplo),
+                                      transA,
+                                      diag,
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCtrsmStridedBatched(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int                   m,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       B,
+                                              int                   ldb,
+                                              hipblasStride         strideB,
+                                              int                   batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasCtrsmStridedBatched(handle,
+                                      row_major_side(side),
+                                      row_major_uplo(uplo),
+                                      transA,
+                                      diag,
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZtrsmStridedBatched(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int                         m,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       B,
+                                              int                         ldb,
+                                              hipblasStride               strideB,
+                                              int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasZtrsmStridedBatched(handle,
+                                      row_major_side(side),
+                                      row_major_uplo(uplo),
+                                      transA,
+                                      diag,
+                                      n,
+                                      m,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowTrsmEx(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 void*              A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb,
+                                 const void*        invA,
+                                 int                invAsize,
+                                 hipblasDatatype_t  computeType)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasTrsmEx(handle,
+                         row_major_side(side),
+                         row_major_uplo(uplo),
+                         transA,
+                         diag,
+                         n,
+                         m,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         invA,
+                         invAsize,
+                         computeType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowTrsmBatchedEx(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const void*        alpha,
+                                        void*              A,
+                                        int                lda,
+                                        void*              B,
+                                        int                ldb,
+                                        int                batchCount,
+                                        const void*        invA,
+                                        int                invAsize,
+                                        hipblasDatatype_t  computeType)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasTrsmBatchedEx(handle,
+                                row_major_side(side),
+                                row_major_uplo(uplo),
+                                transA,
+                                diag,
+                                n,
+                                m,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                batchCount,
+                                invA,
+                                invAsize,
+                                computeType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const void*        alpha,
+                                               void*              A,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               void*              B,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int                batchCount,
+                                               const void*        invA,
+                                               int                invAsize,
+                                               hipblasStride      strideInvA,
+                                               hipblasDatatype_t  computeType)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasTrsmStridedBatchedEx(handle,
+                                       row_major_side(side),
+                                       row_major_uplo(uplo),
+                                       transA,
+                                       diag,
+                                       n,
+                                       m,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       batchCount,
+                                       invA,
+                                       invAsize,
+                                       strideInvA,
+                                       computeType);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSsyrk(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int                n,
+                                int                k,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       beta,
+                                float*             C,
+                                int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSsyrk(handle,
+                        row_major_uplo(uplo),
+                        row_major_transpose(transA),
+                        n,
+                        k,
+                        alpha,
+                        A,
+                        lda,
+                        beta,
+                        C,
+                        ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDsyrk(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int                n,
+                                int                k,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      beta,
+                                double*            C,
+                                int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDsyrk(handle,
+                        row_major_uplo(uplo),
+                        row_major_transpose(transA),
+                        n,
+                        k,
+                        alpha,
+                        A,
+                        lda,
+                        beta,
+                        C,
+                        ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCsyrk(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int                   n,
+                                int                   k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasCsyrk(handle,
+                        row_major_uplo(uplo),
+                        row_major_transpose(transA),
+                        n,
+                        k,
+                        alpha,
+                        A,
+                        lda,
+                        beta,
+                        C,
+                        ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZsyrk(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int                         n,
+                                int                         k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasZsyrk(handle,
+                        row_major_uplo(uplo),
+                        row_major_transpose(transA),
+                        n,
+                        k,
+                        alpha,
+                        A,
+                        lda,
+                        beta,
+                        C,
+                        ldc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSsyrkBatched(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSsyrkBatched(handle,
+                               row_major_uplo(uplo),
+                               row_major_transpose(transA),
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDsyrkBatched(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDsyrkBatched(handle,
+                               row_major_uplo(uplo),
+                               row_major_transpose(transA),
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCsyrkBatched(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasCsyrkBatched(handle,
+                               row_major_uplo(uplo),
+                               row_major_transpose(transA),
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZsyrkBatched(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasZsyrkBatched(handle,
+                               row_major_uplo(uplo),
+                               row_major_transpose(transA),
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowSsyrkStridedBatched(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              hipblasStride      strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasSsyrkStridedBatched(handle,
+                                      row_major_uplo(uplo),
+                                      row_major_transpose(transA),
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowDsyrkStridedBatched(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              hipblasStride      strideC,
+                                              int                batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return hipblasDsyrkStridedBatched(handle,
+                                      row_major_uplo(uplo),
+                                      row_major_transpose(transA),
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowCsyrkStridedBatched(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              hipblasStride         strideC,
+                                              int                   batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasCsyrkStridedBatched(handle,
+                                      row_major_uplo(uplo),
+                                      row_major_transpose(transA),
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasRowZsyrkStridedBatched(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              hipblasStride               strideC,
+                                              int                         batchCount)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+
+    // Not a valid syrk for complex types in either layout
+    if(transA == HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasZsyrkStridedBatched(handle,
+                                      row_major_uplo(uplo),
+                                      row_major_transpose(transA),
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
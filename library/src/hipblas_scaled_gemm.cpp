@@ -0,0 +1,586 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "datatype.hpp"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "functions.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+#include "workspace.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Types whose values can be scaled in place of the product's
+    bool floating_type(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+        case HIPBLAS_R_16B:
+        case HIPBLAS_R_32F:
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_16F:
+        case HIPBLAS_C_16B:
+        case HIPBLAS_C_32F:
+        case HIPBLAS_C_64F:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Whether cType has dgmm and geam and the GEMM's scalars are of cType, so
+    // that the scales are applied without k = 1 GEMMs
+    bool typed_scalars(hipblasDatatype_t c_type, hipblasDatatype_t compute_type)
+    {
+        switch(compute_type)
+        {
+        case HIPBLAS_R_32F_FAST:
+        case HIPBLAS_R_32F_FAST_TF32:
+        case HIPBLAS_R_32F_FAST_16BX3:
+            return c_type == HIPBLAS_R_32F;
+        case HIPBLAS_R_32F:
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_32F:
+        case HIPBLAS_C_64F:
+            return c_type == compute_type;
+        default:
+            return false;
+        }
+    }
+
+    // Y = alpha*diag(s)*op(X) + beta*Y when left, or alpha*op(X)*diag(s) + beta*Y
+    // otherwise, for an op(X) of rows by cols. Each row (left) or column of Y is
+    // one member of a strided-batched GEMM with k = 1, so the whole scaling is
+    // one call in any type the backend's GEMM takes.
+    hipblasStatus_t scale_gemm(hipblasHandle_t    handle,
+                               bool               left,
+                               hipblasOperation_t trans,
+                               int                rows,
+                               int                cols,
+                               const void*        alpha,
+                               const void*        s,
+                               const void*        X,
+                               int                ldx,
+                               const void*        beta,
+                               void*              Y,
+                               int                ldy,
+                               hipblasDatatype_t  type,
+                               hipblasDatatype_t  compute_type)
+    {
+        bool          plain = trans == HIPBLAS_OP_N;
+        hipblasStride step  = ldx;
+        if(left)
+            return hipblasGemmStridedBatchedEx(handle,
+                                               HIPBLAS_OP_N,
+                                               trans,
+                                               1,
+                                               cols,
+                                               1,
+                                               alpha,
+                                               s,
+                                               type,
+                                               1,
+                                               1,
+                                               X,
+                                               type,
+                                               ldx,
+                                               plain ? 1 : step,
+                                               beta,
+                                               Y,
+                                               type,
+                                               ldy,
+                                               1,
+                                               rows,
+                                               compute_type,
+                                               HIPBLAS_GEMM_DEFAULT);
+        return hipblasGemmStridedBatchedEx(handle,
+                                           trans,
+                                           HIPBLAS_OP_N,
+                                           rows,
+                                           1,
+                                           1,
+                                           alpha,
+                                           X,
+                                           type,
+                                           ldx,
+                                           plain ? step : 1,
+                                           s,
+                                           type,
+                                           1,
+                                           1,
+                                           beta,
+                                           Y,
+                                           type,
+                                           ldy,
+                                           ldy,
+                                           cols,
+                                           compute_type,
+                                           HIPBLAS_GEMM_DEFAULT);
+    }
+
+    hipblasStatus_t gemm_scaled_ex(hipblasHandle_t    handle,
+                                   hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const void*        alpha,
+                                   const void*        A,
+                                   hipblasDatatype_t  a_type,
+                                   int                lda,
+                                   const void*        B,
+                                   hipblasDatatype_t  b_type,
+                                   int                ldb,
+                                   const void*        beta,
+                                   void*              C,
+                                   hipblasDatatype_t  c_type,
+                                   int                ldc,
+                                   const void*        row_scale,
+                                   const void*        col_scale,
+                                   hipblasDatatype_t  compute_type,
+                                   hipblasGemmAlgo_t  algo)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        // Without scales, and with nothing to scale when k is 0, this is GemmEx
+        if((!row_scale && !col_scale) || !m || !n || !k)
+            return hipblasGemmEx(handle,
+                                 transa,
+                                 transb,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 a_type,
+                                 lda,
+                                 B,
+                                 b_type,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 c_type,
+                                 ldc,
+                                 compute_type,
+                                 algo);
+
+        size_t        size_a   = hipblas_datatype_size(a_type);
+        size_t        size_b   = hipblas_datatype_size(b_type);
+        size_t        size_c   = hipblas_datatype_size(c_type);
+        unsigned char one[16]  = {};
+        unsigned char zero[16] = {};
+        if(!size_a || !size_b || !size_c)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || k < 0 || ldc < m)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+#ifndef __HIP_PLATFORM_NVCC__
+        // rocBLAS has no int8 GEMM with a floating-point output, and an int32
+        // product cannot be converted without a kernel of our own
+        if(!floating_type(a_type) && floating_type(c_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+#endif
+
+        bool typed = typed_scalars(c_type, compute_type);
+        if(!hipblas_write_one(typed ? c_type : compute_type, one))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipblasPointerMode_t pointer_mode;
+        hipStream_t          stream;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // With A, B and C of one floating type the scales go into copies of
+        // the operands ahead of the GEMM: op(B)*diag(colScale) for the typed
+        // cTypes, whose diag(rowScale) is applied to the product, and both
+        // otherwise. Other inputs, as int8 with a wider C, have the product
+        // formed in a cType workspace and scaled there.
+        bool   same    = a_type == b_type && b_type == c_type && floating_type(c_type);
+        bool   scale_b = same && col_scale;
+        bool   product = !same || (typed && row_scale);
+        size_t mn      = size_t(m) * n;
+        size_t bytes_x = 0, bytes_y = 0;
+        if(typed)
+        {
+            bytes_x = scale_b ? size_t(k) * n * size_c : 0;
+            bytes_y = product ? mn * size_c : 0;
+        }
+        else if(same)
+        {
+            bytes_x = row_scale ? size_t(m) * k * size_a : 0;
+            bytes_y = col_scale ? size_t(k) * n * size_b : 0;
+        }
+        else
+        {
+            bytes_x = mn * size_c;
+            bytes_y = row_scale && col_scale ? mn * size_c : 0;
+        }
+        size_t                  bytes_s = sizeof(one) + sizeof(zero);
+        hipblas_workspace_scope scope(handle, bytes_s + bytes_x + bytes_y);
+        if(scope.status() != HIPBLAS_STATUS_SUCCESS)
+            return scope.status();
+        char* workspace = scope.data<char>();
+        char* X         = workspace + bytes_s;
+        char* Y         = X + bytes_x;
+
+        // The intermediate steps scale by 1 and add 0, in the caller's pointer mode
+        const void* s_one  = one;
+        const void* s_zero = zero;
+        if(pointer_mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            if(hipMemcpyAsync(workspace, one, sizeof(one), hipMemcpyHostToDevice, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(
+                      workspace + sizeof(one), zero, sizeof(zero), hipMemcpyHostToDevice, stream)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            s_one  = workspace;
+            s_zero = workspace + sizeof(one);
+        }
+
+        auto scaled = [&](auto type) {
+            using T                   = decltype(type);
+            using F                   = hipblas_functions<T>;
+            const T*           r      = static_cast<const T*>(row_scale);
+            const T*           c      = static_cast<const T*>(col_scale);
+            const void*        b      = B;
+            int                b_ld   = ldb;
+            hipblasOperation_t tb     = transb;
+            hipblasStatus_t    status = HIPBLAS_STATUS_SUCCESS;
+            if(scale_b)
+            {
+                // op(B)*diag(c) is B*diag(c) untransposed, and diag(c)*B under
+                // a transpose. A conjugate transpose would need conj(c), so a
+                // complex B is conjugate-transposed into X first.
+                T*   Bs      = reinterpret_cast<T*>(X);
+                bool complex = c_type == HIPBLAS_C_32F || c_type == HIPBLAS_C_64F;
+                if(transb == HIPBLAS_OP_N || (transb == HIPBLAS_OP_C && complex))
+                {
+                    const T* from = static_cast<const T*>(B);
+                    int      ld   = ldb;
+                    if(transb != HIPBLAS_OP_N)
+                    {
+                        status = F::geam(handle,
+                                         transb,
+                                         HIPBLAS_OP_N,
+                                         k,
+                                         n,
+                                         static_cast<const T*>(s_one),
+                                         from,
+                                         ldb,
+                                         static_cast<const T*>(s_zero),
+                                         Bs,
+                                         k,
+                                         Bs,
+                                         k);
+                        from   = Bs;
+                        ld     = k;
+                    }
+                    if(status == HIPBLAS_STATUS_SUCCESS)
+                        status = F::dgmm(handle, HIPBLAS_SIDE_RIGHT, k, n, from, ld, c, 1, Bs, k);
+                    tb   = HIPBLAS_OP_N;
+                    b_ld = k;
+                }
+                else
+                {
+                    status = F::dgmm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     n,
+                                     k,
+                                     static_cast<const T*>(B),
+                                     ldb,
+                                     c,
+                                     1,
+                                     Bs,
+                                     n);
+                    b_ld   = n;
+                }
+                b = Bs;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            if(!product)
+                return hipblasGemmEx(handle,
+                                     transa,
+                                     tb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     a_type,
+                                     lda,
+                                     b,
+                                     b_type,
+                                     b_ld,
+                                     beta,
+                                     C,
+                                     c_type,
+                                     ldc,
+                                     compute_type,
+                                     algo);
+
+            // P = alpha*op(A)*op(B), scaled by the diagonals left for it and
+            // added to beta*C
+            T* P   = reinterpret_cast<T*>(Y);
+            status = hipblasGemmEx(handle,
+                                   transa,
+                                   tb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   a_type,
+                                   lda,
+                                   b,
+                                   b_type,
+                                   b_ld,
+                                   s_zero,
+                                   P,
+                                   c_type,
+                                   m,
+                                   compute_type,
+                                   algo);
+            if(status == HIPBLAS_STATUS_SUCCESS && r)
+                status = F::dgmm(handle, HIPBLAS_SIDE_LEFT, m, n, P, m, r, 1, P, m);
+            if(status == HIPBLAS_STATUS_SUCCESS && c && !scale_b)
+                status = F::dgmm(handle, HIPBLAS_SIDE_RIGHT, m, n, P, m, c, 1, P, m);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = F::geam(handle,
+                                 HIPBLAS_OP_N,
+                                 HIPBLAS_OP_N,
+                                 m,
+                                 n,
+                                 static_cast<const T*>(s_one),
+                                 P,
+                                 m,
+                                 static_cast<const T*>(beta),
+                                 static_cast<T*>(C),
+                                 ldc,
+                                 static_cast<T*>(C),
+                                 ldc);
+            return status;
+        };
+        if(typed && hipblas_functions_call(c_type, scaled, status))
+            return status;
+
+        // Half-precision cTypes scale with one strided-batched GEMM of k = 1 per
+        // diagonal
+        if(same)
+        {
+            // diag(row_scale)*op(A) and op(B)*diag(col_scale), both untransposed
+            const void*        a = A, *b = B;
+            int                a_ld = lda, b_ld = ldb;
+            hipblasOperation_t ta = transa, tb = transb;
+            if(row_scale)
+            {
+                status = scale_gemm(handle,
+                                    true,
+                                    transa,
+                                    m,
+                                    k,
+                                    s_one,
+                                    row_scale,
+                                    A,
+                                    lda,
+                                    s_zero,
+                                    X,
+                                    m,
+                                    c_type,
+                                    compute_type);
+                a    = X;
+                a_ld = m;
+                ta   = HIPBLAS_OP_N;
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS && col_scale)
+            {
+                status = scale_gemm(handle,
+                                    false,
+                                    transb,
+                                    k,
+                                    n,
+                                    s_one,
+                                    col_scale,
+                                    B,
+                                    ldb,
+                                    s_zero,
+                                    Y,
+                                    k,
+                                    c_type,
+                                    compute_type);
+                b    = Y;
+                b_ld = k;
+                tb   = HIPBLAS_OP_N;
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblasGemmEx(handle,
+                                       ta,
+                                       tb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a,
+                                       a_type,
+                                       a_ld,
+                                       b,
+                                       b_type,
+                                       b_ld,
+                                       beta,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       compute_type,
+                                       algo);
+        }
+        else
+        {
+            // X = op(A)*op(B), then its columns and rows scaled with the last
+            // step adding beta*C
+            status = hipblasGemmEx(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   s_one,
+                                   A,
+                                   a_type,
+                                   lda,
+                                   B,
+                                   b_type,
+                                   ldb,
+                                   s_zero,
+                                   X,
+                                   c_type,
+                                   m,
+                                   compute_type,
+                                   algo);
+            void* product = X;
+            if(status == HIPBLAS_STATUS_SUCCESS && row_scale && col_scale)
+            {
+                status = scale_gemm(handle,
+                                    false,
+                                    HIPBLAS_OP_N,
+                                    m,
+                                    n,
+                                    s_one,
+                                    col_scale,
+                                    X,
+                                    m,
+                                    s_zero,
+                                    Y,
+                                    m,
+                                    c_type,
+                                    compute_type);
+                product = Y;
+            }
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = scale_gemm(handle,
+                                    row_scale != nullptr,
+                                    HIPBLAS_OP_N,
+                                    m,
+                                    n,
+                                    alpha,
+                                    row_scale ? row_scale : col_scale,
+                                    product,
+                                    m,
+                                    beta,
+                                    C,
+                                    ldc,
+                                    c_type,
+                                    compute_type);
+        }
+
+        return status;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmScaledEx(hipblasHandle_t    handle,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const void*        alpha,
+                                    const void*        A,
+                                    hipblasDatatype_t  a_type,
+                                    int                lda,
+                                    const void*        B,
+                                    hipblasDatatype_t  b_type,
+                                    int                ldb,
+                                    const void*        beta,
+                                    void*              C,
+                                    hipblasDatatype_t  c_type,
+                                    int                ldc,
+                                    const void*        row_scale,
+                                    const void*        col_scale,
+                                    hipblasDatatype_t  compute_type,
+                                    hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+
+    hipblas_internal_call_guard internal;
+    return gemm_scaled_ex(handle,
+                          transa,
+                          transb,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          A,
+                          a_type,
+                          lda,
+                          B,
+                          b_type,
+                          ldb,
+                          beta,
+                          C,
+                          c_type,
+                          ldc,
+                          row_scale,
+                          col_scale,
+                          compute_type,
+                          algo);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,369 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "memory_type.hpp"
+#include "staging.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace
+{
+    constexpr int    staging_chunks    = 4;
+    constexpr size_t staging_min_bytes = 64 << 10; // smaller copies go straight to the driver
+
+    // Chunk size from HIPBLAS_STAGING_SIZE in bytes, 0 disables staging
+    size_t staging_chunk_bytes()
+    {
+        static const size_t bytes = [] {
+            const char* env = getenv("HIPBLAS_STAGING_SIZE");
+            return env ? size_t(strtoull(env, nullptr, 0)) : size_t(4) << 20;
+        }();
+        return bytes;
+    }
+
+    // count matrices of rows x cols elements, ld and stride apart
+    struct strided_matrices
+    {
+        char*  ptr;
+        size_t ld, stride;
+        size_t rows, cols, count, elem_size;
+
+        char* matrix(size_t b, size_t i0 = 0, size_t j0 = 0) const
+        {
+            return ptr + (b * stride + j0 * ld + i0) * elem_size;
+        }
+    };
+
+    // Where a chunk copied from the device is unpacked to, read by the host
+    // function queued behind the copy
+    struct staging_chunk
+    {
+        char*            host = nullptr;
+        hipEvent_t       done = nullptr; // recorded after the last use of host
+        strided_matrices dst;
+    };
+
+    struct staging_ring
+    {
+        std::mutex    mutex;
+        staging_chunk chunks[staging_chunks];
+        int           next = 0;
+
+        bool init(size_t chunk_bytes)
+        {
+            for(auto& chunk : chunks)
+                if(hipHostMalloc((void**)&chunk.host, chunk_bytes) != hipSuccess
+                   || hipEventCreateWithFlags(&chunk.done, hipEventDisableTiming) != hipSuccess)
+                    return false;
+            return true;
+        }
+
+        // The next chunk, once the copy using it last time is complete
+        staging_chunk* acquire()
+        {
+            staging_chunk& chunk = chunks[next];
+            next                 = (next + 1) % staging_chunks;
+            return hipEventSynchronize(chunk.done) == hipSuccess ? &chunk : nullptr;
+        }
+
+        ~staging_ring()
+        {
+            for(auto& chunk : chunks)
+            {
+                if(chunk.done)
+                    (void)hipEventDestroy(chunk.done);
+                if(chunk.host)
+                    (void)hipHostFree(chunk.host);
+            }
+        }
+    };
+
+    // One ring per device, never destroyed so that nothing is released after
+    // the runtime has shut down. Returns nullptr if the ring cannot be set up.
+    staging_ring* get_staging_ring()
+    {
+        struct registry
+        {
+            std::mutex                                             mutex;
+            std::unordered_map<int, std::unique_ptr<staging_ring>> rings;
+        };
+        static registry* rings = new registry;
+
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return nullptr;
+        std::lock_guard<std::mutex> lock(rings->mutex);
+        auto&                       ring = rings->rings[device];
+        if(!ring)
+        {
+            ring = std::make_unique<staging_ring>();
+            if(!ring->init(staging_chunk_bytes()))
+                ring.reset();
+        }
+        return ring.get();
+    }
+
+    // Host memory the runtime does not know about; pinned, registered,
+    // managed and device memory are copied directly
+    bool is_pageable(const void* ptr)
+    {
+        return hipblas_get_memory_type(ptr) == hipblas_memory_type::pageable;
+    }
+
+    // Copy the rows x cols blocks at (i0, j0) of matrices src.matrix(b) to
+    // the same blocks of dst, b < src.count
+    void host_copy(const strided_matrices& dst,
+                   const strided_matrices& src,
+                   size_t                  i0,
+                   size_t                  j0,
+                   size_t                  rows,
+                   size_t                  cols)
+    {
+        for(size_t b = 0; b < src.count; b++)
+            for(size_t j = 0; j < cols; j++)
+                memcpy(dst.matrix(b, i0, j0 + j),
+                       src.matrix(b, i0, j0 + j),
+                       rows * src.elem_size);
+    }
+
+    void unpack_chunk(void* data)
+    {
+        auto*            chunk  = static_cast<staging_chunk*>(data);
+        strided_matrices packed = chunk->dst;
+        packed.ptr              = chunk->host;
+        packed.ld               = packed.rows;
+        packed.stride           = packed.rows * packed.cols;
+        host_copy(chunk->dst, packed, 0, 0, chunk->dst.rows, chunk->dst.cols);
+    }
+
+    // One asynchronous copy of the rows x cols blocks at (i0, j0) of count
+    // matrices when the strides allow it, one copy per matrix otherwise
+    hipError_t device_copy(const strided_matrices& dst,
+                           const strided_matrices& src,
+                           size_t                  i0,
+                           size_t                  j0,
+                           size_t                  rows,
+                           size_t                  cols,
+                           hipMemcpyKind           kind,
+                           hipStream_t             stream)
+    {
+        size_t es     = src.elem_size;
+        size_t count  = src.count;
+        auto   slices = [&](const strided_matrices& m) {
+            return m.ld && m.stride % m.ld == 0 && m.stride / m.ld >= j0 + cols;
+        };
+        auto pitched = [&](const strided_matrices& m) {
+            return make_hipPitchedPtr(m.matrix(0, i0, j0), m.ld * es, rows * es, m.stride / m.ld);
+        };
+        if(count > 1 && slices(dst) && slices(src))
+        {
+            hipMemcpy3DParms params{};
+            params.srcPtr = pitched(src);
+            params.dstPtr = pitched(dst);
+            params.extent = make_hipExtent(rows * es, cols, count);
+            params.kind   = kind;
+            return hipMemcpy3DAsync(&params, stream);
+        }
+
+        for(size_t b = 0; b < count; b++)
+        {
+            hipError_t error = hipMemcpy2DAsync(dst.matrix(b, i0, j0),
+                                                dst.ld * es,
+                                                src.matrix(b, i0, j0),
+                                                src.ld * es,
+                                                rows * es,
+                                                cols,
+                                                kind,
+                                                stream);
+            if(error != hipSuccess)
+                return error;
+        }
+        return hipSuccess;
+    }
+
+    // Copy through the chunks of ring: several whole matrices to a chunk when
+    // they fit, otherwise blocks of whole columns or of parts of one column
+    hipblasStatus_t staged_copy(staging_ring&           ring,
+                                bool                    to_device,
+                                const strided_matrices& host,
+                                const strided_matrices& device,
+                                hipStream_t             stream)
+    {
+        size_t es           = host.elem_size;
+        size_t chunk_bytes  = staging_chunk_bytes();
+        size_t matrix_bytes = host.rows * host.cols * es;
+        size_t per_chunk    = std::max(size_t(1), chunk_bytes / matrix_bytes);
+        size_t block_rows   = std::min(host.rows, chunk_bytes / es);
+        size_t block_cols
+            = per_chunk > 1 ? host.cols : std::max(size_t(1), chunk_bytes / (block_rows * es));
+
+        std::lock_guard<std::mutex> lock(ring.mutex);
+        for(size_t b0 = 0; b0 < host.count; b0 += per_chunk)
+            for(size_t j0 = 0; j0 < host.cols; j0 += block_cols)
+                for(size_t i0 = 0; i0 < host.rows; i0 += block_rows)
+                {
+                    size_t         rb    = std::min(block_rows, host.rows - i0);
+                    size_t         cb    = std::min(block_cols, host.cols - j0);
+                    staging_chunk* chunk = ring.acquire();
+                    if(!chunk)
+                        return HIPBLAS_STATUS_MAPPING_ERROR;
+
+                    // The blocks of this step, the chunk holding them packed
+                    size_t           count = std::min(per_chunk, host.count - b0);
+                    strided_matrices h     = host;
+                    strided_matrices d     = device;
+                    h.ptr                  = host.matrix(b0, i0, j0);
+                    d.ptr                  = device.matrix(b0, i0, j0);
+                    h.rows = d.rows = rb;
+                    h.cols = d.cols = cb;
+                    h.count = d.count = count;
+                    strided_matrices packed{chunk->host, rb, rb * cb, rb, cb, count, es};
+
+                    if(to_device)
+                    {
+                        host_copy(packed, h, 0, 0, rb, cb);
+                        if(device_copy(d, packed, 0, 0, rb, cb, hipMemcpyHostToDevice, stream)
+                           != hipSuccess)
+                            return HIPBLAS_STATUS_MAPPING_ERROR;
+                    }
+                    else
+                    {
+                        chunk->dst = h;
+                        if(device_copy(packed, d, 0, 0, rb, cb, hipMemcpyDeviceToHost, stream)
+                               != hipSuccess
+                           || hipLaunchHostFunc(stream, unpack_chunk, chunk) != hipSuccess)
+                            return HIPBLAS_STATUS_MAPPING_ERROR;
+                    }
+                    if(hipEventRecord(chunk->done, stream) != hipSuccess)
+                        return HIPBLAS_STATUS_MAPPING_ERROR;
+                }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Stage when the host side is pageable and large enough
+    staging_ring* staging_for(const void* host, size_t bytes, size_t elem_size, hipStream_t stream)
+    {
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        if(bytes < staging_min_bytes || staging_chunk_bytes() < elem_size || !is_pageable(host)
+           || hipStreamIsCapturing(stream, &capture) != hipSuccess
+           || capture != hipStreamCaptureStatusNone)
+            return nullptr;
+        return get_staging_ring();
+    }
+}
+
+hipblasStatus_t hipblas_staged_copy(bool        to_device,
+                                    int         rows,
+                                    int         cols,
+                                    int         elem_size,
+                                    const void* src,
+                                    int         src_inc,
+                                    int         src_ld,
+                                    void*       dst,
+                                    int         dst_inc,
+                                    int         dst_ld,
+                                    hipStream_t stream,
+                                    bool        async,
+                                    bool&       staged)
+{
+    staged = false;
+    if(rows <= 0 || cols <= 0 || elem_size <= 0 || src_inc <= 0 || dst_inc <= 0
+       || (cols > 1 && (src_ld < rows || dst_ld < rows)))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // A strided vector is a row with the increments as leading dimensions
+    if(cols == 1 && (src_inc != 1 || dst_inc != 1))
+    {
+        src_ld = src_inc;
+        dst_ld = dst_inc;
+        cols   = rows;
+        rows   = 1;
+    }
+    else if(cols == 1)
+        src_ld = dst_ld = rows;
+
+    const void*   host = to_device ? src : dst;
+    staging_ring* ring = staging_for(host, size_t(rows) * cols * elem_size, elem_size, stream);
+    if(!ring)
+        return HIPBLAS_STATUS_SUCCESS;
+    staged = true;
+
+    size_t           es = elem_size;
+    strided_matrices s{(char*)src, size_t(src_ld), 0, size_t(rows), size_t(cols), 1, es};
+    strided_matrices d{(char*)dst, size_t(dst_ld), 0, size_t(rows), size_t(cols), 1, es};
+    hipblasStatus_t  status
+        = staged_copy(*ring, to_device, to_device ? s : d, to_device ? d : s, stream);
+
+    // The host buffer of an asynchronous set is already packed and may be
+    // reused; a get completes when the stream reaches its last host function
+    if(status == HIPBLAS_STATUS_SUCCESS && !async && hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_MAPPING_ERROR;
+    return status;
+}
+
+hipblasStatus_t hipblas_copy_strided_batched(bool          to_device,
+                                             int           rows,
+                                             int           cols,
+                                             int           elem_size,
+                                             const void*   src,
+                                             int64_t       src_ld,
+                                             hipblasStride src_stride,
+                                             void*         dst,
+                                             int64_t       dst_ld,
+                                             hipblasStride dst_stride,
+                                             int           batch_count,
+                                             hipStream_t   stream,
+                                             bool          async)
+{
+    if(rows <= 0 || cols <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t           m = rows, n = cols, count = batch_count, es = elem_size;
+    strided_matrices s{(char*)src, size_t(src_ld), size_t(src_stride), m, n, count, es};
+    strided_matrices d{(char*)dst, size_t(dst_ld), size_t(dst_stride), m, n, count, es};
+
+    const void*     host   = to_device ? src : dst;
+    staging_ring*   ring   = staging_for(host, m * n * es * count, es, stream);
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(ring)
+        status = staged_copy(*ring, to_device, to_device ? s : d, to_device ? d : s, stream);
+    else if(device_copy(d,
+                        s,
+                        0,
+                        0,
+                        m,
+                        n,
+                        to_device ? hipMemcpyHostToDevice : hipMemcpyDeviceToHost,
+                        stream)
+            != hipSuccess)
+        status = HIPBLAS_STATUS_MAPPING_ERROR;
+
+    if(status == HIPBLAS_STATUS_SUCCESS && !async && hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_MAPPING_ERROR;
+    return status;
+}
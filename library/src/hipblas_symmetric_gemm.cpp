@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "symmetric_gemm.hpp"
+#include "thread_stream.hpp"
+
+std::atomic<int> hipblas_symmetric_handles{0};
+
+hipblasSymmetricOutput_t hipblas_symmetric_output(hipblasHandle_t handle)
+{
+    hipblas_handle_state* state = hipblas_find_handle_state(handle);
+    return state ? state->symmetric_output : HIPBLAS_SYMMETRIC_OUTPUT_NONE;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetSymmetricOutput(hipblasHandle_t handle, hipblasSymmetricOutput_t output)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(output != HIPBLAS_SYMMETRIC_OUTPUT_NONE && output != HIPBLAS_SYMMETRIC_OUTPUT_UPPER
+       && output != HIPBLAS_SYMMETRIC_OUTPUT_LOWER && output != HIPBLAS_SYMMETRIC_OUTPUT_FULL)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    if(output == HIPBLAS_SYMMETRIC_OUTPUT_NONE && !hipblas_find_handle_state(handle))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_handle_state& state = hipblas_get_handle_state(handle);
+    if(state.symmetric_output == output)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state.symmetric_output == HIPBLAS_SYMMETRIC_OUTPUT_NONE)
+        hipblas_symmetric_handles++;
+    else if(output == HIPBLAS_SYMMETRIC_OUTPUT_NONE)
+        hipblas_symmetric_handles--;
+    state.symmetric_output = output;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetSymmetricOutput(hipblasHandle_t handle, hipblasSymmetricOutput_t* output)
+try
+{
+    HIPBLAS_THREAD_STREAM(handle);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(output == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *output = hipblas_symmetric_output(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
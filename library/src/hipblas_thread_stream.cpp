@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "handle_state.hpp"
+#include "logging.hpp"
+#include "thread_stream.hpp"
+#include <algorithm>
+
+std::atomic<int> hipblas_thread_stream_handles{0};
+
+namespace
+{
+    struct thread_binding
+    {
+        hipblasHandle_t                       handle;
+        std::weak_ptr<hipblas_thread_streams> owner; // expires when handle is destroyed
+        hipblasHandle_t                       thread_handle;
+    };
+
+    thread_local std::vector<thread_binding> thread_bindings;
+
+    // Serializes the creation of the bindings of a handle
+    std::mutex binding_mutex;
+
+    thread_binding* find_binding(hipblasHandle_t handle)
+    {
+        // The backend handles of expired bindings were destroyed with their owner
+        auto expired = [](const thread_binding& b) { return b.owner.expired(); };
+        thread_bindings.erase(
+            std::remove_if(thread_bindings.begin(), thread_bindings.end(), expired),
+            thread_bindings.end());
+        for(auto& binding : thread_bindings)
+            if(binding.handle == handle)
+                return &binding;
+        return nullptr;
+    }
+
+    // Copies a setting of the handle to a thread's backend handle. Settings
+    // the backend does not support are left at their defaults.
+    template <typename T>
+    hipblasStatus_t copy_setting(hipblasHandle_t from,
+                                 hipblasHandle_t to,
+                                 hipblasStatus_t (*get)(hipblasHandle_t, T*),
+                                 hipblasStatus_t (*set)(hipblasHandle_t, T))
+    {
+        T               value;
+        hipblasStatus_t status = get(from, &value);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = set(to, value);
+        return status == HIPBLAS_STATUS_NOT_SUPPORTED ? HIPBLAS_STATUS_SUCCESS : status;
+    }
+
+    hipblasStatus_t copy_settings(hipblasHandle_t from, hipblasHandle_t to)
+    {
+        hipblasStatus_t status
+            = copy_setting(from, to, hipblasGetPointerMode, hipblasSetPointerMode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_setting(from, to, hipblasGetAtomicsMode, hipblasSetAtomicsMode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_setting(from, to, hipblasGetDeferredMode, hipblasSetDeferredMode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_setting(
+                from, to, hipblasGetManagedMemoryPolicy, hipblasSetManagedMemoryPolicy);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_setting(from, to, hipblasGetSymmetricOutput, hipblasSetSymmetricOutput);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_setting(from, to, hipblasGetFloat32Mode, hipblasSetFloat32Mode);
+        return status;
+    }
+}
+
+hipblas_thread_streams::~hipblas_thread_streams()
+{
+    for(hipblasHandle_t thread_handle : handles)
+        (void)hipblasDestroy(thread_handle);
+}
+
+hipblasHandle_t hipblas_thread_handle(hipblasHandle_t handle)
+{
+    // hipBLAS calling itself outside of an entry point keeps its handle
+    if(!handle || hipblas_deferred_internal)
+        return handle;
+    thread_binding* binding = find_binding(handle);
+    return binding ? binding->thread_handle : handle;
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasSetThreadStream(hipblasHandle_t handle, hipStream_t stream)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(thread_binding* binding = find_binding(handle))
+        return hipblasSetStream(binding->thread_handle, stream);
+
+    hipblasHandle_t thread_handle = nullptr;
+    hipblasStatus_t status        = hipblasCreate(&thread_handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    {
+        // Reading the settings must not flush the calls queued on the handle
+        // by the threads using it
+        hipblas_internal_call_guard guard;
+        if((status = copy_settings(handle, thread_handle)) != HIPBLAS_STATUS_SUCCESS
+           || (status = hipblasSetStream(thread_handle, stream)) != HIPBLAS_STATUS_SUCCESS)
+        {
+            (void)hipblasDestroy(thread_handle);
+            return status;
+        }
+    }
+
+    std::shared_ptr<hipblas_thread_streams> owner;
+    {
+        std::lock_guard<std::mutex> lock(binding_mutex);
+        hipblas_handle_state&       state = hipblas_get_handle_state(handle);
+        if(!state.thread_streams)
+        {
+            state.thread_streams = std::make_shared<hipblas_thread_streams>();
+            hipblas_thread_stream_handles++;
+        }
+        owner = state.thread_streams;
+    }
+    {
+        std::lock_guard<std::mutex> lock(owner->mutex);
+        owner->handles.push_back(thread_handle);
+    }
+    thread_bindings.push_back({handle, owner, thread_handle});
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasClearThreadStream(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    thread_binding* binding = find_binding(handle);
+    if(!binding)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasHandle_t                         thread_handle = binding->thread_handle;
+    std::shared_ptr<hipblas_thread_streams> owner         = binding->owner.lock();
+    thread_bindings.erase(thread_bindings.begin() + (binding - thread_bindings.data()));
+    if(!owner)
+        return HIPBLAS_STATUS_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(owner->mutex);
+        auto&                       handles = owner->handles;
+        handles.erase(std::remove(handles.begin(), handles.end(), thread_handle), handles.end());
+    }
+    return hipblasDestroy(thread_handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "workspace.hpp"
+#include "handle_state.hpp"
+#include <algorithm>
+
+namespace
+{
+    // Scopes start on 256-byte boundaries; the memory grows in 1 MiB steps
+    constexpr size_t scope_alignment = 256;
+    constexpr size_t growth_step     = size_t(1) << 20;
+
+    size_t round_up(size_t bytes, size_t step)
+    {
+        return (bytes + step - 1) / step * step;
+    }
+}
+
+hipblas_workspace::~hipblas_workspace()
+{
+    for(void* p : retired)
+        (void)hipFree(p);
+    (void)hipFree(memory);
+    if(event)
+        (void)hipEventDestroy(event);
+}
+
+hipblas_workspace_scope::hipblas_workspace_scope(hipblasHandle_t handle, size_t bytes)
+{
+    if(handle == nullptr)
+    {
+        result = HIPBLAS_STATUS_NOT_INITIALIZED;
+        return;
+    }
+    result = hipblasGetStream(handle, &stream);
+    if(result != HIPBLAS_STATUS_SUCCESS || !bytes)
+        return;
+
+    hipblas_workspace& ws    = hipblas_get_handle_state(handle).workspace;
+    size_t             taken = round_up(bytes, scope_alignment);
+
+    if(ws.used)
+    {
+        // Nested in a scope whose work is not yet ordered by the event, so only
+        // memory on the same stream can follow it
+        if(stream == ws.stream && ws.used + taken <= ws.size)
+        {
+            offset = ws.used;
+            memory = static_cast<char*>(ws.memory) + offset;
+            ws.used += taken;
+        }
+        else if(hipMalloc(&memory, bytes) == hipSuccess)
+        {
+            owned     = true;
+            ws.wanted = std::max(ws.wanted, ws.used + taken);
+        }
+        else
+        {
+            memory = nullptr;
+            result = HIPBLAS_STATUS_ALLOC_FAILED;
+            return;
+        }
+        workspace = &ws;
+        return;
+    }
+
+    size_t needed = std::max(taken, ws.wanted);
+    if(needed > ws.size || !ws.retired.empty())
+    {
+        // hipFree waits for the device, so no earlier work still uses the memory
+        for(void* p : ws.retired)
+            (void)hipFree(p);
+        ws.retired.clear();
+        ws.wanted = 0;
+        if(needed > ws.size)
+        {
+            (void)hipFree(ws.memory);
+            ws.memory   = nullptr;
+            ws.size     = 0;
+            size_t size = round_up(needed, growth_step);
+            if(hipMalloc(&ws.memory, size) != hipSuccess)
+            {
+                ws.memory = nullptr;
+                result    = HIPBLAS_STATUS_ALLOC_FAILED;
+                return;
+            }
+            ws.size = size;
+        }
+    }
+    else if(ws.event && ws.stream != stream
+            && hipStreamWaitEvent(stream, ws.event, 0) != hipSuccess)
+    {
+        result = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return;
+    }
+
+    ws.stream = stream;
+    ws.used   = taken;
+    memory    = ws.memory;
+    workspace = &ws;
+}
+
+hipblas_workspace_scope::~hipblas_workspace_scope()
+{
+    if(!workspace)
+        return;
+    if(owned)
+    {
+        workspace->retired.push_back(memory);
+        return;
+    }
+
+    workspace->used = offset;
+    if(offset)
+        return;
+
+    // The next user on another stream waits for this event. Without one the
+    // work is waited for here.
+    if(!workspace->event
+       && hipEventCreateWithFlags(&workspace->event, hipEventDisableTiming) != hipSuccess)
+        workspace->event = nullptr;
+    if(!workspace->event || hipEventRecord(workspace->event, stream) != hipSuccess)
+        (void)hipStreamSynchronize(stream);
+}
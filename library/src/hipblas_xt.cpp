@@ -0,0 +1,728 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "deferred.hpp"
+#include "exceptions.hpp"
+#include "logging.hpp"
+#include "out_of_core.hpp"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#endif
+
+// Devices selected for a hipblasXtHandle_t, each with its own hipBLAS handle
+struct hipblasXtContext
+{
+    std::vector<int>             devices;
+    std::vector<hipblasHandle_t> handles;
+    int                          block_dim = 0; // 0 chooses from the free device memory
+
+    // Host BLAS share, indexed by hipblasXtBlasOp_t and hipblasXtOpType_t
+    float cpu_ratio[3][4]   = {};
+    void* cpu_routine[3][4] = {};
+    float cpu_share[3][4]; // measured host share of the last call, < 0 before the first
+
+    hipblasXtContext()
+    {
+        std::fill(&cpu_share[0][0], &cpu_share[0][0] + 12, -1.0f);
+    }
+
+    void release()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            device = -1;
+        for(size_t i = 0; i < handles.size(); i++)
+        {
+            (void)hipSetDevice(devices[i]);
+            (void)hipblasDestroy(handles[i]);
+        }
+        if(device >= 0)
+            (void)hipSetDevice(device);
+        devices.clear();
+        handles.clear();
+    }
+
+    ~hipblasXtContext()
+    {
+        release();
+    }
+};
+
+namespace
+{
+    template <typename T>
+    constexpr hipblasXtOpType_t xt_type = HIPBLAS_XT_FLOAT;
+    template <>
+    constexpr hipblasXtOpType_t xt_type<double> = HIPBLAS_XT_DOUBLE;
+    template <>
+    constexpr hipblasXtOpType_t xt_type<hipblasComplex> = HIPBLAS_XT_COMPLEX;
+    template <>
+    constexpr hipblasXtOpType_t xt_type<hipblasDoubleComplex> = HIPBLAS_XT_DOUBLECOMPLEX;
+
+    // cblas_<x><routine> from the library named by HIPBLAS_XT_CPU_BLAS when it
+    // is set, otherwise already loaded in the process, for example by the
+    // application, or from the first host BLAS library found. Routines the
+    // library lacks stay null.
+    struct xt_cpu_blas
+    {
+        void* routines[3][4] = {};
+
+        xt_cpu_blas()
+        {
+#ifndef _WIN32
+            const char* env = getenv("HIPBLAS_XT_CPU_BLAS");
+            if(env)
+            {
+                lookup(dlopen(env, RTLD_NOW | RTLD_LOCAL));
+                return;
+            }
+            if(lookup(RTLD_DEFAULT))
+                return;
+            static const char* const libraries[] = {"libcblas.so.3",
+                                                    "libcblas.so",
+                                                    "libblis.so.4",
+                                                    "libblis.so",
+                                                    "libopenblas.so.0",
+                                                    "libopenblas.so"};
+            for(const char* lib : libraries)
+                if(lookup(dlopen(lib, RTLD_NOW | RTLD_LOCAL)))
+                    return;
+#endif
+        }
+
+        bool lookup(void* so)
+        {
+#ifndef _WIN32
+            static const char* const names[3][4]
+                = {{"cblas_sgemm", "cblas_dgemm", "cblas_cgemm", "cblas_zgemm"},
+                   {"cblas_ssyrk", "cblas_dsyrk", "cblas_csyrk", "cblas_zsyrk"},
+                   {"cblas_strsm", "cblas_dtrsm", "cblas_ctrsm", "cblas_ztrsm"}};
+            if(!so)
+                return false;
+            for(int op = 0; op < 3; op++)
+                for(int type = 0; type < 4; type++)
+                    routines[op][type] = dlsym(so, names[op][type]);
+#endif
+            return routines[HIPBLAS_XT_GEMM][HIPBLAS_XT_FLOAT] != nullptr;
+        }
+    };
+
+    void* xt_cpu_routine(hipblasXtHandle_t xt, hipblasXtBlasOp_t op, hipblasXtOpType_t type)
+    {
+        static const xt_cpu_blas cpu_blas;
+        return xt->cpu_routine[op][type] ? xt->cpu_routine[op][type]
+                                         : cpu_blas.routines[op][type];
+    }
+
+    // Blocks are taken from the start of the result by the devices and from
+    // the end by the host, up to host_quota of them
+    struct xt_schedule
+    {
+        std::mutex mutex;
+        int        front = 0, back, host_quota, host_taken = 0;
+
+        xt_schedule(int jobs, int quota)
+            : back(jobs)
+            , host_quota(quota)
+        {
+        }
+
+        int next_device(int jobs)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return front < back ? front++ : jobs;
+        }
+
+        int next_host()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if(front >= back || host_taken >= host_quota)
+                return -1;
+            host_taken++;
+            return --back;
+        }
+
+        // Stop handing out blocks, the result is lost anyway
+        void cancel()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            front = back;
+        }
+    };
+
+    // Share the jobs of a problem between the selected devices, one host
+    // thread per device, and optionally the host BLAS. Each thread takes the
+    // next job index as soon as it has issued the previous one, so faster
+    // devices take more tiles.
+    template <typename T, typename Problem>
+    hipblasStatus_t xt_run(hipblasXtHandle_t xt, Problem problem)
+    {
+        if(xt == nullptr || xt->handles.empty())
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        OOC_RETURN_IF_ERROR(problem.check());
+
+        int tile = xt->block_dim;
+        if(tile <= 0)
+        {
+            // The same tiles on every device, so they fit the smallest one
+            int device;
+            OOC_RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+            tile = 0;
+            for(int d : xt->devices)
+            {
+                int device_tile;
+                OOC_RETURN_IF_HIP_ERROR(hipSetDevice(d));
+                hipblasStatus_t status = ooc_tile_size<T>(device_tile);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                {
+                    (void)hipSetDevice(device);
+                    return status;
+                }
+                tile = tile ? std::min(tile, device_tile) : device_tile;
+            }
+            OOC_RETURN_IF_HIP_ERROR(hipSetDevice(device));
+        }
+        tile     = std::max(1, std::min(tile, problem.max_dim()));
+        int jobs = problem.plan(tile);
+        if(!jobs)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        constexpr hipblasXtBlasOp_t op    = Problem::xt_op;
+        constexpr hipblasXtOpType_t type  = xt_type<T>;
+        float                       ratio = xt->cpu_ratio[op][type];
+        ooc_cblas<T>                cblas;
+        if(ratio != 0 && problem.host_resident())
+        {
+            cblas.gemm = xt_cpu_routine(xt, HIPBLAS_XT_GEMM, type);
+            cblas.syrk = xt_cpu_routine(xt, HIPBLAS_XT_SYRK, type);
+            cblas.trsm = xt_cpu_routine(xt, HIPBLAS_XT_TRSM, type);
+        }
+
+        // Decided before any block is handed out, so that the devices never
+        // stop short of blocks the host cannot compute
+        if(!problem.host_routines(cblas))
+            ratio = 0;
+
+        // Automatic: the host share measured in the previous calls, or no
+        // limit the first time so that the host rate can be measured
+        float share = xt->cpu_share[op][type];
+        int   quota = 0;
+        if(ratio > 0)
+            quota = int(ratio * jobs + 0.5f);
+        else if(ratio < 0)
+            quota = share < 0 ? jobs : int(share * jobs);
+
+        using clock = std::chrono::steady_clock;
+        xt_schedule                  schedule(jobs, quota);
+        std::vector<hipblasStatus_t> status(xt->devices.size(), HIPBLAS_STATUS_SUCCESS);
+        std::vector<std::thread>     workers;
+        std::atomic<int>             device_jobs{0};
+        std::atomic<int64_t>         device_end{0}; // clock ticks since start
+        auto                         start = clock::now();
+        for(size_t i = 0; i < xt->devices.size(); i++)
+            workers.emplace_back([&, i] {
+                try
+                {
+                    hipblas_internal_call_guard internal;
+                    status[i] = ooc_status(hipSetDevice(xt->devices[i]));
+                    if(status[i] == HIPBLAS_STATUS_SUCCESS)
+                        status[i] = ooc_run_jobs<T>(xt->handles[i], problem, jobs, tile, [&] {
+                            int job = schedule.next_device(jobs);
+                            if(job < jobs)
+                                device_jobs++;
+                            return job;
+                        });
+                }
+                catch(...)
+                {
+                    status[i] = exception_to_hipblas_status();
+                }
+
+                if(status[i] != HIPBLAS_STATUS_SUCCESS)
+                    schedule.cancel();
+                int64_t end = (clock::now() - start).count();
+                for(int64_t seen = device_end; seen < end;)
+                    if(device_end.compare_exchange_weak(seen, end))
+                        break;
+            });
+
+        // The calling thread computes the host share
+        int host_jobs = 0;
+        if(quota > 0)
+            for(int job; (job = schedule.next_host()) >= 0; host_jobs++)
+                problem.run_host(cblas, job);
+        int64_t host_end = (clock::now() - start).count();
+
+        for(auto& worker : workers)
+            worker.join();
+
+        for(hipblasStatus_t s : status)
+            if(s != HIPBLAS_STATUS_SUCCESS)
+                return s;
+
+        // Share giving both sides the same time at the measured rates
+        if(ratio < 0 && host_jobs && device_jobs)
+        {
+            double host_rate        = host_jobs / double(host_end);
+            double device_rate      = device_jobs / double(device_end);
+            xt->cpu_share[op][type] = float(host_rate / (host_rate + device_rate));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+extern "C" {
+
+hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *handle = new hipblasXtContext;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    delete handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle, int nbDevices, const int* deviceId)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    int count;
+    OOC_RETURN_IF_HIP_ERROR(hipGetDeviceCount(&count));
+    if(nbDevices <= 0 || deviceId == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    for(int i = 0; i < nbDevices; i++)
+        if(deviceId[i] < 0 || deviceId[i] >= count
+           || std::find(deviceId, deviceId + i, deviceId[i]) != deviceId + i)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    handle->release();
+    int device;
+    OOC_RETURN_IF_HIP_ERROR(hipGetDevice(&device));
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < nbDevices && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        hipblasHandle_t device_handle;
+        status = ooc_status(hipSetDevice(deviceId[i]));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasCreate(&device_handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+        handle->devices.push_back(deviceId[i]);
+        handle->handles.push_back(device_handle);
+
+        // Tiles of peer-resident matrices are then copied directly, where the
+        // devices allow it
+        for(int j = 0; j < nbDevices; j++)
+        {
+            int can_access = 0;
+            if(j != i && hipDeviceCanAccessPeer(&can_access, deviceId[i], deviceId[j]) == hipSuccess
+               && can_access)
+                (void)hipDeviceEnablePeerAccess(deviceId[j], 0);
+        }
+    }
+    (void)hipSetDevice(device);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        handle->release();
+    return status;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle, int blockDim)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    handle->block_dim = blockDim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle, int* blockDim)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blockDim == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *blockDim = handle->block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSetCpuRatio(hipblasXtHandle_t handle,
+                                     hipblasXtBlasOp_t blasOp,
+                                     hipblasXtOpType_t type,
+                                     float             ratio)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blasOp < HIPBLAS_XT_GEMM || blasOp > HIPBLAS_XT_TRSM || type < HIPBLAS_XT_FLOAT
+       || type > HIPBLAS_XT_DOUBLECOMPLEX || !(ratio <= 1))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    handle->cpu_ratio[blasOp][type] = ratio;
+    handle->cpu_share[blasOp][type] = -1;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSetCpuRoutine(hipblasXtHandle_t handle,
+                                       hipblasXtBlasOp_t blasOp,
+                                       hipblasXtOpType_t type,
+                                       void*             blasFunctor)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(blasOp < HIPBLAS_XT_GEMM || blasOp > HIPBLAS_XT_TRSM || type < HIPBLAS_XT_FLOAT
+       || type > HIPBLAS_XT_DOUBLECOMPLEX)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    handle->cpu_routine[blasOp][type] = blasFunctor;
+    handle->cpu_share[blasOp][type]   = -1;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       B,
+                               int                ldb,
+                               const float*       beta,
+                               float*             C,
+                               int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<float>(
+        handle, ooc_gemm<float>{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      B,
+                               int                ldb,
+                               const double*      beta,
+                               double*            C,
+                               int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<double>(
+        handle, ooc_gemm<double>{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               int                   m,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* B,
+                               int                   ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    ooc_gemm<hipblasComplex> problem{transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc};
+    return xt_run<hipblasComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               int                         m,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* B,
+                               int                         ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    ooc_gemm<hipblasDoubleComplex> problem{
+        transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc};
+    return xt_run<hipblasDoubleComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       beta,
+                               float*             C,
+                               int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<float>(handle, ooc_syrk<float>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int                n,
+                               int                k,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      beta,
+                               double*            C,
+                               int                ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<double>(
+        handle, ooc_syrk<double>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<hipblasComplex>(
+        handle, ooc_syrk<hipblasComplex>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<hipblasDoubleComplex>(
+        handle, ooc_syrk<hipblasDoubleComplex>{uplo, transA, n, k, alpha, A, lda, beta, C, ldc});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               float*             B,
+                               int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<float>(
+        handle, ooc_trsm<float>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               double*            B,
+                               int                ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<double>(
+        handle, ooc_trsm<double>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                               hipblasSideMode_t     side,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               hipblasDiagType_t     diag,
+                               int                   m,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               hipblasComplex*       B,
+                               int                   ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    return xt_run<hipblasComplex>(
+        handle, ooc_trsm<hipblasComplex>{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb});
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                               hipblasSideMode_t           side,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               hipblasDiagType_t           diag,
+                               int                         m,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               hipblasDoubleComplex*       B,
+                               int                         ldb)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    ooc_trsm<hipblasDoubleComplex> problem{side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb};
+    return xt_run<hipblasDoubleComplex>(handle, problem);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
@@ -0,0 +1,1044 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "functions.hpp"
+#include "gemmt.hpp"
+#include "hipblas.h"
+#include "workspace.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Per-batch scalars: alpha and beta are arrays of batch_count values, on the
+// host or the device as the pointer mode says. The scaling is folded into
+// backend calls covering the whole batch, so the number of calls does not grow
+// with batch_count: the product or input is scaled with dgmm, by diag(alpha)
+// across the members of a strided batch or by a diagonal broadcast from each
+// member's scalar with dgmmBatched for pointer arrays, and added to the scaled
+// C with geam. Scalars are read on the device only; host scalars that are all
+// equal take the ordinary single call. The intermediates live in the handle's
+// workspace, so the calls neither allocate nor wait for the device. Backends
+// without dgmmBatched or geamBatched take those one member at a time.
+//
+// Where beta_i is zero C_i is not read, as in the ordinary calls: with host
+// scalars those members are cleared first with one geam of zero scalars, which
+// reads neither operand. Device scalars cannot be told apart without reading
+// them back, so the GEMMs with device scalars run member by member through the
+// ordinary call, which skips C_i itself; their number of calls grows with
+// batch_count.
+
+// The scalars of one call with the caller's pointer mode and stream. beta is
+// null for the routines without one.
+struct batch_scalars
+{
+    hipblasHandle_t      handle;
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    size_t               size; // bytes per scalar
+    int                  count;
+    const void*          alpha;
+    const void*          beta;
+    std::vector<char>    copy; // of device scalars, by batch_scalars_read
+
+    bool on_host() const
+    {
+        return pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+    }
+
+    const void* alpha_at(int i) const
+    {
+        return static_cast<const char*>(alpha) + i * size;
+    }
+
+    const void* beta_at(int i) const
+    {
+        return beta ? static_cast<const char*>(beta) + i * size : nullptr;
+    }
+
+    // Whether the scalars are on the host and every member of s has value, or
+    // the first member's value when value is null. An absent beta trivially
+    // qualifies.
+    bool all(const void* s, const void* value = nullptr) const
+    {
+        if(!s)
+            return true;
+        if(!on_host())
+            return false;
+        auto first = static_cast<const char*>(s);
+        for(int i = 0; i < count; i++)
+            if(memcmp(value ? value : first, first + i * size, size))
+                return false;
+        return true;
+    }
+
+    bool uniform() const
+    {
+        return all(alpha) && all(beta);
+    }
+
+    // Whether the scalars are on the host and some member of s has value
+    bool any(const void* s, const void* value) const
+    {
+        if(!s || !on_host())
+            return false;
+        auto first = static_cast<const char*>(s);
+        for(int i = 0; i < count; i++)
+            if(!memcmp(value, first + i * size, size))
+                return true;
+        return false;
+    }
+};
+
+// The scalars of a call to handle, count of size bytes each
+hipblasStatus_t batch_scalars_get(hipblasHandle_t handle,
+                                  const void*     alpha,
+                                  const void*     beta,
+                                  size_t          size,
+                                  int             count,
+                                  batch_scalars&  s);
+
+// The same with the scalars on the host, for the routines that derive other
+// scalars from them: device scalars are copied to the host, which waits for the
+// stream, and alpha and beta point at the copy
+hipblasStatus_t batch_scalars_read(hipblasHandle_t handle,
+                                   const void*     alpha,
+                                   const void*     beta,
+                                   size_t          size,
+                                   int             count,
+                                   batch_scalars&  s);
+
+// Host copy of a device array of count pointers, which waits for the stream
+hipblasStatus_t batch_scalars_pointers(const batch_scalars&      s,
+                                       const void* const*        array,
+                                       std::vector<const void*>& host);
+
+// Offsets of the consecutive parts of a workspace, each on a 16-byte boundary
+struct batch_scalars_layout
+{
+    size_t bytes = 0;
+
+    size_t add(size_t part)
+    {
+        size_t offset = bytes;
+        bytes += (part + 15) / 16 * 16;
+        return offset;
+    }
+};
+
+template <typename T>
+T* batch_scalars_part(void* workspace, size_t offset)
+{
+    return reinterpret_cast<T*>(static_cast<char*>(workspace) + offset);
+}
+
+// Run body(W) in host pointer mode, or in mode, with w_bytes of the handle's
+// workspace, restoring the pointer mode
+template <typename Body>
+hipblasStatus_t batch_scalars_run(const batch_scalars& s,
+                                  size_t               w_bytes,
+                                  Body                 body,
+                                  hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_HOST)
+{
+    hipblas_workspace_scope scope(s.handle, w_bytes);
+    if(scope.status() != HIPBLAS_STATUS_SUCCESS)
+        return scope.status();
+
+    hipblasStatus_t status = hipblasSetPointerMode(s.handle, mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = body(scope.data());
+    hipblasStatus_t restore = hipblasSetPointerMode(s.handle, s.pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = restore;
+    return status;
+}
+
+// Device array of the count pointers base + i*stride, written to d
+template <typename T>
+hipblasStatus_t
+    batch_scalars_upload_pointers(const batch_scalars& s, T* base, hipblasStride stride, T** d)
+{
+    std::vector<T*> host(s.count);
+    for(int i = 0; i < s.count; i++)
+        host[i] = base + i * stride;
+    if(hipMemcpyAsync(d, host.data(), s.count * sizeof(T*), hipMemcpyHostToDevice, s.stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The scalars as a device array: the caller's in device pointer mode, or a
+// copy to d otherwise
+template <typename T>
+const T* batch_scalars_device(const batch_scalars& s, const T* given, T* d, hipblasStatus_t& status)
+{
+    if(!s.on_host())
+        return given;
+    if(hipMemcpyAsync(d, given, s.count * sizeof(T), hipMemcpyHostToDevice, s.stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return d;
+}
+
+// Workspace of batch_scalars_dgmm_batched for members of rows rows
+template <typename T>
+size_t batch_scalars_diag_bytes(int rows, int count)
+{
+    batch_scalars_layout layout;
+    layout.add(count * sizeof(T*));
+    if(rows > 1)
+    {
+        layout.add(rows * sizeof(T));
+        layout.add(size_t(rows) * count * sizeof(T));
+    }
+    return layout.bytes;
+}
+
+// Y_j = X_j * diag(d) for the count column blocks X_j = X + j*xs and
+// Y_j = Y + j*ys, each rows by batch_count
+template <typename T>
+hipblasStatus_t batch_scalars_dgmm(hipblasHandle_t handle,
+                                   int             rows,
+                                   int             batch_count,
+                                   const T*        X,
+                                   int             ldx,
+                                   hipblasStride   xs,
+                                   const T*        d,
+                                   T*              Y,
+                                   int             ldy,
+                                   hipblasStride   ys,
+                                   int             count)
+{
+    using F                = hipblas_functions<T>;
+    hipblasStatus_t status = F::dgmm_strided_batched(
+        handle, HIPBLAS_SIDE_RIGHT, rows, batch_count, X, ldx, xs, d, 1, 0, Y, ldy, ys, count);
+
+    // Backends without the batched form take one block at a time
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        status = HIPBLAS_STATUS_SUCCESS;
+        for(int j = 0; j < count && status == HIPBLAS_STATUS_SUCCESS; j++)
+            status = F::dgmm(handle,
+                             HIPBLAS_SIDE_RIGHT,
+                             rows,
+                             batch_count,
+                             X + j * xs,
+                             ldx,
+                             d,
+                             1,
+                             Y + j * ys,
+                             ldy);
+    }
+    return status;
+}
+
+// Y_j = a*Y_j + b*X_j for the count column blocks, as batch_scalars_dgmm
+template <typename T>
+hipblasStatus_t batch_scalars_geam(hipblasHandle_t handle,
+                                   int             rows,
+                                   int             batch_count,
+                                   const T&        a,
+                                   T*              Y,
+                                   int             ldy,
+                                   hipblasStride   ys,
+                                   const T&        b,
+                                   const T*        X,
+                                   int             ldx,
+                                   hipblasStride   xs,
+                                   int             count)
+{
+    using F                = hipblas_functions<T>;
+    hipblasStatus_t status = F::geam_strided_batched(handle,
+                                                     HIPBLAS_OP_N,
+                                                     HIPBLAS_OP_N,
+                                                     rows,
+                                                     batch_count,
+                                                     &a,
+                                                     Y,
+                                                     ldy,
+                                                     ys,
+                                                     &b,
+                                                     X,
+                                                     ldx,
+                                                     xs,
+                                                     Y,
+                                                     ldy,
+                                                     ys,
+                                                     count);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        status = HIPBLAS_STATUS_SUCCESS;
+        for(int j = 0; j < count && status == HIPBLAS_STATUS_SUCCESS; j++)
+            status = F::geam(handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             rows,
+                             batch_count,
+                             &a,
+                             Y + j * ys,
+                             ldy,
+                             &b,
+                             X + j * xs,
+                             ldx,
+                             Y + j * ys,
+                             ldy);
+    }
+    return status;
+}
+
+// Y_i = diag(d_i)*X_i for the rows by cols members of pointer arrays, d_i
+// holding the member's scalar s_i on each row. The d_i are broadcast from the
+// scalars with one k = 1 GEMM against a column of ones, in the diag part of
+// the workspace of batch_scalars_diag_bytes bytes.
+template <typename T>
+hipblasStatus_t batch_scalars_dgmm_batched(const batch_scalars& s,
+                                           int                  rows,
+                                           int                  cols,
+                                           const T* const       X[],
+                                           int                  ldx,
+                                           const T*             d_s,
+                                           T* const             Y[],
+                                           int                  ldy,
+                                           void*                diag)
+{
+    using F = hipblas_functions<T>;
+    int                  count = s.count;
+    batch_scalars_layout layout;
+    T**                  D_ptrs = batch_scalars_part<T*>(diag, layout.add(count * sizeof(T*)));
+    const T*             D      = d_s;
+    hipblasStatus_t      status = HIPBLAS_STATUS_SUCCESS;
+    if(rows > 1)
+    {
+        const T one  = gemmt_real_scalar<T>(1);
+        const T zero = gemmt_real_scalar<T>(0);
+        T*      ones = batch_scalars_part<T>(diag, layout.add(rows * sizeof(T)));
+        T*      B    = batch_scalars_part<T>(diag, layout.add(size_t(rows) * count * sizeof(T)));
+
+        std::vector<T> host(rows, one);
+        if(hipMemcpyAsync(ones, host.data(), rows * sizeof(T), hipMemcpyHostToDevice, s.stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        status = F::gemm(s.handle,
+                         HIPBLAS_OP_N,
+                         HIPBLAS_OP_N,
+                         rows,
+                         count,
+                         1,
+                         &one,
+                         ones,
+                         rows,
+                         d_s,
+                         1,
+                         &zero,
+                         B,
+                         rows);
+        D = B;
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = batch_scalars_upload_pointers(s, const_cast<T*>(D), rows, D_ptrs);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = F::dgmm_batched(
+            s.handle, HIPBLAS_SIDE_LEFT, rows, cols, X, ldx, D_ptrs, 1, Y, ldy, count);
+
+    // Backends without the batched form take one member at a time
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        std::vector<const void*> x, y;
+        status = batch_scalars_pointers(s, (const void* const*)X, x);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_pointers(s, (const void* const*)Y, y);
+        for(int i = 0; i < count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::dgmm(s.handle,
+                             HIPBLAS_SIDE_LEFT,
+                             rows,
+                             cols,
+                             (const T*)x[i],
+                             ldx,
+                             D + i * rows,
+                             1,
+                             (T*)y[i],
+                             ldy);
+    }
+    return status;
+}
+
+// Z_i = a*Y_i + b*X_i for the rows by cols members of pointer arrays
+template <typename T>
+hipblasStatus_t batch_scalars_geam_batched(const batch_scalars& s,
+                                           int                  rows,
+                                           int                  cols,
+                                           const T&             a,
+                                           const T* const       Y[],
+                                           int                  ldy,
+                                           const T&             b,
+                                           const T* const       X[],
+                                           int                  ldx,
+                                           T* const             Z[],
+                                           int                  ldz)
+{
+    using F                = hipblas_functions<T>;
+    hipblasStatus_t status = F::geam_batched(
+        s.handle, HIPBLAS_OP_N, HIPBLAS_OP_N, rows, cols, &a, Y, ldy, &b, X, ldx, Z, ldz, s.count);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        std::vector<const void*> x, y, z;
+        status = batch_scalars_pointers(s, (const void* const*)X, x);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_pointers(s, (const void* const*)Y, y);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_pointers(s, (const void* const*)Z, z);
+        for(int i = 0; i < s.count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::geam(s.handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             rows,
+                             cols,
+                             &a,
+                             (const T*)y[i],
+                             ldy,
+                             &b,
+                             (const T*)x[i],
+                             ldx,
+                             (T*)z[i],
+                             ldz);
+    }
+    return status;
+}
+
+// Zero the rows by cols members X + i*stride whose beta_i is zero on the host,
+// with one geam of zero scalars over a device array of their pointers in ptrs
+template <typename T>
+hipblasStatus_t batch_scalars_clear(
+    const batch_scalars& s, int rows, int cols, T* X, int ldx, hipblasStride stride, T** ptrs)
+{
+    using F         = hipblas_functions<T>;
+    const T zero    = gemmt_real_scalar<T>(0);
+    std::vector<T*> host;
+    for(int i = 0; i < s.count; i++)
+        if(!memcmp(s.beta_at(i), &zero, sizeof(T)))
+            host.push_back(X + i * stride);
+    if(host.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(hipMemcpyAsync(ptrs, host.data(), host.size() * sizeof(T*), hipMemcpyHostToDevice, s.stream)
+       != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    hipblasStatus_t status = F::geam_batched(s.handle,
+                                             HIPBLAS_OP_N,
+                                             HIPBLAS_OP_N,
+                                             rows,
+                                             cols,
+                                             &zero,
+                                             ptrs,
+                                             ldx,
+                                             &zero,
+                                             ptrs,
+                                             ldx,
+                                             ptrs,
+                                             ldx,
+                                             int(host.size()));
+
+    // Backends without the batched form take one member at a time
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t i = 0; i < host.size() && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::geam(s.handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             rows,
+                             cols,
+                             &zero,
+                             host[i],
+                             ldx,
+                             &zero,
+                             host[i],
+                             ldx,
+                             host[i],
+                             ldx);
+    }
+    return status;
+}
+
+hipblasStatus_t batch_scalars_check_gemm(hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         int                lda,
+                                         int                ldb,
+                                         const void*        beta,
+                                         int                ldc,
+                                         int                batch_count);
+
+// C_i = alpha_i*P_i + beta_i*C_i for a strided batch of m by n matrices, the
+// scalars being of type T. product(Y, ldy, stride_y) writes the products
+// P_i = op(A_i)*op(B_i) to Y in host pointer mode, and member(i) makes the
+// ordinary call of member i in the caller's pointer mode for device scalars
+// and for the layouts beyond the int leading dimensions of dgmm and geam.
+template <typename T, typename Product, typename Member>
+hipblasStatus_t batch_scalars_combine_strided(const batch_scalars& s,
+                                              int                  m,
+                                              int                  n,
+                                              T*                   C,
+                                              int                  ldc,
+                                              hipblasStride        stride_c,
+                                              Product              product,
+                                              Member               member)
+{
+    // Each column of C across the batch is one rows by count matrix, or the
+    // whole of C is when its columns are packed
+    int           count    = s.count;
+    bool          whole    = ldc == m && int64_t(m) * n <= INT_MAX;
+    int           rows     = whole ? m * n : m;
+    int           columns  = whole ? 1 : n;
+    hipblasStride w_stride = hipblasStride(m) * n;
+    hipblasStride c_ld     = count > 1 ? stride_c : std::max(stride_c, hipblasStride(rows));
+    if(!s.on_host() || c_ld > INT_MAX || w_stride > INT_MAX)
+    {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int i = 0; i < count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = member(i);
+        return status;
+    }
+
+    // With beta all zero the product goes straight to C and is scaled there;
+    // otherwise it goes to W first
+    const T              one       = gemmt_real_scalar<T>(1);
+    const T              zero      = gemmt_real_scalar<T>(0);
+    bool                 beta_zero = s.all(s.beta, &zero);
+    bool                 clear     = !beta_zero && s.any(s.beta, &zero);
+    batch_scalars_layout layout;
+    size_t               scalars = layout.add(2 * count * sizeof(T));
+    size_t               w       = layout.add(beta_zero ? 0 : w_stride * count * sizeof(T));
+    size_t               ptrs    = layout.add(clear ? count * sizeof(T*) : 0);
+    return batch_scalars_run(s, layout.bytes, [&](void* workspace) {
+        T*              d       = batch_scalars_part<T>(workspace, scalars);
+        T*              W       = batch_scalars_part<T>(workspace, w);
+        hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha = batch_scalars_device(s, (const T*)s.alpha, d, status);
+        const T*        d_beta  = batch_scalars_device(s, (const T*)s.beta, d + count, status);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(beta_zero)
+        {
+            status = product(C, ldc, stride_c);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = batch_scalars_dgmm<T>(
+                    s.handle, rows, count, C, c_ld, ldc, d_alpha, C, c_ld, ldc, columns);
+            return status;
+        }
+
+        status = product(W, m, w_stride);
+        if(status == HIPBLAS_STATUS_SUCCESS && clear)
+            status = batch_scalars_clear<T>(
+                s, m, n, C, ldc, stride_c, batch_scalars_part<T*>(workspace, ptrs));
+
+        // A uniform alpha or beta on the host is applied by geam, the others by dgmm
+        const T* a = s.all(s.alpha) ? (const T*)s.alpha : &one;
+        const T* b = s.all(s.beta) ? (const T*)s.beta : &one;
+        if(status == HIPBLAS_STATUS_SUCCESS && a == &one)
+            status = batch_scalars_dgmm<T>(
+                s.handle, rows, count, W, w_stride, m, d_alpha, W, w_stride, m, columns);
+        if(status == HIPBLAS_STATUS_SUCCESS && b == &one)
+            status = batch_scalars_dgmm<T>(
+                s.handle, rows, count, C, c_ld, ldc, d_beta, C, c_ld, ldc, columns);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_geam<T>(
+                s.handle, rows, count, *b, C, c_ld, ldc, *a, W, w_stride, m, columns);
+        return status;
+    });
+}
+
+// C_i = alpha_i*P_i + beta_i*C_i for m by n members of a pointer array, the
+// scalars being of type T. product(Y, ldy) writes the products
+// P_i = op(A_i)*op(B_i) to the device pointer array Y in host pointer mode,
+// and member(i) makes the ordinary call of member i in the caller's pointer
+// mode for device scalars.
+template <typename T, typename Product, typename Member>
+hipblasStatus_t batch_scalars_combine_batched(
+    const batch_scalars& s, int m, int n, T* const C[], int ldc, Product product, Member member)
+{
+    int count = s.count;
+    if(!s.on_host())
+    {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int i = 0; i < count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = member(i);
+        return status;
+    }
+
+    // With beta all zero the product goes straight to C and is scaled there;
+    // otherwise it goes to the strided W first. Where some beta_i is zero C is
+    // copied to the strided V, whose members for a zero beta_i are cleared.
+    const T              one       = gemmt_real_scalar<T>(1);
+    const T              zero      = gemmt_real_scalar<T>(0);
+    bool                 beta_zero = s.all(s.beta, &zero);
+    bool                 clear     = !beta_zero && s.any(s.beta, &zero);
+    size_t               w_stride  = size_t(m) * n;
+    batch_scalars_layout layout;
+    size_t               scalars = layout.add(2 * count * sizeof(T));
+    size_t               w       = layout.add(beta_zero ? 0 : w_stride * count * sizeof(T));
+    size_t               w_ptrs  = layout.add(beta_zero ? 0 : count * sizeof(T*));
+    size_t               v       = layout.add(clear ? w_stride * count * sizeof(T) : 0);
+    size_t               v_ptrs  = layout.add(clear ? 2 * count * sizeof(T*) : 0);
+    size_t               diag    = layout.add(batch_scalars_diag_bytes<T>(m, count));
+    return batch_scalars_run(s, layout.bytes, [&](void* workspace) {
+        T*              d       = batch_scalars_part<T>(workspace, scalars);
+        T*              W       = batch_scalars_part<T>(workspace, w);
+        T**             Wp      = batch_scalars_part<T*>(workspace, w_ptrs);
+        T*              V       = batch_scalars_part<T>(workspace, v);
+        T**             Vp      = batch_scalars_part<T*>(workspace, v_ptrs);
+        void*           D       = batch_scalars_part<char>(workspace, diag);
+        hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha = batch_scalars_device(s, (const T*)s.alpha, d, status);
+        const T*        d_beta  = batch_scalars_device(s, (const T*)s.beta, d + count, status);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(beta_zero)
+        {
+            status = product(C, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = batch_scalars_dgmm_batched<T>(s, m, n, C, ldc, d_alpha, C, ldc, D);
+            return status;
+        }
+
+        // W is scaled as one strided batch, C (or V) member by member through
+        // its pointers, and the two are then added to C
+        status = batch_scalars_upload_pointers(s, W, hipblasStride(w_stride), Wp);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = product(Wp, m);
+        if(status == HIPBLAS_STATUS_SUCCESS && w_stride <= INT_MAX)
+            status = batch_scalars_dgmm<T>(s.handle,
+                                           int(w_stride),
+                                           count,
+                                           W,
+                                           int(w_stride),
+                                           0,
+                                           d_alpha,
+                                           W,
+                                           int(w_stride),
+                                           0,
+                                           1);
+        else if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm_batched<T>(s, m, n, Wp, m, d_alpha, Wp, m, D);
+        T* const* Cin  = C;
+        int       ldin = ldc;
+        if(clear)
+        {
+            Cin  = Vp;
+            ldin = m;
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = batch_scalars_upload_pointers(s, V, hipblasStride(w_stride), Vp);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = batch_scalars_geam_batched<T>(s, m, n, one, C, ldc, zero, C, ldc, Vp, m);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = batch_scalars_clear<T>(
+                    s, m, n, V, m, hipblasStride(w_stride), Vp + count);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm_batched<T>(s, m, n, Cin, ldin, d_beta, Cin, ldin, D);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_geam_batched<T>(s, m, n, one, Cin, ldin, one, Wp, m, C, ldc);
+        return status;
+    });
+}
+
+// C_i = alpha_i*op(A_i)*op(B_i) + beta_i*C_i for a strided batch
+template <typename T>
+hipblasStatus_t batch_scalars_gemm_strided(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T*           A,
+                                           int                lda,
+                                           hipblasStride      stride_a,
+                                           const T*           B,
+                                           int                ldb,
+                                           hipblasStride      stride_b,
+                                           const T*           beta,
+                                           T*                 C,
+                                           int                ldc,
+                                           hipblasStride      stride_c,
+                                           int                batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    hipblasStatus_t status = batch_scalars_check_gemm(
+        transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS && batch_count > 1 && stride_c < hipblasStride(ldc) * n)
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return status;
+
+    batch_scalars s;
+    status = batch_scalars_get(handle, alpha, beta, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::gemm_strided_batched(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       A,
+                                       lda,
+                                       stride_a,
+                                       B,
+                                       ldb,
+                                       stride_b,
+                                       beta,
+                                       C,
+                                       ldc,
+                                       stride_c,
+                                       batch_count);
+
+    return batch_scalars_combine_strided<T>(
+        s,
+        m,
+        n,
+        C,
+        ldc,
+        stride_c,
+        [&](T* Y, int ldy, hipblasStride stride_y) {
+            const T one  = gemmt_real_scalar<T>(1);
+            const T zero = gemmt_real_scalar<T>(0);
+            return F::gemm_strided_batched(handle,
+                                           transa,
+                                           transb,
+                                           m,
+                                           n,
+                                           k,
+                                           &one,
+                                           A,
+                                           lda,
+                                           stride_a,
+                                           B,
+                                           ldb,
+                                           stride_b,
+                                           &zero,
+                                           Y,
+                                           ldy,
+                                           stride_y,
+                                           batch_count);
+        },
+        [&](int i) {
+            return F::gemm(handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha + i,
+                           A + i * stride_a,
+                           lda,
+                           B + i * stride_b,
+                           ldb,
+                           beta + i,
+                           C + i * stride_c,
+                           ldc);
+        });
+}
+
+// C_i = alpha_i*op(A_i)*op(B_i) + beta_i*C_i for a batch of pointer arrays
+template <typename T>
+hipblasStatus_t batch_scalars_gemm_batched(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const T* const     B[],
+                                           int                ldb,
+                                           const T*           beta,
+                                           T* const           C[],
+                                           int                ldc,
+                                           int                batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    hipblasStatus_t status = batch_scalars_check_gemm(
+        transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return status;
+
+    batch_scalars s;
+    status = batch_scalars_get(handle, alpha, beta, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::gemm_batched(
+            handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+
+    return batch_scalars_combine_batched<T>(
+        s,
+        m,
+        n,
+        C,
+        ldc,
+        [&](T* const Y[], int ldy) {
+            const T one  = gemmt_real_scalar<T>(1);
+            const T zero = gemmt_real_scalar<T>(0);
+            return F::gemm_batched(
+                handle, transa, transb, m, n, k, &one, A, lda, B, ldb, &zero, Y, ldy, batch_count);
+        },
+        [&](int i) {
+            return F::gemm_batched(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha + i,
+                                   A + i,
+                                   lda,
+                                   B + i,
+                                   ldb,
+                                   beta + i,
+                                   C + i,
+                                   ldc,
+                                   1);
+        });
+}
+
+// y_i = alpha_i*x_i + y_i for a strided batch
+template <typename T>
+hipblasStatus_t batch_scalars_axpy_strided(hipblasHandle_t handle,
+                                           int             n,
+                                           const T*        alpha,
+                                           const T*        x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           T*              y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    batch_scalars   s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, nullptr, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::axpy_strided_batched(
+            handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
+
+    // With unit increments the batch is one n by batch_count matrix: W = X*diag(alpha)
+    // and Y = Y + W. Other layouts go member by member.
+    hipblasStride x_ld = batch_count > 1 ? stridex : std::max(stridex, hipblasStride(n));
+    hipblasStride y_ld = batch_count > 1 ? stridey : std::max(stridey, hipblasStride(n));
+    if(incx != 1 || incy != 1 || x_ld < n || y_ld < n || x_ld > INT_MAX || y_ld > INT_MAX)
+    {
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::axpy(handle, n, alpha + i, x + i * stridex, incx, y + i * stridey, incy);
+        return status;
+    }
+
+    batch_scalars_layout layout;
+    size_t               scalars = layout.add(s.on_host() ? batch_count * sizeof(T) : 0);
+    size_t               w       = layout.add(size_t(n) * batch_count * sizeof(T));
+    return batch_scalars_run(s, layout.bytes, [&](void* workspace) {
+        const T         one     = gemmt_real_scalar<T>(1);
+        T*              W       = batch_scalars_part<T>(workspace, w);
+        hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha = batch_scalars_device(
+            s, alpha, batch_scalars_part<T>(workspace, scalars), status);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm<T>(handle, n, batch_count, x, x_ld, 0, d_alpha, W, n, 0, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_geam<T>(
+                handle, n, batch_count, one, y, y_ld, 0, one, W, n, 0, 1);
+        return status;
+    });
+}
+
+// y_i = alpha_i*x_i + y_i for a batch of pointer arrays
+template <typename T>
+hipblasStatus_t batch_scalars_axpy_batched(hipblasHandle_t handle,
+                                           int             n,
+                                           const T*        alpha,
+                                           const T* const  x[],
+                                           int             incx,
+                                           T* const        y[],
+                                           int             incy,
+                                           int             batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    batch_scalars   s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, nullptr, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::axpy_batched(handle, n, alpha, x, incx, y, incy, batch_count);
+
+    // Each member is a 1 by n matrix with leading dimension inc: W_i = alpha_i*x_i
+    // and y_i = y_i + W_i. Non-positive increments go member by member.
+    if(incx <= 0 || incy <= 0)
+    {
+        std::vector<const void*> xs, ys;
+        status = batch_scalars_pointers(s, (const void* const*)x, xs);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_pointers(s, (const void* const*)y, ys);
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::axpy(handle, n, alpha + i, (const T*)xs[i], incx, (T*)ys[i], incy);
+        return status;
+    }
+
+    batch_scalars_layout layout;
+    size_t               scalars = layout.add(s.on_host() ? batch_count * sizeof(T) : 0);
+    size_t               w       = layout.add(size_t(n) * batch_count * sizeof(T));
+    size_t               w_ptrs  = layout.add(batch_count * sizeof(T*));
+    size_t               diag    = layout.add(batch_scalars_diag_bytes<T>(1, batch_count));
+    return batch_scalars_run(s, layout.bytes, [&](void* workspace) {
+        const T         one     = gemmt_real_scalar<T>(1);
+        T*              W       = batch_scalars_part<T>(workspace, w);
+        T**             Wp      = batch_scalars_part<T*>(workspace, w_ptrs);
+        hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha = batch_scalars_device(
+            s, alpha, batch_scalars_part<T>(workspace, scalars), status);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_upload_pointers(s, W, hipblasStride(n), Wp);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm_batched<T>(
+                s, 1, n, x, incx, d_alpha, Wp, 1, batch_scalars_part<char>(workspace, diag));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_geam_batched<T>(s, 1, n, one, y, incy, one, Wp, 1, y, incy);
+        return status;
+    });
+}
+
+// x_i = alpha_i*x_i for a strided batch
+template <typename T>
+hipblasStatus_t batch_scalars_scal_strided(hipblasHandle_t handle,
+                                           int             n,
+                                           const T*        alpha,
+                                           T*              x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           int             batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    batch_scalars   s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, nullptr, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::scal_strided_batched(handle, n, alpha, x, incx, stridex, batch_count);
+
+    // With a unit increment the batch is one n by batch_count matrix scaled
+    // in place by diag(alpha); other layouts go member by member
+    hipblasStride x_ld = batch_count > 1 ? stridex : std::max(stridex, hipblasStride(n));
+    if(incx != 1 || x_ld < n || x_ld > INT_MAX)
+    {
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = F::scal(handle, n, alpha + i, x + i * stridex, incx);
+        return status;
+    }
+
+    size_t w_bytes = s.on_host() ? batch_count * sizeof(T) : 0;
+    return batch_scalars_run(s, w_bytes, [&](void* workspace) {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha
+            = batch_scalars_device(s, alpha, static_cast<T*>(workspace), status);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm<T>(
+                handle, n, batch_count, x, x_ld, 0, d_alpha, x, x_ld, 0, 1);
+        return status;
+    });
+}
+
+// x_i = alpha_i*x_i for a batch of pointer arrays, each member a 1 by n
+// matrix with leading dimension incx scaled in place
+template <typename T>
+hipblasStatus_t batch_scalars_scal_batched(hipblasHandle_t handle,
+                                           int             n,
+                                           const T*        alpha,
+                                           T* const        x[],
+                                           int             incx,
+                                           int             batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    batch_scalars   s;
+    hipblasStatus_t status = batch_scalars_get(handle, alpha, nullptr, sizeof(T), batch_count, s);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.uniform())
+        return F::scal_batched(handle, n, alpha, x, incx, batch_count);
+
+    batch_scalars_layout layout;
+    size_t               scalars = layout.add(s.on_host() ? batch_count * sizeof(T) : 0);
+    size_t               diag    = layout.add(batch_scalars_diag_bytes<T>(1, batch_count));
+    return batch_scalars_run(s, layout.bytes, [&](void* workspace) {
+        hipblasStatus_t status  = HIPBLAS_STATUS_SUCCESS;
+        const T*        d_alpha = batch_scalars_device(
+            s, alpha, batch_scalars_part<T>(workspace, scalars), status);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = batch_scalars_dgmm_batched<T>(
+                s, 1, n, x, incx, d_alpha, x, incx, batch_scalars_part<char>(workspace, diag));
+        return status;
+    });
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "functions.hpp"
+#include "gemmt.hpp"
+#include "hipblas.h"
+#include "workspace.hpp"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <hip/hip_runtime_api.h>
+
+// Compact layout: the batch_count matrices of a call form one group and are
+// interleaved, element (i, j) of matrix b being X[(i + j * ldx) * batch_count + b],
+// so the element of all matrices is contiguous. Packing and unpacking are
+// geam transposes, one per column, or one for the whole matrix when both
+// sides are packed.
+
+// Columns of a strided batch of column-major matrices A to compact layout Ac,
+// or back when unpack is set; from and to are A and Ac in the direction of the
+// copy. one and zero are the scalars in the handle's pointer mode.
+template <typename T>
+hipblasStatus_t compact_copy(hipblasHandle_t handle,
+                             bool            unpack,
+                             int             m,
+                             int             n,
+                             int             lda,
+                             hipblasStride   stride_a,
+                             int             ldac,
+                             const T*        from,
+                             T*              to,
+                             int             batch_count,
+                             const T*        one,
+                             const T*        zero)
+{
+    if(!m || !n)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    // Each column is one transpose between an m by batch_count matrix and a
+    // batch_count by m one, or the whole matrix at once when both are packed
+    using F                = hipblas_functions<T>;
+    int             g      = batch_count;
+    bool            whole  = lda == m && ldac == m && int64_t(m) * n <= INT_MAX;
+    int             rows   = whole ? m * n : m;
+    int             cols   = whole ? 1 : n;
+    hipblasStride   a_ld   = std::max(stride_a, hipblasStride(rows));
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int j = 0; j < cols && status == HIPBLAS_STATUS_SUCCESS; j++)
+    {
+        size_t a_col  = size_t(j) * lda;
+        size_t ac_col = size_t(j) * ldac * g;
+        if(unpack)
+            status = F::geam(handle,
+                             HIPBLAS_OP_T,
+                             HIPBLAS_OP_N,
+                             rows,
+                             g,
+                             one,
+                             from + ac_col,
+                             g,
+                             zero,
+                             to + a_col,
+                             a_ld,
+                             to + a_col,
+                             a_ld);
+        else
+            status = F::geam(handle,
+                             HIPBLAS_OP_T,
+                             HIPBLAS_OP_N,
+                             g,
+                             rows,
+                             one,
+                             from + a_col,
+                             a_ld,
+                             zero,
+                             to + ac_col,
+                             g,
+                             to + ac_col,
+                             g);
+    }
+    return status;
+}
+
+// Strided batch of column-major matrices A to compact layout Ac, or back when
+// unpack is set; from and to are A and Ac in the direction of the copy
+template <typename T>
+hipblasStatus_t compact_pack(hipblasHandle_t handle,
+                             bool            unpack,
+                             int             m,
+                             int             n,
+                             int             lda,
+                             hipblasStride   stride_a,
+                             int             ldac,
+                             const T*        from,
+                             T*              to,
+                             int             batch_count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || batch_count < 0 || lda < std::max(1, m) || ldac < std::max(1, m)
+       || (batch_count > 1 && stride_a < hipblasStride(lda) * n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!m || !n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t pointer_mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The scalars 1 and 0, copied to the handle's workspace in device pointer mode
+    bool                    device          = pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    T                       host_scalars[2] = {gemmt_real_scalar<T>(1), gemmt_real_scalar<T>(0)};
+    hipblas_workspace_scope scope(handle, device ? sizeof(host_scalars) : 0);
+    hipStream_t             stream;
+    status = scope.status();
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    const T* one = host_scalars;
+    if(device)
+    {
+        if(hipMemcpyAsync(
+               scope.data<T>(), host_scalars, sizeof(host_scalars), hipMemcpyHostToDevice, stream)
+           != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        one = scope.data<T>();
+    }
+    return compact_copy(
+        handle, unpack, m, n, lda, stride_a, ldac, from, to, batch_count, one, one + 1);
+}
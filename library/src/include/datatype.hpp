@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+#include <cstring>
+
+// Bytes per element of a datatype, or 0 for values that are not datatypes
+inline size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+// Write 1 in the given compute type, returning its size, or 0 for types hipBLAS
+// does not compute in
+inline size_t hipblas_write_one(hipblasDatatype_t type, void* out)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+    {
+        uint16_t one = 0x3C00;
+        memcpy(out, &one, sizeof(one));
+        return sizeof(one);
+    }
+    case HIPBLAS_R_16B:
+    {
+        uint16_t one = 0x3F80;
+        memcpy(out, &one, sizeof(one));
+        return sizeof(one);
+    }
+    case HIPBLAS_R_32I:
+    {
+        int32_t one = 1;
+        memcpy(out, &one, sizeof(one));
+        return sizeof(one);
+    }
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+    {
+        float one[2] = {1, 0};
+        memcpy(out, one, hipblas_datatype_size(type));
+        return hipblas_datatype_size(type);
+    }
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+    {
+        double one[2] = {1, 0};
+        memcpy(out, one, hipblas_datatype_size(type));
+        return hipblas_datatype_size(type);
+    }
+    default:
+        return 0;
+    }
+}
+
+// Bytes per element of a BLAS precision character, 'h', 's', 'd', 'c' or 'z'
+inline size_t hipblas_precision_size(char precision)
+{
+    switch(precision)
+    {
+    case 'h':
+        return sizeof(hipblasHalf);
+    case 's':
+        return sizeof(float);
+    case 'd':
+        return sizeof(double);
+    case 'c':
+        return sizeof(hipblasComplex);
+    case 'z':
+        return sizeof(hipblasDoubleComplex);
+    }
+    return 0;
+}
+
+// Bytes spanned by a column-major rows x cols matrix with leading dimension ld
+inline size_t hipblas_matrix_span(int rows, int cols, int ld, size_t elem_size)
+{
+    return (size_t(ld) * (cols - 1) + rows) * elem_size;
+}
+
+// Bytes spanned by n elements with increment inc, in either direction
+inline size_t hipblas_vector_span(int n, int inc, size_t elem_size)
+{
+    return (size_t(n - 1) * (inc < 0 ? -size_t(inc) : size_t(inc)) + 1) * elem_size;
+}
+
+inline bool hipblas_overlaps(const void* a, size_t a_bytes, const void* b, size_t b_bytes)
+{
+    return (const char*)a < (const char*)b + b_bytes && (const char*)b < (const char*)a + a_bytes;
+}
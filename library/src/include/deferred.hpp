@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// Calls queued on a handle in HIPBLAS_DEFERRED_MODE_ENABLED. All queued calls
+// share precision, transposes, sizes, leading dimensions, host scalars and
+// stream, and no queued call reads or writes the output of another.
+struct hipblas_deferred_gemm_queue
+{
+    char               precision = 0; // 'h', 's', 'd', 'c' or 'z', 0 when empty
+    hipblasOperation_t transA    = HIPBLAS_OP_N;
+    hipblasOperation_t transB    = HIPBLAS_OP_N;
+    int                m = 0, n = 0, k = 0;
+    int                lda = 0, ldb = 0, ldc = 0;
+    unsigned char      alpha[16] = {};
+    unsigned char      beta[16]  = {};
+    std::vector<char*> A, B, C;
+
+    // Stream of the queued calls, which threads bound by hipblasSetThreadStream
+    // may have left since, and the handle and thread they were queued from
+    hipStream_t     stream = nullptr;
+    hipblasHandle_t handle = nullptr;
+    std::thread::id owner;
+
+    // Pointer arrays for the hipblasXgemmBatched fallback go through a small
+    // ring of pinned and device buffers, each reused once its event completes.
+    struct array_slot
+    {
+        void**     host     = nullptr;
+        void**     device   = nullptr;
+        size_t     capacity = 0;
+        hipEvent_t done     = nullptr;
+    };
+    static constexpr int deferred_array_slots = 4;
+    array_slot           slots[deferred_array_slots];
+    int                  next_slot = 0;
+
+    hipblas_deferred_gemm_queue() = default;
+    hipblas_deferred_gemm_queue(const hipblas_deferred_gemm_queue&) = delete;
+    hipblas_deferred_gemm_queue& operator=(const hipblas_deferred_gemm_queue&) = delete;
+    ~hipblas_deferred_gemm_queue();
+};
+
+// Number of handles in deferred mode or capturing a graph. While it is zero the
+// entry points skip all deferred bookkeeping with a single relaxed load.
+extern std::atomic<int> hipblas_deferred_handles;
+
+// Set while the deferred module itself calls hipBLAS, so that those calls are
+// neither queued nor trigger a flush of the queue being built or issued.
+extern thread_local bool hipblas_deferred_internal;
+
+// Calls into hipBLAS made by the deferred and graph modules bypass the entry hooks
+struct hipblas_internal_call_guard
+{
+    bool saved;
+    hipblas_internal_call_guard()
+        : saved(hipblas_deferred_internal)
+    {
+        hipblas_deferred_internal = true;
+    }
+    ~hipblas_internal_call_guard()
+    {
+        hipblas_deferred_internal = saved;
+    }
+};
+
+inline bool hipblas_deferred_active()
+{
+    return hipblas_deferred_handles.load(std::memory_order_relaxed) && !hipblas_deferred_internal;
+}
+
+// Queue a typed GEMM if the handle is in deferred mode. Sets queued when the
+// call was taken; otherwise the caller runs it directly. Pending calls that
+// the new one cannot join are flushed first.
+hipblasStatus_t hipblas_deferred_gemm(hipblasHandle_t    handle,
+                                      char               precision,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const void*        A,
+                                      int                lda,
+                                      const void*        B,
+                                      int                ldb,
+                                      const void*        beta,
+                                      void*              C,
+                                      int                ldc,
+                                      bool&              queued);
+
+// Issue any calls queued on the handle
+hipblasStatus_t hipblas_deferred_flush(hipblasHandle_t handle);
+
+// Issue, for the entry points that do not take a handle, the calls queued or
+// recorded by the calling thread and those queued on stream by any thread
+hipblasStatus_t hipblas_deferred_flush_stream(hipStream_t stream);
+
+// Keep calls on a deferred handle stream-ordered behind its queued GEMMs
+#define HIPBLAS_DEFERRED_FLUSH(handle)                                         \
+    do                                                                         \
+    {                                                                          \
+        if(hipblas_deferred_active())                                          \
+        {                                                                      \
+            hipblasStatus_t deferred_status_ = hipblas_deferred_flush(handle); \
+            if(deferred_status_ != HIPBLAS_STATUS_SUCCESS)                     \
+                return deferred_status_;                                       \
+        }                                                                      \
+    } while(0)
+
+#define HIPBLAS_DEFERRED_FLUSH_STREAM(stream)                                         \
+    do                                                                                \
+    {                                                                                 \
+        if(hipblas_deferred_active())                                                 \
+        {                                                                             \
+            hipblasStatus_t deferred_status_ = hipblas_deferred_flush_stream(stream); \
+            if(deferred_status_ != HIPBLAS_STATUS_SUCCESS)                            \
+                return deferred_status_;                                              \
+        }                                                                             \
+    } while(0)
+
+#define HIPBLAS_DEFERRED_GEMM(handle, precision, ...)                                      \
+    do                                                                                     \
+    {                                                                                      \
+        if(hipblas_deferred_active())                                                      \
+        {                                                                                  \
+            bool            deferred_queued_ = false;                                      \
+            hipblasStatus_t deferred_status_                                               \
+                = hipblas_deferred_gemm(handle, precision, __VA_ARGS__, deferred_queued_); \
+            if(deferred_queued_ || deferred_status_ != HIPBLAS_STATUS_SUCCESS)             \
+                return deferred_status_;                                                   \
+        }                                                                                  \
+    } while(0)
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "hipblas.h"
+#include <atomic>
+
+// Number of handles with a hipblasFloat32Mode_t other than
+// HIPBLAS_FLOAT32_MODE_DEFAULT, checked before any other work
+extern std::atomic<int> hipblas_float32_handles;
+
+hipblasFloat32Mode_t hipblas_float32_mode(hipblasHandle_t handle);
+
+// How the products of an f32 GemmEx-family call are computed
+enum hipblas_float32_path
+{
+    hipblas_float32_path_full, // in f32
+    hipblas_float32_path_tf32, // in the backend's TF32 (cuBLAS) or xf32 (rocBLAS) math mode
+    hipblas_float32_path_16bx3, // with hipblas_gemm_16bx3
+};
+
+// Path of a call from its compute type, or from the handle's mode for
+// HIPBLAS_R_32F with f32 data. The fast compute types require f32 data and are
+// replaced with HIPBLAS_R_32F. tf32_supported, given by the backend, tells
+// whether the current device has TF32 or xf32 matrix cores; without them only
+// the bf16x3 mode leaves f32. Calls made by hipBLAS itself ignore the handle's
+// mode.
+hipblasStatus_t hipblas_float32_resolve(hipblasHandle_t       handle,
+                                        hipblasDatatype_t     a_type,
+                                        hipblasDatatype_t     b_type,
+                                        hipblasDatatype_t     c_type,
+                                        hipblasDatatype_t&    compute_type,
+                                        bool                  (*tf32_supported)(),
+                                        hipblas_float32_path& path);
+
+inline hipblasStatus_t hipblas_float32_select(hipblasHandle_t       handle,
+                                              hipblasDatatype_t     a_type,
+                                              hipblasDatatype_t     b_type,
+                                              hipblasDatatype_t     c_type,
+                                              hipblasDatatype_t&    compute_type,
+                                              bool                  (*tf32_supported)(),
+                                              hipblas_float32_path& path)
+{
+    path = hipblas_float32_path_full;
+    if(compute_type == HIPBLAS_R_32F && !hipblas_float32_handles.load(std::memory_order_relaxed))
+        return HIPBLAS_STATUS_SUCCESS;
+    return hipblas_float32_resolve(
+        handle, a_type, b_type, c_type, compute_type, tf32_supported, path);
+}
+
+// f32 GEMMs emulated with bf16 ones: each of op(A) and op(B) is split into the
+// bf16 value of its upper 16 bits and the bf16 value of the exact remainder,
+// and C = alpha*(Al*Bh + Ah*Bl + Ah*Bh) + beta*C is computed as three bf16
+// GEMMs with f32 accumulation, smallest terms first. The split is made of
+// strided copies picking the upper halves of the f32 values, which are
+// little-endian, and a GEMM forming the remainder. The operands are packed and
+// split in the handle's workspace, once for a stride of 0, in the caller's
+// pointer mode and without waiting for the stream.
+hipblasStatus_t hipblas_gemm_16bx3(hipblasHandle_t    handle,
+                                   hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const void*        alpha,
+                                   const void*        A,
+                                   int                lda,
+                                   hipblasStride      stride_a,
+                                   const void*        B,
+                                   int                ldb,
+                                   hipblasStride      stride_b,
+                                   const void*        beta,
+                                   void*              C,
+                                   int                ldc,
+                                   hipblasStride      stride_c,
+                                   int                batch_count,
+                                   hipblasGemmAlgo_t  algo);
+
+// The same for arrays of device pointers, the members being packed with
+// geamBatched, or one at a time on backends without it
+hipblasStatus_t hipblas_gemm_batched_16bx3(hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const void*        alpha,
+                                           const void*        A[],
+                                           int                lda,
+                                           const void*        B[],
+                                           int                ldb,
+                                           const void*        beta,
+                                           void*              C[],
+                                           int                ldc,
+                                           int                batch_count,
+                                           hipblasGemmAlgo_t  algo);
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Typed entry points by element type. hipBLAS has no device code of its own, so
+// the routines it adds on top of the backend are composed of these calls and of
+// HIP runtime copies and sets. hipblasHalf only has the GEMMs.
+template <typename T>
+struct hipblas_functions;
+
+#define HIPBLAS_GEMM_FUNCTIONS(prefix)                                                \
+    static constexpr auto gemm                 = hipblas##prefix##gemm;               \
+    static constexpr auto gemm_batched         = hipblas##prefix##gemmBatched;        \
+    static constexpr auto gemm_strided_batched = hipblas##prefix##gemmStridedBatched;
+
+#define HIPBLAS_BLAS_FUNCTIONS(prefix)                                                     \
+    static constexpr auto axpy                  = hipblas##prefix##axpy;                   \
+    static constexpr auto axpy_batched          = hipblas##prefix##axpyBatched;            \
+    static constexpr auto axpy_strided_batched  = hipblas##prefix##axpyStridedBatched;     \
+    static constexpr auto scal                  = hipblas##prefix##scal;                   \
+    static constexpr auto scal_batched          = hipblas##prefix##scalBatched;            \
+    static constexpr auto scal_strided_batched  = hipblas##prefix##scalStridedBatched;     \
+    static constexpr auto gemv                  = hipblas##prefix##gemv;                   \
+    static constexpr auto gemv_strided_batched  = hipblas##prefix##gemvStridedBatched;     \
+    static constexpr auto dgmm                  = hipblas##prefix##dgmm;                   \
+    static constexpr auto dgmm_batched          = hipblas##prefix##dgmmBatched;            \
+    static constexpr auto dgmm_strided_batched  = hipblas##prefix##dgmmStridedBatched;     \
+    static constexpr auto geam                  = hipblas##prefix##geam;                   \
+    static constexpr auto geam_batched          = hipblas##prefix##geamBatched;            \
+    static constexpr auto geam_strided_batched  = hipblas##prefix##geamStridedBatched;     \
+    static constexpr auto syrk                  = hipblas##prefix##syrk;                   \
+    static constexpr auto syrk_batched          = hipblas##prefix##syrkBatched;            \
+    static constexpr auto syrk_strided_batched  = hipblas##prefix##syrkStridedBatched;     \
+    static constexpr auto syrkx                 = hipblas##prefix##syrkx;                  \
+    static constexpr auto syrkx_batched         = hipblas##prefix##syrkxBatched;           \
+    static constexpr auto syrkx_strided_batched = hipblas##prefix##syrkxStridedBatched;    \
+    static constexpr auto trsm                  = hipblas##prefix##trsm;
+
+#define HIPBLAS_HERMITIAN_FUNCTIONS(prefix)                                             \
+    static constexpr auto herk                  = hipblas##prefix##herk;                \
+    static constexpr auto herk_batched          = hipblas##prefix##herkBatched;         \
+    static constexpr auto herk_strided_batched  = hipblas##prefix##herkStridedBatched;  \
+    static constexpr auto herkx                 = hipblas##prefix##herkx;               \
+    static constexpr auto herkx_batched         = hipblas##prefix##herkxBatched;        \
+    static constexpr auto herkx_strided_batched = hipblas##prefix##herkxStridedBatched;
+
+template <>
+struct hipblas_functions<hipblasHalf>
+{
+    HIPBLAS_GEMM_FUNCTIONS(H)
+};
+
+template <>
+struct hipblas_functions<float>
+{
+    HIPBLAS_GEMM_FUNCTIONS(S)
+    HIPBLAS_BLAS_FUNCTIONS(S)
+};
+
+template <>
+struct hipblas_functions<double>
+{
+    HIPBLAS_GEMM_FUNCTIONS(D)
+    HIPBLAS_BLAS_FUNCTIONS(D)
+};
+
+template <>
+struct hipblas_functions<hipblasComplex>
+{
+    HIPBLAS_GEMM_FUNCTIONS(C)
+    HIPBLAS_BLAS_FUNCTIONS(C)
+    HIPBLAS_HERMITIAN_FUNCTIONS(C)
+};
+
+template <>
+struct hipblas_functions<hipblasDoubleComplex>
+{
+    HIPBLAS_GEMM_FUNCTIONS(Z)
+    HIPBLAS_BLAS_FUNCTIONS(Z)
+    HIPBLAS_HERMITIAN_FUNCTIONS(Z)
+};
+
+// status = call(T()) for the element type T of type when it has the BLAS
+// functions, returning false for the other types
+template <typename Call>
+bool hipblas_functions_call(hipblasDatatype_t type, Call call, hipblasStatus_t& status)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_32F:
+        status = call(float());
+        return true;
+    case HIPBLAS_R_64F:
+        status = call(double());
+        return true;
+    case HIPBLAS_C_32F:
+        status = call(hipblasComplex());
+        return true;
+    case HIPBLAS_C_64F:
+        status = call(hipblasDoubleComplex());
+        return true;
+    default:
+        return false;
+    }
+}
+
+#undef HIPBLAS_GEMM_FUNCTIONS
+#undef HIPBLAS_BLAS_FUNCTIONS
+#undef HIPBLAS_HERMITIAN_FUNCTIONS
@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+// A strided batched GEMM that broadcasts one operand, with stride 0, is a
+// single GEMM when the other operand and C are packed side by side:
+//
+//   strideA == 0: the op(B_i) and C_i are consecutive column blocks, so
+//                 C = op(A) * op(B) with n * batch_count columns
+//   strideB == 0: the op(A_i) and C_i are consecutive row blocks, so
+//                 C = op(A) * op(B) with m * batch_count rows
+//
+// When the call matches, m or n is scaled by batch_count and batch_count is
+// set to 1; the pointers, leading dimensions and scalars are unchanged. Each
+// element of C is still one length k dot product, but the backend may pick a
+// different kernel for the larger shape, so results can differ in the last
+// bits from the uncollapsed call. HIPBLAS_GEMM_BROADCAST=0 turns this off.
+bool hipblas_gemm_collapse_broadcast(hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int&               m,
+                                     int&               n,
+                                     int                lda,
+                                     int                ldb,
+                                     int                ldc,
+                                     int64_t            stride_a,
+                                     int64_t            stride_b,
+                                     int64_t            stride_c,
+                                     int&               batch_count);
@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// hipblasGemmExD and its batched forms on backends whose GEMM writes its
+// result over C: copy C to D on the handle's stream, then run the GEMM in
+// place on D. Nothing is copied when C and D are the same matrices or when
+// beta is a host zero, in which case the GEMM does not read D. C and D must
+// have the same datatype.
+hipblasStatus_t hipblas_gemm_ex_d_copy(hipblasHandle_t   handle,
+                                       hipblasDatatype_t c_type,
+                                       hipblasDatatype_t d_type,
+                                       hipblasDatatype_t compute_type,
+                                       int               m,
+                                       int               n,
+                                       const void*       beta,
+                                       const void*       C,
+                                       int               ldc,
+                                       hipblasStride     stride_c,
+                                       void*             D,
+                                       int               ldd,
+                                       hipblasStride     stride_d,
+                                       int               batch_count);
+
+// Same with arrays of device pointers to the matrices of C and D
+hipblasStatus_t hipblas_gemm_batched_ex_d_copy(hipblasHandle_t   handle,
+                                               hipblasDatatype_t c_type,
+                                               hipblasDatatype_t d_type,
+                                               hipblasDatatype_t compute_type,
+                                               int               m,
+                                               int               n,
+                                               const void*       beta,
+                                               const void* const C[],
+                                               int               ldc,
+                                               void* const       D[],
+                                               int               ldd,
+                                               int               batch_count);
@@ -0,0 +1,416 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "functions.hpp"
+#include "hipblas.h"
+#include "workspace.hpp"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+// hipblasXgemmt: only the uplo triangle of C = alpha*op(A)*op(B) + beta*C is
+// computed and written. When op(B) is the transpose of a matrix shaped like
+// op(A) the backend syrkx computes it directly. Otherwise C is split into
+// block rows of gemmt_block(n): the rectangle of each block row off the
+// diagonal is one GEMM, and its diagonal tile is computed by GEMM into a
+// workspace W and added to the triangle of C with syrkx(W, I), I being the
+// identity, which writes nothing outside the triangle. W, the identity and the
+// device scalars are in the handle's workspace, so the call does not wait for
+// the device.
+
+template <typename T>
+T gemmt_real_scalar(double value)
+{
+    if constexpr(std::is_floating_point<T>{})
+        return T(value);
+    else
+    {
+        using R    = std::conditional_t<sizeof(T) == 2 * sizeof(float), float, double>;
+        R parts[2] = {R(value), 0};
+        T scalar;
+        memcpy(&scalar, parts, sizeof(scalar));
+        return scalar;
+    }
+}
+
+// Block rows of at least 128, and at most 16 of them, so that the extra
+// syrkx work on the diagonal tiles stays small next to the GEMMs
+inline int gemmt_block(int n)
+{
+    return std::min(n, std::max(128, (n + 15) / 16));
+}
+
+// syrkx computes op(A)*op(B)^T for one operation applied to both A and B
+template <typename T>
+bool gemmt_native(hipblasOperation_t transa, hipblasOperation_t transb)
+{
+    auto transposed = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_T || (std::is_floating_point<T>{} && op == HIPBLAS_OP_C);
+    };
+    return (transa == HIPBLAS_OP_N && transposed(transb))
+           || (transposed(transa) && transb == HIPBLAS_OP_N);
+}
+
+template <typename T>
+hipblasStatus_t gemmt_check(hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int                n,
+                            int                k,
+                            int                lda,
+                            int                ldb,
+                            int                ldc,
+                            int                batch_count)
+{
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || !valid_op(transa)
+       || !valid_op(transb))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? n : k)
+       || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, n))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Strided form; batch_count 1 is the plain form. Arguments are checked.
+template <typename T>
+hipblasStatus_t gemmt_strided(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T*           A,
+                              int                lda,
+                              hipblasStride      stride_a,
+                              const T*           B,
+                              int                ldb,
+                              hipblasStride      stride_b,
+                              const T*           beta,
+                              T*                 C,
+                              int                ldc,
+                              hipblasStride      stride_c,
+                              int                batch_count)
+{
+    using F = hipblas_functions<T>;
+    if(!n || !batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(gemmt_native<T>(transa, transb))
+    {
+        // op(A)*op(B) = X*Y^T with X and Y both A and B, or both their transposes
+        hipblasOperation_t trans = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        if(batch_count == 1)
+            return F::syrkx(handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        return F::syrkx_strided_batched(handle,
+                                        uplo,
+                                        trans,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        stride_a,
+                                        B,
+                                        ldb,
+                                        stride_b,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        stride_c,
+                                        batch_count);
+    }
+
+    hipblasPointerMode_t pointer_mode;
+    hipStream_t          stream;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Workspace: the scalars 1 and 0, the identity and one W per matrix
+    int                     nb       = gemmt_block(n);
+    hipblasStride           stride_w = hipblasStride(nb) * nb;
+    size_t                  w_elems  = size_t(stride_w) * batch_count;
+    hipblas_workspace_scope scope(handle, (2 + stride_w + w_elems) * sizeof(T));
+    if(scope.status() != HIPBLAS_STATUS_SUCCESS)
+        return scope.status();
+
+    T*             workspace       = scope.data<T>();
+    T              host_scalars[2] = {gemmt_real_scalar<T>(1), gemmt_real_scalar<T>(0)};
+    std::vector<T> ones(nb, host_scalars[0]);
+    T*             identity = workspace + 2;
+    T*             W        = identity + stride_w;
+    if(hipMemcpyAsync(workspace, host_scalars, sizeof(host_scalars), hipMemcpyHostToDevice, stream)
+           != hipSuccess
+       || hipMemsetAsync(identity, 0, stride_w * sizeof(T), stream) != hipSuccess
+       || hipMemcpy2DAsync(identity,
+                           (nb + 1) * sizeof(T),
+                           ones.data(),
+                           sizeof(T),
+                           sizeof(T),
+                           nb,
+                           hipMemcpyHostToDevice,
+                           stream)
+              != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    const T* one  = pointer_mode == HIPBLAS_POINTER_MODE_HOST ? host_scalars : workspace;
+    const T* zero = one + 1;
+
+    // Rows r of op(A) and columns c of op(B)
+    auto a_rows = [&](int r) { return A + (transa == HIPBLAS_OP_N ? r : size_t(r) * lda); };
+    auto b_cols = [&](int c) { return B + (transb == HIPBLAS_OP_N ? size_t(c) * ldb : c); };
+
+    // C' = alpha*op(A)'*op(B)' + s*C' for rows rows of op(A) and cols columns of op(B)
+    auto gemm = [&](int rows, int cols, int r, int c, const T* s, T* Cs, int ld, long long sc) {
+        if(batch_count == 1)
+            return F::gemm(handle,
+                           transa,
+                           transb,
+                           rows,
+                           cols,
+                           k,
+                           alpha,
+                           a_rows(r),
+                           lda,
+                           b_cols(c),
+                           ldb,
+                           s,
+                           Cs,
+                           ld);
+        return F::gemm_strided_batched(handle,
+                                       transa,
+                                       transb,
+                                       rows,
+                                       cols,
+                                       k,
+                                       alpha,
+                                       a_rows(r),
+                                       lda,
+                                       stride_a,
+                                       b_cols(c),
+                                       ldb,
+                                       stride_b,
+                                       s,
+                                       Cs,
+                                       ld,
+                                       sc,
+                                       batch_count);
+    };
+
+    for(int i0 = 0; i0 < n && status == HIPBLAS_STATUS_SUCCESS; i0 += nb)
+    {
+        int ib   = std::min(nb, n - i0);
+        T*  C_ii = C + i0 + size_t(i0) * ldc;
+
+        // W = alpha*op(A)*op(B) for the diagonal tile
+        status = gemm(ib, ib, i0, i0, zero, W, nb, stride_w);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        // C_ii = W*I^T + beta*C_ii on the triangle only
+        if(batch_count == 1)
+            status = F::syrkx(
+                handle, uplo, HIPBLAS_OP_N, ib, ib, one, W, nb, identity, nb, beta, C_ii, ldc);
+        else
+            status = F::syrkx_strided_batched(handle,
+                                              uplo,
+                                              HIPBLAS_OP_N,
+                                              ib,
+                                              ib,
+                                              one,
+                                              W,
+                                              nb,
+                                              stride_w,
+                                              identity,
+                                              nb,
+                                              0,
+                                              beta,
+                                              C_ii,
+                                              ldc,
+                                              stride_c,
+                                              batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            break;
+
+        // The rest of the block row on the uplo side of the diagonal
+        if(uplo == HIPBLAS_FILL_MODE_UPPER && i0 + ib < n)
+            status = gemm(
+                ib, n - i0 - ib, i0, i0 + ib, beta, C + i0 + size_t(i0 + ib) * ldc, ldc, stride_c);
+        else if(uplo == HIPBLAS_FILL_MODE_LOWER && i0)
+            status = gemm(ib, i0, i0, 0, beta, C + i0, ldc, stride_c);
+    }
+    return status;
+}
+
+// Batched syrkx is not available on every backend; those run the strided
+// form on one matrix at a time
+template <typename T>
+hipblasStatus_t gemmt_strided_batched(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                n,
+                                      int                k,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int                lda,
+                                      hipblasStride      stride_a,
+                                      const T*           B,
+                                      int                ldb,
+                                      hipblasStride      stride_b,
+                                      const T*           beta,
+                                      T*                 C,
+                                      int                ldc,
+                                      hipblasStride      stride_c,
+                                      int                batch_count)
+{
+    hipblasStatus_t status = gemmt_check<T>(
+        handle, uplo, transa, transb, n, k, lda, ldb, ldc, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The first call to write C is a syrkx, so NOT_SUPPORTED leaves C unchanged
+    status = gemmt_strided(handle,
+                           uplo,
+                           transa,
+                           transb,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           stride_a,
+                           B,
+                           ldb,
+                           stride_b,
+                           beta,
+                           C,
+                           ldc,
+                           stride_c,
+                           batch_count);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED || batch_count == 1)
+        return status;
+
+    status = HIPBLAS_STATUS_SUCCESS;
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = gemmt_strided(handle,
+                               uplo,
+                               transa,
+                               transb,
+                               n,
+                               k,
+                               alpha,
+                               A + b * stride_a,
+                               lda,
+                               0,
+                               B + b * stride_b,
+                               ldb,
+                               0,
+                               beta,
+                               C + b * stride_c,
+                               ldc,
+                               0,
+                               1);
+    return status;
+}
+
+// The pointer arrays are read back when the product needs the blocked form,
+// which offsets every matrix, or when the backend has no batched syrkx
+template <typename T>
+hipblasStatus_t gemmt_batched(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T* const     A[],
+                              int                lda,
+                              const T* const     B[],
+                              int                ldb,
+                              const T*           beta,
+                              T* const           C[],
+                              int                ldc,
+                              int                batch_count)
+{
+    hipblasStatus_t status = gemmt_check<T>(
+        handle, uplo, transa, transb, n, k, lda, ldb, ldc, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batch_count)
+        return status;
+
+    if(gemmt_native<T>(transa, transb))
+    {
+        hipblasOperation_t trans = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+        status                   = hipblas_functions<T>::syrkx_batched(
+            handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    std::vector<const T*> a_ptrs(batch_count), b_ptrs(batch_count);
+    std::vector<T*>       c_ptrs(batch_count);
+    size_t                ptr_bytes = batch_count * sizeof(T*);
+    if(hipMemcpyAsync(a_ptrs.data(), A, ptr_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(b_ptrs.data(), B, ptr_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipMemcpyAsync(c_ptrs.data(), C, ptr_bytes, hipMemcpyDeviceToHost, stream) != hipSuccess
+       || hipStreamSynchronize(stream) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = gemmt_strided(handle,
+                               uplo,
+                               transa,
+                               transb,
+                               n,
+                               k,
+                               alpha,
+                               a_ptrs[b],
+                               lda,
+                               0,
+                               b_ptrs[b],
+                               ldb,
+                               0,
+                               beta,
+                               c_ptrs[b],
+                               ldc,
+                               0,
+                               1);
+    return status;
+}
@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "hipblas.h"
+#include <vector>
+
+// One call recorded by hipblasGraphBegin and not yet issued into the capture
+struct hipblas_graph_op
+{
+    enum op_kind
+    {
+        op_scal,
+        op_axpy,
+        op_dot,
+        op_gemv
+    };
+
+    op_kind            kind;
+    char               precision; // 's', 'd', 'c' or 'z'
+    hipblasOperation_t trans = HIPBLAS_OP_N;
+    int                m = 0, n = 0, lda = 0;
+    int                incx = 0, incy = 0;
+    unsigned char      alpha[16] = {}; // host scalars of scal, axpy and gemv
+    unsigned char      beta[16]  = {};
+    const char*        A         = nullptr;
+    char*              x         = nullptr; // written by scal, read otherwise
+    char*              y         = nullptr; // written by axpy and gemv, read by dot
+    char*              result    = nullptr; // device result of dot
+};
+
+// Capture in progress on a handle between hipblasGraphBegin and hipblasGraphEnd.
+// Recorded calls wait in window until a call that cannot be recorded, and are
+// then combined and issued into the capture stream.
+struct hipblas_graph_recording
+{
+    hipStream_t                   stream       = nullptr;
+    hipStream_t                   saved_stream = nullptr; // handle stream before the capture
+    bool                          owns_stream  = false;
+    bool                          capturing    = false;
+    std::vector<hipblas_graph_op> window;
+
+    hipblas_graph_recording() = default;
+    hipblas_graph_recording(const hipblas_graph_recording&) = delete;
+    hipblas_graph_recording& operator=(const hipblas_graph_recording&) = delete;
+    ~hipblas_graph_recording();
+};
+
+struct hipblasGraph
+{
+    hipGraph_t     graph = nullptr;
+    hipGraphExec_t exec  = nullptr;
+};
+
+// Record a call if the handle is capturing a graph, copying the host scalars
+// alpha and beta. Sets recorded when the call was taken; otherwise the caller
+// runs it directly, after the calls recorded or queued on the handle.
+hipblasStatus_t hipblas_graph_record(hipblasHandle_t   handle,
+                                     hipblas_graph_op& op,
+                                     const void*       alpha,
+                                     const void*       beta,
+                                     bool&             recorded);
+
+// Issue the recorded calls of a capturing handle, called by hipblas_deferred_flush
+hipblasStatus_t hipblas_graph_flush(hipblasHandle_t handle, hipblas_graph_recording& recording);
+
+// Issue the recorded calls of every handle capturing on the calling thread
+hipblasStatus_t hipblas_graph_flush_thread();
+
+inline hipblasStatus_t hipblas_graph_scal(hipblasHandle_t handle,
+                                          char            precision,
+                                          int             n,
+                                          const void*     alpha,
+                                          void*           x,
+                                          int             incx,
+                                          bool&           recorded)
+{
+    hipblas_graph_op op{hipblas_graph_op::op_scal, precision};
+    op.n    = n;
+    op.incx = incx;
+    op.x    = (char*)x;
+    return hipblas_graph_record(handle, op, alpha, nullptr, recorded);
+}
+
+inline hipblasStatus_t hipblas_graph_axpy(hipblasHandle_t handle,
+                                          char            precision,
+                                          int             n,
+                                          const void*     alpha,
+                                          const void*     x,
+                                          int             incx,
+                                          void*           y,
+                                          int             incy,
+                                          bool&           recorded)
+{
+    hipblas_graph_op op{hipblas_graph_op::op_axpy, precision};
+    op.n    = n;
+    op.incx = incx;
+    op.incy = incy;
+    op.x    = (char*)x;
+    op.y    = (char*)y;
+    return hipblas_graph_record(handle, op, alpha, nullptr, recorded);
+}
+
+inline hipblasStatus_t hipblas_graph_dot(hipblasHandle_t handle,
+                                         char            precision,
+                                         int             n,
+                                         const void*     x,
+                                         int             incx,
+                                         const void*     y,
+                                         int             incy,
+                                         void*           result,
+                                         bool&           recorded)
+{
+    hipblas_graph_op op{hipblas_graph_op::op_dot, precision};
+    op.n      = n;
+    op.incx   = incx;
+    op.incy   = incy;
+    op.x      = (char*)x;
+    op.y      = (char*)y;
+    op.result = (char*)result;
+    return hipblas_graph_record(handle, op, nullptr, nullptr, recorded);
+}
+
+inline hipblasStatus_t hipblas_graph_gemv(hipblasHandle_t    handle,
+                                          char               precision,
+                                          hipblasOperation_t trans,
+                                          int                m,
+                                          int                n,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          int                lda,
+                                          const void*        x,
+                                          int                incx,
+                                          const void*        beta,
+                                          void*              y,
+                                          int                incy,
+                                          bool&              recorded)
+{
+    hipblas_graph_op op{hipblas_graph_op::op_gemv, precision};
+    op.trans = trans;
+    op.m     = m;
+    op.n     = n;
+    op.lda   = lda;
+    op.incx  = incx;
+    op.incy  = incy;
+    op.A     = (const char*)A;
+    op.x     = (char*)x;
+    op.y     = (char*)y;
+    return hipblas_graph_record(handle, op, alpha, beta, recorded);
+}
+
+// Replaces HIPBLAS_DEFERRED_FLUSH in the entry points whose calls can be
+// recorded, e.g. HIPBLAS_GRAPH_RECORD(axpy, handle, 's', n, alpha, x, incx, y, incy)
+#define HIPBLAS_GRAPH_RECORD(op, handle, ...)                               \
+    do                                                                      \
+    {                                                                       \
+        if(hipblas_deferred_active())                                       \
+        {                                                                   \
+            bool            graph_recorded_ = false;                        \
+            hipblasStatus_t graph_status_                                   \
+                = hipblas_graph_##op(handle, __VA_ARGS__, graph_recorded_); \
+            if(graph_recorded_ || graph_status_ != HIPBLAS_STATUS_SUCCESS)  \
+                return graph_status_;                                       \
+        }                                                                   \
+    } while(0)
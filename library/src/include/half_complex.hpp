@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Complex f16 (HIPBLAS_C_16F) for GemmEx and the Level-1 Ex routines, which
+// neither backend implements. Each routine runs as real f16 calls on the
+// interleaved (real, imaginary) view of the data with f32 arithmetic: a
+// complex element z is the 2 by 1 real vector [re(z); im(z)], and a scalar
+// times z, conj(z) or i*z is a 2 by 2 real matrix applied to it.
+//
+// GemmEx forms the 2m by 2k real representation of alpha's real part times
+// op(A), whose 2 by 2 blocks are [re -im; im re], in the handle's workspace;
+// C's real view is then that times op(B)'s real view in a single real GEMM
+// with f32 accumulation. A complex alpha with a nonzero imaginary part takes a
+// second such GEMM, and a complex beta a scaling of C ahead of them, rounding C
+// to its type in between. Device scalars are used in place, taking both GEMMs
+// and the scaling of C.
+//
+// The backend entry points call these when the data type is HIPBLAS_C_16F,
+// after their own logging.
+hipblasStatus_t hipblas_half_complex_gemm(hipblasHandle_t    handle,
+                                          hipblasOperation_t transa,
+                                          hipblasOperation_t transb,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  b_type,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  c_type,
+                                          int                ldc,
+                                          hipblasDatatype_t  compute_type,
+                                          hipblasGemmAlgo_t  algo);
+
+hipblasStatus_t hipblas_half_complex_axpy(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       alpha,
+                                          hipblasDatatype_t alpha_type,
+                                          const void*       x,
+                                          int               incx,
+                                          void*             y,
+                                          hipblasDatatype_t y_type,
+                                          int               incy,
+                                          hipblasDatatype_t execution_type);
+
+// dotu, or dotc when conjugate is set
+hipblasStatus_t hipblas_half_complex_dot(hipblasHandle_t   handle,
+                                         int               n,
+                                         const void*       x,
+                                         int               incx,
+                                         const void*       y,
+                                         hipblasDatatype_t y_type,
+                                         int               incy,
+                                         void*             result,
+                                         hipblasDatatype_t result_type,
+                                         hipblasDatatype_t execution_type,
+                                         bool              conjugate);
+
+hipblasStatus_t hipblas_half_complex_scal(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       alpha,
+                                          hipblasDatatype_t alpha_type,
+                                          void*             x,
+                                          int               incx,
+                                          hipblasDatatype_t execution_type);
+
+hipblasStatus_t hipblas_half_complex_nrm2(hipblasHandle_t   handle,
+                                          int               n,
+                                          const void*       x,
+                                          int               incx,
+                                          void*             result,
+                                          hipblasDatatype_t result_type,
+                                          hipblasDatatype_t execution_type);
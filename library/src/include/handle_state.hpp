@@ -0,0 +1,74 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "graph.hpp"
+#include "hipblas.h"
+#include "thread_stream.hpp"
+#include "workspace.hpp"
+#include <memory>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// hipBLAS settings and resources attached to a handle. hipblasHandle_t is the
+// backend handle itself, so they are kept in a side table keyed by the handle
+// and released by hipblasDestroy. As with the handle itself, the state of one
+// handle must not be used from several threads at once; threads bound to the
+// handle by hipblasSetThreadStream run on backend handles of their own.
+struct hipblas_handle_state
+{
+    hipblasDeferredMode_t       deferred_mode = HIPBLAS_DEFERRED_MODE_DISABLED;
+    hipblas_deferred_gemm_queue deferred;
+
+    // Set between hipblasGraphBegin and hipblasGraphEnd
+    std::unique_ptr<hipblas_graph_recording> graph;
+
+    hipblasManagedMemoryPolicy_t managed_policy = HIPBLAS_MANAGED_MEMORY_POLICY_NONE;
+
+    // Managed allocations already advised, with the advice given, since
+    // hipMemAdvise synchronizes
+    std::set<std::tuple<const void*, size_t, int>> managed_advised;
+
+    hipblasSymmetricOutput_t symmetric_output = HIPBLAS_SYMMETRIC_OUTPUT_NONE;
+
+    hipblasFloat32Mode_t float32_mode = HIPBLAS_FLOAT32_MODE_DEFAULT;
+
+    // Backend handles of the threads bound to the handle by hipblasSetThreadStream
+    std::shared_ptr<hipblas_thread_streams> thread_streams;
+
+    hipblas_workspace workspace;
+};
+
+// State of the handle, created with default settings on first use
+hipblas_handle_state& hipblas_get_handle_state(hipblasHandle_t handle);
+
+// State of the handle, or nullptr if it never left the defaults
+hipblas_handle_state* hipblas_find_handle_state(hipblasHandle_t handle);
+
+void hipblas_erase_handle_state(hipblasHandle_t handle);
+
+std::vector<hipblasHandle_t> hipblas_handles_with_state();
@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "hipblas.h"
+#include <cstdint>
+
+// Bitmask read once from the HIPBLAS_LAYER environment variable.
+// Values mirror the ROCBLAS_LAYER bits so the same settings can be reused.
+typedef enum hipblas_layer_mode_
+{
+    hipblas_layer_mode_none        = 0x0,
+    hipblas_layer_mode_log_profile = 0x4,
+    hipblas_layer_mode_log_trace   = 0x8,
+    hipblas_layer_mode_log_range   = 0x10,
+    hipblas_layer_mode_log_shape   = 0x20,
+} hipblas_layer_mode;
+
+uint32_t hipblas_get_layer_mode();
+
+// Binary trace written with hipblas_layer_mode_log_trace, one header followed
+// by one record per call. hipblas-bench --replay reads the same layout from
+// clients/include/hipblas_trace.hpp, so bump the version on any change here.
+#define HIPBLAS_TRACE_MAGIC "HIPBLTRC"
+#define HIPBLAS_TRACE_VERSION 1
+
+struct hipblas_trace_header
+{
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+};
+
+struct hipblas_trace_record
+{
+    char     function[48];
+    double   time_us; // host time at entry, relative to the first traced call
+    uint64_t handle; // handle, stream and buffer addresses are only used as identities
+    uint64_t stream;
+    uint64_t A, B, C; // device pointer arrays for the batched forms
+    int64_t  stride_a, stride_b, stride_c;
+    int32_t  device;
+    int32_t  pointer_mode;
+    int32_t  a_type, b_type, c_type, compute_type;
+    int32_t  transA, transB;
+    int32_t  m, n, k;
+    int32_t  lda, ldb, ldc;
+    int32_t  batch_count;
+    int32_t  reserved;
+    uint8_t  alpha[16]; // raw host scalars, zero in device pointer mode
+    uint8_t  beta[16];
+};
+
+// Record one GEMM-family call in the shape histogram. The histogram is written
+// to HIPBLAS_LOG_PROFILE_PATH (or stderr) at process exit as hipblas-bench yaml.
+// Strides are 0 and batch_count is 1 for the non-strided, non-batched forms.
+void hipblas_log_gemm_profile(hipblasHandle_t    handle,
+                              const char*        func,
+                              hipblasDatatype_t  a_type,
+                              hipblasDatatype_t  b_type,
+                              hipblasDatatype_t  c_type,
+                              hipblasDatatype_t  compute_type,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              int                lda,
+                              int64_t            stride_a,
+                              const void*        B,
+                              int                ldb,
+                              int64_t            stride_b,
+                              const void*        beta,
+                              const void*        C,
+                              int                ldc,
+                              int64_t            stride_c,
+                              int                batch_count);
+
+// Append one GEMM-family call to the binary trace at HIPBLAS_LOG_TRACE_PATH
+void hipblas_log_gemm_trace(hipblasHandle_t    handle,
+                            const char*        func,
+                            hipblasDatatype_t  a_type,
+                            hipblasDatatype_t  b_type,
+                            hipblasDatatype_t  c_type,
+                            hipblasDatatype_t  compute_type,
+                            hipblasOperation_t transA,
+                            hipblasOperation_t transB,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            int                lda,
+                            int64_t            stride_a,
+                            const void*        B,
+                            int                ldb,
+                            int64_t            stride_b,
+                            const void*        beta,
+                            const void*        C,
+                            int                ldc,
+                            int64_t            stride_c,
+                            int                batch_count);
+
+// Mark the shape of one GEMM-family call inside its range
+void hipblas_log_gemm_shape(hipblasHandle_t    handle,
+                            const char*        func,
+                            hipblasDatatype_t  a_type,
+                            hipblasDatatype_t  b_type,
+                            hipblasDatatype_t  c_type,
+                            hipblasDatatype_t  compute_type,
+                            hipblasOperation_t transA,
+                            hipblasOperation_t transB,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            int                lda,
+                            int64_t            stride_a,
+                            const void*        B,
+                            int                ldb,
+                            int64_t            stride_b,
+                            const void*        beta,
+                            const void*        C,
+                            int                ldc,
+                            int64_t            stride_c,
+                            int                batch_count);
+
+// Cheap check at every entry point; nothing is recorded unless enabled. GEMMs
+// that hipBLAS issues itself, under hipblas_internal_call_guard, are not user
+// calls and are left out of the profile and the trace.
+template <typename... Ts>
+inline void hipblas_log_gemm(hipblasHandle_t handle, const char* func, Ts... args)
+{
+    if(hipblas_deferred_internal)
+        return;
+    uint32_t layer_mode = hipblas_get_layer_mode();
+    if(layer_mode & hipblas_layer_mode_log_profile)
+        hipblas_log_gemm_profile(handle, func, args...);
+    if(layer_mode & hipblas_layer_mode_log_trace)
+        hipblas_log_gemm_trace(handle, func, args...);
+    if(layer_mode & hipblas_layer_mode_log_shape)
+        hipblas_log_gemm_shape(handle, func, args...);
+}
+
+// roctx or NVTX ranges, whichever tracer library can be loaded at runtime.
+// Without one these are no-ops.
+void hipblas_range_push(const char* name);
+void hipblas_range_pop();
+void hipblas_range_mark(const char* message);
+
+// Range named after the API function, open for the lifetime of the object.
+// Enabled with HIPBLAS_LAYER bit 0x10; bit 0x20 also marks the call's shape
+// where the entry point logs one.
+class hipblas_range_marker
+{
+    bool active;
+
+public:
+    explicit hipblas_range_marker(const char* func)
+        : active(hipblas_get_layer_mode()
+                 & (hipblas_layer_mode_log_range | hipblas_layer_mode_log_shape))
+    {
+        if(active)
+            hipblas_range_push(func);
+    }
+
+    ~hipblas_range_marker()
+    {
+        if(active)
+            hipblas_range_pop();
+    }
+
+    hipblas_range_marker(const hipblas_range_marker&) = delete;
+    hipblas_range_marker& operator=(const hipblas_range_marker&) = delete;
+};
+
+#define HIPBLAS_RANGE_MARKER() hipblas_range_marker hipblas_range_marker_(__func__)
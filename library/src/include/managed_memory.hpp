@@ -0,0 +1,67 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <cstdint>
+
+// Number of handles with a managed memory policy other than
+// HIPBLAS_MANAGED_MEMORY_POLICY_NONE, checked before any pointer queries
+extern std::atomic<int> hipblas_managed_handles;
+
+// Prefetch and advise the managed regions a GEMM-family call touches to the
+// current device on the handle's stream. Strides are 0 and batch_count is 1
+// for the non-strided forms. C is the output; Cin is the separate input matrix
+// of the forms writing D from C, read with the same shape and type. The hints
+// never change the result, so failures are ignored.
+void hipblas_managed_prefetch_gemm(hipblasHandle_t    handle,
+                                   hipblasDatatype_t  a_type,
+                                   hipblasDatatype_t  b_type,
+                                   hipblasDatatype_t  c_type,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const void*        A,
+                                   int                lda,
+                                   int64_t            stride_a,
+                                   const void*        B,
+                                   int                ldb,
+                                   int64_t            stride_b,
+                                   const void*        C,
+                                   int                ldc,
+                                   int64_t            stride_c,
+                                   int                batch_count,
+                                   const void*        Cin         = nullptr,
+                                   int                ldc_in      = 0,
+                                   int64_t            stride_c_in = 0);
+
+template <typename... Ts>
+inline void hipblas_managed_gemm(hipblasHandle_t handle, Ts... args)
+{
+    if(hipblas_managed_handles.load(std::memory_order_relaxed))
+        hipblas_managed_prefetch_gemm(handle, args...);
+}
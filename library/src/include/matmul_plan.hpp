@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// Backend independent part of a hipblasMatmulPlan_t. Each backend derives
+// struct hipblasMatmulPlan from it and adds the translated arguments its
+// GEMM takes.
+struct hipblas_matmul_plan
+{
+    hipblasOperation_t      transa, transb;
+    int                     m, n, k;
+    int                     lda, ldb, ldc;
+    hipblasDatatype_t       a_type, b_type, c_type, compute_type;
+    hipblasGemmAlgo_t       algo;
+    hipblasMatmulEpilogue_t epilogue;
+    int                     device         = 0;
+    size_t                  workspace_size = 0;
+
+    // Epilogue operands: 1 in compute_type on the host and n ones of c_type
+    // on the device, the bias being added as the rank-1 update bias * ones^T
+    unsigned char one[16] = {};
+    void*         ones    = nullptr;
+
+    hipblas_matmul_plan() = default;
+    hipblas_matmul_plan(const hipblas_matmul_plan&) = delete;
+    hipblas_matmul_plan& operator=(const hipblas_matmul_plan&) = delete;
+    ~hipblas_matmul_plan();
+};
+
+// Validate and store the arguments of hipblasMatmulPlanCreate and allocate the
+// epilogue operands
+hipblasStatus_t hipblas_matmul_plan_init(hipblas_matmul_plan&    plan,
+                                         hipblasOperation_t      transa,
+                                         hipblasOperation_t      transb,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         hipblasDatatype_t       a_type,
+                                         int                     lda,
+                                         hipblasDatatype_t       b_type,
+                                         int                     ldb,
+                                         hipblasDatatype_t       c_type,
+                                         int                     ldc,
+                                         hipblasDatatype_t       compute_type,
+                                         hipblasGemmAlgo_t       algo,
+                                         hipblasMatmulEpilogue_t epilogue);
+
+// Whether the plan was created on the current device, the only one it may be
+// executed on
+bool hipblas_matmul_plan_current(const hipblas_matmul_plan& plan);
+
+// Apply the plan's epilogue to C once its GEMM has been issued
+hipblasStatus_t hipblas_matmul_plan_epilogue(hipblasHandle_t            handle,
+                                             const hipblas_matmul_plan& plan,
+                                             void*                      C,
+                                             const void*                bias);
@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <hip/hip_runtime_api.h>
+
+// Kind of memory a pointer refers to, as reported by hipPointerGetAttributes
+enum class hipblas_memory_type
+{
+    pageable, // host memory unknown to the runtime
+    host, // pinned or registered host memory
+    device,
+    managed,
+};
+
+// Pageable memory is reported as unregistered by HIP 6 and later, and makes
+// the query fail before, so a failed query also means pageable memory.
+inline hipblas_memory_type hipblas_get_memory_type(const void* ptr)
+{
+    hipPointerAttribute_t attr;
+    if(!ptr || hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+    {
+        (void)hipGetLastError();
+        return hipblas_memory_type::pageable;
+    }
+    if(attr.isManaged)
+        return hipblas_memory_type::managed;
+#if HIP_VERSION_MAJOR >= 6
+    switch(attr.type)
+    {
+    case hipMemoryTypeUnregistered:
+        return hipblas_memory_type::pageable;
+    case hipMemoryTypeHost:
+        return hipblas_memory_type::host;
+    case hipMemoryTypeManaged:
+        return hipblas_memory_type::managed;
+    default:
+        return hipblas_memory_type::device;
+    }
+#else
+    return attr.memoryType == hipMemoryTypeHost ? hipblas_memory_type::host
+                                                : hipblas_memory_type::device;
+#endif
+}
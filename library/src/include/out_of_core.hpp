@@ -0,0 +1,819 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "functions.hpp"
+#include "hipblas.h"
+#include "memory_type.hpp"
+#include "staging.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <type_traits>
+#include <vector>
+
+// Tiled Level-3 routines on matrices that do not live on the device. The
+// result is split into independent jobs, each of which copies its tiles in,
+// computes and copies the result back on one stream. hipblasXgemmOutOfCore
+// runs the jobs on one device, the hipblasXt routines share them between
+// devices.
+
+constexpr int ooc_lanes = 2;
+
+inline hipblasStatus_t ooc_status(hipError_t error)
+{
+    switch(error)
+    {
+    case hipSuccess:
+        return HIPBLAS_STATUS_SUCCESS;
+    case hipErrorOutOfMemory:
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    default:
+        return HIPBLAS_STATUS_EXECUTION_FAILED;
+    }
+}
+
+#define OOC_RETURN_IF_ERROR(expr)                 \
+    do                                            \
+    {                                             \
+        hipblasStatus_t ooc_status_ = (expr);     \
+        if(ooc_status_ != HIPBLAS_STATUS_SUCCESS) \
+            return ooc_status_;                   \
+    } while(0)
+
+#define OOC_RETURN_IF_HIP_ERROR(expr) OOC_RETURN_IF_ERROR(ooc_status(expr))
+
+template <typename T>
+T ooc_real_scalar(double value)
+{
+    if constexpr(std::is_floating_point<T>{})
+        return T(value);
+    else
+    {
+        using R    = std::conditional_t<sizeof(T) == 2 * sizeof(float), float, double>;
+        R parts[2] = {R(value), 0};
+        T scalar;
+        memcpy(&scalar, parts, sizeof(scalar));
+        return scalar;
+    }
+}
+
+template <typename T>
+bool ooc_is_zero(const T& scalar)
+{
+    T zero = ooc_real_scalar<T>(0);
+    return !memcmp(&scalar, &zero, sizeof(T));
+}
+
+// Copy a rows x cols column-major block to or from a device tile packed with
+// leading dimension rows. The other side may be host memory or memory of any
+// device, so the copy kind is left to the runtime. Pageable host memory goes
+// through the pinned buffers of hipblasSetMatrixAsync, so that its copies
+// still overlap the work of the other lane.
+template <typename T>
+hipblasStatus_t ooc_load_tile(T* dst, const T* src, int ld, int rows, int cols, hipStream_t stream)
+{
+    if(rows <= 0 || cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    bool            staged;
+    hipblasStatus_t status = hipblas_staged_copy(
+        true, rows, cols, sizeof(T), src, 1, ld, dst, 1, rows, stream, true, staged);
+    if(staged)
+        return status;
+    return ooc_status(hipMemcpy2DAsync(dst,
+                                       rows * sizeof(T),
+                                       src,
+                                       size_t(ld) * sizeof(T),
+                                       rows * sizeof(T),
+                                       cols,
+                                       hipMemcpyDefault,
+                                       stream));
+}
+
+template <typename T>
+hipblasStatus_t ooc_store_tile(T* dst, int ld, const T* src, int rows, int cols, hipStream_t stream)
+{
+    if(rows <= 0 || cols <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    bool            staged;
+    hipblasStatus_t status = hipblas_staged_copy(
+        false, rows, cols, sizeof(T), src, 1, rows, dst, 1, ld, stream, true, staged);
+    if(staged)
+        return status;
+    return ooc_status(hipMemcpy2DAsync(dst,
+                                       size_t(ld) * sizeof(T),
+                                       src,
+                                       rows * sizeof(T),
+                                       rows * sizeof(T),
+                                       cols,
+                                       hipMemcpyDefault,
+                                       stream));
+}
+
+// Load the rows x cols block of op(A) at (r0, c0). The block keeps the
+// orientation A is stored in, so it is used with the same trans, and its
+// device leading dimension is returned in ld.
+template <typename T>
+hipblasStatus_t ooc_load_op_tile(T*                 dst,
+                                 const T*           A,
+                                 int                lda,
+                                 hipblasOperation_t trans,
+                                 int                r0,
+                                 int                c0,
+                                 int                rows,
+                                 int                cols,
+                                 hipStream_t        stream,
+                                 int&               ld)
+{
+    if(trans == HIPBLAS_OP_N)
+    {
+        ld = std::max(1, rows);
+        return ooc_load_tile(dst, A + r0 + size_t(c0) * lda, lda, rows, cols, stream);
+    }
+    ld = std::max(1, cols);
+    return ooc_load_tile(dst, A + c0 + size_t(r0) * lda, lda, cols, rows, stream);
+}
+
+// True unless ptr is device memory, so that the host can read it
+inline bool ooc_is_host_pointer(const void* ptr)
+{
+    return hipblas_get_memory_type(ptr) != hipblas_memory_type::device;
+}
+
+// The jobs read the scalars on the host and pass them to the lane handles in
+// host pointer mode, so a device scalar is copied to storage once the work
+// queued before the call has produced it
+template <typename T>
+hipblasStatus_t ooc_host_scalar(const T*& scalar, T& storage, hipStream_t stream)
+{
+    OOC_RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&storage, scalar, sizeof(T), hipMemcpyDeviceToHost, stream));
+    OOC_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    scalar = &storage;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Host BLAS routines with the CBLAS signatures, used by hipblasXt for the
+// share of blocks computed on the host. The hipBLAS enum values match the CBLAS
+// ones, so they are passed through unchanged.
+constexpr int ooc_cblas_col_major = 102;
+
+template <typename T>
+struct ooc_cblas
+{
+    // Real scalars are passed by value, complex ones by pointer
+    using scalar = std::conditional_t<std::is_floating_point<T>{}, T, const void*>;
+    using gemm_t = void (*)(
+        int, int, int, int, int, int, scalar, const T*, int, const T*, int, scalar, T*, int);
+    using syrk_t = void (*)(int, int, int, int, int, scalar, const T*, int, scalar, T*, int);
+    using trsm_t = void (*)(int, int, int, int, int, int, int, scalar, const T*, int, T*, int);
+
+    void* gemm = nullptr;
+    void* syrk = nullptr;
+    void* trsm = nullptr;
+
+    static scalar pass(const T* value)
+    {
+        if constexpr(std::is_floating_point<T>{})
+            return *value;
+        else
+            return value;
+    }
+};
+
+// Square tiles from HIPBLAS_OOC_TILE_SIZE if set, otherwise as large as half
+// the free memory of the current device allows
+template <typename T>
+hipblasStatus_t ooc_tile_size(int& tile)
+{
+    const char* env = getenv("HIPBLAS_OOC_TILE_SIZE");
+    tile            = env ? atoi(env) : 0;
+    if(tile > 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t free_bytes, total_bytes;
+    OOC_RETURN_IF_HIP_ERROR(hipMemGetInfo(&free_bytes, &total_bytes));
+    double elements = double(free_bytes) / 2 / (3 * ooc_lanes * sizeof(T));
+    tile            = std::max(64, std::min(8192, int(std::sqrt(elements)) / 64 * 64));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Streams, handles and device tiles of one out-of-core call on the current
+// device. Each lane has its own handle, created with the atomics mode of the
+// caller's, so that the two lanes never share a workspace. On destruction all
+// transfers have completed.
+template <typename T>
+struct ooc_context
+{
+    struct lane
+    {
+        hipStream_t     stream = nullptr;
+        hipblasHandle_t handle = nullptr;
+        T*              a      = nullptr;
+        T*              b      = nullptr;
+        T*              c      = nullptr;
+    };
+
+    lane lanes[ooc_lanes];
+    int  tile = 0;
+
+    ooc_context() = default;
+    ooc_context(const ooc_context&) = delete;
+    ooc_context& operator=(const ooc_context&) = delete;
+
+    hipblasStatus_t init(hipblasHandle_t handle, int tile_size)
+    {
+        tile = tile_size;
+        hipStream_t          stream;
+        hipblasAtomicsMode_t atomics_mode;
+        OOC_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        OOC_RETURN_IF_ERROR(hipblasGetAtomicsMode(handle, &atomics_mode));
+
+        // Work already queued on the handle may still use the matrices
+        OOC_RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        size_t tile_bytes = size_t(tile) * tile * sizeof(T);
+        for(auto& l : lanes)
+        {
+            OOC_RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&l.stream, hipStreamNonBlocking));
+            OOC_RETURN_IF_ERROR(hipblasCreate(&l.handle));
+            OOC_RETURN_IF_ERROR(hipblasSetStream(l.handle, l.stream));
+            OOC_RETURN_IF_ERROR(hipblasSetAtomicsMode(l.handle, atomics_mode));
+            OOC_RETURN_IF_HIP_ERROR(hipMalloc((void**)&l.a, tile_bytes));
+            OOC_RETURN_IF_HIP_ERROR(hipMalloc((void**)&l.b, tile_bytes));
+            OOC_RETURN_IF_HIP_ERROR(hipMalloc((void**)&l.c, tile_bytes));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Wait for every lane, reporting the first failed transfer or kernel
+    hipblasStatus_t finish()
+    {
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(auto& l : lanes)
+        {
+            if(!l.stream)
+                continue;
+            hipblasStatus_t lane_status = ooc_status(hipStreamSynchronize(l.stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = lane_status;
+        }
+        return status;
+    }
+
+    ~ooc_context()
+    {
+        (void)finish();
+        for(auto& l : lanes)
+        {
+            (void)hipFree(l.a);
+            (void)hipFree(l.b);
+            (void)hipFree(l.c);
+            if(l.handle)
+                (void)hipblasDestroy(l.handle);
+            if(l.stream)
+                (void)hipStreamDestroy(l.stream);
+        }
+    }
+};
+
+// Each problem below validates its arguments in check(), splits the result
+// into tiles of the given size in plan() and computes one of the jobs in
+// run(), on the lane of the context it is given, or in run_host() with the
+// host BLAS when all its matrices are host_resident() and host_routines()
+// finds every routine it calls. Jobs write disjoint parts of the result, so
+// they may run in any order, on any device or on the host.
+
+template <typename T>
+struct ooc_gemm
+{
+    hipblasOperation_t transa, transb;
+    int                m, n, k;
+    const T*           alpha;
+    const T*           A;
+    int                lda;
+    const T*           B;
+    int                ldb;
+    const T*           beta;
+    T*                 C;
+    int                ldc;
+    int                tile = 0, row_tiles = 0;
+
+    static constexpr hipblasXtBlasOp_t xt_op = HIPBLAS_XT_GEMM;
+
+    hipblasStatus_t check() const
+    {
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+           || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m && n && (!alpha || !beta || !C || (k && (!A || !B))))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int max_dim() const
+    {
+        return std::max({m, n, k});
+    }
+
+    hipblasStatus_t host_scalars(T* storage, hipStream_t stream)
+    {
+        OOC_RETURN_IF_ERROR(ooc_host_scalar(alpha, storage[0], stream));
+        return ooc_host_scalar(beta, storage[1], stream);
+    }
+
+    // One block of C per job
+    int plan(int t)
+    {
+        tile      = t;
+        row_tiles = (m + t - 1) / t;
+        return m && n ? row_tiles * ((n + t - 1) / t) : 0;
+    }
+
+    hipblasStatus_t run(typename ooc_context<T>::lane& l, int job) const
+    {
+        using F     = hipblas_functions<T>;
+        const T one = ooc_real_scalar<T>(1);
+        int     t   = tile;
+        int     i0  = job % row_tiles * t;
+        int     j0  = job / row_tiles * t;
+        int     mb  = std::min(t, m - i0);
+        int     nb  = std::min(t, n - j0);
+        if(!ooc_is_zero(*beta))
+            OOC_RETURN_IF_ERROR(
+                ooc_load_tile(l.c, C + i0 + size_t(j0) * ldc, ldc, mb, nb, l.stream));
+
+        // Accumulate over the k panels on the device
+        for(int l0 = 0; l0 < std::max(k, 1); l0 += t)
+        {
+            int kb = std::min(t, k - l0);
+            int ld_a, ld_b;
+            OOC_RETURN_IF_ERROR(
+                ooc_load_op_tile(l.a, A, lda, transa, i0, l0, mb, kb, l.stream, ld_a));
+            OOC_RETURN_IF_ERROR(
+                ooc_load_op_tile(l.b, B, ldb, transb, l0, j0, kb, nb, l.stream, ld_b));
+            OOC_RETURN_IF_ERROR(F::gemm(l.handle,
+                                      transa,
+                                      transb,
+                                      mb,
+                                      nb,
+                                      kb,
+                                      alpha,
+                                      l.a,
+                                      ld_a,
+                                      l.b,
+                                      ld_b,
+                                      l0 ? &one : beta,
+                                      l.c,
+                                      mb));
+        }
+
+        return ooc_store_tile(C + i0 + size_t(j0) * ldc, ldc, l.c, mb, nb, l.stream);
+    }
+
+    bool host_resident() const
+    {
+        return ooc_is_host_pointer(A) && ooc_is_host_pointer(B) && ooc_is_host_pointer(C);
+    }
+
+    bool host_routines(const ooc_cblas<T>& cblas) const
+    {
+        return cblas.gemm != nullptr;
+    }
+
+    void run_host(const ooc_cblas<T>& cblas, int job) const
+    {
+        int t  = tile;
+        int i0 = job % row_tiles * t;
+        int j0 = job / row_tiles * t;
+        ((typename ooc_cblas<T>::gemm_t)cblas.gemm)(
+            ooc_cblas_col_major,
+            transa,
+            transb,
+            std::min(t, m - i0),
+            std::min(t, n - j0),
+            k,
+            ooc_cblas<T>::pass(alpha),
+            transa == HIPBLAS_OP_N ? A + i0 : A + size_t(i0) * lda,
+            lda,
+            transb == HIPBLAS_OP_N ? B + size_t(j0) * ldb : B + j0,
+            ldb,
+            ooc_cblas<T>::pass(beta),
+            C + i0 + size_t(j0) * ldc,
+            ldc);
+    }
+};
+
+template <typename T>
+struct ooc_syrk
+{
+    hipblasFillMode_t  uplo;
+    hipblasOperation_t trans;
+    int                n, k;
+    const T*           alpha;
+    const T*           A;
+    int                lda;
+    const T*           beta;
+    T*                 C;
+    int                ldc;
+    int                tile = 0;
+    std::vector<int>   blocks; // (i0, j0) pairs of the tiles in the uplo triangle
+
+    static constexpr hipblasXtBlasOp_t xt_op = HIPBLAS_XT_SYRK;
+
+    hipblasStatus_t check() const
+    {
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n < 0 || k < 0 || lda < std::max(1, trans == HIPBLAS_OP_N ? n : k)
+           || ldc < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n && (!alpha || !beta || !C || (k && !A)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int max_dim() const
+    {
+        return std::max(n, k);
+    }
+
+    hipblasStatus_t host_scalars(T* storage, hipStream_t stream)
+    {
+        OOC_RETURN_IF_ERROR(ooc_host_scalar(alpha, storage[0], stream));
+        return ooc_host_scalar(beta, storage[1], stream);
+    }
+
+    int plan(int t)
+    {
+        tile = t;
+        blocks.clear();
+        for(int j0 = 0; j0 < n; j0 += t)
+        {
+            int i_first = uplo == HIPBLAS_FILL_MODE_LOWER ? j0 : 0;
+            int i_last  = uplo == HIPBLAS_FILL_MODE_LOWER ? n : j0 + 1;
+            for(int i0 = i_first; i0 < i_last; i0 += t)
+            {
+                blocks.push_back(i0);
+                blocks.push_back(j0);
+            }
+        }
+        return int(blocks.size() / 2);
+    }
+
+    // Diagonal blocks are a SYRK of one panel of op(A), the others a GEMM of two
+    hipblasStatus_t run(typename ooc_context<T>::lane& l, int job) const
+    {
+        using F                   = hipblas_functions<T>;
+        const T            one    = ooc_real_scalar<T>(1);
+        int                t      = tile;
+        int                i0     = blocks[2 * job];
+        int                j0     = blocks[2 * job + 1];
+        int                mb     = std::min(t, n - i0);
+        int                nb     = std::min(t, n - j0);
+        bool               diag   = i0 == j0;
+        hipblasOperation_t transb = trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+
+        // The other triangle of a diagonal block is written back, so it is
+        // always loaded
+        if(diag || !ooc_is_zero(*beta))
+            OOC_RETURN_IF_ERROR(
+                ooc_load_tile(l.c, C + i0 + size_t(j0) * ldc, ldc, mb, nb, l.stream));
+
+        for(int l0 = 0; l0 < std::max(k, 1); l0 += t)
+        {
+            int      kb        = std::min(t, k - l0);
+            const T* beta_step = l0 ? &one : beta;
+            int      ld_a, ld_b;
+            OOC_RETURN_IF_ERROR(
+                ooc_load_op_tile(l.a, A, lda, trans, i0, l0, mb, kb, l.stream, ld_a));
+            if(diag)
+            {
+                OOC_RETURN_IF_ERROR(F::syrk(
+                    l.handle, uplo, trans, mb, kb, alpha, l.a, ld_a, beta_step, l.c, mb));
+                continue;
+            }
+
+            // op(A)_j^T is loaded as the block of op(A) at (j0, l0)
+            OOC_RETURN_IF_ERROR(
+                ooc_load_op_tile(l.b, A, lda, trans, j0, l0, nb, kb, l.stream, ld_b));
+            OOC_RETURN_IF_ERROR(F::gemm(l.handle,
+                                      trans,
+                                      transb,
+                                      mb,
+                                      nb,
+                                      kb,
+                                      alpha,
+                                      l.a,
+                                      ld_a,
+                                      l.b,
+                                      ld_b,
+                                      beta_step,
+                                      l.c,
+                                      mb));
+        }
+
+        return ooc_store_tile(C + i0 + size_t(j0) * ldc, ldc, l.c, mb, nb, l.stream);
+    }
+
+    bool host_resident() const
+    {
+        return ooc_is_host_pointer(A) && ooc_is_host_pointer(C);
+    }
+
+    // Off-diagonal blocks are a GEMM
+    bool host_routines(const ooc_cblas<T>& cblas) const
+    {
+        return cblas.syrk && cblas.gemm;
+    }
+
+    void run_host(const ooc_cblas<T>& cblas, int job) const
+    {
+        int      t   = tile;
+        int      i0  = blocks[2 * job];
+        int      j0  = blocks[2 * job + 1];
+        int      mb  = std::min(t, n - i0);
+        int      nb  = std::min(t, n - j0);
+        const T* A_i = trans == HIPBLAS_OP_N ? A + i0 : A + size_t(i0) * lda;
+        const T* A_j = trans == HIPBLAS_OP_N ? A + j0 : A + size_t(j0) * lda;
+        T*       C_b = C + i0 + size_t(j0) * ldc;
+        if(i0 == j0)
+            ((typename ooc_cblas<T>::syrk_t)cblas.syrk)(ooc_cblas_col_major,
+                                                        uplo,
+                                                        trans,
+                                                        mb,
+                                                        k,
+                                                        ooc_cblas<T>::pass(alpha),
+                                                        A_i,
+                                                        lda,
+                                                        ooc_cblas<T>::pass(beta),
+                                                        C_b,
+                                                        ldc);
+        else
+            ((typename ooc_cblas<T>::gemm_t)cblas.gemm)(
+                ooc_cblas_col_major,
+                trans,
+                trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+                mb,
+                nb,
+                k,
+                ooc_cblas<T>::pass(alpha),
+                A_i,
+                lda,
+                A_j,
+                lda,
+                ooc_cblas<T>::pass(beta),
+                C_b,
+                ldc);
+    }
+};
+
+template <typename T>
+struct ooc_trsm
+{
+    hipblasSideMode_t  side;
+    hipblasFillMode_t  uplo;
+    hipblasOperation_t transa;
+    hipblasDiagType_t  diag;
+    int                m, n;
+    const T*           alpha;
+    const T*           A;
+    int                lda;
+    T*                 B;
+    int                ldb;
+    int                tile = 0;
+
+    static constexpr hipblasXtBlasOp_t xt_op = HIPBLAS_XT_TRSM;
+
+    bool left() const
+    {
+        return side == HIPBLAS_SIDE_LEFT;
+    }
+
+    hipblasStatus_t check() const
+    {
+        if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m < 0 || n < 0 || lda < std::max(1, left() ? m : n) || ldb < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m && n && (!alpha || !A || !B))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int max_dim() const
+    {
+        return std::max(m, n);
+    }
+
+    hipblasStatus_t host_scalars(T* storage, hipStream_t stream)
+    {
+        return ooc_host_scalar(alpha, storage[0], stream);
+    }
+
+    // Panels of B across the dimension op(A) does not touch are independent
+    int plan(int t)
+    {
+        tile = t;
+        return m && n ? ((left() ? n : m) + t - 1) / t : 0;
+    }
+
+    // Blocks of X along the dimension of op(A) are solved in dependency order:
+    // forward when op(A) is lower triangular on the left or upper triangular
+    // on the right, backward otherwise. Each is updated with the blocks solved
+    // before it, read back from B, then solved against the diagonal block.
+    hipblasStatus_t run(typename ooc_context<T>::lane& l, int job) const
+    {
+        using F           = hipblas_functions<T>;
+        const T minus_one = ooc_real_scalar<T>(-1);
+        const T one       = ooc_real_scalar<T>(1);
+        int     t         = tile;
+        int     ka        = left() ? m : n;
+        int     panel     = left() ? n : m;
+        int     p0        = job * t;
+        int     pb        = std::min(t, panel - p0);
+        bool    lower_op  = (uplo == HIPBLAS_FILL_MODE_LOWER) == (transa == HIPBLAS_OP_N);
+        bool    forward   = left() ? lower_op : !lower_op;
+        int     blocks    = (ka + t - 1) / t;
+
+        for(int step = 0; step < blocks; step++)
+        {
+            int bi   = forward ? step : blocks - 1 - step;
+            int i0   = bi * t;
+            int ib   = std::min(t, ka - i0);
+            T*  B_i  = left() ? B + i0 + size_t(p0) * ldb : B + p0 + size_t(i0) * ldb;
+            int rows = left() ? ib : pb;
+            int cols = left() ? pb : ib;
+            OOC_RETURN_IF_ERROR(ooc_load_tile(l.c, B_i, ldb, rows, cols, l.stream));
+
+            for(int prev = 0; prev < step; prev++)
+            {
+                int      bj        = forward ? prev : blocks - 1 - prev;
+                int      j0        = bj * t;
+                int      jb        = std::min(t, ka - j0);
+                const T* beta_step = prev ? &one : alpha;
+                int      ld_a;
+                if(left())
+                {
+                    OOC_RETURN_IF_ERROR(
+                        ooc_load_op_tile(l.a, A, lda, transa, i0, j0, ib, jb, l.stream, ld_a));
+                    OOC_RETURN_IF_ERROR(
+                        ooc_load_tile(l.b, B + j0 + size_t(p0) * ldb, ldb, jb, pb, l.stream));
+                    OOC_RETURN_IF_ERROR(F::gemm(l.handle,
+                                              transa,
+                                              HIPBLAS_OP_N,
+                                              ib,
+                                              pb,
+                                              jb,
+                                              &minus_one,
+                                              l.a,
+                                              ld_a,
+                                              l.b,
+                                              jb,
+                                              beta_step,
+                                              l.c,
+                                              rows));
+                }
+                else
+                {
+                    OOC_RETURN_IF_ERROR(
+                        ooc_load_op_tile(l.a, A, lda, transa, j0, i0, jb, ib, l.stream, ld_a));
+                    OOC_RETURN_IF_ERROR(
+                        ooc_load_tile(l.b, B + p0 + size_t(j0) * ldb, ldb, pb, jb, l.stream));
+                    OOC_RETURN_IF_ERROR(F::gemm(l.handle,
+                                              HIPBLAS_OP_N,
+                                              transa,
+                                              pb,
+                                              ib,
+                                              jb,
+                                              &minus_one,
+                                              l.b,
+                                              pb,
+                                              l.a,
+                                              ld_a,
+                                              beta_step,
+                                              l.c,
+                                              rows));
+                }
+            }
+
+            // alpha was applied by the updates when there were any
+            OOC_RETURN_IF_ERROR(
+                ooc_load_tile(l.a, A + i0 + size_t(i0) * lda, lda, ib, ib, l.stream));
+            OOC_RETURN_IF_ERROR(F::trsm(l.handle,
+                                      side,
+                                      uplo,
+                                      transa,
+                                      diag,
+                                      rows,
+                                      cols,
+                                      step ? &one : alpha,
+                                      l.a,
+                                      ib,
+                                      l.c,
+                                      rows));
+            OOC_RETURN_IF_ERROR(ooc_store_tile(B_i, ldb, l.c, rows, cols, l.stream));
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    bool host_resident() const
+    {
+        return ooc_is_host_pointer(A) && ooc_is_host_pointer(B);
+    }
+
+    bool host_routines(const ooc_cblas<T>& cblas) const
+    {
+        return cblas.trsm != nullptr;
+    }
+
+    // The whole panel is solved by one host call
+    void run_host(const ooc_cblas<T>& cblas, int job) const
+    {
+        int p0 = job * tile;
+        int pb = std::min(tile, (left() ? n : m) - p0);
+        ((typename ooc_cblas<T>::trsm_t)cblas.trsm)(ooc_cblas_col_major,
+                                                    side,
+                                                    uplo,
+                                                    transa,
+                                                    diag,
+                                                    left() ? m : pb,
+                                                    left() ? pb : n,
+                                                    ooc_cblas<T>::pass(alpha),
+                                                    A,
+                                                    lda,
+                                                    left() ? B + size_t(p0) * ldb : B + p0,
+                                                    ldb);
+    }
+};
+
+// Run the jobs with tiles of the given size on the current device,
+// alternating between its lanes, and take each job index from next_job. Jobs
+// are taken one at a time, so several devices sharing next_job balance their
+// load as they go.
+template <typename T, typename Problem, typename NextJob>
+hipblasStatus_t ooc_run_jobs(hipblasHandle_t handle,
+                             const Problem&  problem,
+                             int             jobs,
+                             int             tile,
+                             NextJob&&       next_job)
+{
+    ooc_context<T> ctx;
+    OOC_RETURN_IF_ERROR(ctx.init(handle, tile));
+    for(int count = 0, job; (job = next_job()) < jobs; count++)
+        OOC_RETURN_IF_ERROR(problem.run(ctx.lanes[count % ooc_lanes], job));
+    return ctx.finish();
+}
+
+// Single-device driver of hipblasXgemmOutOfCore and friends
+template <typename T, typename Problem>
+hipblasStatus_t ooc_run(hipblasHandle_t handle, Problem problem)
+{
+    OOC_RETURN_IF_ERROR(problem.check());
+    int tile;
+    OOC_RETURN_IF_ERROR(ooc_tile_size<T>(tile));
+    tile     = std::max(1, std::min(tile, problem.max_dim()));
+    int jobs = problem.plan(tile);
+    if(!jobs)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasPointerMode_t mode;
+    T                    scalars[2];
+    OOC_RETURN_IF_ERROR(hipblasGetPointerMode(handle, &mode));
+    if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+    {
+        hipStream_t stream;
+        OOC_RETURN_IF_ERROR(hipblasGetStream(handle, &stream));
+        OOC_RETURN_IF_ERROR(problem.host_scalars(scalars, stream));
+    }
+
+    int next = 0;
+    return ooc_run_jobs<T>(handle, problem, jobs, tile, [&] { return next++; });
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+// hipblasSet/GetVector/Matrix and their Async forms with a pageable host
+// buffer copy through a ring of pinned chunks per device: the strided host
+// data is packed into one chunk while the copy of the previous chunk is in
+// flight. Sets staged when the copy was done here; otherwise the caller uses
+// the backend copy, which is also the case for pinned host buffers, small
+// copies and streams being captured. Vectors are copied as one column with
+// element increments host_inc and device_inc; matrices have increments 1.
+hipblasStatus_t hipblas_staged_copy(bool        to_device,
+                                    int         rows,
+                                    int         cols,
+                                    int         elem_size,
+                                    const void* src,
+                                    int         src_inc,
+                                    int         src_ld,
+                                    void*       dst,
+                                    int         dst_inc,
+                                    int         dst_ld,
+                                    hipStream_t stream,
+                                    bool        async,
+                                    bool&       staged);
+
+#define HIPBLAS_STAGED_COPY(...)                                                         \
+    do                                                                                   \
+    {                                                                                    \
+        bool            staged_copy_   = false;                                          \
+        hipblasStatus_t staged_status_ = hipblas_staged_copy(__VA_ARGS__, staged_copy_); \
+        if(staged_copy_)                                                                 \
+            return staged_status_;                                                       \
+    } while(0)
+
+// Copy batch_count matrices at a constant stride between host and device, for
+// the batched transfer API; leading dimensions and strides are in elements.
+// Pageable host memory is staged as above, several matrices to a chunk; the
+// device side is copied with one 3D copy per chunk, or for the whole batch
+// from pinned memory, when the strides are whole numbers of columns.
+hipblasStatus_t hipblas_copy_strided_batched(bool          to_device,
+                                             int           rows,
+                                             int           cols,
+                                             int           elem_size,
+                                             const void*   src,
+                                             int64_t       src_ld,
+                                             hipblasStride src_stride,
+                                             void*         dst,
+                                             int64_t       dst_ld,
+                                             hipblasStride dst_stride,
+                                             int           batch_count,
+                                             hipStream_t   stream,
+                                             bool          async);
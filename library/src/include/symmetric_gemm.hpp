@@ -0,0 +1,459 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "deferred.hpp"
+#include "functions.hpp"
+#include "gemmt.hpp"
+#include "hipblas.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Number of handles with a hipblasSymmetricOutput_t other than
+// HIPBLAS_SYMMETRIC_OUTPUT_NONE, checked before any other work
+extern std::atomic<int> hipblas_symmetric_handles;
+
+hipblasSymmetricOutput_t hipblas_symmetric_output(hipblasHandle_t handle);
+
+// hipblasXgemm with a symmetric C declared by hipblasSetSymmetricOutput. For
+// complementary transposes op(A)*op(B) is op(A)*op(A)^T when B is A, which is
+// syrk (herk for a conjugate transpose), and otherwise a product syrkx (herkx)
+// computes one triangle of. The full output is computed in block rows from
+// the diagonal rightwards, and the part of each right of the diagonal block
+// is transposed below it.
+
+// Sets trans to the operation syrk or herk applies to A when op(A)*op(B) is
+// symmetric, or Hermitian, for one of transA and transB HIPBLAS_OP_N
+template <typename T>
+bool symmetric_gemm_trans(hipblasOperation_t  transa,
+                          hipblasOperation_t  transb,
+                          hipblasOperation_t& trans,
+                          bool&               hermitian)
+{
+    constexpr bool real       = std::is_floating_point<T>{};
+    auto           transposed = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+    hermitian = !real && (transa == HIPBLAS_OP_C || transb == HIPBLAS_OP_C);
+    if(transa == HIPBLAS_OP_N && transposed(transb))
+        trans = HIPBLAS_OP_N;
+    else if(transposed(transa) && transb == HIPBLAS_OP_N)
+        trans = real ? HIPBLAS_OP_T : transa;
+    else
+        return false;
+    return true;
+}
+
+// Real and imaginary parts of a host scalar
+template <typename T>
+auto symmetric_gemm_parts(const T& value)
+{
+    using R = std::conditional_t<sizeof(T) == 2 * sizeof(float), float, double>;
+    struct
+    {
+        R re, im;
+    } parts;
+    memcpy(&parts, &value, sizeof(parts));
+    return parts;
+}
+
+// Whether the call is one hipblasSetSymmetricOutput applies to, and the
+// operation syrk or herk applies to A for it
+template <typename T>
+bool symmetric_gemm_applies(hipblasHandle_t           handle,
+                            hipblasOperation_t        transa,
+                            hipblasOperation_t        transb,
+                            int                       m,
+                            int                       n,
+                            int                       k,
+                            int                       lda,
+                            int                       ldb,
+                            int                       ldc,
+                            int                       batch_count,
+                            hipblasSymmetricOutput_t& output,
+                            hipblasOperation_t&       trans,
+                            bool&                     hermitian)
+{
+    output = hipblas_symmetric_output(handle);
+    if(output == HIPBLAS_SYMMETRIC_OUTPUT_NONE || m != n || n <= 0 || k < 0 || batch_count <= 0
+       || !symmetric_gemm_trans<T>(transa, transb, trans, hermitian))
+        return false;
+
+    // Invalid arguments are left for the GEMM to report
+    return lda >= std::max(1, transa == HIPBLAS_OP_N ? n : k)
+           && ldb >= std::max(1, transb == HIPBLAS_OP_N ? k : n) && ldc >= std::max(1, n);
+}
+
+// Compute C in block rows, from the diagonal rightwards with one GEMM each,
+// and transpose the part right of the diagonal block below it
+template <typename T>
+hipblasStatus_t symmetric_gemm_full(hipblasHandle_t    handle,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                n,
+                                    int                k,
+                                    const T*           alpha,
+                                    const T*           A,
+                                    int                lda,
+                                    const T*           B,
+                                    int                ldb,
+                                    const T*           beta,
+                                    T*                 C,
+                                    int                ldc,
+                                    hipblasOperation_t mirror,
+                                    bool               device_scalars)
+{
+    using F          = hipblas_functions<T>;
+    const T one      = gemmt_real_scalar<T>(1);
+    const T zero     = gemmt_real_scalar<T>(0);
+    int     nb       = gemmt_block(n);
+    auto    A_row    = [&](int i) { return transa == HIPBLAS_OP_N ? A + i : A + size_t(i) * lda; };
+    auto    B_column = [&](int j) { return transb == HIPBLAS_OP_N ? B + size_t(j) * ldb : B + j; };
+
+    for(int i0 = 0; i0 < n; i0 += nb)
+    {
+        int             ib     = std::min(nb, n - i0);
+        int             i1     = i0 + ib;
+        hipblasStatus_t status = F::gemm(handle,
+                                         transa,
+                                         transb,
+                                         ib,
+                                         n - i0,
+                                         k,
+                                         alpha,
+                                         A_row(i0),
+                                         lda,
+                                         B_column(i0),
+                                         ldb,
+                                         beta,
+                                         C + i0 + size_t(i0) * ldc,
+                                         ldc);
+        if(status != HIPBLAS_STATUS_SUCCESS || i1 == n)
+            return status;
+
+        // C(i1:n, i0:i1) = C(i0:i1, i1:n)^T, with host scalars
+        if(device_scalars)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        T* below = C + i1 + size_t(i0) * ldc;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::geam(handle,
+                             mirror,
+                             HIPBLAS_OP_N,
+                             n - i1,
+                             ib,
+                             &one,
+                             C + i0 + size_t(i1) * ldc,
+                             ldc,
+                             &zero,
+                             below,
+                             ldc,
+                             below,
+                             ldc);
+        if(device_scalars)
+        {
+            hipblasStatus_t restore = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = restore;
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Strided form; batch_count 1 is the plain form. Sets done when C was
+// computed here, otherwise the caller runs the GEMM, which is also the case
+// when the backend does not support the routine used.
+template <typename T>
+hipblasStatus_t hipblas_symmetric_gemm(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int                lda,
+                                       int64_t            stride_a,
+                                       const T*           B,
+                                       int                ldb,
+                                       int64_t            stride_b,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int                ldc,
+                                       int64_t            stride_c,
+                                       int                batch_count,
+                                       bool&              done)
+{
+    using F = hipblas_functions<T>;
+    hipblasSymmetricOutput_t output;
+    hipblasOperation_t       trans;
+    bool                     hermitian;
+    if(!symmetric_gemm_applies<T>(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  lda,
+                                  ldb,
+                                  ldc,
+                                  batch_count,
+                                  output,
+                                  trans,
+                                  hermitian))
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_internal_call_guard internal;
+    hipblasPointerMode_t        pointer_mode;
+    hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    bool device_scalars = pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+    if(output == HIPBLAS_SYMMETRIC_OUTPUT_FULL)
+    {
+        // A single block row saves nothing
+        if(n <= gemmt_block(n))
+            return HIPBLAS_STATUS_SUCCESS;
+
+        done = true;
+        for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = symmetric_gemm_full(handle,
+                                         transa,
+                                         transb,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A + b * stride_a,
+                                         lda,
+                                         B + b * stride_b,
+                                         ldb,
+                                         beta,
+                                         C + b * stride_c,
+                                         ldc,
+                                         hermitian ? HIPBLAS_OP_C : HIPBLAS_OP_T,
+                                         device_scalars);
+        return status;
+    }
+
+    hipblasFillMode_t uplo = output == HIPBLAS_SYMMETRIC_OUTPUT_UPPER ? HIPBLAS_FILL_MODE_UPPER
+                                                                      : HIPBLAS_FILL_MODE_LOWER;
+    bool aliased = A == B && lda == ldb && stride_a == stride_b;
+    if constexpr(!std::is_floating_point<T>{})
+    {
+        if(hermitian)
+        {
+            // herk and herkx take a real beta, and herk a real alpha
+            if(device_scalars)
+                return HIPBLAS_STATUS_SUCCESS;
+            auto a = symmetric_gemm_parts(*alpha);
+            auto c = symmetric_gemm_parts(*beta);
+            if(c.im != 0 || (aliased && a.im != 0))
+                return HIPBLAS_STATUS_SUCCESS;
+
+            using H = hipblas_functions<T>;
+            if(aliased && batch_count == 1)
+                status = H::herk(handle, uplo, trans, n, k, &a.re, A, lda, &c.re, C, ldc);
+            else if(aliased)
+                status = H::herk_strided_batched(handle,
+                                                 uplo,
+                                                 trans,
+                                                 n,
+                                                 k,
+                                                 &a.re,
+                                                 A,
+                                                 lda,
+                                                 stride_a,
+                                                 &c.re,
+                                                 C,
+                                                 ldc,
+                                                 stride_c,
+                                                 batch_count);
+            else if(batch_count == 1)
+                status = H::herkx(handle, uplo, trans, n, k, alpha, A, lda, B, ldb, &c.re, C, ldc);
+            else
+                status = H::herkx_strided_batched(handle,
+                                                  uplo,
+                                                  trans,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  A,
+                                                  lda,
+                                                  stride_a,
+                                                  B,
+                                                  ldb,
+                                                  stride_b,
+                                                  &c.re,
+                                                  C,
+                                                  ldc,
+                                                  stride_c,
+                                                  batch_count);
+            done = status != HIPBLAS_STATUS_NOT_SUPPORTED;
+            return done ? status : HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+
+    if(aliased && batch_count == 1)
+        status = F::syrk(handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+    else if(aliased)
+        status = F::syrk_strided_batched(handle,
+                                         uplo,
+                                         trans,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         stride_a,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         stride_c,
+                                         batch_count);
+    else if(batch_count == 1)
+        status = F::syrkx(handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    else
+        status = F::syrkx_strided_batched(handle,
+                                          uplo,
+                                          trans,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          stride_a,
+                                          B,
+                                          ldb,
+                                          stride_b,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          stride_c,
+                                          batch_count);
+    done = status != HIPBLAS_STATUS_NOT_SUPPORTED;
+    return done ? status : HIPBLAS_STATUS_SUCCESS;
+}
+
+// Batched form, for the triangular outputs only
+template <typename T>
+hipblasStatus_t hipblas_symmetric_gemm(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T* const     A[],
+                                       int                lda,
+                                       const T* const     B[],
+                                       int                ldb,
+                                       const T*           beta,
+                                       T* const           C[],
+                                       int                ldc,
+                                       int                batch_count,
+                                       bool&              done)
+{
+    using F = hipblas_functions<T>;
+    hipblasSymmetricOutput_t output;
+    hipblasOperation_t       trans;
+    bool                     hermitian;
+    if(!symmetric_gemm_applies<T>(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  lda,
+                                  ldb,
+                                  ldc,
+                                  batch_count,
+                                  output,
+                                  trans,
+                                  hermitian)
+       || output == HIPBLAS_SYMMETRIC_OUTPUT_FULL)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblas_internal_call_guard internal;
+    hipblasPointerMode_t        pointer_mode;
+    hipblasStatus_t             status = hipblasGetPointerMode(handle, &pointer_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasFillMode_t uplo = output == HIPBLAS_SYMMETRIC_OUTPUT_UPPER ? HIPBLAS_FILL_MODE_UPPER
+                                                                      : HIPBLAS_FILL_MODE_LOWER;
+    bool aliased = A == B && lda == ldb;
+    if constexpr(!std::is_floating_point<T>{})
+    {
+        if(hermitian)
+        {
+            if(pointer_mode == HIPBLAS_POINTER_MODE_DEVICE)
+                return HIPBLAS_STATUS_SUCCESS;
+            auto a = symmetric_gemm_parts(*alpha);
+            auto c = symmetric_gemm_parts(*beta);
+            if(c.im != 0 || (aliased && a.im != 0))
+                return HIPBLAS_STATUS_SUCCESS;
+
+            using H = hipblas_functions<T>;
+            if(aliased)
+                status = H::herk_batched(
+                    handle, uplo, trans, n, k, &a.re, A, lda, &c.re, C, ldc, batch_count);
+            else
+                status = H::herkx_batched(
+                    handle, uplo, trans, n, k, alpha, A, lda, B, ldb, &c.re, C, ldc, batch_count);
+            done = status != HIPBLAS_STATUS_NOT_SUPPORTED;
+            return done ? status : HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+
+    if(aliased)
+        status = F::syrk_batched(
+            handle, uplo, trans, n, k, alpha, A, lda, beta, C, ldc, batch_count);
+    else
+        status = F::syrkx_batched(
+            handle, uplo, trans, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    done = status != HIPBLAS_STATUS_NOT_SUPPORTED;
+    return done ? status : HIPBLAS_STATUS_SUCCESS;
+}
+
+// Run a typed GEMM as a symmetric update if the handle declares its output
+// symmetric; the arguments are those of hipblas_symmetric_gemm without done.
+// Calls made by hipBLAS itself are left alone.
+#define HIPBLAS_SYMMETRIC_GEMM(T, ...)                                     \
+    do                                                                     \
+    {                                                                      \
+        if(hipblas_symmetric_handles.load(std::memory_order_relaxed)       \
+           && !hipblas_deferred_internal)                                  \
+        {                                                                  \
+            bool            symmetric_done_   = false;                     \
+            hipblasStatus_t symmetric_status_ = hipblas_symmetric_gemm<T>( \
+                __VA_ARGS__, symmetric_done_);                             \
+            if(symmetric_done_)                                            \
+                return symmetric_status_;                                  \
+        }                                                                  \
+    } while(0)
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// The backend handles created for the threads bound to a handle by
+// hipblasSetThreadStream, each running on its thread's stream. Owned by the
+// state of the handle, so that hipblasDestroy releases them; the bindings of
+// the threads hold weak references. The mutex is taken when threads bind and
+// unbind, never by the calls themselves.
+struct hipblas_thread_streams
+{
+    std::mutex                   mutex;
+    std::vector<hipblasHandle_t> handles;
+
+    ~hipblas_thread_streams();
+};
+
+// Number of handles with a thread stream binding. While it is zero the entry
+// points skip the per-thread lookup with a single relaxed load.
+extern std::atomic<int> hipblas_thread_stream_handles;
+
+// The backend handle of the calling thread's binding to handle, or handle
+// itself when the thread has none. hipBLAS calling itself outside of an entry
+// point keeps the handle it was given.
+hipblasHandle_t hipblas_thread_handle(hipblasHandle_t handle);
+
+// Run the call on the calling thread's binding of the handle, if any, by
+// replacing handle with the thread's own backend handle
+#define HIPBLAS_THREAD_STREAM(handle)                                      \
+    do                                                                     \
+    {                                                                      \
+        if(hipblas_thread_stream_handles.load(std::memory_order_relaxed)) \
+            handle = hipblas_thread_handle(handle);                        \
+    } while(0)
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2022 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Device memory of a handle for the intermediates of the routines hipBLAS
+// composes from backend calls. It is kept between calls, so that those calls
+// neither allocate nor wait for the device: work on the handle's stream is
+// ordered after the previous user of the memory, with an event when the stream
+// changed since. The memory only grows, and freeing the smaller one then
+// waits for the device.
+struct hipblas_workspace
+{
+    void*       memory = nullptr;
+    size_t      size   = 0;
+    size_t      used   = 0; // by the scopes alive
+    size_t      wanted = 0; // by nested scopes that did not fit
+    hipStream_t stream = nullptr; // of the last user
+    hipEvent_t  event  = nullptr; // recorded after the last user
+
+    // Allocations of nested scopes that did not fit, freed with the memory
+    std::vector<void*> retired;
+
+    hipblas_workspace() = default;
+    ~hipblas_workspace();
+
+    hipblas_workspace(const hipblas_workspace&) = delete;
+    hipblas_workspace& operator=(const hipblas_workspace&) = delete;
+};
+
+// Part of the handle's workspace for the lifetime of the object, which ends
+// once the call has enqueued its work on the handle's stream. Scopes opened
+// while another is alive take the memory after it, or an allocation of their
+// own when it does not fit.
+class hipblas_workspace_scope
+{
+    hipblas_workspace* workspace = nullptr;
+    void*              memory    = nullptr;
+    size_t             offset    = 0;
+    bool               owned     = false;
+    hipStream_t        stream    = nullptr;
+    hipblasStatus_t    result    = HIPBLAS_STATUS_SUCCESS;
+
+public:
+    hipblas_workspace_scope(hipblasHandle_t handle, size_t bytes);
+    ~hipblas_workspace_scope();
+
+    hipblas_workspace_scope(const hipblas_workspace_scope&) = delete;
+    hipblas_workspace_scope& operator=(const hipblas_workspace_scope&) = delete;
+
+    // ALLOC_FAILED, or the error of querying the handle's stream
+    hipblasStatus_t status() const
+    {
+        return result;
+    }
+
+    template <typename T = void>
+    T* data() const
+    {
+        return static_cast<T*>(memory);
+    }
+};
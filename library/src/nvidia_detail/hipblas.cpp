@@ -22,11 +22,25 @@
  * ************************************************************************ */
 
 #include "hipblas.h"
+#include "deferred.hpp"
 #include "exceptions.hpp"
+#include "fast_float32.hpp"
+#include "gemm_broadcast.hpp"
+#include "gemm_ex_d.hpp"
+#include "graph.hpp"
+#include "half_complex.hpp"
+#include "handle_state.hpp"
+#include "logging.hpp"
+#include "managed_memory.hpp"
+#include "matmul_plan.hpp"
+#include "staging.hpp"
+#include "symmetric_gemm.hpp"
+#include "thread_stream.hpp"
 #include <cublas.h>
 #include <cublas_v2.h>
 #include <cuda_runtime_api.h>
 #include <hip/hip_runtime.h>
+#include <memory>
 
 #ifdef __cplusplus
 extern "C" {
@@ -297,6 +311,9 @@ hipblasStatus_t hipCUBLASStatusToHIPStatus(cublasStatus_t cuStatus)
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, streamId));
 }
 catch(...)
@@ -307,6 +324,9 @@ catch(...)
 hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasGetStream((cublasHandle_t)handle, streamId));
 }
 catch(...)
@@ -317,6 +337,7 @@ catch(...)
 hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return hipCUBLASStatusToHIPStatus(cublasCreate((cublasHandle_t*)handle));
 }
 catch(...)
@@ -328,6 +349,9 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_erase_handle_state(handle);
     return hipCUBLASStatusToHIPStatus(cublasDestroy((cublasHandle_t)handle));
 }
 catch(...)
@@ -338,6 +362,9 @@ catch(...)
 hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSetPointerMode((cublasHandle_t)handle, HIPPointerModeToCudaPointerMode(mode)));
 }
@@ -349,6 +376,9 @@ catch(...)
 hipblasStatus_t hipblasGetPointerMode(hipblasHandle_t handle, hipblasPointerMode_t* mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     cublasPointerMode_t cublasMode;
     cublasStatus        status = cublasGetPointerMode((cublasHandle_t)handle, &cublasMode);
     *mode                      = CudaPointerModeToHIPPointerMode(cublasMode);
@@ -362,6 +392,9 @@ catch(...)
 hipblasStatus_t hipblasSetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t int8Datatype)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -372,6 +405,9 @@ catch(...)
 hipblasStatus_t hipblasGetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t* int8Datatype)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -383,6 +419,9 @@ catch(...)
 hipblasStatus_t hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(true, n, 1, elemSize, x, incx, 0, y, incy, 0, nullptr, false);
     return hipCUBLASStatusToHIPStatus(
         cublasSetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
 }
@@ -395,6 +434,9 @@ catch(...)
 hipblasStatus_t hipblasGetVector(int n, int elemSize, const void* x, int incx, void* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(false, n, 1, elemSize, x, incx, 0, y, incy, 0, nullptr, false);
     return hipCUBLASStatusToHIPStatus(
         cublasGetVector(n, elemSize, x, incx, y, incy)); // HGSOS no need for handle
 }
@@ -408,6 +450,9 @@ hipblasStatus_t
     hipblasSetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(true, rows, cols, elemSize, A, 1, lda, B, 1, ldb, nullptr, false);
     return hipCUBLASStatusToHIPStatus(cublasSetMatrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -420,6 +465,9 @@ hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(nullptr);
+    HIPBLAS_STAGED_COPY(false, rows, cols, elemSize, A, 1, lda, B, 1, ldb, nullptr, false);
     return hipCUBLASStatusToHIPStatus(cublasGetMatrix(rows, cols, elemSize, A, lda, B, ldb));
 }
 catch(...)
@@ -431,6 +479,9 @@ hipblasStatus_t hipblasSetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(true, n, 1, elemSize, x, incx, 0, y, incy, 0, stream, true);
     return hipCUBLASStatusToHIPStatus(cublasSetVectorAsync(n, elemSize, x, incx, y, incy, stream));
 }
 catch(...)
@@ -442,6 +493,9 @@ hipblasStatus_t hipblasGetVectorAsync(
     int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(false, n, 1, elemSize, x, incx, 0, y, incy, 0, stream, true);
     return hipCUBLASStatusToHIPStatus(cublasGetVectorAsync(n, elemSize, x, incx, y, incy, stream));
 }
 catch(...)
@@ -453,6 +507,9 @@ hipblasStatus_t hipblasSetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(true, rows, cols, elemSize, A, 1, lda, B, 1, ldb, stream, true);
     return hipCUBLASStatusToHIPStatus(
         cublasSetMatrixAsync(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -465,6 +522,9 @@ hipblasStatus_t hipblasGetMatrixAsync(
     int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_DEFERRED_FLUSH_STREAM(stream);
+    HIPBLAS_STAGED_COPY(false, rows, cols, elemSize, A, 1, lda, B, 1, ldb, stream, true);
     return hipCUBLASStatusToHIPStatus(
         cublasGetMatrixAsync(rows, cols, elemSize, A, lda, B, ldb, stream));
 }
@@ -477,6 +537,9 @@ catch(...)
 hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSetAtomicsMode(
         (cublasHandle_t)handle, HIPAtomicsModeToCudaAtomicsMode(atomics_mode)));
 }
@@ -488,6 +551,9 @@ catch(...)
 hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasGetAtomicsMode((cublasHandle_t)handle, (cublasAtomicsMode_t*)atomics_mode));
 }
@@ -500,6 +566,9 @@ catch(...)
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasIsamax((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -510,6 +579,9 @@ catch(...)
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasIdamax((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -521,6 +593,9 @@ hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasIcamax((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -533,6 +608,9 @@ hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasIzamax((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -545,12 +623,18 @@ catch(...)
 hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
 hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -561,6 +645,9 @@ hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                      int                         batchCount,
                                      int*                        result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -571,6 +658,9 @@ hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                      int                               batchCount,
                                      int*                              result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -583,6 +673,9 @@ hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                             int             batchCount,
                                             int*            result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -594,6 +687,9 @@ hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                             int             batchCount,
                                             int*            result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -605,6 +701,9 @@ hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount,
                                             int*                  result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -616,6 +715,9 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount,
                                             int*                        result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -623,6 +725,9 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasIsamin((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -633,6 +738,9 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasIdamin((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -644,6 +752,9 @@ hipblasStatus_t
     hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasIcamin((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -656,6 +767,9 @@ hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasIzamin((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -668,12 +782,18 @@ catch(...)
 hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
 hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -684,6 +804,9 @@ hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                      int                         batchCount,
                                      int*                        result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -694,6 +817,9 @@ hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                      int                               batchCount,
                                      int*                              result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -706,6 +832,9 @@ hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
                                             int             batchCount,
                                             int*            result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -717,6 +846,9 @@ hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                             int             batchCount,
                                             int*            result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -728,6 +860,9 @@ hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount,
                                             int*                  result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -739,6 +874,9 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount,
                                             int*                        result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -746,6 +884,9 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -757,6 +898,9 @@ hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDasum((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -768,6 +912,9 @@ hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasScasum((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -780,6 +927,9 @@ hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDzasum((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -793,6 +943,9 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
@@ -809,6 +962,9 @@ hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                     int                 batchCount,
                                     double*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -819,6 +975,9 @@ hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                      int                         batchCount,
                                      float*                      result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -829,6 +988,9 @@ hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                      int                               batchCount,
                                      double*                           result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -841,6 +1003,9 @@ hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
                                            int             batchCount,
                                            float*          result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -852,6 +1017,9 @@ hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                            int             batchCount,
                                            double*         result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -863,6 +1031,9 @@ hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount,
                                             float*                result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -874,6 +1045,9 @@ hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount,
                                             double*                     result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -886,6 +1060,9 @@ hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                              hipblasHalf*       y,
                              int                incy)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -893,6 +1070,9 @@ hipblasStatus_t hipblasSaxpy(
     hipblasHandle_t handle, int n, const float* alpha, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 's', n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasSaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
 }
@@ -910,6 +1090,9 @@ hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                              int             incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'd', n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(
         cublasDaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
 }
@@ -927,6 +1110,9 @@ hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'c', n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCaxpy(
         (cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -944,6 +1130,9 @@ hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(axpy, handle, 'z', n, alpha, x, incx, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZaxpy((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)alpha,
@@ -967,6 +1156,9 @@ hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
                                     int                      incy,
                                     int                      batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -980,6 +1172,9 @@ hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -999,6 +1194,9 @@ hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1011,6 +1209,9 @@ hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1023,6 +1224,9 @@ hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1038,6 +1242,9 @@ hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridey,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1052,6 +1259,9 @@ hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1066,6 +1276,9 @@ hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1080,6 +1293,9 @@ hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1094,6 +1310,9 @@ hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1102,6 +1321,9 @@ hipblasStatus_t
     hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasScopy((cublasHandle_t)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -1113,6 +1335,9 @@ hipblasStatus_t
     hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDcopy((cublasHandle_t)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -1124,6 +1349,9 @@ hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasCcopy((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -1140,6 +1368,9 @@ hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZcopy(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
 }
@@ -1157,6 +1388,9 @@ hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1168,6 +1402,9 @@ hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1179,6 +1416,9 @@ hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1190,6 +1430,9 @@ hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1204,6 +1447,9 @@ hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1217,6 +1463,9 @@ hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1230,6 +1479,9 @@ hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1243,6 +1495,9 @@ hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1255,6 +1510,9 @@ hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                             int                incy,
                             hipblasHalf*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1266,6 +1524,9 @@ hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                              int                    incy,
                              hipblasBfloat16*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1278,6 +1539,9 @@ hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                             float*          result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(dot, handle, 's', n, x, incx, y, incy, result);
     return hipCUBLASStatusToHIPStatus(
         cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
 }
@@ -1295,6 +1559,9 @@ hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                             double*         result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(dot, handle, 'd', n, x, incx, y, incy, result);
     return hipCUBLASStatusToHIPStatus(
         cublasDdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
 }
@@ -1312,6 +1579,9 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCdotc(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
 }
@@ -1329,6 +1599,9 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                              hipblasComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCdotu(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, (cuComplex*)result));
 }
@@ -1346,6 +1619,9 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZdotc((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)x,
@@ -1368,6 +1644,9 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZdotu((cublasHandle_t)handle,
                                                   n,
                                                   (cuDoubleComplex*)x,
@@ -1392,6 +1671,9 @@ hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                    hipblasHalf*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -1411,6 +1693,9 @@ hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                     int                          batchCount,
                                     hipblasBfloat16*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1424,6 +1709,9 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(
@@ -1443,6 +1731,9 @@ hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                    int                 batchCount,
                                    double*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1455,6 +1746,9 @@ hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                     int                         batchCount,
                                     hipblasComplex*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1467,6 +1761,9 @@ hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                     int                         batchCount,
                                     hipblasComplex*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1479,6 +1776,9 @@ hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1491,6 +1791,9 @@ hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1506,6 +1809,9 @@ hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    handle,
                                           int                batchCount,
                                           hipblasHalf*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1520,6 +1826,9 @@ hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                            int                    batchCount,
                                            hipblasBfloat16*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1534,6 +1843,9 @@ hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount,
                                           float*          result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1548,6 +1860,9 @@ hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                           int             batchCount,
                                           double*         result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1562,6 +1877,9 @@ hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount,
                                            hipblasComplex*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1576,6 +1894,9 @@ hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount,
                                            hipblasComplex*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1590,6 +1911,9 @@ hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1604,6 +1928,9 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1611,6 +1938,9 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSnrm2((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -1622,6 +1952,9 @@ hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDnrm2((cublasHandle_t)handle, n, x, incx, result));
 }
 catch(...)
@@ -1633,6 +1966,9 @@ hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasScnrm2((cublasHandle_t)handle, n, (cuComplex*)x, incx, result));
 }
@@ -1645,6 +1981,9 @@ hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDznrm2((cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, result));
 }
@@ -1657,6 +1996,9 @@ catch(...)
 hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1667,6 +2009,9 @@ hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                     int                 batchCount,
                                     double*             result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1677,6 +2022,9 @@ hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                      int                         batchCount,
                                      float*                      result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1687,6 +2035,9 @@ hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                      int                               batchCount,
                                      double*                           result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1699,6 +2050,9 @@ hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
                                            int             batchCount,
                                            float*          result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1710,6 +2064,9 @@ hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                            int             batchCount,
                                            double*         result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1721,6 +2078,9 @@ hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             int                   batchCount,
                                             float*                result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1732,6 +2092,9 @@ hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                             int                         batchCount,
                                             double*                     result)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1746,6 +2109,9 @@ hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                             const float*    s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
 }
@@ -1764,6 +2130,9 @@ hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                             const double*   s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDrot((cublasHandle_t)handle, n, x, incx, y, incy, c, s));
 }
@@ -1782,6 +2151,9 @@ hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                             const hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCrot(
         (cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, (cuComplex*)s));
 }
@@ -1800,6 +2172,9 @@ hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                              const float*    s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasCsrot((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy, c, s));
 }
@@ -1818,6 +2193,9 @@ hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                             const hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZrot((cublasHandle_t)handle,
                                                  n,
                                                  (cuDoubleComplex*)x,
@@ -1842,6 +2220,9 @@ hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                              const double*         s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZdrot(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy, c, s));
 }
@@ -1861,6 +2242,9 @@ hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                    const float*    s,
                                    int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1874,6 +2258,9 @@ hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                    const double*   s,
                                    int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1887,6 +2274,9 @@ hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                    const hipblasComplex* s,
                                    int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1900,6 +2290,9 @@ hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                     const float*          s,
                                     int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1913,6 +2306,9 @@ hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                    const hipblasDoubleComplex* s,
                                    int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1926,6 +2322,9 @@ hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                     const double*               s,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1942,6 +2341,9 @@ hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                           const float*    s,
                                           int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1957,6 +2359,9 @@ hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                           const double*   s,
                                           int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1972,6 +2377,9 @@ hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                           const hipblasComplex* s,
                                           int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -1987,6 +2395,9 @@ hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                            const float*    s,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2002,6 +2413,9 @@ hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                           const hipblasDoubleComplex* s,
                                           int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2017,6 +2431,9 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                            const double*         s,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2024,6 +2441,9 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
 hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSrotg((cublasHandle_t)handle, a, b, c, s));
 }
 catch(...)
@@ -2034,6 +2454,9 @@ catch(...)
 hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDrotg((cublasHandle_t)handle, a, b, c, s));
 }
 catch(...)
@@ -2045,6 +2468,9 @@ hipblasStatus_t hipblasCrotg(
     hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasCrotg((cublasHandle_t)handle, (cuComplex*)a, (cuComplex*)b, c, (cuComplex*)s));
 }
@@ -2060,6 +2486,9 @@ hipblasStatus_t hipblasZrotg(hipblasHandle_t       handle,
                              hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZrotg(
         (cublasHandle_t)handle, (cuDoubleComplex*)a, (cuDoubleComplex*)b, c, (cuDoubleComplex*)s));
 }
@@ -2076,6 +2505,9 @@ hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                     float* const    s[],
                                     int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2086,6 +2518,9 @@ hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                     double* const   s[],
                                     int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2096,6 +2531,9 @@ hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                     hipblasComplex* const s[],
                                     int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2106,6 +2544,9 @@ hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                     hipblasDoubleComplex* const s[],
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2121,6 +2562,9 @@ hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stride_s,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2135,6 +2579,9 @@ hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stride_s,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2149,6 +2596,9 @@ hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stride_s,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2163,6 +2613,9 @@ hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_s,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2171,6 +2624,9 @@ hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
 }
@@ -2183,6 +2639,9 @@ hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDrotm((cublasHandle_t)handle, n, x, incx, y, incy, param));
 }
@@ -2201,6 +2660,9 @@ hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                     const float* const param[],
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2213,6 +2675,9 @@ hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                     const double* const param[],
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2229,6 +2694,9 @@ hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   strideParam,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2244,6 +2712,9 @@ hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   strideParam,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2252,6 +2723,9 @@ hipblasStatus_t hipblasSrotmg(
     hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -2263,6 +2737,9 @@ hipblasStatus_t hipblasDrotmg(
     hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDrotmg((cublasHandle_t)handle, d1, d2, x1, y1, param));
 }
 catch(...)
@@ -2279,6 +2756,9 @@ hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                      float* const       param[],
                                      int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2290,6 +2770,9 @@ hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                      double* const       param[],
                                      int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2307,6 +2790,9 @@ hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   strideParam,
                                             int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2323,6 +2809,9 @@ hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   strideParam,
                                             int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2330,6 +2819,9 @@ hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
 hipblasStatus_t hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 's', n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -2341,6 +2833,9 @@ hipblasStatus_t
     hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'd', n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(cublasDscal((cublasHandle_t)handle, n, alpha, x, incx));
 }
 catch(...)
@@ -2352,6 +2847,9 @@ hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'c', n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(
         cublasCscal((cublasHandle_t)handle, n, (cuComplex*)alpha, (cuComplex*)x, incx));
 }
@@ -2364,6 +2862,9 @@ hipblasStatus_t
     hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasCsscal((cublasHandle_t)handle, n, alpha, (cuComplex*)x, incx));
 }
@@ -2379,6 +2880,9 @@ hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(scal, handle, 'z', n, alpha, x, incx);
     return hipCUBLASStatusToHIPStatus(
         cublasZscal((cublasHandle_t)handle, n, (cuDoubleComplex*)alpha, (cuDoubleComplex*)x, incx));
 }
@@ -2391,6 +2895,9 @@ hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasZdscal((cublasHandle_t)handle, n, alpha, (cuDoubleComplex*)x, incx));
 }
@@ -2404,6 +2911,9 @@ hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // TODO warn user that function was demoted to ignore batch
     // return hipCUBLASStatusToHIPStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
@@ -2415,6 +2925,9 @@ catch(...)
 hipblasStatus_t hipblasDscalBatched(
     hipblasHandle_t handle, int n, const double* alpha, double* const x[], int incx, int batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2425,6 +2938,9 @@ hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                     int                   incx,
                                     int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2435,6 +2951,9 @@ hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2445,6 +2964,9 @@ hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                      int                   incx,
                                      int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2455,6 +2977,9 @@ hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2467,6 +2992,9 @@ hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2478,6 +3006,9 @@ hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2489,6 +3020,9 @@ hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridex,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2500,6 +3034,9 @@ hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridex,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2511,6 +3048,9 @@ hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2522,6 +3062,9 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2529,6 +3072,9 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
 hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSswap((cublasHandle_t)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -2540,6 +3086,9 @@ hipblasStatus_t
     hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDswap((cublasHandle_t)handle, n, x, incx, y, incy));
 }
 catch(...)
@@ -2551,6 +3100,9 @@ hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasCswap((cublasHandle_t)handle, n, (cuComplex*)x, incx, (cuComplex*)y, incy));
 }
@@ -2567,6 +3119,9 @@ hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZswap(
         (cublasHandle_t)handle, n, (cuDoubleComplex*)x, incx, (cuDoubleComplex*)y, incy));
 }
@@ -2579,12 +3134,18 @@ catch(...)
 hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
 hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2596,6 +3157,9 @@ hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                     int             incy,
                                     int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2607,6 +3171,9 @@ hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                     int                   incy,
                                     int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2621,6 +3188,9 @@ hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2634,6 +3204,9 @@ hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2647,6 +3220,9 @@ hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridey,
                                            int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2660,6 +3236,9 @@ hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2680,6 +3259,9 @@ hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2716,6 +3298,9 @@ hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2752,6 +3337,9 @@ hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2788,6 +3376,9 @@ hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgbmv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -2825,6 +3416,9 @@ hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2844,6 +3438,9 @@ hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2863,6 +3460,9 @@ hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2882,6 +3482,9 @@ hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2905,6 +3508,9 @@ hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_y,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2927,6 +3533,9 @@ hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_y,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2949,6 +3558,9 @@ hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2971,6 +3583,9 @@ hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -2989,6 +3604,9 @@ hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 's', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3021,6 +3639,9 @@ hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                              int                incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'd', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3053,6 +3674,9 @@ hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'c', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasCgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3085,6 +3709,9 @@ hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_GRAPH_RECORD(gemv, handle, 'z', trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
     return hipCUBLASStatusToHIPStatus(cublasZgemv((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(trans),
                                                   m,
@@ -3119,6 +3746,9 @@ hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // TODO warn user that function was demoted to ignore batch
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
@@ -3154,6 +3784,9 @@ hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // TODO warn user that function was demoted to ignore batch
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
@@ -3188,6 +3821,9 @@ hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3205,6 +3841,9 @@ hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3227,6 +3866,9 @@ hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // TODO warn user that function was demoted to ignore batch
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
@@ -3265,6 +3907,9 @@ hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // TODO warn user that function was demoted to ignore batch
     return HIPBLAS_STATUS_NOT_SUPPORTED;
     // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
@@ -3302,6 +3947,9 @@ hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3322,6 +3970,9 @@ hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3338,6 +3989,9 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSger((cublasHandle_t)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -3358,6 +4012,9 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDger((cublasHandle_t)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -3378,6 +4035,9 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgeru((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3406,6 +4066,9 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgerc((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3434,6 +4097,9 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgeru((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3462,6 +4128,9 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgerc((cublasHandle_t)handle,
                                                   m,
                                                   n,
@@ -3491,6 +4160,9 @@ hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                    int                lda,
                                    int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3506,6 +4178,9 @@ hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                    int                 lda,
                                    int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3521,6 +4196,9 @@ hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                     int                         lda,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3536,6 +4214,9 @@ hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                     int                         lda,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3551,6 +4232,9 @@ hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                     int                               lda,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3566,6 +4250,9 @@ hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                     int                               lda,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3585,6 +4272,9 @@ hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   strideA,
                                           int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3603,6 +4293,9 @@ hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   strideA,
                                           int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3621,6 +4314,9 @@ hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideA,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3639,6 +4335,9 @@ hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideA,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3657,6 +4356,9 @@ hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideA,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3675,6 +4377,9 @@ hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideA,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3693,6 +4398,9 @@ hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3725,6 +4433,9 @@ hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3758,6 +4469,9 @@ hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3775,6 +4489,9 @@ hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3796,6 +4513,9 @@ hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3816,6 +4536,9 @@ hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3833,6 +4556,9 @@ hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChemv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3863,6 +4589,9 @@ hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhemv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -3894,6 +4623,9 @@ hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3910,6 +4642,9 @@ hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3930,6 +4665,9 @@ hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3949,6 +4687,9 @@ hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -3963,6 +4704,9 @@ hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCher((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -3987,6 +4731,9 @@ hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZher((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -4012,6 +4759,9 @@ hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
                                    int                         lda,
                                    int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4025,6 +4775,9 @@ hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                    int                               lda,
                                    int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4041,6 +4794,9 @@ hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
                                           hipblasStride         strideA,
                                           int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4056,6 +4812,9 @@ hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                           hipblasStride               strideA,
                                           int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4072,6 +4831,9 @@ hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCher2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4100,6 +4862,9 @@ hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZher2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4129,6 +4894,9 @@ hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
                                     int                         lda,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4144,6 +4912,9 @@ hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                     int                               lda,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4163,6 +4934,9 @@ hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideA,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4181,6 +4955,9 @@ hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideA,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4197,6 +4974,9 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4225,6 +5005,9 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4254,6 +5037,9 @@ hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4269,6 +5055,9 @@ hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4288,6 +5077,9 @@ hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4306,6 +5098,9 @@ hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4319,6 +5114,9 @@ hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChpr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -4341,6 +5139,9 @@ hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhpr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -4364,6 +5165,9 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       AP[],
                                    int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4376,6 +5180,9 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       AP[],
                                    int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4391,6 +5198,9 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           hipblasStride         strideAP,
                                           int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4405,6 +5215,9 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           hipblasStride               strideAP,
                                           int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4420,6 +5233,9 @@ hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                              hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChpr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4446,6 +5262,9 @@ hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhpr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4473,6 +5292,9 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     hipblasComplex* const       AP[],
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4487,6 +5309,9 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       AP[],
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4505,6 +5330,9 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideAP,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4522,6 +5350,9 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideAP,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4540,6 +5371,9 @@ hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4572,6 +5406,9 @@ hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -4605,6 +5442,9 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4622,6 +5462,9 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4643,6 +5486,9 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4663,6 +5509,9 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4679,6 +5528,9 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSspmv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -4699,6 +5551,9 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDspmv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, AP, x, incx, beta, y, incy));
 }
@@ -4720,6 +5575,9 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4735,6 +5593,9 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4754,6 +5615,9 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4772,6 +5636,9 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4785,6 +5652,9 @@ hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                             float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSspr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, AP));
 }
@@ -4802,6 +5672,9 @@ hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                             double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDspr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, AP));
 }
@@ -4818,6 +5691,9 @@ hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                             int                   incx,
                             hipblasComplex*       AP)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4829,6 +5705,9 @@ hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                             int                         incx,
                             hipblasDoubleComplex*       AP)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4842,6 +5721,9 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    float* const       AP[],
                                    int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4854,6 +5736,9 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    double* const       AP[],
                                    int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4866,6 +5751,9 @@ hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       AP[],
                                    int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4878,6 +5766,9 @@ hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       AP[],
                                    int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4893,6 +5784,9 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           hipblasStride     strideAP,
                                           int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4907,6 +5801,9 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           hipblasStride     strideAP,
                                           int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4921,6 +5818,9 @@ hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                           hipblasStride         strideAP,
                                           int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4935,6 +5835,9 @@ hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                           hipblasStride               strideAP,
                                           int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -4950,6 +5853,9 @@ hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                              float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSspr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, AP));
 }
@@ -4969,6 +5875,9 @@ hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                              double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDspr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, AP));
 }
@@ -4989,6 +5898,9 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     float* const       AP[],
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5003,6 +5915,9 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     double* const       AP[],
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5021,6 +5936,9 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideAP,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5038,6 +5956,9 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideAP,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5055,6 +5976,9 @@ hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsymv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -5076,6 +6000,9 @@ hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsymv(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, A, lda, x, incx, beta, y, incy));
 }
@@ -5097,6 +6024,9 @@ hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsymv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5127,6 +6057,9 @@ hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsymv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5158,6 +6091,9 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5174,6 +6110,9 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5190,6 +6129,9 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5206,6 +6148,9 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5226,6 +6171,9 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5245,6 +6193,9 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stridey,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5264,6 +6215,9 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5283,6 +6237,9 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5297,6 +6254,9 @@ hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSsyr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, A, lda));
 }
@@ -5315,6 +6275,9 @@ hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDsyr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, A, lda));
 }
@@ -5333,6 +6296,9 @@ hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsyr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -5357,6 +6323,9 @@ hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsyr((cublasHandle_t)handle,
                                                  hipFillToCudaFill(uplo),
                                                  n,
@@ -5382,6 +6351,9 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    int                lda,
                                    int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5395,6 +6367,9 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    int                 lda,
                                    int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5408,6 +6383,9 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    int                         lda,
                                    int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5421,6 +6399,9 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    int                               lda,
                                    int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5437,6 +6418,9 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           hipblasStride     strideA,
                                           int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5452,6 +6436,9 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           hipblasStride     strideA,
                                           int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5467,6 +6454,9 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           hipblasStride         strideA,
                                           int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5482,6 +6472,9 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           hipblasStride               strideA,
                                           int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5498,6 +6491,9 @@ hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsyr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, A, lda));
 }
@@ -5518,6 +6514,9 @@ hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsyr2(
         (cublasHandle_t)handle, hipFillToCudaFill(uplo), n, alpha, x, incx, y, incy, A, lda));
 }
@@ -5538,6 +6537,9 @@ hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsyr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5566,6 +6568,9 @@ hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsyr2((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   n,
@@ -5595,6 +6600,9 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     int                lda,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5610,6 +6618,9 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     int                 lda,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5625,6 +6636,9 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     int                         lda,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5640,6 +6654,9 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     int                               lda,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5659,6 +6676,9 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideA,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5677,6 +6697,9 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideA,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5695,6 +6718,9 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideA,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5713,6 +6739,9 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideA,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5729,6 +6758,9 @@ hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5757,6 +6789,9 @@ hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5785,6 +6820,9 @@ hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5813,6 +6851,9 @@ hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtbmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -5842,6 +6883,9 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5857,6 +6901,9 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5872,6 +6919,9 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5887,6 +6937,9 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5905,6 +6958,9 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_x,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5922,6 +6978,9 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_x,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5939,6 +6998,9 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5956,6 +7018,9 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -5972,6 +7037,9 @@ hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6000,6 +7068,9 @@ hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6028,6 +7099,9 @@ hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6056,6 +7130,9 @@ hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtbsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6085,6 +7162,9 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6100,6 +7180,9 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6115,6 +7198,9 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6130,6 +7216,9 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6148,6 +7237,9 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6165,6 +7257,9 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6182,6 +7277,9 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridex,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6199,6 +7297,9 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridex,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6213,6 +7314,9 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6237,6 +7341,9 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6261,6 +7368,9 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6285,6 +7395,9 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtpmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6310,6 +7423,9 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6323,6 +7439,9 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6336,6 +7455,9 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6349,6 +7471,9 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6365,6 +7490,9 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6380,6 +7508,9 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6395,6 +7526,9 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridex,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6410,6 +7544,9 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridex,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6424,6 +7561,9 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6448,6 +7588,9 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6472,6 +7615,9 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6496,6 +7642,9 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtpsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6521,6 +7670,9 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6534,6 +7686,9 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6547,6 +7702,9 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6560,6 +7718,9 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6576,6 +7737,9 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6591,6 +7755,9 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6606,6 +7773,9 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridex,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6621,6 +7791,9 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridex,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6636,6 +7809,9 @@ hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6662,6 +7838,9 @@ hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6688,6 +7867,9 @@ hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6714,6 +7896,9 @@ hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtrmv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6741,6 +7926,9 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6755,6 +7943,9 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6769,6 +7960,9 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6783,6 +7977,9 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6800,6 +7997,9 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_x,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6816,6 +8016,9 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stride_x,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6832,6 +8035,9 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6848,6 +8054,9 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6863,6 +8072,9 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6889,6 +8101,9 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6915,6 +8130,9 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6941,6 +8159,9 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtrsv((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -6968,6 +8189,9 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     int                incx,
                                     int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6982,6 +8206,9 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -6996,6 +8223,9 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     int                         incx,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7010,6 +8240,9 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     int                               incx,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7027,6 +8260,9 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7043,6 +8279,9 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      stridex,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7059,6 +8298,9 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridex,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7075,6 +8317,9 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridex,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7094,6 +8339,9 @@ hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCherk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7124,6 +8372,9 @@ hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZherk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7155,6 +8406,9 @@ hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7171,6 +8425,9 @@ hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7190,6 +8447,9 @@ hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7208,6 +8468,9 @@ hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7227,6 +8490,9 @@ hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCherkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7261,6 +8527,9 @@ hipblasStatus_t hipblasZherkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZherkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7296,6 +8565,9 @@ hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7314,6 +8586,9 @@ hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7336,6 +8611,9 @@ hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7357,6 +8635,9 @@ hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7376,6 +8657,9 @@ hipblasStatus_t hipblasCher2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCher2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7410,6 +8694,9 @@ hipblasStatus_t hipblasZher2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZher2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -7445,6 +8732,9 @@ hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7463,6 +8753,9 @@ hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7485,6 +8778,9 @@ hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7506,6 +8802,9 @@ hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7525,6 +8824,9 @@ hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7559,6 +8861,9 @@ hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7593,6 +8898,9 @@ hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7627,6 +8935,9 @@ hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsymm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -7662,6 +8973,9 @@ hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7680,6 +8994,9 @@ hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7698,6 +9015,9 @@ hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7716,6 +9036,9 @@ hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7738,6 +9061,9 @@ hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideC,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7759,6 +9085,9 @@ hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     strideC,
                                            int               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7780,6 +9109,9 @@ hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7801,6 +9133,9 @@ hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7818,6 +9153,9 @@ hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7848,6 +9186,9 @@ hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7878,6 +9219,9 @@ hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7908,6 +9252,9 @@ hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsyrk((cublasHandle_t)handle,
                                                   hipFillToCudaFill(uplo),
                                                   hipOperationToCudaOperation(transA),
@@ -7939,6 +9286,9 @@ hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7955,6 +9305,9 @@ hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7971,6 +9324,9 @@ hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -7987,6 +9343,9 @@ hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8006,6 +9365,9 @@ hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8024,6 +9386,9 @@ hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8042,6 +9407,9 @@ hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8060,6 +9428,9 @@ hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8079,6 +9450,9 @@ hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8113,6 +9487,9 @@ hipblasStatus_t hipblasDsyr2k(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8147,6 +9524,9 @@ hipblasStatus_t hipblasCsyr2k(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8181,6 +9561,9 @@ hipblasStatus_t hipblasZsyr2k(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsyr2k((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8216,6 +9599,9 @@ hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                      int                ldc,
                                      int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8234,6 +9620,9 @@ hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                      int                 ldc,
                                      int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8252,6 +9641,9 @@ hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8270,6 +9662,9 @@ hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8292,6 +9687,9 @@ hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8313,6 +9711,9 @@ hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8334,6 +9735,9 @@ hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8355,6 +9759,9 @@ hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8374,6 +9781,9 @@ hipblasStatus_t hipblasSsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8408,6 +9818,9 @@ hipblasStatus_t hipblasDsyrkx(hipblasHandle_t    handle,
                               int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8442,6 +9855,9 @@ hipblasStatus_t hipblasCsyrkx(hipblasHandle_t       handle,
                               int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8476,6 +9892,9 @@ hipblasStatus_t hipblasZsyrkx(hipblasHandle_t             handle,
                               int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZsyrkx((cublasHandle_t)handle,
                                                    hipFillToCudaFill(uplo),
                                                    hipOperationToCudaOperation(transA),
@@ -8511,6 +9930,9 @@ hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                      int                ldc,
                                      int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8529,6 +9951,9 @@ hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                      int                 ldc,
                                      int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8547,6 +9972,9 @@ hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                      int                         ldc,
                                      int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8565,6 +9993,9 @@ hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                      int                               ldc,
                                      int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8587,6 +10018,9 @@ hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8608,6 +10042,9 @@ hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                             hipblasStride      strideC,
                                             int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8629,6 +10066,9 @@ hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         strideC,
                                             int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8650,6 +10090,9 @@ hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               strideC,
                                             int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8669,6 +10112,9 @@ hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8703,6 +10149,9 @@ hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8737,6 +10186,9 @@ hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8771,6 +10223,9 @@ hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgeam((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -8806,6 +10261,9 @@ hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8824,6 +10282,9 @@ hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8842,6 +10303,9 @@ hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8860,6 +10324,9 @@ hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8882,6 +10349,9 @@ hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8903,6 +10373,9 @@ hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideC,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8924,6 +10397,9 @@ hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8945,6 +10421,9 @@ hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -8964,6 +10443,9 @@ hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasChemm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -8998,6 +10480,9 @@ hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZhemm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9033,6 +10518,9 @@ hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9051,6 +10539,9 @@ hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9073,6 +10564,9 @@ hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideC,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9094,6 +10588,9 @@ hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideC,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9112,6 +10609,9 @@ hipblasStatus_t hipblasStrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // cuBLAS API for trmm is a bit different, you can pass in a third
     // pointer to do out-of-place trmm. If you want the in-place behaviour
     // you can pass in B as the third pointer, as seen here.
@@ -9149,6 +10649,9 @@ hipblasStatus_t hipblasDtrmm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9183,6 +10686,9 @@ hipblasStatus_t hipblasCtrmm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9217,6 +10723,9 @@ hipblasStatus_t hipblasZtrmm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtrmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9252,6 +10761,9 @@ hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                     int                ldb,
                                     int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9269,6 +10781,9 @@ hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                     int                 ldb,
                                     int                 batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9286,6 +10801,9 @@ hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                     int                         ldb,
                                     int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9303,6 +10821,9 @@ hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                     int                               ldb,
                                     int                               batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9323,6 +10844,9 @@ hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9342,6 +10866,9 @@ hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9361,6 +10888,9 @@ hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideB,
                                            int                   batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9380,6 +10910,9 @@ hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideB,
                                            int                         batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9398,6 +10931,9 @@ hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9430,6 +10966,9 @@ hipblasStatus_t hipblasDtrsm(hipblasHandle_t    handle,
                              int                ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9462,6 +11001,9 @@ hipblasStatus_t hipblasCtrsm(hipblasHandle_t       handle,
                              int                   ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9494,6 +11036,9 @@ hipblasStatus_t hipblasZtrsm(hipblasHandle_t             handle,
                              int                         ldb)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtrsm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   hipFillToCudaFill(uplo),
@@ -9528,6 +11073,9 @@ hipblasStatus_t hipblasStrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasStrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9562,6 +11110,9 @@ hipblasStatus_t hipblasDtrsmBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9596,6 +11147,9 @@ hipblasStatus_t hipblasCtrsmBatched(hipblasHandle_t       handle,
                                     int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9630,6 +11184,9 @@ hipblasStatus_t hipblasZtrsmBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZtrsmBatched((cublasHandle_t)handle,
                                                          hipSideToCudaSide(side),
                                                          hipFillToCudaFill(uplo),
@@ -9666,6 +11223,9 @@ hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9685,6 +11245,9 @@ hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                            hipblasStride      strideB,
                                            int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9704,6 +11267,9 @@ hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         strideB,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9723,6 +11289,9 @@ hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               strideB,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9736,6 +11305,9 @@ hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                               float*            invA,
                               int               ldinvA)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9748,6 +11320,9 @@ hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
                               double*           invA,
                               int               ldinvA)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9760,6 +11335,9 @@ hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
                               hipblasComplex*       invA,
                               int                   ldinvA)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9772,6 +11350,9 @@ hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
                               hipblasDoubleComplex*       invA,
                               int                         ldinvA)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9786,6 +11367,9 @@ hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
                                      int                ldinvA,
                                      int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9799,6 +11383,9 @@ hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
                                      int                 ldinvA,
                                      int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9812,6 +11399,9 @@ hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
                                      int                         ldinvA,
                                      int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9825,6 +11415,9 @@ hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
                                      int                               ldinvA,
                                      int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9841,6 +11434,9 @@ hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
                                             hipblasStride     stride_invA,
                                             int               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9856,6 +11452,9 @@ hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
                                             hipblasStride     stride_invA,
                                             int               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9871,6 +11470,9 @@ hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stride_invA,
                                             int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9886,6 +11488,9 @@ hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stride_invA,
                                             int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -9902,6 +11507,9 @@ hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSdgmm(
         (cublasHandle_t)handle, hipSideToCudaSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -9922,6 +11530,9 @@ hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
                              int               ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDdgmm(
         (cublasHandle_t)handle, hipSideToCudaSide(side), m, n, A, lda, x, incx, C, ldc));
 }
@@ -9942,6 +11553,9 @@ hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCdgmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   m,
@@ -9970,6 +11584,9 @@ hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZdgmm((cublasHandle_t)handle,
                                                   hipSideToCudaSide(side),
                                                   m,
@@ -9999,6 +11616,9 @@ hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                     int                ldc,
                                     int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10014,6 +11634,9 @@ hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                     int                 ldc,
                                     int                 batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10029,6 +11652,9 @@ hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                     int                         ldc,
                                     int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10044,6 +11670,9 @@ hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                     int                               ldc,
                                     int                               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10063,6 +11692,9 @@ hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stride_C,
                                            int               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10081,6 +11713,9 @@ hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                            hipblasStride     stride_C,
                                            int               batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10099,6 +11734,9 @@ hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stride_C,
                                            int                   batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10117,6 +11755,9 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stride_C,
                                            int                         batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10126,18 +11767,27 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
 hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
 hipblasStatus_t hipblasDgetrf(
     hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
 hipblasStatus_t hipblasCgetrf(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10148,6 +11798,9 @@ hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
                               int*                  ipiv,
                               int*                  info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10161,6 +11814,9 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10178,6 +11834,9 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
 }
@@ -10195,6 +11854,9 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
         (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10212,6 +11874,9 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
         (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
 }
@@ -10231,6 +11896,9 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10244,6 +11912,9 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10257,6 +11928,9 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10270,6 +11944,9 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             int*                  info,
                                             const int             batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10285,6 +11962,9 @@ hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               const int                ldb,
                               int*                     info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10299,6 +11979,9 @@ hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
                               const int                ldb,
                               int*                     info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10313,6 +11996,9 @@ hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
                               const int                ldb,
                               int*                     info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10327,6 +12013,9 @@ hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
                               const int                ldb,
                               int*                     info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10344,6 +12033,9 @@ hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10374,6 +12066,9 @@ hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10404,6 +12099,9 @@ hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          handle,
                                      const int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10434,6 +12132,9 @@ hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(trans),
                                                           n,
@@ -10467,6 +12168,9 @@ hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10485,6 +12189,9 @@ hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10503,6 +12210,9 @@ hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10521,6 +12231,9 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
                                             int*                     info,
                                             const int                batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10536,6 +12249,9 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
@@ -10555,6 +12271,9 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
 }
@@ -10574,6 +12293,9 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
                                                           n,
                                                           (cuComplex**)A,
@@ -10600,6 +12322,9 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
                                                           n,
                                                           (cuDoubleComplex**)A,
@@ -10624,6 +12349,9 @@ hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               float*          ipiv,
                               int*            info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10635,6 +12363,9 @@ hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
                               double*         ipiv,
                               int*            info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10646,6 +12377,9 @@ hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
                               hipblasComplex* ipiv,
                               int*            info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10657,6 +12391,9 @@ hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
                               hipblasDoubleComplex* ipiv,
                               int*                  info)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10671,6 +12408,9 @@ hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasSgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
@@ -10689,6 +12429,9 @@ hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(
         cublasDgeqrfBatched((cublasHandle_t)handle, m, n, A, lda, ipiv, info, batch_count));
 }
@@ -10707,6 +12450,9 @@ hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
         (cublasHandle_t)handle, m, n, (cuComplex**)A, lda, (cuComplex**)ipiv, info, batch_count));
 }
@@ -10725,6 +12471,9 @@ hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched((cublasHandle_t)handle,
                                                           m,
                                                           n,
@@ -10751,6 +12500,9 @@ hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10765,6 +12517,9 @@ hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10779,6 +12534,9 @@ hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
                                             int*                info,
                                             const int           batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10793,6 +12551,9 @@ hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
                                             int*                  info,
                                             const int             batch_count)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10809,6 +12570,9 @@ hipblasStatus_t hipblasSgels(hipblasHandle_t    handle,
                              int*               info,
                              int*               deviceInfo)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
@@ -10825,6 +12589,9 @@ hipblasStatus_t hipblasDgels(hipblasHandle_t    handle,
                              int*               info,
                              int*               deviceInfo)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10840,6 +12607,9 @@ hipblasStatus_t hipblasCgels(hipblasHandle_t    handle,
                              int*               info,
                              int*               deviceInfo)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10855,6 +12625,9 @@ hipblasStatus_t hipblasZgels(hipblasHandle_t       handle,
                              int*                  info,
                              int*                  deviceInfo)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -10873,6 +12646,9 @@ hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t    handle,
                                     const int          batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasSgelsBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(trans),
                                                          m,
@@ -10905,6 +12681,9 @@ hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t    handle,
                                     const int          batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasDgelsBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(trans),
                                                          m,
@@ -10937,6 +12716,9 @@ hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t       handle,
                                     const int             batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasCgelsBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(trans),
                                                          m,
@@ -10969,6 +12751,9 @@ hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
                                     const int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasZgelsBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(trans),
                                                          m,
@@ -11003,6 +12788,9 @@ hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t     handle,
                                            int*                deviceInfo,
                                            const int           batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
@@ -11022,6 +12810,9 @@ hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t     handle,
                                            int*                deviceInfo,
                                            const int           batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
@@ -11041,6 +12832,9 @@ hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t     handle,
                                            int*                deviceInfo,
                                            const int           batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
@@ -11060,6 +12854,9 @@ hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t       handle,
                                            int*                  deviceInfo,
                                            const int             batchCount)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     // only batched variants of gels are supported in cuBLAS
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
@@ -11083,6 +12880,53 @@ hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'h', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+
     return hipCUBLASStatusToHIPStatus(cublasHgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -11119,6 +12963,55 @@ hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 's', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(
+        float, handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+
     return hipCUBLASStatusToHIPStatus(cublasSgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -11155,6 +13048,55 @@ hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                              int                ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'd', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(
+        double, handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+
     return hipCUBLASStatusToHIPStatus(cublasDgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -11191,6 +13133,72 @@ hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                              int                   ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'c', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           0,
+                           B,
+                           ldb,
+                           0,
+                           beta,
+                           C,
+                           ldc,
+                           0,
+                           1);
+
     return hipCUBLASStatusToHIPStatus(cublasCgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -11227,6 +13235,72 @@ hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                              int                         ldc)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_GEMM(
+        handle, 'z', transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           0,
+                           B,
+                           ldb,
+                           0,
+                           beta,
+                           C,
+                           ldc,
+                           0,
+                           1);
+
     return hipCUBLASStatusToHIPStatus(cublasZgemm((cublasHandle_t)handle,
                                                   hipOperationToCudaOperation(transa),
                                                   hipOperationToCudaOperation(transb),
@@ -11265,6 +13339,33 @@ hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
                                     int                      batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm_batched",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasHgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11303,6 +13404,35 @@ hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm_batched",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(
+        float, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasSgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11341,6 +13471,35 @@ hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm_batched",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(
+        double, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasDgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11379,6 +13538,49 @@ hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm_batched",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasCgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11417,6 +13619,49 @@ hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm_batched",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           B,
+                           ldb,
+                           beta,
+                           C,
+                           ldc,
+                           batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasZgemmBatched((cublasHandle_t)handle,
                                                          hipOperationToCudaOperation(transa),
                                                          hipOperationToCudaOperation(transb),
@@ -11459,6 +13704,53 @@ hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_hgemm_strided_batched",
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     HIPBLAS_R_16F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         HIPBLAS_R_16F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasHgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11503,6 +13795,72 @@ hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_sgemm_strided_batched",
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     HIPBLAS_R_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         HIPBLAS_R_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(float,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11547,6 +13905,72 @@ hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_dgemm_strided_batched",
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     HIPBLAS_R_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         HIPBLAS_R_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(double,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11591,6 +14015,72 @@ hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_cgemm_strided_batched",
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     HIPBLAS_C_32F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         HIPBLAS_C_32F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasCgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11635,6 +14125,72 @@ hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_zgemm_strided_batched",
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     HIPBLAS_C_64F,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     bsa,
+                     B,
+                     ldb,
+                     bsb,
+                     beta,
+                     C,
+                     ldc,
+                     bsc,
+                     batchCount);
+    hipblas_managed_gemm(handle,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         HIPBLAS_C_64F,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         bsa,
+                         B,
+                         ldb,
+                         bsb,
+                         C,
+                         ldc,
+                         bsc,
+                         batchCount);
+    HIPBLAS_SYMMETRIC_GEMM(hipblasDoubleComplex,
+                           handle,
+                           transa,
+                           transb,
+                           m,
+                           n,
+                           k,
+                           alpha,
+                           A,
+                           lda,
+                           bsa,
+                           B,
+                           ldb,
+                           bsb,
+                           beta,
+                           C,
+                           ldc,
+                           bsc,
+                           batchCount);
+    hipblas_gemm_collapse_broadcast(transa, transb, m, n, lda, ldb, ldc, bsa, bsb, bsc, batchCount);
+
     return hipCUBLASStatusToHIPStatus(cublasZgemmStridedBatched((cublasHandle_t)handle,
                                                                 hipOperationToCudaOperation(transa),
                                                                 hipOperationToCudaOperation(transb),
@@ -11659,6 +14215,46 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// fast f32
+// Whether the current device has TF32 tensor cores, from compute capability 8.0
+static bool hipblas_tf32_supported()
+{
+    int device, major;
+    return hipGetDevice(&device) == hipSuccess
+           && hipDeviceGetAttribute(&major, hipDeviceAttributeComputeCapabilityMajor, device)
+                  == hipSuccess
+           && major >= 8;
+}
+
+// The handle in the TF32 math mode for the lifetime of the object, if enabled.
+// The mode is the handle's, so other threads using the handle meanwhile see
+// it too, unless bound by hipblasSetThreadStream; hipblasSetFloat32Mode
+// documents this.
+class hipblas_tf32_math
+{
+    cublasHandle_t handle;
+    cublasMath_t   saved  = CUBLAS_DEFAULT_MATH;
+    bool           active = false;
+
+public:
+    hipblas_tf32_math(hipblasHandle_t handle, bool enable)
+        : handle((cublasHandle_t)handle)
+    {
+        active = enable && cublasGetMathMode(this->handle, &saved) == CUBLAS_STATUS_SUCCESS
+                 && cublasSetMathMode(this->handle, CUBLAS_TF32_TENSOR_OP_MATH)
+                        == CUBLAS_STATUS_SUCCESS;
+    }
+
+    ~hipblas_tf32_math()
+    {
+        if(active)
+            (void)cublasSetMathMode(handle, saved);
+    }
+
+    hipblas_tf32_math(const hipblas_tf32_math&) = delete;
+    hipblas_tf32_math& operator=(const hipblas_tf32_math&) = delete;
+};
+
 // gemm_ex
 hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasOperation_t transa,
@@ -11681,6 +14277,99 @@ hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         c_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         C,
+                         ldc,
+                         0,
+                         1);
+
+    if(a_type == HIPBLAS_C_16F)
+        return hipblas_half_complex_gemm(handle,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         B,
+                                         b_type,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         c_type,
+                                         ldc,
+                                         compute_type,
+                                         algo);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_16bx3(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  0,
+                                  B,
+                                  ldb,
+                                  0,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  0,
+                                  1,
+                                  algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     return hipCUBLASStatusToHIPStatus(cublasGemmEx((cublasHandle_t)handle,
                                                    hipOperationToCudaOperation(transa),
                                                    hipOperationToCudaOperation(transb),
@@ -11706,6 +14395,187 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// matmul plan
+struct hipblasMatmulPlan : hipblas_matmul_plan
+{
+    cublasOperation_t cuda_transa, cuda_transb;
+    cudaDataType_t    cuda_a_type, cuda_b_type, cuda_c_type, cuda_compute_type;
+    cublasGemmAlgo_t  cuda_algo;
+};
+
+hipblasStatus_t hipblasMatmulPlanCreate(hipblasHandle_t         handle,
+                                        hipblasMatmulPlan_t*    plan,
+                                        hipblasOperation_t      transa,
+                                        hipblasOperation_t      transb,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        hipblasDatatype_t       a_type,
+                                        int                     lda,
+                                        hipblasDatatype_t       b_type,
+                                        int                     ldb,
+                                        hipblasDatatype_t       c_type,
+                                        int                     ldc,
+                                        hipblasDatatype_t       compute_type,
+                                        hipblasGemmAlgo_t       algo,
+                                        hipblasMatmulEpilogue_t epilogue)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!plan)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto            p      = std::make_unique<hipblasMatmulPlan>();
+    hipblasStatus_t status = hipblas_matmul_plan_init(*p,
+                                                      transa,
+                                                      transb,
+                                                      m,
+                                                      n,
+                                                      k,
+                                                      a_type,
+                                                      lda,
+                                                      b_type,
+                                                      ldb,
+                                                      c_type,
+                                                      ldc,
+                                                      compute_type,
+                                                      algo,
+                                                      epilogue);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // cuBLAS GEMMs use the handle's own workspace, so workspace_size stays 0
+    p->cuda_transa       = hipOperationToCudaOperation(transa);
+    p->cuda_transb       = hipOperationToCudaOperation(transb);
+    p->cuda_a_type       = HIPDatatypeToCudaDatatype(a_type);
+    p->cuda_b_type       = HIPDatatypeToCudaDatatype(b_type);
+    p->cuda_c_type       = HIPDatatypeToCudaDatatype(c_type);
+    p->cuda_compute_type = HIPDatatypeToCudaDatatype(compute_type);
+    p->cuda_algo         = HIPGemmAlgoToCudaGemmAlgo(algo);
+
+    *plan = p.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanExecute(hipblasHandle_t     handle,
+                                         hipblasMatmulPlan_t plan,
+                                         const void*         alpha,
+                                         const void*         A,
+                                         const void*         B,
+                                         const void*         beta,
+                                         void*               C,
+                                         const void*         bias)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(!plan || !hipblas_matmul_plan_current(*plan))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex",
+                     plan->a_type,
+                     plan->b_type,
+                     plan->c_type,
+                     plan->compute_type,
+                     plan->transa,
+                     plan->transb,
+                     plan->m,
+                     plan->n,
+                     plan->k,
+                     alpha,
+                     A,
+                     plan->lda,
+                     0,
+                     B,
+                     plan->ldb,
+                     0,
+                     beta,
+                     C,
+                     plan->ldc,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         plan->a_type,
+                         plan->b_type,
+                         plan->c_type,
+                         plan->transa,
+                         plan->transb,
+                         plan->m,
+                         plan->n,
+                         plan->k,
+                         A,
+                         plan->lda,
+                         0,
+                         B,
+                         plan->ldb,
+                         0,
+                         C,
+                         plan->ldc,
+                         0,
+                         1);
+
+    cublasStatus_t status = cublasGemmEx((cublasHandle_t)handle,
+                                         plan->cuda_transa,
+                                         plan->cuda_transb,
+                                         plan->m,
+                                         plan->n,
+                                         plan->k,
+                                         alpha,
+                                         A,
+                                         plan->cuda_a_type,
+                                         plan->lda,
+                                         B,
+                                         plan->cuda_b_type,
+                                         plan->ldb,
+                                         beta,
+                                         C,
+                                         plan->cuda_c_type,
+                                         plan->ldc,
+                                         plan->cuda_compute_type,
+                                         plan->cuda_algo);
+    if(status != CUBLAS_STATUS_SUCCESS)
+        return hipCUBLASStatusToHIPStatus(status);
+
+    return hipblas_matmul_plan_epilogue(handle, *plan, C, bias);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanGetWorkspaceSize(hipblasMatmulPlan_t plan, size_t* size)
+try
+{
+    if(!plan || !size)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *size = plan->workspace_size;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasMatmulPlanDestroy(hipblasMatmulPlan_t plan)
+try
+{
+    delete plan;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasOperation_t transa,
                                      hipblasOperation_t transb,
@@ -11728,6 +14598,57 @@ hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
                                      hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_batched_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     C,
+                     ldc,
+                     0,
+                     batch_count);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_batched_16bx3(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          B,
+                                          ldb,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count,
+                                          algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     return hipCUBLASStatusToHIPStatus(cublasGemmBatchedEx((cublasHandle_t)handle,
                                                           hipOperationToCudaOperation(transa),
                                                           hipOperationToCudaOperation(transb),
@@ -11779,6 +14700,81 @@ hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasGemmAlgo_t  algo)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_strided_batched_ex",
+                     a_type,
+                     b_type,
+                     c_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     beta,
+                     C,
+                     ldc,
+                     stride_C,
+                     batch_count);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         c_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         stride_A,
+                         B,
+                         ldb,
+                         stride_B,
+                         C,
+                         ldc,
+                         stride_C,
+                         batch_count);
+    hipblas_gemm_collapse_broadcast(
+        transa, transb, m, n, lda, ldb, ldc, stride_A, stride_B, stride_C, batch_count);
+
+    hipblas_float32_path float32_path;
+    hipblasStatus_t      float32_status = hipblas_float32_select(
+        handle, a_type, b_type, c_type, compute_type, hipblas_tf32_supported, float32_path);
+    if(float32_status != HIPBLAS_STATUS_SUCCESS)
+        return float32_status;
+    if(float32_path == hipblas_float32_path_16bx3)
+        return hipblas_gemm_16bx3(handle,
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  k,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  stride_A,
+                                  B,
+                                  ldb,
+                                  stride_B,
+                                  beta,
+                                  C,
+                                  ldc,
+                                  stride_C,
+                                  batch_count,
+                                  algo);
+    hipblas_tf32_math tf32_math(handle, float32_path == hipblas_float32_path_tf32);
+
     return hipCUBLASStatusToHIPStatus(
         cublasGemmStridedBatchedEx((cublasHandle_t)handle,
                                    hipOperationToCudaOperation(transa),
@@ -11809,6 +14805,341 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasGemmExD(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const void*        alpha,
+                               const void*        A,
+                               hipblasDatatype_t  a_type,
+                               int                lda,
+                               const void*        B,
+                               hipblasDatatype_t  b_type,
+                               int                ldb,
+                               const void*        beta,
+                               const void*        C,
+                               hipblasDatatype_t  c_type,
+                               int                ldc,
+                               void*              D,
+                               hipblasDatatype_t  d_type,
+                               int                ldd,
+                               hipblasDatatype_t  compute_type,
+                               hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     D,
+                     ldd,
+                     0,
+                     1);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         d_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         0,
+                         B,
+                         ldb,
+                         0,
+                         D,
+                         ldd,
+                         0,
+                         1,
+                         C,
+                         ldc,
+                         0);
+
+    hipblasStatus_t status = hipblas_gemm_ex_d_copy(handle,
+                                                    c_type,
+                                                    d_type,
+                                                    compute_type,
+                                                    m,
+                                                    n,
+                                                    beta,
+                                                    C,
+                                                    ldc,
+                                                    0,
+                                                    D,
+                                                    ldd,
+                                                    0,
+                                                    1);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmEx((cublasHandle_t)handle,
+                     hipOperationToCudaOperation(transa),
+                     hipOperationToCudaOperation(transb),
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     HIPDatatypeToCudaDatatype(a_type),
+                     lda,
+                     B,
+                     HIPDatatypeToCudaDatatype(b_type),
+                     ldb,
+                     beta,
+                     D,
+                     HIPDatatypeToCudaDatatype(d_type),
+                     ldd,
+                     HIPDatatypeToCudaDatatype(compute_type),
+                     HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmBatchedExD(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const void*        A[],
+                                      hipblasDatatype_t  a_type,
+                                      int                lda,
+                                      const void*        B[],
+                                      hipblasDatatype_t  b_type,
+                                      int                ldb,
+                                      const void*        beta,
+                                      const void*        C[],
+                                      hipblasDatatype_t  c_type,
+                                      int                ldc,
+                                      void*              D[],
+                                      hipblasDatatype_t  d_type,
+                                      int                ldd,
+                                      int                batch_count,
+                                      hipblasDatatype_t  compute_type,
+                                      hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_batched_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     0,
+                     B,
+                     ldb,
+                     0,
+                     beta,
+                     D,
+                     ldd,
+                     0,
+                     batch_count);
+
+    hipblasStatus_t status = hipblas_gemm_batched_ex_d_copy(handle,
+                                                            c_type,
+                                                            d_type,
+                                                            compute_type,
+                                                            m,
+                                                            n,
+                                                            beta,
+                                                            C,
+                                                            ldc,
+                                                            D,
+                                                            ldd,
+                                                            batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmBatchedEx((cublasHandle_t)handle,
+                            hipOperationToCudaOperation(transa),
+                            hipOperationToCudaOperation(transb),
+                            m,
+                            n,
+                            k,
+                            alpha,
+                            A,
+                            HIPDatatypeToCudaDatatype(a_type),
+                            lda,
+                            B,
+                            HIPDatatypeToCudaDatatype(b_type),
+                            ldb,
+                            beta,
+                            D,
+                            HIPDatatypeToCudaDatatype(d_type),
+                            ldd,
+                            batch_count,
+                            HIPDatatypeToCudaDatatype(compute_type),
+                            HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExD(hipblasHandle_t    handle,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             hipblasStride      stride_A,
+                                             const void*        B,
+                                             hipblasDatatype_t  b_type,
+                                             int                ldb,
+                                             hipblasStride      stride_B,
+                                             const void*        beta,
+                                             const void*        C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasStride      stride_C,
+                                             void*              D,
+                                             hipblasDatatype_t  d_type,
+                                             int                ldd,
+                                             hipblasStride      stride_D,
+                                             int                batch_count,
+                                             hipblasDatatype_t  compute_type,
+                                             hipblasGemmAlgo_t  algo)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    hipblas_log_gemm(handle,
+                     "hipblas_gemm_strided_batched_ex_d",
+                     a_type,
+                     b_type,
+                     d_type,
+                     compute_type,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     stride_A,
+                     B,
+                     ldb,
+                     stride_B,
+                     beta,
+                     D,
+                     ldd,
+                     stride_D,
+                     batch_count);
+    hipblas_managed_gemm(handle,
+                         a_type,
+                         b_type,
+                         d_type,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         A,
+                         lda,
+                         stride_A,
+                         B,
+                         ldb,
+                         stride_B,
+                         D,
+                         ldd,
+                         stride_D,
+                         batch_count,
+                         C,
+                         ldc,
+                         stride_C);
+
+    hipblasStatus_t status = hipblas_gemm_ex_d_copy(handle,
+                                                    c_type,
+                                                    d_type,
+                                                    compute_type,
+                                                    m,
+                                                    n,
+                                                    beta,
+                                                    C,
+                                                    ldc,
+                                                    stride_C,
+                                                    D,
+                                                    ldd,
+                                                    stride_D,
+                                                    batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipCUBLASStatusToHIPStatus(
+        cublasGemmStridedBatchedEx((cublasHandle_t)handle,
+                                   hipOperationToCudaOperation(transa),
+                                   hipOperationToCudaOperation(transb),
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   HIPDatatypeToCudaDatatype(a_type),
+                                   lda,
+                                   stride_A,
+                                   B,
+                                   HIPDatatypeToCudaDatatype(b_type),
+                                   ldb,
+                                   stride_B,
+                                   beta,
+                                   D,
+                                   HIPDatatypeToCudaDatatype(d_type),
+                                   ldd,
+                                   stride_D,
+                                   batch_count,
+                                   HIPDatatypeToCudaDatatype(compute_type),
+                                   HIPGemmAlgoToCudaGemmAlgo(algo)));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // trsm_ex
 hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasSideMode_t  side,
@@ -11826,6 +15157,9 @@ hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               int                invA_size,
                               hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11846,6 +15180,9 @@ hipblasStatus_t hipblasTrsmBatchedEx(hipblasHandle_t    handle,
                                      int                invA_size,
                                      hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11869,6 +15206,9 @@ hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
                                             hipblasStride      stride_invA,
                                             hipblasDatatype_t  compute_type)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -11956,6 +15296,12 @@ hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_axpy(
+            handle, n, alpha, alphaType, x, incx, y, yType, incy, executionType);
     return hipCUBLASStatusToHIPStatus(cublasAxpyEx((cublasHandle_t)handle,
                                                    n,
                                                    alpha,
@@ -11986,6 +15332,9 @@ hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                      int               batch_count,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12004,6 +15353,9 @@ hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
                                             int               batch_count,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12021,6 +15373,12 @@ hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_dot(
+            handle, n, x, incx, y, yType, incy, result, resultType, executionType, false);
     return hipCUBLASStatusToHIPStatus(cublasDotEx((cublasHandle_t)handle,
                                                   n,
                                                   x,
@@ -12051,6 +15409,12 @@ hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_dot(
+            handle, n, x, incx, y, yType, incy, result, resultType, executionType, true);
     return hipCUBLASStatusToHIPStatus(cublasDotcEx((cublasHandle_t)handle,
                                                    n,
                                                    x,
@@ -12081,6 +15445,9 @@ hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                     hipblasDatatype_t resultType,
                                     hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12097,6 +15464,9 @@ hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t resultType,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12115,6 +15485,9 @@ hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
                                            hipblasDatatype_t resultType,
                                            hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12133,6 +15506,9 @@ hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12147,6 +15523,11 @@ hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_nrm2(handle, n, x, incx, result, resultType, executionType);
     return hipCUBLASStatusToHIPStatus(cublasNrm2Ex((cublasHandle_t)handle,
                                                    n,
                                                    x,
@@ -12171,6 +15552,9 @@ hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                      hipblasDatatype_t resultType,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12185,6 +15569,9 @@ hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12203,6 +15590,9 @@ hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                              hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return hipCUBLASStatusToHIPStatus(cublasRotEx((cublasHandle_t)handle,
                                                   n,
                                                   x,
@@ -12235,6 +15625,9 @@ hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                     int               batch_count,
                                     hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12254,6 +15647,9 @@ hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
                                            int               batch_count,
                                            hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12268,6 +15664,11 @@ hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                               hipblasDatatype_t executionType)
 try
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
+    if(xType == HIPBLAS_C_16F)
+        return hipblas_half_complex_scal(handle, n, alpha, alphaType, x, incx, executionType);
     return hipCUBLASStatusToHIPStatus(cublasScalEx((cublasHandle_t)handle,
                                                    n,
                                                    alpha,
@@ -12292,6 +15693,9 @@ hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                      int               batch_count,
                                      hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
@@ -12306,6 +15710,9 @@ hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
                                             int               batch_count,
                                             hipblasDatatype_t executionType)
 {
+    HIPBLAS_RANGE_MARKER();
+    HIPBLAS_THREAD_STREAM(handle);
+    HIPBLAS_DEFERRED_FLUSH(handle);
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
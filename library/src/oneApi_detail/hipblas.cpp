@@ -6,6 +6,8 @@
 #include <hip/hip_interop.h>
 #include <hipblas.h>
 #include <exceptions.hpp>
+#include <logging.hpp>
+#include <memory_type.hpp>
 //#include <math.h>
 
 #include "sycl_w.h"
@@ -26,6 +28,7 @@ static hipblasStatus_t updateSyclHandlesToCrrStream(hipStream_t stream, syclblas
 hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // create syclBlas
     syclblas_create((syclblasHandle_t*)handle);
 
@@ -42,6 +45,7 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return syclblas_destroy((syclblasHandle_t)handle);
 }
 catch(...)
@@ -52,6 +56,7 @@ catch(...)
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t stream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return updateSyclHandlesToCrrStream(stream, (syclblasHandle_t)handle);
 }
 catch(...)
@@ -62,6 +67,7 @@ catch(...)
 hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* pStream)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     if(handle == nullptr)
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
@@ -77,6 +83,7 @@ catch(...)
 hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     *atomics_mode = HIPBLAS_ATOMICS_ALLOWED;
     return HIPBLAS_STATUS_SUCCESS;
  }
@@ -88,6 +95,7 @@ catch(...)
 hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // No op
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -96,9 +104,2852 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasSetDeferredMode(hipblasHandle_t handle, hipblasDeferredMode_t mode)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // Calls are always issued immediately
+    return mode == HIPBLAS_DEFERRED_MODE_DISABLED ? HIPBLAS_STATUS_SUCCESS
+                                                  : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetDeferredMode(hipblasHandle_t handle, hipblasDeferredMode_t* mode)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *mode = HIPBLAS_DEFERRED_MODE_DISABLED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasFlush(hipblasHandle_t handle)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // No op
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasHandlePoolReserve(hipblasHandlePool_t pool, int count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasWarmup(hipblasHandle_t handle, const hipblasGemmShape_t* shapes, int shapeCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetThreadStream(hipblasHandle_t handle, hipStream_t stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasClearThreadStream(hipblasHandle_t handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetManagedMemoryPolicy(hipblasHandle_t              handle,
+                                              hipblasManagedMemoryPolicy_t policy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(policy != HIPBLAS_MANAGED_MEMORY_POLICY_NONE
+       && policy != HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH
+       && policy != HIPBLAS_MANAGED_MEMORY_POLICY_PREFETCH_ADVISE)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    // No hints are given
+    return policy == HIPBLAS_MANAGED_MEMORY_POLICY_NONE ? HIPBLAS_STATUS_SUCCESS
+                                                        : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetManagedMemoryPolicy(hipblasHandle_t               handle,
+                                              hipblasManagedMemoryPolicy_t* policy)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!policy)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *policy = HIPBLAS_MANAGED_MEMORY_POLICY_NONE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetSymmetricOutput(hipblasHandle_t handle, hipblasSymmetricOutput_t output)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(output != HIPBLAS_SYMMETRIC_OUTPUT_NONE && output != HIPBLAS_SYMMETRIC_OUTPUT_UPPER
+       && output != HIPBLAS_SYMMETRIC_OUTPUT_LOWER && output != HIPBLAS_SYMMETRIC_OUTPUT_FULL)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // GEMM outputs are always computed in full
+    return output == HIPBLAS_SYMMETRIC_OUTPUT_NONE ? HIPBLAS_STATUS_SUCCESS
+                                                   : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetSymmetricOutput(hipblasHandle_t handle, hipblasSymmetricOutput_t* output)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!output)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *output = HIPBLAS_SYMMETRIC_OUTPUT_NONE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetFloat32Mode(hipblasHandle_t handle, hipblasFloat32Mode_t mode)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(mode != HIPBLAS_FLOAT32_MODE_DEFAULT && mode != HIPBLAS_FLOAT32_MODE_FAST
+       && mode != HIPBLAS_FLOAT32_MODE_FAST_TF32 && mode != HIPBLAS_FLOAT32_MODE_FAST_16BX3)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    // f32 GEMMs always run in full precision
+    return mode == HIPBLAS_FLOAT32_MODE_DEFAULT ? HIPBLAS_STATUS_SUCCESS
+                                                : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetFloat32Mode(hipblasHandle_t handle, hipblasFloat32Mode_t* mode)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!mode)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *mode = HIPBLAS_FLOAT32_MODE_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGraphBegin(hipblasHandle_t handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGraphEnd(hipblasHandle_t handle, hipblasGraph_t* graph)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGraphLaunch(hipblasGraph_t graph, hipStream_t stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGraphDestroy(hipblasGraph_t graph)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowHgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const hipblasHalf* alpha,
+                                const hipblasHalf* A,
+                                int                lda,
+                                const hipblasHalf* B,
+                                int                ldb,
+                                const hipblasHalf* beta,
+                                hipblasHalf*       C,
+                                int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       B,
+                                int                ldb,
+                                const float*       beta,
+                                float*             C,
+                                int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemm(hipblasHandle_t    handle,
+                                hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      B,
+                                int                ldb,
+                                const double*      beta,
+                                double*            C,
+                                int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemm(hipblasHandle_t       handle,
+                                hipblasOperation_t    transA,
+                                hipblasOperation_t    transB,
+                                int                   m,
+                                int                   n,
+                                int                   k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* B,
+                                int                   ldb,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemm(hipblasHandle_t             handle,
+                                hipblasOperation_t          transA,
+                                hipblasOperation_t          transB,
+                                int                         m,
+                                int                         n,
+                                int                         k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* B,
+                                int                         ldb,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowHgemmBatched(hipblasHandle_t          handle,
+                                       hipblasOperation_t       transA,
+                                       hipblasOperation_t       transB,
+                                       int                      m,
+                                       int                      n,
+                                       int                      k,
+                                       const hipblasHalf*       alpha,
+                                       const hipblasHalf* const A[],
+                                       int                      lda,
+                                       const hipblasHalf* const B[],
+                                       int                      ldb,
+                                       const hipblasHalf*       beta,
+                                       hipblasHalf* const       C[],
+                                       int                      ldc,
+                                       int                      batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemmBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t transA,
+                                       hipblasOperation_t transB,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const B[],
+                                       int                ldb,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemmBatched(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transA,
+                                       hipblasOperation_t  transB,
+                                       int                 m,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const B[],
+                                       int                 ldb,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemmBatched(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transA,
+                                       hipblasOperation_t          transB,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const B[],
+                                       int                         ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemmBatched(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transA,
+                                       hipblasOperation_t                transB,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int                               ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowHgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const hipblasHalf* alpha,
+                                              const hipblasHalf* A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const hipblasHalf* B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const hipblasHalf* beta,
+                                              hipblasHalf*       C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const float*       B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const double*      B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              long long          strideC,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemmStridedBatched(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              long long             strideA,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              long long             strideB,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              long long             strideC,
+                                              int                   batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemmStridedBatched(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              hipblasOperation_t          transB,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              long long                   strideA,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              long long                   strideB,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              long long                   strideC,
+                                              int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowGemmEx(hipblasHandle_t    handle,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const void*        alpha,
+                                 const void*        A,
+                                 hipblasDatatype_t  aType,
+                                 int                lda,
+                                 const void*        B,
+                                 hipblasDatatype_t  bType,
+                                 int                ldb,
+                                 const void*        beta,
+                                 void*              C,
+                                 hipblasDatatype_t  cType,
+                                 int                ldc,
+                                 hipblasDatatype_t  computeType,
+                                 hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowGemmBatchedEx(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  aType,
+                                        int                lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  bType,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  cType,
+                                        int                ldc,
+                                        int                batchCount,
+                                        hipblasDatatype_t  computeType,
+                                        hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  aType,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               const void*        B,
+                                               hipblasDatatype_t  bType,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  cType,
+                                               int                ldc,
+                                               hipblasStride      strideC,
+                                               int                batchCount,
+                                               hipblasDatatype_t  computeType,
+                                               hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       x,
+                                int                incx,
+                                const float*       beta,
+                                float*             y,
+                                int                incy)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemv(hipblasHandle_t    handle,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      x,
+                                int                incx,
+                                const double*      beta,
+                                double*            y,
+                                int                incy)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemv(hipblasHandle_t       handle,
+                                hipblasOperation_t    trans,
+                                int                   m,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       y,
+                                int                   incy)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemv(hipblasHandle_t             handle,
+                                hipblasOperation_t          trans,
+                                int                         m,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       y,
+                                int                         incy)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemvBatched(hipblasHandle_t    handle,
+                                       hipblasOperation_t trans,
+                                       int                m,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const x[],
+                                       int                incx,
+                                       const float*       beta,
+                                       float* const       y[],
+                                       int                incy,
+                                       int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemvBatched(hipblasHandle_t     handle,
+                                       hipblasOperation_t  trans,
+                                       int                 m,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const x[],
+                                       int                 incx,
+                                       const double*       beta,
+                                       double* const       y[],
+                                       int                 incy,
+                                       int                 batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemvBatched(hipblasHandle_t             handle,
+                                       hipblasOperation_t          trans,
+                                       int                         m,
+                                       int                         n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       y[],
+                                       int                         incy,
+                                       int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemvBatched(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                trans,
+                                       int                               m,
+                                       int                               n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       y[],
+                                       int                               incy,
+                                       int                               batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSgemvStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int                m,
+                                              int                n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const float*       x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const float*       beta,
+                                              float*             y,
+                                              int                incy,
+                                              hipblasStride      stridey,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDgemvStridedBatched(hipblasHandle_t    handle,
+                                              hipblasOperation_t transA,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const double*      x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const double*      beta,
+                                              double*            y,
+                                              int                incy,
+                                              hipblasStride      stridey,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCgemvStridedBatched(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              int                   m,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       y,
+                                              int                   incy,
+                                              hipblasStride         stridey,
+                                              int                   batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZgemvStridedBatched(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transA,
+                                              int                         m,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       y,
+                                              int                         incy,
+                                              hipblasStride               stridey,
+                                              int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowStrsm(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const float*       alpha,
+                                float*             A,
+                                int                lda,
+                                float*             B,
+                                int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDtrsm(hipblasHandle_t    handle,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const double*      alpha,
+                                double*            A,
+                                int                lda,
+                                double*            B,
+                                int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCtrsm(hipblasHandle_t       handle,
+                                hipblasSideMode_t     side,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                hipblasDiagType_t     diag,
+                                int                   m,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                hipblasComplex*       A,
+                                int                   lda,
+                                hipblasComplex*       B,
+                                int                   ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZtrsm(hipblasHandle_t             handle,
+                                hipblasSideMode_t           side,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                hipblasDiagType_t           diag,
+                                int                         m,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       A,
+                                int                         lda,
+                                hipblasDoubleComplex*       B,
+                                int                         ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowStrsmBatched(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int                m,
+                                       int                n,
+                                       const float*       alpha,
+                                       float* const       A[],
+                                       int                lda,
+                                       float*             B[],
+                                       int                ldb,
+                                       int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDtrsmBatched(hipblasHandle_t    handle,
+                                       hipblasSideMode_t  side,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       hipblasDiagType_t  diag,
+                                       int                m,
+                                       int                n,
+                                       const double*      alpha,
+                                       double* const      A[],
+                                       int                lda,
+                                       double*            B[],
+                                       int                ldb,
+                                       int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCtrsmBatched(hipblasHandle_t       handle,
+                                       hipblasSideMode_t     side,
+                                       hipblasFillMode_t     uplo,
+                                       hipblasOperation_t    transA,
+                                       hipblasDiagType_t     diag,
+                                       int                   m,
+                                       int                   n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const A[],
+                                       int                   lda,
+                                       hipblasComplex*       B[],
+                                       int                   ldb,
+                                       int                   batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZtrsmBatched(hipblasHandle_t             handle,
+                                       hipblasSideMode_t           side,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       hipblasDiagType_t           diag,
+                                       int                         m,
+                                       int                         n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const A[],
+                                       int                         lda,
+                                       hipblasDoubleComplex*       B[],
+                                       int                         ldb,
+                                       int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowStrsmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const float*       alpha,
+                                              float*             A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              float*             B,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDtrsmStridedBatched(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              double*            A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              double*            B,
+                                              int                ldb,
+                                              hipblasStride      strideB,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCtrsmStridedBatched(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int                   m,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              hipblasComplex*       B,
+                                              int                   ldb,
+                                              hipblasStride         strideB,
+                                              int                   batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZtrsmStridedBatched(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int                         m,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              hipblasDoubleComplex*       B,
+                                              int                         ldb,
+                                              hipblasStride               strideB,
+                                              int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowTrsmEx(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const void*        alpha,
+                                 void*              A,
+                                 int                lda,
+                                 void*              B,
+                                 int                ldb,
+                                 const void*        invA,
+                                 int                invAsize,
+                                 hipblasDatatype_t  computeType)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowTrsmBatchedEx(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t transA,
+                                        hipblasDiagType_t  diag,
+                                        int                m,
+                                        int                n,
+                                        const void*        alpha,
+                                        void*              A,
+                                        int                lda,
+                                        void*              B,
+                                        int                ldb,
+                                        int                batchCount,
+                                        const void*        invA,
+                                        int                invAsize,
+                                        hipblasDatatype_t  computeType)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                               hipblasSideMode_t  side,
+                                               hipblasFillMode_t  uplo,
+                                               hipblasOperation_t transA,
+                                               hipblasDiagType_t  diag,
+                                               int                m,
+                                               int                n,
+                                               const void*        alpha,
+                                               void*              A,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               void*              B,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               int                batchCount,
+                                               const void*        invA,
+                                               int                invAsize,
+                                               hipblasStride      strideInvA,
+                                               hipblasDatatype_t  computeType)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSsyrk(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int                n,
+                                int                k,
+                                const float*       alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       beta,
+                                float*             C,
+                                int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDsyrk(hipblasHandle_t    handle,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t transA,
+                                int                n,
+                                int                k,
+                                const double*      alpha,
+                                const double*      A,
+                                int                lda,
+                                const double*      beta,
+                                double*            C,
+                                int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCsyrk(hipblasHandle_t       handle,
+                                hipblasFillMode_t     uplo,
+                                hipblasOperation_t    transA,
+                                int                   n,
+                                int                   k,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* A,
+                                int                   lda,
+                                const hipblasComplex* beta,
+                                hipblasComplex*       C,
+                                int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZsyrk(hipblasHandle_t             handle,
+                                hipblasFillMode_t           uplo,
+                                hipblasOperation_t          transA,
+                                int                         n,
+                                int                         k,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* A,
+                                int                         lda,
+                                const hipblasDoubleComplex* beta,
+                                hipblasDoubleComplex*       C,
+                                int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSsyrkBatched(hipblasHandle_t    handle,
+                                       hipblasFillMode_t  uplo,
+                                       hipblasOperation_t transA,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDsyrkBatched(hipblasHandle_t     handle,
+                                       hipblasFillMode_t   uplo,
+                                       hipblasOperation_t  transA,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCsyrkBatched(hipblasHandle_t             handle,
+                                       hipblasFillMode_t           uplo,
+                                       hipblasOperation_t          transA,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZsyrkBatched(hipblasHandle_t                   handle,
+                                       hipblasFillMode_t                 uplo,
+                                       hipblasOperation_t                transA,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowSsyrkStridedBatched(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              hipblasStride      strideC,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowDsyrkStridedBatched(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      strideA,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              hipblasStride      strideC,
+                                              int                batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowCsyrkStridedBatched(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         strideA,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              hipblasStride         strideC,
+                                              int                   batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasRowZsyrkStridedBatched(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               strideA,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              hipblasStride               strideC,
+                                              int                         batchCount)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmt(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const float*       alpha,
+                              const float*       A,
+                              int                lda,
+                              const float*       B,
+                              int                ldb,
+                              const float*       beta,
+                              float*             C,
+                              int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmt(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmt(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              hipblasOperation_t    transa,
+                              hipblasOperation_t    transb,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              const hipblasComplex* B,
+                              int                   ldb,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       C,
+                              int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmt(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              hipblasOperation_t          transa,
+                              hipblasOperation_t          transb,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              const hipblasDoubleComplex* B,
+                              int                         ldb,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       C,
+                              int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmtBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                n,
+                                     int                k,
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     int                lda,
+                                     const float* const B[],
+                                     int                ldb,
+                                     const float*       beta,
+                                     float* const       C[],
+                                     int                ldc,
+                                     int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmtBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     hipblasOperation_t  transa,
+                                     hipblasOperation_t  transb,
+                                     int                 n,
+                                     int                 k,
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     int                 lda,
+                                     const double* const B[],
+                                     int                 ldb,
+                                     const double*       beta,
+                                     double* const       C[],
+                                     int                 ldc,
+                                     int                 batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmtBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transa,
+                                     hipblasOperation_t          transb,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     const hipblasComplex* const B[],
+                                     int                         ldb,
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       C[],
+                                     int                         ldc,
+                                     int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmtBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     hipblasOperation_t                transa,
+                                     hipblasOperation_t                transb,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     const hipblasDoubleComplex* const B[],
+                                     int                               ldb,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       C[],
+                                     int                               ldc,
+                                     int                               batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmtStridedBatched(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            hipblasStride      stride_a,
+                                            const float*       B,
+                                            int                ldb,
+                                            hipblasStride      stride_b,
+                                            const float*       beta,
+                                            float*             C,
+                                            int                ldc,
+                                            hipblasStride      stride_c,
+                                            int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmtStridedBatched(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            hipblasStride      stride_a,
+                                            const double*      B,
+                                            int                ldb,
+                                            hipblasStride      stride_b,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc,
+                                            hipblasStride      stride_c,
+                                            int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmtStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transa,
+                                            hipblasOperation_t    transb,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         stride_a,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            hipblasStride         stride_b,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc,
+                                            hipblasStride         stride_c,
+                                            int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmtStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               stride_a,
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
+                                            hipblasStride               stride_b,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc,
+                                            hipblasStride               stride_c,
+                                            int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgepackCompact(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const float*    A,
+                                      int             lda,
+                                      hipblasStride   stride_a,
+                                      float*          Ac,
+                                      int             ldac,
+                                      int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgepackCompact(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const double*   A,
+                                      int             lda,
+                                      hipblasStride   stride_a,
+                                      double*         Ac,
+                                      int             ldac,
+                                      int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgepackCompact(hipblasHandle_t       handle,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      hipblasStride         stride_a,
+                                      hipblasComplex*       Ac,
+                                      int                   ldac,
+                                      int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgepackCompact(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      hipblasStride               stride_a,
+                                      hipblasDoubleComplex*       Ac,
+                                      int                         ldac,
+                                      int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgeunpackCompact(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const float*    Ac,
+                                        int             ldac,
+                                        float*          A,
+                                        int             lda,
+                                        hipblasStride   stride_a,
+                                        int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgeunpackCompact(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        const double*   Ac,
+                                        int             ldac,
+                                        double*         A,
+                                        int             lda,
+                                        hipblasStride   stride_a,
+                                        int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgeunpackCompact(hipblasHandle_t       handle,
+                                        int                   m,
+                                        int                   n,
+                                        const hipblasComplex* Ac,
+                                        int                   ldac,
+                                        hipblasComplex*       A,
+                                        int                   lda,
+                                        hipblasStride         stride_a,
+                                        int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgeunpackCompact(hipblasHandle_t             handle,
+                                        int                         m,
+                                        int                         n,
+                                        const hipblasDoubleComplex* Ac,
+                                        int                         ldac,
+                                        hipblasDoubleComplex*       A,
+                                        int                         lda,
+                                        hipblasStride               stride_a,
+                                        int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmBatchedVec(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const float*       alpha,
+                                       const float* const A[],
+                                       int                lda,
+                                       const float* const B[],
+                                       int                ldb,
+                                       const float*       beta,
+                                       float* const       C[],
+                                       int                ldc,
+                                       int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmBatchedVec(hipblasHandle_t     handle,
+                                       hipblasOperation_t  transa,
+                                       hipblasOperation_t  transb,
+                                       int                 m,
+                                       int                 n,
+                                       int                 k,
+                                       const double*       alpha,
+                                       const double* const A[],
+                                       int                 lda,
+                                       const double* const B[],
+                                       int                 ldb,
+                                       const double*       beta,
+                                       double* const       C[],
+                                       int                 ldc,
+                                       int                 batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmBatchedVec(hipblasHandle_t             handle,
+                                       hipblasOperation_t          transa,
+                                       hipblasOperation_t          transb,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const A[],
+                                       int                         lda,
+                                       const hipblasComplex* const B[],
+                                       int                         ldb,
+                                       const hipblasComplex*       beta,
+                                       hipblasComplex* const       C[],
+                                       int                         ldc,
+                                       int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmBatchedVec(hipblasHandle_t                   handle,
+                                       hipblasOperation_t                transa,
+                                       hipblasOperation_t                transb,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const A[],
+                                       int                               lda,
+                                       const hipblasDoubleComplex* const B[],
+                                       int                               ldb,
+                                       const hipblasDoubleComplex*       beta,
+                                       hipblasDoubleComplex* const       C[],
+                                       int                               ldc,
+                                       int                               batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int                lda,
+                                              hipblasStride      stride_a,
+                                              const float*       B,
+                                              int                ldb,
+                                              hipblasStride      stride_b,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              hipblasStride      stride_c,
+                                              int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmStridedBatchedVec(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              hipblasStride      stride_a,
+                                              const double*      B,
+                                              int                ldb,
+                                              hipblasStride      stride_b,
+                                              const double*      beta,
+                                              double*            C,
+                                              int                ldc,
+                                              hipblasStride      stride_c,
+                                              int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchedVec(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              hipblasStride         stride_a,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              hipblasStride         stride_b,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc,
+                                              hipblasStride         stride_c,
+                                              int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchedVec(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              hipblasStride               stride_a,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              hipblasStride               stride_b,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc,
+                                              hipblasStride               stride_c,
+                                              int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyBatchedVec(hipblasHandle_t    handle,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int                incx,
+                                       float* const       y[],
+                                       int                incy,
+                                       int                batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDaxpyBatchedVec(hipblasHandle_t     handle,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int                 incx,
+                                       double* const       y[],
+                                       int                 incy,
+                                       int                 batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCaxpyBatchedVec(hipblasHandle_t             handle,
+                                       int                         n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       hipblasComplex* const       y[],
+                                       int                         incy,
+                                       int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZaxpyBatchedVec(hipblasHandle_t                   handle,
+                                       int                               n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int                               incy,
+                                       int                               batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDaxpyStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCaxpyStridedBatchedVec(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int                   incy,
+                                              hipblasStride         stridey,
+                                              int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZaxpyStridedBatchedVec(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int                         incy,
+                                              hipblasStride               stridey,
+                                              int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSscalBatchedVec(hipblasHandle_t handle,
+                                       int             n,
+                                       const float*    alpha,
+                                       float* const    x[],
+                                       int             incx,
+                                       int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDscalBatchedVec(hipblasHandle_t handle,
+                                       int             n,
+                                       const double*   alpha,
+                                       double* const   x[],
+                                       int             incx,
+                                       int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCscalBatchedVec(hipblasHandle_t       handle,
+                                       int                   n,
+                                       const hipblasComplex* alpha,
+                                       hipblasComplex* const x[],
+                                       int                   incx,
+                                       int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZscalBatchedVec(hipblasHandle_t             handle,
+                                       int                         n,
+                                       const hipblasDoubleComplex* alpha,
+                                       hipblasDoubleComplex* const x[],
+                                       int                         incx,
+                                       int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSscalStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              float*          x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDscalStridedBatchedVec(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              double*         x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              int             batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCscalStridedBatchedVec(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              hipblasComplex*       x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              int                   batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZscalStridedBatchedVec(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              hipblasDoubleComplex*       x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              int                         batch_count)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmBatchedExVec(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A[],
+                                        hipblasDatatype_t  a_type,
+                                        int                lda,
+                                        const void*        B[],
+                                        hipblasDatatype_t  b_type,
+                                        int                ldb,
+                                        const void*        beta,
+                                        void*              C[],
+                                        hipblasDatatype_t  c_type,
+                                        int                ldc,
+                                        int                batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExVec(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const void*        alpha,
+                                               const void*        A,
+                                               hipblasDatatype_t  a_type,
+                                               int                lda,
+                                               hipblasStride      stride_a,
+                                               const void*        B,
+                                               hipblasDatatype_t  b_type,
+                                               int                ldb,
+                                               hipblasStride      stride_b,
+                                               const void*        beta,
+                                               void*              C,
+                                               hipblasDatatype_t  c_type,
+                                               int                ldc,
+                                               hipblasStride      stride_c,
+                                               int                batch_count,
+                                               hipblasDatatype_t  compute_type,
+                                               hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmScaledEx(hipblasHandle_t    handle,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const void*        alpha,
+                                    const void*        A,
+                                    hipblasDatatype_t  a_type,
+                                    int                lda,
+                                    const void*        B,
+                                    hipblasDatatype_t  b_type,
+                                    int                ldb,
+                                    const void*        beta,
+                                    void*              C,
+                                    hipblasDatatype_t  c_type,
+                                    int                ldc,
+                                    const void*        row_scale,
+                                    const void*        col_scale,
+                                    hipblasDatatype_t  compute_type,
+                                    hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmExD(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const void*        alpha,
+                               const void*        A,
+                               hipblasDatatype_t  a_type,
+                               int                lda,
+                               const void*        B,
+                               hipblasDatatype_t  b_type,
+                               int                ldb,
+                               const void*        beta,
+                               const void*        C,
+                               hipblasDatatype_t  c_type,
+                               int                ldc,
+                               void*              D,
+                               hipblasDatatype_t  d_type,
+                               int                ldd,
+                               hipblasDatatype_t  compute_type,
+                               hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmBatchedExD(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const void*        A[],
+                                      hipblasDatatype_t  a_type,
+                                      int                lda,
+                                      const void*        B[],
+                                      hipblasDatatype_t  b_type,
+                                      int                ldb,
+                                      const void*        beta,
+                                      const void*        C[],
+                                      hipblasDatatype_t  c_type,
+                                      int                ldc,
+                                      void*              D[],
+                                      hipblasDatatype_t  d_type,
+                                      int                ldd,
+                                      int                batch_count,
+                                      hipblasDatatype_t  compute_type,
+                                      hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedExD(hipblasHandle_t    handle,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             hipblasStride      stride_A,
+                                             const void*        B,
+                                             hipblasDatatype_t  b_type,
+                                             int                ldb,
+                                             hipblasStride      stride_B,
+                                             const void*        beta,
+                                             const void*        C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasStride      stride_C,
+                                             void*              D,
+                                             hipblasDatatype_t  d_type,
+                                             int                ldd,
+                                             hipblasStride      stride_D,
+                                             int                batch_count,
+                                             hipblasDatatype_t  compute_type,
+                                             hipblasGemmAlgo_t  algo)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasMatmulPlanCreate(hipblasHandle_t         handle,
+                                        hipblasMatmulPlan_t*    plan,
+                                        hipblasOperation_t      transa,
+                                        hipblasOperation_t      transb,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        hipblasDatatype_t       a_type,
+                                        int                     lda,
+                                        hipblasDatatype_t       b_type,
+                                        int                     ldb,
+                                        hipblasDatatype_t       c_type,
+                                        int                     ldc,
+                                        hipblasDatatype_t       compute_type,
+                                        hipblasGemmAlgo_t       algo,
+                                        hipblasMatmulEpilogue_t epilogue)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasMatmulPlanExecute(hipblasHandle_t     handle,
+                                         hipblasMatmulPlan_t plan,
+                                         const void*         alpha,
+                                         const void*         A,
+                                         const void*         B,
+                                         const void*         beta,
+                                         void*               C,
+                                         const void*         bias)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasMatmulPlanGetWorkspaceSize(hipblasMatmulPlan_t plan, size_t* size)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasMatmulPlanDestroy(hipblasMatmulPlan_t plan)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       B,
+                                      int                ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgemmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      B,
+                                      int                ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmOutOfCore(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transa,
+                                      hipblasOperation_t    transb,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmOutOfCore(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transa,
+                                      hipblasOperation_t          transb,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSsyrkOutOfCore(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       beta,
+                                      float*             C,
+                                      int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDsyrkOutOfCore(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int                n,
+                                      int                k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      beta,
+                                      double*            C,
+                                      int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCsyrkOutOfCore(hipblasHandle_t       handle,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZsyrkOutOfCore(hipblasHandle_t             handle,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasStrsmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      float*             B,
+                                      int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDtrsmOutOfCore(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      double*            B,
+                                      int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCtrsmOutOfCore(hipblasHandle_t       handle,
+                                      hipblasSideMode_t     side,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      hipblasDiagType_t     diag,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      hipblasComplex*       B,
+                                      int                   ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZtrsmOutOfCore(hipblasHandle_t             handle,
+                                      hipblasSideMode_t           side,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      hipblasDiagType_t           diag,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      hipblasDoubleComplex*       B,
+                                      int                         ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtCreate(hipblasXtHandle_t* handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtDestroy(hipblasXtHandle_t handle)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtDeviceSelect(hipblasXtHandle_t handle,
+                                      int               nbDevices,
+                                      const int*        deviceId)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtSetBlockDim(hipblasXtHandle_t handle,
+                                     int               blockDim)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtGetBlockDim(hipblasXtHandle_t handle,
+                                     int*              blockDim)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtSetCpuRatio(hipblasXtHandle_t handle,
+                                     hipblasXtBlasOp_t blasOp,
+                                     hipblasXtOpType_t type,
+                                     float             ratio)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtSetCpuRoutine(hipblasXtHandle_t handle,
+                                       hipblasXtBlasOp_t blasOp,
+                                       hipblasXtOpType_t type,
+                                       void*             blasFunctor)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtSgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       B,
+                               int                ldb,
+                               const float*       beta,
+                               float*             C,
+                               int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtDgemm(hipblasXtHandle_t  handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      B,
+                               int                ldb,
+                               const double*      beta,
+                               double*            C,
+                               int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtCgemm(hipblasXtHandle_t     handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               int                   m,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* B,
+                               int                   ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtZgemm(hipblasXtHandle_t           handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               int                         m,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* B,
+                               int                         ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtSsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int                n,
+                               int                k,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               const float*       beta,
+                               float*             C,
+                               int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtDsyrk(hipblasXtHandle_t  handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int                n,
+                               int                k,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               const double*      beta,
+                               double*            C,
+                               int                ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtCsyrk(hipblasXtHandle_t     handle,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtZsyrk(hipblasXtHandle_t           handle,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtStrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const float*       alpha,
+                               const float*       A,
+                               int                lda,
+                               float*             B,
+                               int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtDtrsm(hipblasXtHandle_t  handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int                m,
+                               int                n,
+                               const double*      alpha,
+                               const double*      A,
+                               int                lda,
+                               double*            B,
+                               int                ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtCtrsm(hipblasXtHandle_t     handle,
+                               hipblasSideMode_t     side,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               hipblasDiagType_t     diag,
+                               int                   m,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               hipblasComplex*       B,
+                               int                   ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasXtZtrsm(hipblasXtHandle_t           handle,
+                               hipblasSideMode_t           side,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               hipblasDiagType_t           diag,
+                               int                         m,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               hipblasDoubleComplex*       B,
+                               int                         ldb)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetVectorBatchedAsync(int               n,
+                                             int               elemSize,
+                                             const void* const x[],
+                                             int               incx,
+                                             void* const       y[],
+                                             int               incy,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetVectorBatchedAsync(int               n,
+                                             int               elemSize,
+                                             const void* const x[],
+                                             int               incx,
+                                             void* const       y[],
+                                             int               incy,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetVectorStridedBatchedAsync(int           n,
+                                                    int           elemSize,
+                                                    const void*   x,
+                                                    int           incx,
+                                                    hipblasStride stridex,
+                                                    void*         y,
+                                                    int           incy,
+                                                    hipblasStride stridey,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetVectorStridedBatchedAsync(int           n,
+                                                    int           elemSize,
+                                                    const void*   x,
+                                                    int           incx,
+                                                    hipblasStride stridex,
+                                                    void*         y,
+                                                    int           incy,
+                                                    hipblasStride stridey,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetMatrixBatchedAsync(int               rows,
+                                             int               cols,
+                                             int               elemSize,
+                                             const void* const AP[],
+                                             int               lda,
+                                             void* const       BP[],
+                                             int               ldb,
+                                             int               batchCount,
+                                             hipStream_t       stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetMatrixStridedBatchedAsync(int           rows,
+                                                    int           cols,
+                                                    int           elemSize,
+                                                    const void*   AP,
+                                                    int           lda,
+                                                    hipblasStride strideA,
+                                                    void*         BP,
+                                                    int           ldb,
+                                                    hipblasStride strideB,
+                                                    int           batchCount,
+                                                    hipStream_t   stream)
+{
+    HIPBLAS_RANGE_MARKER();
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 hipblasStatus_t hipblasGetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t * int8Type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     *int8Type = HIPBLAS_INT8_DATATYPE_INT8;
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -110,6 +2961,7 @@ catch(...)
 hipblasStatus_t hipblasSetInt8Datatype(hipblasHandle_t handle, hipblasInt8Datatype_t int8Type)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // No op
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -164,6 +3016,7 @@ onemklDiag convert(hipblasDiagType_t val) {
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amax takes int64_t*
     int64_t *dev_results = (int64_t*)result;
@@ -195,6 +3048,7 @@ catch (...) {
 hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amax takes int64_t*
@@ -228,6 +3082,7 @@ catch(...)
 hipblasStatus_t hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amax takes int64_t*
@@ -260,6 +3115,7 @@ catch (...) {
 hipblasStatus_t hipblasIzamax(hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amax takes int64_t*
@@ -289,11 +3145,454 @@ catch (...) {
     return exception_to_hipblas_status();
 }
 
+// The device writes the result of the Async reductions, so it must be pinned
+// host memory or device memory
+bool isDeviceAccessible(const void* ptr)
+{
+    return hipblas_get_memory_type(ptr) != hipblas_memory_type::pageable;
+}
+
+hipblasStatus_t recordReductionEvent(hipblasHandle_t handle, hipEvent_t event)
+{
+    if(!event)
+        return HIPBLAS_STATUS_SUCCESS;
+    hipStream_t stream;
+    hipblasStatus_t status = syclblas_get_hipstream((syclblasHandle_t)handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipEventRecord(event, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+
+hipblasStatus_t hipblasSdotAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const float*    x,
+                                 int             incx,
+                                 const float*    y,
+                                 int             incy,
+                                 float*          result,
+                                 hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklSdot(sycl_queue, n, x, incx, y, incy, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotAsync(hipblasHandle_t handle,
+                                 int             n,
+                                 const double*   x,
+                                 int             incx,
+                                 const double*   y,
+                                 int             incy,
+                                 double*         result,
+                                 hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklDdot(sycl_queue, n, x, incx, y, incy, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotuAsync(hipblasHandle_t       handle,
+                                  int                   n,
+                                  const hipblasComplex* x,
+                                  int                   incx,
+                                  const hipblasComplex* y,
+                                  int                   incy,
+                                  hipblasComplex*       result,
+                                  hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklCdotu(sycl_queue,
+                n,
+                (const float _Complex*)x,
+                incx,
+                (const float _Complex*)y,
+                incy,
+                (float _Complex*)result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotcAsync(hipblasHandle_t       handle,
+                                  int                   n,
+                                  const hipblasComplex* x,
+                                  int                   incx,
+                                  const hipblasComplex* y,
+                                  int                   incy,
+                                  hipblasComplex*       result,
+                                  hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklCdotc(sycl_queue,
+                n,
+                (const float _Complex*)x,
+                incx,
+                (const float _Complex*)y,
+                incy,
+                (float _Complex*)result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotuAsync(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  const hipblasDoubleComplex* y,
+                                  int                         incy,
+                                  hipblasDoubleComplex*       result,
+                                  hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklZdotu(sycl_queue,
+                n,
+                (const double _Complex*)x,
+                incx,
+                (const double _Complex*)y,
+                incy,
+                (double _Complex*)result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotcAsync(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  const hipblasDoubleComplex* y,
+                                  int                         incy,
+                                  hipblasDoubleComplex*       result,
+                                  hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklZdotc(sycl_queue,
+                n,
+                (const double _Complex*)x,
+                incx,
+                (const double _Complex*)y,
+                incy,
+                (double _Complex*)result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSnrm2Async(hipblasHandle_t handle,
+                                  int             n,
+                                  const float*    x,
+                                  int             incx,
+                                  float*          result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklSnrm2(sycl_queue, n, x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnrm2Async(hipblasHandle_t handle,
+                                  int             n,
+                                  const double*   x,
+                                  int             incx,
+                                  double*         result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklDnrm2(sycl_queue, n, x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScnrm2Async(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   float*                result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklCnrm2(sycl_queue, n, (const float _Complex*)x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDznrm2Async(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   double*                     result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklZnrm2(sycl_queue, n, (const double _Complex*)x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSasumAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const float*    x,
+                                  int             incx,
+                                  float*          result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklSasum(sycl_queue, n, x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDasumAsync(hipblasHandle_t handle,
+                                  int             n,
+                                  const double*   x,
+                                  int             incx,
+                                  double*         result,
+                                  hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklDasum(sycl_queue, n, x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasScasumAsync(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   float*                result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklCasum(sycl_queue, n, (const float _Complex*)x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDzasumAsync(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   double*                     result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    if(!result || !isDeviceAccessible(result))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // Written in queue order, without waiting
+    auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
+    onemklZasum(sycl_queue, n, (const double _Complex*)x, incx, result);
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIsamaxAsync(hipblasHandle_t handle,
+                                   int             n,
+                                   const float*    x,
+                                   int             incx,
+                                   int*            result,
+                                   hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // oneMKL returns a 64-bit index, converted on the host after a wait
+    hipblasStatus_t status = hipblasIsamax(handle, n, x, incx, result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIdamaxAsync(hipblasHandle_t handle,
+                                   int             n,
+                                   const double*   x,
+                                   int             incx,
+                                   int*            result,
+                                   hipEvent_t      event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // oneMKL returns a 64-bit index, converted on the host after a wait
+    hipblasStatus_t status = hipblasIdamax(handle, n, x, incx, result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIcamaxAsync(hipblasHandle_t       handle,
+                                   int                   n,
+                                   const hipblasComplex* x,
+                                   int                   incx,
+                                   int*                  result,
+                                   hipEvent_t            event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // oneMKL returns a 64-bit index, converted on the host after a wait
+    hipblasStatus_t status = hipblasIcamax(handle, n, x, incx, result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasIzamaxAsync(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   int*                        result,
+                                   hipEvent_t                  event)
+try
+{
+    HIPBLAS_RANGE_MARKER();
+    // oneMKL returns a 64-bit index, converted on the host after a wait
+    hipblasStatus_t status = hipblasIzamax(handle, n, x, incx, result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return recordReductionEvent(handle, event);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // Level-1 : amin (supported datatypes : float, double, complex float, complex double)
 // Generic amin which can handle batched/stride/non-batched
 hipblasStatus_t hipblasIsamin(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amin takes int64_t*
@@ -327,6 +3626,7 @@ catch(...)
 hipblasStatus_t hipblasIdamin(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amin takes int64_t*
@@ -360,6 +3660,7 @@ catch(...)
 hipblasStatus_t hipblasIcamin(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amin takes int64_t*
@@ -394,6 +3695,7 @@ catch(...)
 hipblasStatus_t hipblasIzamin(hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // Warning: result is a int* where as amin takes int64_t*
@@ -430,6 +3732,7 @@ catch(...)
 hipblasStatus_t hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // 'result' can be device or host memory but oneMKL needs device memory
@@ -484,6 +3787,7 @@ catch(...)
 hipblasStatus_t hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // 'result' can be device or host memory but oneMKL needs device memory
@@ -511,6 +3815,7 @@ catch(...)
 hipblasStatus_t hipblasDzasum(hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     // 'result' can be device or host memory but oneMKL needs device memory
@@ -540,6 +3845,7 @@ hipblasStatus_t hipblasSaxpy(hipblasHandle_t handle, int n, const float* alpha,
                              const float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_result_dev_ptr = isDevicePointer(alpha);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // 'alpha' can be device or host memory hence need to be copied before access
@@ -564,6 +3870,7 @@ hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle, int n, const double* alpha,
                              const double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_result_dev_ptr = isDevicePointer(alpha);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // 'alpha' can be device or host memory hence need to be copied before access
@@ -589,6 +3896,7 @@ hipblasStatus_t hipblasCaxpy(hipblasHandle_t handle, int n, const hipblasComplex
                              const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_result_dev_ptr = isDevicePointer(alpha);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // 'alpha' can be device or host memory hence need to be copied before access
@@ -613,6 +3921,7 @@ hipblasStatus_t hipblasZaxpy(hipblasHandle_t handle, int n, const hipblasDoubleC
                              const hipblasDoubleComplex* x, int incx, hipblasDoubleComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_result_dev_ptr = isDevicePointer(alpha);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // 'alpha' can be device or host memory hence need to be copied before access
@@ -941,6 +4250,7 @@ catch(...)
 hipblasStatus_t hipblasSdot(hipblasHandle_t handle, int n, const float* x, int incx, const float* y, int incy, float* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -966,6 +4276,7 @@ catch(...)
 hipblasStatus_t hipblasDdot(hipblasHandle_t handle, int n, const double* x, int incx, const double* y, int incy, double* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -992,6 +4303,7 @@ hipblasStatus_t hipblasCdotc(hipblasHandle_t handle, int n, const hipblasComplex
                              int incx, const hipblasComplex* y, int incy, hipblasComplex* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1018,6 +4330,7 @@ hipblasStatus_t hipblasCdotu(hipblasHandle_t handle, int n, const hipblasComplex
                              int incx, const hipblasComplex* y, int incy, hipblasComplex* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1044,6 +4357,7 @@ hipblasStatus_t hipblasZdotc(hipblasHandle_t handle, int n, const hipblasDoubleC
                              int incx, const hipblasDoubleComplex* y, int incy, hipblasDoubleComplex* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1069,6 +4383,7 @@ hipblasStatus_t hipblasZdotu(hipblasHandle_t handle, int n, const hipblasDoubleC
                              int incx, const hipblasDoubleComplex* y, int incy, hipblasDoubleComplex* result)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_result_dev_ptr = isDevicePointer(result);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1095,6 +4410,7 @@ catch(...)
 hipblasStatus_t hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklSswap(sycl_queue, n, x, incx, y, incy);
     syclblas_queue_wait(sycl_queue);
@@ -1108,6 +4424,7 @@ catch(...)
 hipblasStatus_t hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDswap(sycl_queue, n, x, incx, y, incy);
     syclblas_queue_wait(sycl_queue);
@@ -1122,6 +4439,7 @@ hipblasStatus_t hipblasCswap(hipblasHandle_t handle, int n, hipblasComplex* x, i
                              hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCswap(sycl_queue, n, (float _Complex*)x, incx, (float _Complex*)y, incy);
     syclblas_queue_wait(sycl_queue);
@@ -1136,6 +4454,7 @@ hipblasStatus_t hipblasZswap(hipblasHandle_t handle, int n, hipblasDoubleComplex
                              hipblasDoubleComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZswap(sycl_queue, n, (double _Complex*)x, incx, (double _Complex*)y, incy);
     syclblas_queue_wait(sycl_queue);
@@ -1152,6 +4471,7 @@ hipblasStatus_t hipblasSrot(hipblasHandle_t handle,int n, float* x,int incx,
                                            float* y, int incy,const float* c, const float* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1181,6 +4501,7 @@ hipblasStatus_t hipblasDrot(hipblasHandle_t handle,int n, double* x,int incx,
                                            double* y, int incy,const double* c, const double* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1211,6 +4532,7 @@ hipblasStatus_t hipblasCrot(hipblasHandle_t handle,int n, hipblasComplex* x,int
                                            const hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1242,6 +4564,7 @@ hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,int n, hipblasComplex* x,int
                                            const float* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1272,6 +4595,7 @@ hipblasStatus_t hipblasZrot(hipblasHandle_t handle,int n, hipblasDoubleComplex*
                                            const hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1302,6 +4626,7 @@ hipblasStatus_t hipblasZdrot(hipblasHandle_t handle,int n, hipblasDoubleComplex*
                                            const double* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hip_status;
     bool is_c_dev_ptr = isDevicePointer(c);
     bool is_s_dev_ptr = isDevicePointer(s);
@@ -1331,6 +4656,7 @@ catch(...)
 hipblasStatus_t hipblasSrotg(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_a_dev_ptr = isDevicePointer(a);
     bool is_b_dev_ptr = isDevicePointer(b);
     bool is_c_dev_ptr = isDevicePointer(c);
@@ -1351,6 +4677,7 @@ catch(...)
 hipblasStatus_t hipblasDrotg(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_a_dev_ptr = isDevicePointer(a);
     bool is_b_dev_ptr = isDevicePointer(b);
     bool is_c_dev_ptr = isDevicePointer(c);
@@ -1371,6 +4698,7 @@ catch(...)
 hipblasStatus_t hipblasCrotg(hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_a_dev_ptr = isDevicePointer(a);
     bool is_b_dev_ptr = isDevicePointer(b);
     bool is_c_dev_ptr = isDevicePointer(c);
@@ -1392,6 +4720,7 @@ hipblasStatus_t hipblasZrotg(hipblasHandle_t handle, hipblasDoubleComplex* a,
                              hipblasDoubleComplex* b, double* c, hipblasDoubleComplex* s)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     bool is_a_dev_ptr = isDevicePointer(a);
     bool is_b_dev_ptr = isDevicePointer(b);
     bool is_c_dev_ptr = isDevicePointer(c);
@@ -1414,6 +4743,7 @@ catch(...)
 hipblasStatus_t hipblasSrotm(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hipStatus;
     bool is_param_dev_ptr = isDevicePointer(param);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1439,6 +4769,7 @@ catch(...)
 hipblasStatus_t hipblasDrotm(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     hipError_t hipStatus;
     bool is_param_dev_ptr = isDevicePointer(param);
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
@@ -1495,6 +4826,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1524,6 +4856,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1555,6 +4888,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1586,6 +4920,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1595,6 +4930,7 @@ hipblasStatus_t hipblasSgemv(hipblasHandle_t handle, hipblasOperation_t trans, i
                              const float* beta, float* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1624,6 +4960,7 @@ hipblasStatus_t hipblasDgemv(hipblasHandle_t handle, hipblasOperation_t trans, i
                              const double* beta, double* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1676,6 +5013,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1707,6 +5045,7 @@ try{
 }
 catch(...)
 {
+    HIPBLAS_RANGE_MARKER();
     return exception_to_hipblas_status();
 }
 
@@ -1716,6 +5055,7 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle, int m, int n, const float* a
                             float* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1738,6 +5078,7 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle, int m, int n, const double*
                             double* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1760,6 +5101,7 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t handle, int m, int n, const hipblas
                             hipblasComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1783,6 +5125,7 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t handle, int m, int n, const hipblas
                             hipblasComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1806,6 +5149,7 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t handle, int m, int n, const hipblas
                             hipblasDoubleComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1829,6 +5173,7 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t handle, int m, int n, const hipblas
                             hipblasDoubleComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1855,6 +5200,7 @@ hipblasStatus_t hipblasChbmv(hipblasHandle_t handle, hipblasFillMode_t uplo,
                              const hipblasComplex* beta, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1886,6 +5232,7 @@ hipblasStatus_t hipblasZhbmv(hipblasHandle_t handle, hipblasFillMode_t uplo,
                              const hipblasDoubleComplex* beta, hipblasDoubleComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1917,6 +5264,7 @@ hipblasStatus_t hipblasChemv(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             const hipblasComplex* beta, hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1947,6 +5295,7 @@ hipblasStatus_t hipblasZhemv(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             const hipblasDoubleComplex* beta, hipblasDoubleComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -1977,6 +5326,7 @@ hipblasStatus_t hipblasCher(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             hipblasComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -1999,6 +5349,7 @@ hipblasStatus_t hipblasZher(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             hipblasDoubleComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -2022,6 +5373,7 @@ hipblasStatus_t hipblasCher2(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             const hipblasComplex* y, int incy, hipblasComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -2045,6 +5397,7 @@ hipblasStatus_t hipblasZher2(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             const hipblasDoubleComplex* y, int incy, hipblasDoubleComplex* AP, int lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
 
@@ -2070,6 +5423,7 @@ hipblasStatus_t hipblasChpmv(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             hipblasComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -2100,6 +5454,7 @@ hipblasStatus_t hipblasZhpmv(hipblasHandle_t handle, hipblasFillMode_t uplo, int
                             hipblasDoubleComplex* y, int incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
     auto is_beta_dev_ptr = isDevicePointer(beta);
@@ -2134,6 +5489,7 @@ hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2161,6 +5517,7 @@ hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2190,6 +5547,7 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2207,6 +5565,7 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2227,6 +5586,7 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2246,6 +5606,7 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2265,6 +5626,7 @@ hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
                              hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2295,6 +5657,7 @@ hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
                              hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2327,6 +5690,7 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2346,6 +5710,7 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2369,6 +5734,7 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2391,6 +5757,7 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2413,6 +5780,7 @@ hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2451,6 +5819,7 @@ hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2491,6 +5860,7 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2513,6 +5883,7 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2539,6 +5910,7 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2564,6 +5936,7 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
 	return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2584,6 +5957,7 @@ hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2620,6 +5994,7 @@ hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2658,6 +6033,7 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2678,6 +6054,7 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2702,6 +6079,7 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2725,6 +6103,7 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2742,6 +6121,7 @@ hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
                             float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2769,6 +6149,7 @@ hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
                             double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -2796,6 +6177,7 @@ hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
                             hipblasComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2812,6 +6194,7 @@ hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
                             hipblasDoubleComplex*       AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2830,6 +6213,7 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2847,6 +6231,7 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2864,6 +6249,7 @@ hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2881,6 +6267,7 @@ hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2901,6 +6288,7 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2920,6 +6308,7 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2939,6 +6328,7 @@ hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2958,6 +6348,7 @@ hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -2977,6 +6368,7 @@ hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
                              float*            AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3006,6 +6398,7 @@ hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
                              double*           AP)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3037,6 +6430,7 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3056,6 +6450,7 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3079,6 +6474,7 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3101,6 +6497,7 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3122,6 +6519,7 @@ hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3159,6 +6557,7 @@ hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
                              int               incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3196,6 +6595,7 @@ hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
                              int                   incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3216,6 +6616,7 @@ hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
                              int                         incy)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3238,6 +6639,7 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3259,6 +6661,7 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3280,6 +6683,7 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3301,6 +6705,7 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3326,6 +6731,7 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3350,6 +6756,7 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3374,6 +6781,7 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3398,6 +6806,7 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3416,6 +6825,7 @@ hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3444,6 +6854,7 @@ hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
                             int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3472,6 +6883,7 @@ hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
                             int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3489,6 +6901,7 @@ hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
                             int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3508,6 +6921,7 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3526,6 +6940,7 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3544,6 +6959,7 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3562,6 +6978,7 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3583,6 +7000,7 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3603,6 +7021,7 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3623,6 +7042,7 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3643,6 +7063,7 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3663,6 +7084,7 @@ hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3693,6 +7115,7 @@ hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
                              int               lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     // As per spec alpha can be device/host memory. In case of device memory *alpha will crash
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     auto is_alpha_dev_ptr = isDevicePointer(alpha);
@@ -3723,6 +7146,7 @@ hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3742,6 +7166,7 @@ hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3763,6 +7188,7 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3783,6 +7209,7 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3803,6 +7230,7 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3823,6 +7251,7 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3847,6 +7276,7 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3870,6 +7300,7 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3893,6 +7324,7 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3916,6 +7348,7 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -3936,6 +7369,7 @@ hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStbmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, k, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -3957,6 +7391,7 @@ hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtbmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, k, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -3978,6 +7413,7 @@ hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtbmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, k, 
                             (const float _Complex*)A, lda, (float _Complex*)x, incx);
@@ -4000,6 +7436,7 @@ hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtbmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, k, 
                             (const double _Complex*)A, lda, (double _Complex*)x, incx);
@@ -4024,6 +7461,7 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4044,6 +7482,7 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4064,6 +7503,7 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4084,6 +7524,7 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4107,6 +7548,7 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4129,6 +7571,7 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4151,6 +7594,7 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4173,6 +7617,7 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4193,6 +7638,7 @@ hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStbsv(sycl_queue, convert(uplo), convert(transA), convert(diag), n, k, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4214,6 +7660,7 @@ hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtbsv(sycl_queue, convert(uplo), convert(transA), convert(diag), n, k, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4235,6 +7682,7 @@ hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtbsv(sycl_queue, convert(uplo), convert(transA), convert(diag), n, k, (const float _Complex*)A, lda, (float _Complex*)x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4256,6 +7704,7 @@ hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtbsv(sycl_queue, convert(uplo), convert(transA), convert(diag), n, k, (const double _Complex*)A, lda, (double _Complex*)x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4279,6 +7728,7 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4299,6 +7749,7 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4319,6 +7770,7 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4339,6 +7791,7 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4362,6 +7815,7 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4384,6 +7838,7 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4406,6 +7861,7 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4428,6 +7884,7 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4446,6 +7903,7 @@ hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStpmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, AP, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4465,6 +7923,7 @@ hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtpmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, AP, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4484,6 +7943,7 @@ hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtpmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, 
                 (const float _Complex*)AP, (float _Complex*)x, incx);
@@ -4504,6 +7964,7 @@ hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtpmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, 
                 (const double _Complex*)AP, (double _Complex*)x, incx);
@@ -4526,6 +7987,7 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4544,6 +8006,7 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4562,6 +8025,7 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4580,6 +8044,7 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4601,6 +8066,7 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4621,6 +8087,7 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4641,6 +8108,7 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4661,6 +8129,7 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4679,6 +8148,7 @@ hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStpsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, AP, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4698,6 +8168,7 @@ hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtpsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, AP, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4717,6 +8188,7 @@ hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtpsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const float _Complex*) AP, (float _Complex*)x, incx);
@@ -4737,6 +8209,7 @@ hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtpsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const double _Complex*) AP, (double _Complex*)x, incx);
@@ -4759,6 +8232,7 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4777,6 +8251,7 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4795,6 +8270,7 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4813,6 +8289,7 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4834,6 +8311,7 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4854,6 +8332,7 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4874,6 +8353,7 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4894,6 +8374,7 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -4913,6 +8394,7 @@ hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStrmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4933,6 +8415,7 @@ hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtrmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -4953,6 +8436,7 @@ hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtrmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const float _Complex*)A, lda, (float _Complex*)x, incx);
@@ -4974,6 +8458,7 @@ hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtrmv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const double _Complex*)A, lda, (double _Complex*)x, incx);
@@ -4997,6 +8482,7 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5016,6 +8502,7 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5035,6 +8522,7 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5054,6 +8542,7 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     int                               batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5076,6 +8565,7 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5097,6 +8587,7 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5118,6 +8609,7 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            int                   batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5139,6 +8631,7 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            int                         batchCount)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5158,6 +8651,7 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklStrsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -5178,6 +8672,7 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklDtrsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m, A, lda, x, incx);
     return HIPBLAS_STATUS_SUCCESS;
@@ -5198,6 +8693,7 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklCtrsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const float _Complex*)A, lda, (float _Complex*)x, incx);
@@ -5219,6 +8715,7 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     auto sycl_queue = syclblas_get_sycl_queue((syclblasHandle_t)handle);
     onemklZtrsv(sycl_queue, convert(uplo), convert(transA), convert(diag), m,
                 (const double _Complex*)A, lda, (double _Complex*)x, incx);
@@ -5242,6 +8739,7 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5261,6 +8759,7 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     int                 batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5280,6 +8779,7 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5299,6 +8799,7 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     int                               batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5321,6 +8822,7 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5342,6 +8844,7 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            int                batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5363,6 +8866,7 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            int                   batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)
@@ -5384,6 +8888,7 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            int                         batch_count)
 try
 {
+    HIPBLAS_RANGE_MARKER();
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 catch(...)